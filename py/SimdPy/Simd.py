@@ -121,6 +121,8 @@ class ImageFile(enum.Enum) :
     Png = 5
     ## A JPEG (Joint Photographic Experts Group) image file format.
     Jpeg = 6
+    ## A QOI (Quite OK Image) lossless image file format.
+    Qoi = 7
 
 ## @ingroup python
 # Describes pixel format type. It is used in Simd.Image.
@@ -335,19 +337,25 @@ class WarpAffineFlags(enum.Flag) :
     Default = 0 
 	## 8-bit integer channel type.
     ChannelByte = 0 
+	## 16-bit unsigned integer channel type.
+    ChannelShort = 8 
+	## 32-bit float channel type.
+    ChannelFloat = 16 
 	## Bit mask of channel type.
-    ChannelMask = 1 
+    ChannelMask = 24 
 	## Nearest pixel interpolation method.
     InterpNearest = 0
 	## Bilinear pixel interpolation method.
     InterpBilinear = 2 
+	## Bicubic pixel interpolation method.
+    InterpBicubic = 32 
 	## Bit mask of pixel interpolation options.
-    InterpMask = 2 
-	## Nearest pixel interpolation method.
+    InterpMask = 34 
+	## Constant border.
     BorderConstant = 0
-	## Bilinear pixel interpolation method.
+	## Transparent border.
     BorderTransparent = 4 
-	## Bit mask of pixel interpolation options.
+	## Bit mask of border type.
     BorderMask = 4 
 
 	
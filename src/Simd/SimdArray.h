@@ -33,29 +33,33 @@ namespace Simd
     {
         T * const data;
         size_t const size;
+        bool const shared;
 
         SIMD_INLINE Array(size_t size_ = 0, bool clear = false, size_t align = SIMD_ALIGN)
             : data(0)
             , size(0)
+            , shared(false)
         {
             Resize(size_, clear);
         }
 
         SIMD_INLINE ~Array()
         {
-            if (data)
+            if (data && !shared)
                 Simd::Free(data);
         }
 
         SIMD_INLINE void Resize(size_t size_, bool clear = false, size_t align = SIMD_ALIGN)
         {
-            if (size_ != size)
+            if (size_ != size || shared)
             {
                 if (data)
                 {
-                    Simd::Free(data);
+                    if (!shared)
+                        Simd::Free(data);
                     *(T**)&data = 0;
                 }
+                *(bool*)&shared = false;
                 *(size_t*)&size = size_;
                 if (size_)
                     *(T**)&data = (T*)Simd::Allocate(RawSize(), align);
@@ -80,6 +84,15 @@ namespace Simd
         {
             Simd::Swap((T*&)data, (T*&)(array.data));
             Simd::Swap((size_t&)size, (size_t&)(array.size));
+            Simd::Swap((bool&)shared, (bool&)(array.shared));
+        }
+
+        SIMD_INLINE void Share(T * data_, size_t size_)
+        {
+            Resize(0);
+            *(T**)&data = data_;
+            *(size_t*)&size = size_;
+            *(bool*)&shared = data_ != NULL;
         }
 
         SIMD_INLINE T & operator[] (size_t i)
@@ -104,7 +117,8 @@ namespace Simd
 
         SIMD_INLINE T * Release()
         {
-            uint8_t* released = data;
+            assert(!shared);
+            T* released = data;
             *(T**)&data = NULL;
             *(size_t*)&size = 0;
             return released;
@@ -122,9 +136,15 @@ namespace Simd
     typedef Array<uint8_t*> Array8up;
     typedef Array<const uint8_t*> Array8ucp;
 
+    typedef Array<int16_t*> Array16ip;
+    typedef Array<const int16_t*> Array16icp;
+
     typedef Array<uint16_t*> Array16up;
     typedef Array<const uint16_t*> Array16ucp;
 
+    typedef Array<float*> Array32fp;
+    typedef Array<const float*> Array32fcp;
+
 #if defined(__GNUC__) && __GNUC__ >= 6
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wignored-attributes"
@@ -0,0 +1,166 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdBoxFilter.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE void BoxFilterColUpdate8u(__m256i add, __m256i sub, uint32_t* sum, uint32_t* sqsum)
+        {
+            _mm256_storeu_si256((__m256i*)sum, _mm256_add_epi32(_mm256_loadu_si256((__m256i*)sum), _mm256_sub_epi32(add, sub)));
+            if (sqsum)
+            {
+                __m256i sq = _mm256_sub_epi32(_mm256_madd_epi16(add, add), _mm256_madd_epi16(sub, sub));
+                _mm256_storeu_si256((__m256i*)sqsum, _mm256_add_epi32(_mm256_loadu_si256((__m256i*)sqsum), sq));
+            }
+        }
+
+        void BoxFilterColUpdate8u(const uint8_t* add, const uint8_t* sub, size_t size, uint32_t* sum, uint32_t* sqsum)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+            {
+                __m256i _add = _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(add + i)));
+                __m256i _sub = sub ? _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(sub + i))) : K_ZERO;
+                BoxFilterColUpdate8u(_add, _sub, sum + i, sqsum ? sqsum + i : NULL);
+            }
+            for (; i < size; ++i)
+            {
+                int a = add[i], s = sub ? sub[i] : 0;
+                sum[i] += a - s;
+                if (sqsum)
+                    sqsum[i] += a * a - s * s;
+            }
+        }
+
+        SIMD_INLINE void BoxFilterColUpdate32f(__m256d add, __m256d sub, double* sum, double* sqsum)
+        {
+            _mm256_storeu_pd(sum, _mm256_add_pd(_mm256_loadu_pd(sum), _mm256_sub_pd(add, sub)));
+            if (sqsum)
+                _mm256_storeu_pd(sqsum, _mm256_add_pd(_mm256_loadu_pd(sqsum), _mm256_sub_pd(_mm256_mul_pd(add, add), _mm256_mul_pd(sub, sub))));
+        }
+
+        static void BoxFilterColUpdate32f(const float* add, const float* sub, size_t size, double* sum, double* sqsum)
+        {
+            const size_t DF = F / 2;
+            size_t sizeDF = AlignLo(size, DF), i = 0;
+            for (; i < sizeDF; i += DF)
+            {
+                __m256d _add = _mm256_cvtps_pd(_mm_loadu_ps(add + i));
+                __m256d _sub = sub ? _mm256_cvtps_pd(_mm_loadu_ps(sub + i)) : _mm256_setzero_pd();
+                BoxFilterColUpdate32f(_add, _sub, sum + i, sqsum ? sqsum + i : NULL);
+            }
+            for (; i < size; ++i)
+            {
+                double a = add[i], s = sub ? sub[i] : 0.0;
+                sum[i] += a - s;
+                if (sqsum)
+                    sqsum[i] += a * a - s * s;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void BoxFilterRow8u(const uint32_t* sum, const uint32_t* sqsum, size_t step, __m256 norm, uint8_t* mean, float* var)
+        {
+            __m256i s = _mm256_sub_epi32(_mm256_loadu_si256((__m256i*)(sum + step)), _mm256_loadu_si256((__m256i*)sum));
+            __m256 m = _mm256_mul_ps(_mm256_cvtepi32_ps(s), norm);
+            if (var)
+            {
+                __m256i q = _mm256_sub_epi32(_mm256_loadu_si256((__m256i*)(sqsum + step)), _mm256_loadu_si256((__m256i*)sqsum));
+                _mm256_storeu_ps(var, _mm256_max_ps(_mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(q), norm), _mm256_mul_ps(m, m)), _mm256_setzero_ps()));
+            }
+            __m256i i32 = _mm256_cvttps_epi32(_mm256_add_ps(m, _mm256_set1_ps(0.5f)));
+            __m256i u8 = PackI16ToU8(PackI32ToI16(i32, K_ZERO), K_ZERO);
+            _mm_storel_epi64((__m128i*)mean, _mm256_castsi256_si128(u8));
+        }
+
+        static void BoxFilterRow8u(const uint32_t* sum, const uint32_t* sqsum, size_t size, size_t step, float norm, uint8_t* mean, float* var)
+        {
+            __m256 _norm = _mm256_set1_ps(norm);
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                BoxFilterRow8u(sum + i, sqsum ? sqsum + i : NULL, step, _norm, mean + i, var ? var + i : NULL);
+            if (sizeF < size)
+            {
+                size_t i = size - F;
+                BoxFilterRow8u(sum + i, sqsum ? sqsum + i : NULL, step, _norm, mean + i, var ? var + i : NULL);
+            }
+        }
+
+        SIMD_INLINE void BoxFilterRow32f(const double* sum, const double* sqsum, size_t step, __m256d norm, float* mean, float* var)
+        {
+            __m256d m = _mm256_mul_pd(_mm256_sub_pd(_mm256_loadu_pd(sum + step), _mm256_loadu_pd(sum)), norm);
+            if (var)
+            {
+                __m256d v = _mm256_sub_pd(_mm256_mul_pd(_mm256_sub_pd(_mm256_loadu_pd(sqsum + step), _mm256_loadu_pd(sqsum)), norm), _mm256_mul_pd(m, m));
+                _mm_storeu_ps(var, _mm256_cvtpd_ps(_mm256_max_pd(v, _mm256_setzero_pd())));
+            }
+            _mm_storeu_ps(mean, _mm256_cvtpd_ps(m));
+        }
+
+        static void BoxFilterRow32f(const double* sum, const double* sqsum, size_t size, size_t step, double norm, float* mean, float* var)
+        {
+            const size_t DF = F / 2;
+            __m256d _norm = _mm256_set1_pd(norm);
+            size_t sizeDF = AlignLo(size, DF);
+            for (size_t i = 0; i < sizeDF; i += DF)
+                BoxFilterRow32f(sum + i, sqsum ? sqsum + i : NULL, step, _norm, mean + i, var ? var + i : NULL);
+            if (sizeDF < size)
+            {
+                size_t i = size - DF;
+                BoxFilterRow32f(sum + i, sqsum ? sqsum + i : NULL, step, _norm, mean + i, var ? var + i : NULL);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        BoxFilterDefault::BoxFilterDefault(const BoxFilterParam& param)
+            : Sse41::BoxFilterDefault(param)
+        {
+            _colUpdate8u = BoxFilterColUpdate8u;
+            _colUpdate32f = BoxFilterColUpdate32f;
+            if (_alg.size >= F)
+            {
+                _row8u = BoxFilterRow8u;
+                _row32f = BoxFilterRow32f;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void* BoxFilterInit(size_t width, size_t height, size_t channels, SimdBoxFilterChannelType type, size_t radiusX, size_t radiusY)
+        {
+            BoxFilterParam param(width, height, channels, type, radiusX, radiusY, A);
+            if (!param.Valid())
+                return NULL;
+            return new BoxFilterDefault(param);
+        }
+    }
+#endif
+}
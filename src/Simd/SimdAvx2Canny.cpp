@@ -0,0 +1,141 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdCanny.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        const __m256i K16_CANNY_TAN = SIMD_MM256_SET1_EPI16(Base::CANNY_TAN_22_5);
+        const __m256i K8_CANNY_EDGE = SIMD_MM256_SET1_EPI8(Base::CannyMapEdge);
+
+        SIMD_INLINE void CannyMagnitude(const int16_t* dx, const int16_t* dy, int16_t* mag)
+        {
+            __m256i _dx = _mm256_abs_epi16(_mm256_loadu_si256((__m256i*)dx));
+            __m256i _dy = _mm256_abs_epi16(_mm256_loadu_si256((__m256i*)dy));
+            _mm256_storeu_si256((__m256i*)mag, _mm256_add_epi16(_dx, _dy));
+        }
+
+        static void CannyMagnitude(const int16_t* dx, const int16_t* dy, size_t width, int16_t* mag)
+        {
+            assert(width >= HA);
+            size_t widthHA = AlignLo(width, HA);
+            for (size_t x = 0; x < widthHA; x += HA)
+                CannyMagnitude(dx + x, dy + x, mag + x);
+            if (widthHA < width)
+                CannyMagnitude(dx + width - HA, dy + width - HA, mag + width - HA);
+        }
+
+        SIMD_INLINE __m256i CannyTan(__m256i a)
+        {
+            __m256i hi = _mm256_add_epi16(_mm256_mulhi_epu16(a, K16_CANNY_TAN), K16_0001);
+            return _mm256_add_epi16(hi, _mm256_cmpeq_epi16(_mm256_mullo_epi16(a, K16_CANNY_TAN), _mm256_setzero_si256()));
+        }
+
+        SIMD_INLINE __m256i CannyNms(const int16_t* dx, const int16_t* dy, const int16_t* mag0, const int16_t* mag1, const int16_t* mag2, __m256i low, __m256i high)
+        {
+            __m256i _dx = _mm256_loadu_si256((__m256i*)dx);
+            __m256i _dy = _mm256_loadu_si256((__m256i*)dy);
+            __m256i ax = _mm256_abs_epi16(_dx), ay = _mm256_abs_epi16(_dy);
+            __m256i hor = _mm256_cmpgt_epi16(CannyTan(ax), ay);
+            __m256i ver = _mm256_cmpgt_epi16(CannyTan(ay), ax);
+            __m256i neg = _mm256_srai_epi16(_mm256_xor_si256(_dx, _dy), 15);
+            __m256i a = _mm256_blendv_epi8(_mm256_loadu_si256((__m256i*)(mag0 - 1)), _mm256_loadu_si256((__m256i*)(mag0 + 1)), neg);
+            __m256i b = _mm256_blendv_epi8(_mm256_loadu_si256((__m256i*)(mag2 + 1)), _mm256_loadu_si256((__m256i*)(mag2 - 1)), neg);
+            a = _mm256_blendv_epi8(a, _mm256_loadu_si256((__m256i*)(mag1 - 1)), hor);
+            b = _mm256_blendv_epi8(b, _mm256_sub_epi16(_mm256_loadu_si256((__m256i*)(mag1 + 1)), K16_0001), hor);
+            a = _mm256_blendv_epi8(a, _mm256_loadu_si256((__m256i*)mag0), ver);
+            b = _mm256_blendv_epi8(b, _mm256_sub_epi16(_mm256_loadu_si256((__m256i*)mag2), K16_0001), ver);
+            __m256i m = _mm256_loadu_si256((__m256i*)mag1);
+            __m256i max = _mm256_and_si256(_mm256_cmpgt_epi16(m, low), _mm256_and_si256(_mm256_cmpgt_epi16(m, a), _mm256_cmpgt_epi16(m, b)));
+            return _mm256_and_si256(max, _mm256_sub_epi16(K16_0001, _mm256_cmpgt_epi16(m, high)));
+        }
+
+        SIMD_INLINE void CannyNms(const int16_t* dx, const int16_t* dy, const int16_t* mag0, const int16_t* mag1, const int16_t* mag2, __m256i low, __m256i high, uint8_t* map)
+        {
+            __m256i lo = CannyNms(dx + 0, dy + 0, mag0 + 0, mag1 + 0, mag2 + 0, low, high);
+            __m256i hi = CannyNms(dx + HA, dy + HA, mag0 + HA, mag1 + HA, mag2 + HA, low, high);
+            _mm256_storeu_si256((__m256i*)map, PackI16ToU8(lo, hi));
+        }
+
+        static void CannyNms(const int16_t* dx, const int16_t* dy, const int16_t* mag0, const int16_t* mag1, const int16_t* mag2, size_t width, int16_t low, int16_t high, uint8_t* map)
+        {
+            assert(width >= A);
+            size_t widthA = AlignLo(width, A);
+            __m256i _low = _mm256_set1_epi16(low), _high = _mm256_set1_epi16(high);
+            for (size_t x = 0; x < widthA; x += A)
+                CannyNms(dx + x, dy + x, mag0 + x, mag1 + x, mag2 + x, _low, _high, map + x);
+            if (widthA < width)
+            {
+                size_t x = width - A;
+                CannyNms(dx + x, dy + x, mag0 + x, mag1 + x, mag2 + x, _low, _high, map + x);
+            }
+        }
+
+        SIMD_INLINE void CannyOutput(const uint8_t* map, uint8_t* dst)
+        {
+            _mm256_storeu_si256((__m256i*)dst, _mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i*)map), K8_CANNY_EDGE));
+        }
+
+        static void CannyOutput(const uint8_t* map, size_t width, uint8_t* dst)
+        {
+            assert(width >= A);
+            size_t widthA = AlignLo(width, A);
+            for (size_t x = 0; x < widthA; x += A)
+                CannyOutput(map + x, dst + x);
+            if (widthA < width)
+                CannyOutput(map + width - A, dst + width - A);
+        }
+
+        //---------------------------------------------------------------------
+
+        CannyDefault::CannyDefault(const CannyParam& param)
+            : Sse41::CannyDefault(param)
+        {
+            if (_param.width > A)
+            {
+                _sobelDx = Avx2::SobelDx;
+                _sobelDy = Avx2::SobelDy;
+                _magnitude = CannyMagnitude;
+                _nms = CannyNms;
+                _output = CannyOutput;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void* CannyInit(size_t width, size_t height, float lowThreshold, float highThreshold)
+        {
+            CannyParam param(width, height, lowThreshold, highThreshold);
+            if (!param.Valid())
+                return NULL;
+            return new CannyDefault(param);
+        }
+    }
+#endif
+}
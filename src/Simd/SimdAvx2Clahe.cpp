@@ -0,0 +1,92 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdClahe.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i ClaheLerp(__m256i a, __m256i b, __m256i w)
+        {
+            return _mm256_add_epi32(_mm256_slli_epi32(a, Base::CLAHE_SHIFT), _mm256_mullo_epi32(_mm256_sub_epi32(b, a), w));
+        }
+
+        SIMD_INLINE __m256i ClaheInterpolate8(const uint8_t* src, const int32_t* ix0, const int32_t* ix1, const int32_t* wx,
+            const int32_t* lut0, const int32_t* lut1, __m256i wy)
+        {
+            __m256i v = _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)src));
+            __m256i i0 = _mm256_add_epi32(_mm256_loadu_si256((__m256i*)ix0), v);
+            __m256i i1 = _mm256_add_epi32(_mm256_loadu_si256((__m256i*)ix1), v);
+            __m256i _wx = _mm256_loadu_si256((__m256i*)wx);
+            __m256i top = ClaheLerp(_mm256_i32gather_epi32((int*)lut0, i0, 4), _mm256_i32gather_epi32((int*)lut0, i1, 4), _wx);
+            __m256i bot = ClaheLerp(_mm256_i32gather_epi32((int*)lut1, i0, 4), _mm256_i32gather_epi32((int*)lut1, i1, 4), _wx);
+            __m256i sum = _mm256_add_epi32(ClaheLerp(top, bot, wy), _mm256_set1_epi32(Base::CLAHE_ROUND));
+            return _mm256_srli_epi32(sum, 2 * Base::CLAHE_SHIFT);
+        }
+
+        static void ClaheInterpolate(const uint8_t* src, size_t width, const int32_t* ix0, const int32_t* ix1, const int32_t* wx,
+            const int32_t* lut0, const int32_t* lut1, int32_t wy, uint8_t* dst)
+        {
+            size_t width16 = AlignLo(width, 16), width8 = AlignLo(width, 8), x = 0;
+            __m256i _wy = _mm256_set1_epi32(wy);
+            for (; x < width16; x += 16)
+            {
+                __m256i lo = ClaheInterpolate8(src + x + 0, ix0 + x + 0, ix1 + x + 0, wx + x + 0, lut0, lut1, _wy);
+                __m256i hi = ClaheInterpolate8(src + x + 8, ix0 + x + 8, ix1 + x + 8, wx + x + 8, lut0, lut1, _wy);
+                __m256i u16 = PackI32ToI16(lo, hi);
+                _mm_storeu_si128((__m128i*)(dst + x), _mm256_castsi256_si128(PackI16ToU8(u16, K_ZERO)));
+            }
+            for (; x < width8; x += 8)
+            {
+                __m256i val = ClaheInterpolate8(src + x, ix0 + x, ix1 + x, wx + x, lut0, lut1, _wy);
+                __m128i u16 = _mm_packus_epi32(_mm256_castsi256_si128(val), _mm256_extracti128_si256(val, 1));
+                _mm_storel_epi64((__m128i*)(dst + x), _mm_packus_epi16(u16, Sse41::K_ZERO));
+            }
+            for (; x < width; ++x)
+                dst[x] = Base::ClaheInterpolate(src[x], ix0[x], ix1[x], wx[x], lut0, lut1, wy);
+        }
+
+        //---------------------------------------------------------------------
+
+        ClaheDefault::ClaheDefault(const ClaheParam& param)
+            : Sse41::ClaheDefault(param)
+        {
+            _interpolate = ClaheInterpolate;
+        }
+
+        //---------------------------------------------------------------------
+
+        void* ClaheInit(size_t width, size_t height, size_t tilesX, size_t tilesY, float clipLimit)
+        {
+            ClaheParam param(width, height, tilesX, tilesY, clipLimit);
+            if (!param.Valid())
+                return NULL;
+            return new ClaheDefault(param);
+        }
+    }
+#endif
+}
@@ -0,0 +1,70 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdConnectedComponents.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        static size_t ConnectedComponentsRuns(const uint8_t* mask, size_t width, uint8_t index, int32_t* runs)
+        {
+            size_t widthA = AlignLo(width, A), x = 0;
+            __m256i _index = _mm256_set1_epi8(index);
+            uint32_t inside = 0;
+            int32_t* end = runs;
+            for (; x < widthA; x += A)
+            {
+                uint32_t bits = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i*)(mask + x)), _index));
+                end = Base::ConnectedComponentsEdges<A>(bits, int32_t(x), inside, end);
+            }
+            end = Base::ConnectedComponentsEdges(mask, x, width, index, inside, end);
+            if (inside)
+                *end++ = int32_t(width);
+            return (end - runs) / 2;
+        }
+
+        //---------------------------------------------------------------------
+
+        ConnectedComponentsDefault::ConnectedComponentsDefault(const ConnectedComponentsParam& param)
+            : Sse41::ConnectedComponentsDefault(param)
+        {
+            if (_param.width >= A)
+                _runs = ConnectedComponentsRuns;
+        }
+
+        //---------------------------------------------------------------------
+
+        void* ConnectedComponentsInit(size_t width, size_t height, SimdConnectivityType connectivity, SimdBool moments)
+        {
+            ConnectedComponentsParam param(width, height, connectivity, moments);
+            if (!param.Valid())
+                return NULL;
+            return new ConnectedComponentsDefault(param);
+        }
+    }
+#endif
+}
@@ -25,6 +25,7 @@
 #include "Simd/SimdLoadBlock.h"
 #include "Simd/SimdStore.h"
 #include "Simd/SimdGaussianBlur.h"
+#include "Simd/SimdFmadd.h"
 #include "Simd/SimdExtract.h"
 #include "Simd/SimdUnpack.h"
 
@@ -38,7 +39,17 @@ namespace Simd
             return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(src))));
         }
 
-        SIMD_INLINE void BlurColsAny(const uint8_t* src, size_t size, size_t channels, const float* weight, size_t kernel, float* dst)
+        SIMD_INLINE __m256 LoadAs32f(const uint16_t* src)
+        {
+            return _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128((__m128i*)src)));
+        }
+
+        SIMD_INLINE __m256 LoadAs32f(const float* src)
+        {
+            return _mm256_loadu_ps(src);
+        }
+
+        template<class T> SIMD_INLINE void BlurColsAny(const T* src, size_t size, size_t channels, const float* weight, size_t kernel, float* dst)
         {
             size_t sizeF = AlignLo(size, F);
             size_t i = 0;
@@ -58,13 +69,13 @@ namespace Simd
             }
         }
 
-        SIMD_INLINE void StoreAs8u(uint8_t* dst, const __m256& f0)
+        SIMD_INLINE void StoreAs(uint8_t* dst, const __m256& f0)
         {
             __m256i i0 = _mm256_cvtps_epi32(f0);
             ((int64_t*)dst)[0] = Extract64i<0>(PackI16ToU8(PackI32ToI16(i0, K_ZERO), K_ZERO));
         }
 
-        SIMD_INLINE void StoreAs8u(uint8_t* dst, const __m256& f0, const __m256& f1, const __m256& f2, const __m256& f3)
+        SIMD_INLINE void StoreAs(uint8_t* dst, const __m256& f0, const __m256& f1, const __m256& f2, const __m256& f3)
         {
             __m256i i0 = _mm256_cvtps_epi32(f0);
             __m256i i1 = _mm256_cvtps_epi32(f1);
@@ -73,7 +84,32 @@ namespace Simd
             _mm256_storeu_si256((__m256i*)dst, PackI16ToU8(PackI32ToI16(i0, i1), PackI32ToI16(i2, i3)));
         }
 
-        SIMD_INLINE void BlurRowsAny(const float* src, size_t size, size_t stride, const float* weight, size_t kernel, uint8_t* dst)
+        SIMD_INLINE void StoreAs(uint16_t* dst, const __m256& f0)
+        {
+            __m256i i0 = _mm256_cvtps_epi32(f0);
+            _mm_storeu_si128((__m128i*)dst, _mm256_castsi256_si128(PackU32ToI16(i0, K_ZERO)));
+        }
+
+        SIMD_INLINE void StoreAs(uint16_t* dst, const __m256& f0, const __m256& f1, const __m256& f2, const __m256& f3)
+        {
+            _mm256_storeu_si256((__m256i*)dst + 0, PackU32ToI16(_mm256_cvtps_epi32(f0), _mm256_cvtps_epi32(f1)));
+            _mm256_storeu_si256((__m256i*)dst + 1, PackU32ToI16(_mm256_cvtps_epi32(f2), _mm256_cvtps_epi32(f3)));
+        }
+
+        SIMD_INLINE void StoreAs(float* dst, const __m256& f0)
+        {
+            _mm256_storeu_ps(dst, f0);
+        }
+
+        SIMD_INLINE void StoreAs(float* dst, const __m256& f0, const __m256& f1, const __m256& f2, const __m256& f3)
+        {
+            _mm256_storeu_ps(dst + 0 * F, f0);
+            _mm256_storeu_ps(dst + 1 * F, f1);
+            _mm256_storeu_ps(dst + 2 * F, f2);
+            _mm256_storeu_ps(dst + 3 * F, f3);
+        }
+
+        template<class T> SIMD_INLINE void BlurRowsAny(const float* src, size_t size, size_t stride, const float* weight, size_t kernel, T* dst)
         {
             size_t sizeA = AlignLo(size, A);
             size_t sizeF = AlignLo(size, F);
@@ -93,59 +129,41 @@ namespace Simd
                     sum2 = _mm256_fmadd_ps(w, _mm256_loadu_ps(ps + 2 * F), sum2);
                     sum3 = _mm256_fmadd_ps(w, _mm256_loadu_ps(ps + 3 * F), sum3);
                 }
-                StoreAs8u(dst + i, sum0, sum1, sum2, sum3);
+                StoreAs(dst + i, sum0, sum1, sum2, sum3);
             }
             for (; i < sizeF; i += F)
             {
                 __m256 sum = _mm256_setzero_ps();
                 for (size_t k = 0; k < kernel; ++k)
                     sum = _mm256_fmadd_ps(_mm256_set1_ps(weight[k]), _mm256_loadu_ps(src + i + k * stride), sum);
-                StoreAs8u(dst + i, sum);
+                StoreAs(dst + i, sum);
             }
             for (; i < size; ++i)
             {
                 float sum = 0;
                 for (size_t k = 0; k < kernel; ++k)
                     sum += weight[k] * src[i + k * stride];
-                dst[i] = Round(sum);
+                dst[i] = Base::BlurConvert<T>(sum);
             }
         }
 
-        template<int channels> void BlurImageAny(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
+        template<class T, int channels> void BlurImageAny(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, 
+            size_t yBeg, size_t yEnd, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
         {
-            Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-            BlurColsAny(cols, a.size, p.channels, a.weight.data, a.kernel, rows + a.half * a.stride);
-            for (size_t row = 0; row < a.half; ++row)
-                memcpy(rows + row * a.stride, rows + a.half * a.stride, a.size * sizeof(float));
-            for (size_t row = 1; row < a.nose; ++row)
-            {
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurColsAny(cols, a.size, p.channels, a.weight.data, a.kernel, rows + (a.half + row) * a.stride);
-            }
-            for (size_t row = a.nose; row <= a.half; ++row)
-                memcpy(rows + (a.half + row) * a.stride, rows + (a.half + a.nose - 1) * a.stride, a.size * sizeof(float));
-            BlurRowsAny(rows, a.size, a.stride, a.weight.data, a.kernel, dst), dst += dstStride;
-
-            for (size_t row = 1, b = row % a.kernel + 2 * a.half, w = a.kernel - row % a.kernel; row < a.body; ++row, ++b, --w)
+            ptrdiff_t beg = yBeg - a.half, end = yEnd + a.half, last = p.height - 1;
+            for (ptrdiff_t sy = beg; sy < end; ++sy)
             {
-                if (b >= a.kernel)
-                    b -= a.kernel;
-                if (w == 0)
-                    w += a.kernel;
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurColsAny(cols, a.size, p.channels, a.weight.data, a.kernel, rows + b * a.stride);
-                BlurRowsAny(rows, a.size, a.stride, a.weight.data + w, a.kernel, dst), dst += dstStride;
-            }
-
-            size_t last = (a.body + 2 * a.half - 1) % a.kernel;
-            for (size_t row = a.body, b = row % a.kernel + 2 * a.half, w = a.kernel - row % a.kernel; row < p.height; ++row, ++b, --w)
-            {
-                if (b >= a.kernel)
-                    b -= a.kernel;
-                if (w == 0)
-                    w += a.kernel;
-                memcpy(rows + b * a.stride, rows + last * a.stride, a.size * sizeof(float));
-                BlurRowsAny(rows, a.size, a.stride, a.weight.data + w, a.kernel, dst), dst += dstStride;
+                float* row = rows + (sy + a.half) % a.kernel * a.stride;
+                if (sy > beg && (sy <= 0 || sy > last))
+                    memcpy(row, rows + (sy + a.half - 1) % a.kernel * a.stride, a.size * sizeof(float));
+                else
+                {
+                    Base::PadCols<int(channels * sizeof(T))>(src + Simd::RestrictRange<ptrdiff_t>(sy, 0, last) * srcStride, a.half, a.size * sizeof(T), cols);
+                    BlurColsAny((T*)cols, a.size, channels, a.weight.data, a.kernel, row);
+                }
+                ptrdiff_t y = sy - a.half;
+                if (y >= (ptrdiff_t)yBeg)
+                    BlurRowsAny(rows, a.size, a.stride, a.weight.data + a.kernel - y % a.kernel, a.kernel, (T*)(dst + y * dstStride));
             }
         }
 
@@ -248,14 +266,14 @@ namespace Simd
                     sum2 = _mm256_fmadd_ps(w[k], _mm256_loadu_ps(ps + 2 * F), sum2);
                     sum3 = _mm256_fmadd_ps(w[k], _mm256_loadu_ps(ps + 3 * F), sum3);
                 }
-                StoreAs8u(dst + i, sum0, sum1, sum2, sum3);
+                StoreAs(dst + i, sum0, sum1, sum2, sum3);
             }
             for (; i < sizeF; i += F)
             {
                 __m256 sum = _mm256_setzero_ps();
                 for (size_t k = 0; k < kernel; ++k)
                     sum = _mm256_fmadd_ps(w[k], _mm256_loadu_ps(src + i + k * stride), sum);
-                StoreAs8u(dst + i, sum);
+                StoreAs(dst + i, sum);
             }
             for (; i < size; ++i)
             {
@@ -266,41 +284,23 @@ namespace Simd
             }
         }
 
-        template<int channels, int kernel> void BlurImage(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
+        template<int channels, int kernel> void BlurImage(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, 
+            size_t yBeg, size_t yEnd, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
         {
-            Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-            BlurCols<kernel>(cols, a.size, p.channels, a.weight.data, rows + a.half * a.stride);
-            for (size_t row = 0; row < a.half; ++row)
-                memcpy(rows + row * a.stride, rows + a.half * a.stride, a.size * sizeof(float));
-            for (size_t row = 1; row < a.nose; ++row)
-            {
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurCols<kernel>(cols, a.size, p.channels, a.weight.data, rows + (a.half + row) * a.stride);
-            }
-            for (size_t row = a.nose; row <= a.half; ++row)
-                memcpy(rows + (a.half + row) * a.stride, rows + (a.half + a.nose - 1) * a.stride, a.size * sizeof(float));
-            BlurRows<kernel>(rows, a.size, a.stride, a.weight.data, dst), dst += dstStride;
-
-            for (size_t row = 1, b = row % a.kernel + 2 * a.half, w = kernel - row % kernel; row < a.body; ++row, ++b, --w)
-            {
-                if (b >= kernel)
-                    b -= kernel;
-                if (w == 0)
-                    w += kernel;
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurCols<kernel>(cols, a.size, p.channels, a.weight.data, rows + b * a.stride);
-                BlurRows<kernel>(rows, a.size, a.stride, a.weight.data + w, dst), dst += dstStride;
-            }
-
-            size_t last = (a.body + 2 * a.half - 1) % kernel;
-            for (size_t row = a.body, b = row % kernel + 2 * a.half, w = kernel - row % kernel; row < p.height; ++row, ++b, --w)
+            ptrdiff_t beg = yBeg - a.half, end = yEnd + a.half, last = p.height - 1;
+            for (ptrdiff_t sy = beg; sy < end; ++sy)
             {
-                if (b >= kernel)
-                    b -= kernel;
-                if (w == 0)
-                    w += kernel;
-                memcpy(rows + b * a.stride, rows + last * a.stride, a.size * sizeof(float));
-                BlurRows<kernel>(rows, a.size, a.stride, a.weight.data + w, dst), dst += dstStride;
+                float* row = rows + (sy + a.half) % kernel * a.stride;
+                if (sy > beg && (sy <= 0 || sy > last))
+                    memcpy(row, rows + (sy + a.half - 1) % kernel * a.stride, a.size * sizeof(float));
+                else
+                {
+                    Base::PadCols<channels>(src + Simd::RestrictRange<ptrdiff_t>(sy, 0, last) * srcStride, a.half, a.size, cols);
+                    BlurCols<kernel>(cols, a.size, p.channels, a.weight.data, row);
+                }
+                ptrdiff_t y = sy - a.half;
+                if (y >= (ptrdiff_t)yBeg)
+                    BlurRows<kernel>(rows, a.size, a.stride, a.weight.data + kernel - y % kernel, dst + y * dstStride);
             }
         }
 
@@ -308,13 +308,19 @@ namespace Simd
 
         template<int channels> Base::BlurDefaultPtr GetBlurDefaultPtr(const BlurParam& p, const Base::AlgDefault& a)
         {
+            switch (p.type)
+            {
+            case SimdGaussianBlurChannel16u: return BlurImageAny<uint16_t, channels>;
+            case SimdGaussianBlurChannel32f: return BlurImageAny<float, channels>;
+            default: break;
+            }
             switch (a.kernel)
             {
             case 3: return BlurImage<channels, 3>;
             case 5: return BlurImage<channels, 5>;
             case 7: return BlurImage<channels, 7>;
             case 9: return BlurImage<channels, 9>;
-            default: return BlurImageAny<channels>;
+            default: return BlurImageAny<uint8_t, channels>;
             }
         }
 
@@ -337,6 +343,136 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        template<bool tail> SIMD_INLINE __m256 IirLoad(const float* src, __m256i mask)
+        {
+            return tail ? _mm256_maskload_ps(src, mask) : _mm256_loadu_ps(src);
+        }
+
+        template<bool tail> SIMD_INLINE void IirStore(float* dst, __m256 value, __m256i mask)
+        {
+            if (tail)
+                _mm256_maskstore_ps(dst, mask, value);
+            else
+                _mm256_storeu_ps(dst, value);
+        }
+
+        template<bool tail, class T> SIMD_INLINE void IirStore(T* dst, __m256 value, size_t size)
+        {
+            if (tail)
+            {
+                float buf[F];
+                _mm256_storeu_ps(buf, value);
+                for (size_t i = 0; i < size; ++i)
+                    dst[i] = Base::BlurConvert<T>(buf[i]);
+            }
+            else
+                StoreAs(dst, value);
+        }
+
+        SIMD_INLINE __m256 IirSum(const __m256* k, const __m256& x0, const __m256& y1, const __m256& y2, const __m256& y3)
+        {
+            return Fmadd<true>(k[3], y3, Fmadd<true>(k[2], y2, Fmadd<true>(k[0], x0, k[1], y1)));
+        }
+
+        SIMD_INLINE __m256 IirInit(const __m256* m, const __m256& e, const __m256& u0, const __m256& u1, const __m256& u2)
+        {
+            return Fmadd<true>(m[2], u2, Fmadd<true>(m[1], u1, Fmadd<true>(m[0], u0, e)));
+        }
+
+        template<bool tail> SIMD_INLINE void IirForward(const __m256* k, float* w0, const float* w1, const float* w2, const float* w3, __m256i mask)
+        {
+            __m256 sum = IirSum(k, IirLoad<tail>(w0, mask), IirLoad<tail>(w1, mask), IirLoad<tail>(w2, mask), IirLoad<tail>(w3, mask));
+            IirStore<tail>(w0, sum, mask);
+        }
+
+        template<bool tail, class T> SIMD_INLINE void IirInit(const __m256* m, float* y0, const float* w1, const float* w2,
+            const float* last, float* next1, float* next2, T* dst, __m256i mask, size_t size)
+        {
+            __m256 e = IirLoad<tail>(last, mask);
+            __m256 u0 = _mm256_sub_ps(IirLoad<tail>(y0, mask), e);
+            __m256 u1 = _mm256_sub_ps(IirLoad<tail>(w1, mask), e);
+            __m256 u2 = _mm256_sub_ps(IirLoad<tail>(w2, mask), e);
+            __m256 v0 = IirInit(m + 0, e, u0, u1, u2);
+            IirStore<tail>(y0, v0, mask);
+            IirStore<tail>(next1, IirInit(m + 3, e, u0, u1, u2), mask);
+            IirStore<tail>(next2, IirInit(m + 6, e, u0, u1, u2), mask);
+            IirStore<tail>(dst, v0, size);
+        }
+
+        template<bool tail, class T> SIMD_INLINE void IirBackward(const __m256* k, float* y0, const float* y1, const float* y2, const float* y3, T* dst, __m256i mask, size_t size)
+        {
+            __m256 sum = IirSum(k, IirLoad<tail>(y0, mask), IirLoad<tail>(y1, mask), IirLoad<tail>(y2, mask), IirLoad<tail>(y3, mask));
+            IirStore<tail>(y0, sum, mask);
+            IirStore<tail>(dst, sum, size);
+        }
+
+        template<class T> void BlurIirVer(const Base::AlgIir& a, size_t size, size_t height, float* img, size_t stride, float* buf, uint8_t* dst, size_t dstStride)
+        {
+            size_t sizeF = AlignLo(size, F), tail = size - sizeF, i;
+            __m256i mask = LeftNotZero32i(tail);
+            __m256 k[4], m[9];
+            k[0] = _mm256_set1_ps(a.b);
+            k[1] = _mm256_set1_ps(a.a1);
+            k[2] = _mm256_set1_ps(a.a2);
+            k[3] = _mm256_set1_ps(a.a3);
+            for (size_t j = 0; j < 9; ++j)
+                m[j] = _mm256_set1_ps(a.m[j]);
+            float* first = buf, * last = buf + size, * next1 = buf + 2 * size, * next2 = buf + 3 * size;
+            memcpy(first, img, size * sizeof(float));
+            memcpy(last, img + (height - 1) * stride, size * sizeof(float));
+            for (ptrdiff_t y = 0; y < (ptrdiff_t)height; ++y)
+            {
+                float* w0 = img + y * stride;
+                const float* w1 = y > 0 ? w0 - stride : first;
+                const float* w2 = y > 1 ? w0 - 2 * stride : first;
+                const float* w3 = y > 2 ? w0 - 3 * stride : first;
+                for (i = 0; i < sizeF; i += F)
+                    IirForward<false>(k, w0 + i, w1 + i, w2 + i, w3 + i, mask);
+                if (tail)
+                    IirForward<true>(k, w0 + i, w1 + i, w2 + i, w3 + i, mask);
+            }
+            {
+                ptrdiff_t y = height - 1;
+                float* y0 = img + y * stride;
+                const float* w1 = y > 0 ? y0 - stride : first;
+                const float* w2 = y > 1 ? y0 - 2 * stride : first;
+                T* d = (T*)(dst + y * dstStride);
+                for (i = 0; i < sizeF; i += F)
+                    IirInit<false>(m, y0 + i, w1 + i, w2 + i, last + i, next1 + i, next2 + i, d + i, mask, F);
+                if (tail)
+                    IirInit<true>(m, y0 + i, w1 + i, w2 + i, last + i, next1 + i, next2 + i, d + i, mask, tail);
+            }
+            for (ptrdiff_t y = height - 2; y >= 0; --y)
+            {
+                float* y0 = img + y * stride;
+                const float* y1 = y0 + stride;
+                const float* y2 = y + 2 < (ptrdiff_t)height ? y0 + 2 * stride : next1;
+                const float* y3 = y + 3 < (ptrdiff_t)height ? y0 + 3 * stride : (y + 3 == (ptrdiff_t)height ? next1 : next2);
+                T* d = (T*)(dst + y * dstStride);
+                for (i = 0; i < sizeF; i += F)
+                    IirBackward<false>(k, y0 + i, y1 + i, y2 + i, y3 + i, d + i, mask, F);
+                if (tail)
+                    IirBackward<true>(k, y0 + i, y1 + i, y2 + i, y3 + i, d + i, mask, tail);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        GaussianBlurIir::GaussianBlurIir(const BlurParam& param)
+            : Sse41::GaussianBlurIir(param)
+        {
+            switch (_param.type)
+            {
+            case SimdGaussianBlurChannel8u: _ver = BlurIirVer<uint8_t>; break;
+            case SimdGaussianBlurChannel16u: _ver = BlurIirVer<uint16_t>; break;
+            case SimdGaussianBlurChannel32f: _ver = BlurIirVer<float>; break;
+            default:
+                assert(0);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon)
         {
             BlurParam param(width, height, channels, sigma, epsilon, A);
@@ -345,6 +481,17 @@ namespace Simd
             return new GaussianBlurDefault(param);
         }
 
+        void* GaussianBlurInitEx(size_t width, size_t height, size_t channels, SimdGaussianBlurChannelType type,
+            const float* sigma, const float* epsilon, SimdGaussianBlurMethod method)
+        {
+            BlurParam param(width, height, channels, type, sigma, epsilon, method, A);
+            if (!param.Valid())
+                return NULL;
+            if (param.Iir())
+                return new GaussianBlurIir(param);
+            return new GaussianBlurDefault(param);
+        }
+
         //---------------------------------------------------------------------
 
         namespace
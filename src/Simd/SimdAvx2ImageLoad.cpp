@@ -124,6 +124,29 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        ImageQoiLoader::ImageQoiLoader(const ImageLoaderParam& param)
+            : Sse41::ImageQoiLoader(param)
+        {
+        }
+
+        void ImageQoiLoader::SetConverters()
+        {
+            Sse41::ImageQoiLoader::SetConverters();
+            if (_image.width >= A)
+            {
+                switch (_param.format)
+                {
+                case SimdPixelFormatGray8: _converter = Avx2::RgbaToGray; break;
+                case SimdPixelFormatBgr24: _converter = Avx2::BgraToRgb; break;
+                case SimdPixelFormatBgra32: _converter = Avx2::BgraToRgba; break;
+                case SimdPixelFormatRgb24: _converter = Avx2::BgraToBgr; break;
+                default: break;
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         ImageLoader* CreateImageLoader(const ImageLoaderParam& param)
         {
             switch (param.file)
@@ -134,6 +157,7 @@ namespace Simd
             case SimdImageFilePpmBin: return new ImagePpmBinLoader(param);
             case SimdImageFilePng: return new Sse41::ImagePngLoader(param);
             case SimdImageFileJpeg: return new Base::ImageJpegLoader(param);
+            case SimdImageFileQoi: return new ImageQoiLoader(param);
             default:
                 return NULL;
             }
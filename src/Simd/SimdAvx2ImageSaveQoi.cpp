@@ -0,0 +1,140 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdImageSave.h"
+#include "Simd/SimdImageQoi.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        const __m256i K8_QOI_HASH = SIMD_MM256_SETR_EPI8(
+            3, 5, 7, 11, 3, 5, 7, 11, 3, 5, 7, 11, 3, 5, 7, 11,
+            3, 5, 7, 11, 3, 5, 7, 11, 3, 5, 7, 11, 3, 5, 7, 11);
+        const __m256i K16_QOI_MASK = SIMD_MM256_SET1_EPI16(63);
+        const __m256i K32_QOI_PERMUTE = SIMD_MM256_SETR_EPI32(0, 4, 1, 5, 2, 6, 3, 7);
+
+        SIMD_INLINE __m256i QoiHash8(const uint8_t* rgba)
+        {
+            return _mm256_madd_epi16(_mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)rgba), K8_QOI_HASH), K16_0001);
+        }
+
+        void QoiHashRow(const uint8_t* rgba, size_t size, uint8_t* hash)
+        {
+            size_t size32 = AlignLo(size, 32), i = 0;
+            for (; i < size32; i += 32, rgba += 128)
+            {
+                __m256i lo = _mm256_and_si256(_mm256_packs_epi32(QoiHash8(rgba + 0 * A), QoiHash8(rgba + 1 * A)), K16_QOI_MASK);
+                __m256i hi = _mm256_and_si256(_mm256_packs_epi32(QoiHash8(rgba + 2 * A), QoiHash8(rgba + 3 * A)), K16_QOI_MASK);
+                __m256i _hash = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(lo, hi), K32_QOI_PERMUTE);
+                _mm256_storeu_si256((__m256i*)(hash + i), _hash);
+            }
+            Sse41::QoiHashRow(rgba, size - i, hash + i);
+        }
+
+        size_t QoiRunLength(const uint32_t* rgba, size_t size, uint32_t value)
+        {
+            size_t size8 = AlignLo(size, 8), i = 0;
+            __m256i _value = _mm256_set1_epi32(value);
+            for (; i < size8; i += 8)
+            {
+                uint32_t mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_loadu_si256((__m256i*)(rgba + i)), _value)));
+                if (mask != 0xFF)
+                    return i + _tzcnt_u32(~mask);
+            }
+            return i + Sse41::QoiRunLength(rgba + i, size - i, value);
+        }
+
+        SIMD_INLINE __m256i QoiSignedByte(__m256i value, int shift)
+        {
+            return _mm256_srai_epi32(_mm256_slli_epi32(value, shift), 24);
+        }
+
+        SIMD_INLINE __m256i QoiInRange(__m256i value, int lo, int hi)
+        {
+            return _mm256_andnot_si256(_mm256_cmpgt_epi32(value, _mm256_set1_epi32(hi)), _mm256_cmpgt_epi32(value, _mm256_set1_epi32(lo - 1)));
+        }
+
+        SIMD_INLINE __m256i QoiDiff8(const uint32_t* rgba)
+        {
+            __m256i cur = _mm256_loadu_si256((__m256i*)rgba);
+            __m256i prv = _mm256_loadu_si256((__m256i*)(rgba - 1));
+            __m256i d = _mm256_sub_epi8(cur, prv);
+            __m256i vr = QoiSignedByte(d, 24);
+            __m256i vg = QoiSignedByte(d, 16);
+            __m256i vb = QoiSignedByte(d, 8);
+            __m256i vgr = QoiSignedByte(_mm256_sub_epi32(vr, vg), 24);
+            __m256i vgb = QoiSignedByte(_mm256_sub_epi32(vb, vg), 24);
+            __m256i isDiff = _mm256_and_si256(_mm256_and_si256(QoiInRange(vr, -2, 1), QoiInRange(vg, -2, 1)), QoiInRange(vb, -2, 1));
+            __m256i isLuma = _mm256_and_si256(_mm256_and_si256(QoiInRange(vgr, -8, 7), QoiInRange(vg, -32, 31)), QoiInRange(vgb, -8, 7));
+            __m256i diff = _mm256_or_si256(_mm256_set1_epi32(QOI_OP_DIFF), _mm256_or_si256(_mm256_slli_epi32(_mm256_add_epi32(vr, _mm256_set1_epi32(2)), 4),
+                _mm256_or_si256(_mm256_slli_epi32(_mm256_add_epi32(vg, _mm256_set1_epi32(2)), 2), _mm256_add_epi32(vb, _mm256_set1_epi32(2)))));
+            __m256i luma = _mm256_or_si256(_mm256_or_si256(_mm256_set1_epi32(QOI_OP_LUMA), _mm256_add_epi32(vg, _mm256_set1_epi32(32))), _mm256_slli_epi32(
+                _mm256_or_si256(_mm256_slli_epi32(_mm256_add_epi32(vgr, _mm256_set1_epi32(8)), 4), _mm256_add_epi32(vgb, _mm256_set1_epi32(8))), 8));
+            __m256i code = _mm256_blendv_epi8(_mm256_blendv_epi8(_mm256_set1_epi32(QOI_OP_RGB), luma, isLuma), diff, isDiff);
+            __m256i sameAlpha = _mm256_cmpeq_epi32(_mm256_srli_epi32(d, 24), _mm256_setzero_si256());
+            code = _mm256_blendv_epi8(_mm256_set1_epi32(QOI_OP_RGBA), code, sameAlpha);
+            return _mm256_andnot_si256(_mm256_cmpeq_epi32(cur, prv), code);
+        }
+
+        void QoiDiffRow(const uint32_t* rgba, size_t size, uint32_t prev, uint16_t* diff)
+        {
+            if (size == 0)
+                return;
+            diff[0] = Base::QoiDiff(rgba[0], prev);
+            size_t size16 = AlignLo(size - 1, 16) + 1, i = 1;
+            for (; i < size16; i += 16)
+            {
+                __m256i codes = _mm256_packus_epi32(QoiDiff8(rgba + i + 0), QoiDiff8(rgba + i + 8));
+                _mm256_storeu_si256((__m256i*)(diff + i), _mm256_permute4x64_epi64(codes, 0xD8));
+            }
+            for (; i < size; ++i)
+                diff[i] = Base::QoiDiff(rgba[i], rgba[i - 1]);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ImageQoiSaver::ImageQoiSaver(const ImageSaverParam& param)
+            : Sse41::ImageQoiSaver(param)
+        {
+            if (_param.width >= A)
+            {
+                switch (_param.format)
+                {
+                case SimdPixelFormatGray8: _toRgbaAlpha = Avx2::GrayToBgra; break;
+                case SimdPixelFormatBgr24: _toRgbaAlpha = Avx2::RgbToBgra; break;
+                case SimdPixelFormatBgra32: _toRgba = Avx2::BgraToRgba; break;
+                case SimdPixelFormatRgb24: _toRgbaAlpha = Avx2::BgrToBgra; break;
+                default: break;
+                }
+            }
+            _hashRow = Avx2::QoiHashRow;
+            _runLength = Avx2::QoiRunLength;
+            _diffRow = Avx2::QoiDiffRow;
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
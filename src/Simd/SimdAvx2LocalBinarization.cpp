@@ -0,0 +1,92 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdLocalBinarization.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdFmadd.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i LocalBinarization8(const uint32_t* sum, const uint32_t* sqsum, size_t step, const __m256* alg, const uint8_t* src)
+        {
+            __m256i s = _mm256_sub_epi32(_mm256_loadu_si256((__m256i*)(sum + step)), _mm256_loadu_si256((__m256i*)sum));
+            __m256i q = _mm256_sub_epi32(_mm256_loadu_si256((__m256i*)(sqsum + step)), _mm256_loadu_si256((__m256i*)sqsum));
+            __m256 mean = _mm256_mul_ps(_mm256_cvtepi32_ps(s), alg[0]);
+            __m256 var = Fmadd<true>(_mm256_cvtepi32_ps(q), alg[0], mean, _mm256_sub_ps(_mm256_setzero_ps(), mean));
+            __m256 dev = _mm256_sqrt_ps(_mm256_max_ps(var, _mm256_setzero_ps()));
+            __m256 threshold = Fmadd<true>(mean, Fmadd<true>(alg[2], dev, alg[1]), alg[3], dev);
+            __m256 value = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)src)));
+            return _mm256_castps_si256(_mm256_cmp_ps(value, threshold, _CMP_GT_OQ));
+        }
+
+        SIMD_INLINE void LocalBinarization16(const uint32_t* sum, const uint32_t* sqsum, size_t step, const __m256* alg,
+            const uint8_t* src, __m128i positive, __m128i negative, uint8_t* dst)
+        {
+            __m256i m0 = LocalBinarization8(sum + 0 * F, sqsum + 0 * F, step, alg, src + 0 * F);
+            __m256i m1 = LocalBinarization8(sum + 1 * F, sqsum + 1 * F, step, alg, src + 1 * F);
+            __m256i m01 = _mm256_permute4x64_epi64(_mm256_packs_epi32(m0, m1), 0xD8);
+            __m128i mask = _mm_packs_epi16(_mm256_castsi256_si128(m01), _mm256_extracti128_si256(m01, 1));
+            _mm_storeu_si128((__m128i*)dst, _mm_blendv_epi8(negative, positive, mask));
+        }
+
+        static void LocalBinarizationRow(const uint32_t* sum, const uint32_t* sqsum, size_t width, const Base::LocalBinarizationAlg& alg,
+            const uint8_t* src, uint8_t positive, uint8_t negative, uint8_t* dst)
+        {
+            __m256 _alg[4] = { _mm256_set1_ps(alg.norm), _mm256_set1_ps(alg.alpha), _mm256_set1_ps(alg.beta), _mm256_set1_ps(alg.gamma) };
+            __m128i _positive = _mm_set1_epi8(positive), _negative = _mm_set1_epi8(negative);
+            size_t widthDF = AlignLo(width, DF);
+            for (size_t i = 0; i < widthDF; i += DF)
+                LocalBinarization16(sum + i, sqsum + i, alg.step, _alg, src + i, _positive, _negative, dst + i);
+            if (widthDF < width)
+            {
+                size_t i = width - DF;
+                LocalBinarization16(sum + i, sqsum + i, alg.step, _alg, src + i, _positive, _negative, dst + i);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        LocalBinarizationDefault::LocalBinarizationDefault(const LocalBinarizationParam& param)
+            : Sse41::LocalBinarizationDefault(param)
+        {
+            _colUpdate = BoxFilterColUpdate8u;
+            if (_param.width >= DF)
+                _row = LocalBinarizationRow;
+        }
+
+        //---------------------------------------------------------------------
+
+        void* LocalBinarizationInit(size_t width, size_t height, SimdLocalBinarizationType type, size_t radius, float k, float r)
+        {
+            LocalBinarizationParam param(width, height, type, radius, k, r, A);
+            if (!param.Valid())
+                return NULL;
+            return new LocalBinarizationDefault(param);
+        }
+    }
+#endif
+}
@@ -25,6 +25,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdLoadBlock.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdMedianFilter.h"
 
 namespace Simd
 {
@@ -648,6 +649,28 @@ namespace Simd
             else
                 MedianFilterSquare5x5<false>(src, srcStride, width, height, channelCount, dst, dstStride);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        struct MedianHist16
+        {
+            static SIMD_INLINE void Add(uint16_t* dst, const uint16_t* src)
+            {
+                _mm256_storeu_si256((__m256i*)dst, _mm256_add_epi16(_mm256_loadu_si256((__m256i*)dst), _mm256_loadu_si256((__m256i*)src)));
+            }
+
+            static SIMD_INLINE void Update(uint16_t* dst, const uint16_t* add, const uint16_t* sub)
+            {
+                __m256i _dst = _mm256_add_epi16(_mm256_loadu_si256((__m256i*)dst), _mm256_loadu_si256((__m256i*)add));
+                _mm256_storeu_si256((__m256i*)dst, _mm256_sub_epi16(_dst, _mm256_loadu_si256((__m256i*)sub)));
+            }
+        };
+
+        void MedianFilterSquare(const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radius, uint8_t* dst, size_t dstStride)
+        {
+            Base::MedianFilterSquare<MedianHist16>(src, srcStride, width, height, channelCount, radius, dst, dstStride);
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 }
@@ -0,0 +1,132 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMorphology.h"
+#include "Simd/SimdTranspose.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        template<bool dilate> SIMD_INLINE __m256i MorphologyOp(__m256i a, __m256i b)
+        {
+            return dilate ? _mm256_max_epu8(a, b) : _mm256_min_epu8(a, b);
+        }
+
+        template<bool dilate> static void MorphologyRowOp(const uint8_t* a, const uint8_t* b, size_t width, uint8_t* dst)
+        {
+            size_t widthA = AlignLo(width, A), x = 0;
+            for (; x < widthA; x += A)
+                _mm256_storeu_si256((__m256i*)(dst + x), MorphologyOp<dilate>(_mm256_loadu_si256((__m256i*)(a + x)), _mm256_loadu_si256((__m256i*)(b + x))));
+            if (widthA < width && width >= A)
+            {
+                x = width - A;
+                _mm256_storeu_si256((__m256i*)(dst + x), MorphologyOp<dilate>(_mm256_loadu_si256((__m256i*)(a + x)), _mm256_loadu_si256((__m256i*)(b + x))));
+            }
+            else
+            {
+                for (; x < width; ++x)
+                    dst[x] = dilate ? Simd::Max(a[x], b[x]) : Simd::Min(a[x], b[x]);
+            }
+        }
+
+        template<bool dilate> void MorphologyHorizontal(const uint8_t* src, size_t srcStride, size_t width, size_t rows, size_t size, size_t anchor, uint8_t* buf, uint8_t* dst, size_t dstStride)
+        {
+            size_t length = width + size - 1, rowsA = AlignLo(rows, A), width16 = AlignLo(width, 16);
+            __m256i* t = (__m256i*)AlignHi(buf, A), * h = t + length, neutral = _mm256_set1_epi8(dilate ? 0 : -1);
+            uint8_t* tb = (uint8_t*)(t + anchor), * hb = (uint8_t*)h;
+            for (size_t r = 0; r < rowsA; r += A)
+            {
+                const uint8_t* s = src + r * srcStride;
+                uint8_t* d = dst + r * dstStride;
+                for (size_t i = 0; i < anchor; ++i)
+                    t[i] = neutral;
+                for (size_t i = anchor + width; i < length; ++i)
+                    t[i] = neutral;
+                size_t x = 0;
+                for (; x < width16; x += 16)
+                {
+                    Sse41::Transpose16x16(s + x, srcStride, tb + x * A, A);
+                    Sse41::Transpose16x16(s + 16 * srcStride + x, srcStride, tb + x * A + 16, A);
+                }
+                for (; x < width; ++x)
+                    for (size_t j = 0; j < A; ++j)
+                        tb[x * A + j] = s[j * srcStride + x];
+                for (size_t b = 0; b < length; b += size)
+                {
+                    size_t e = Simd::Min(b + size, length);
+                    h[e - 1] = t[e - 1];
+                    for (size_t p = e - 1; p > b; --p)
+                        h[p - 1] = MorphologyOp<dilate>(h[p], t[p - 1]);
+                    for (size_t p = b + 1; p < e; ++p)
+                        t[p] = MorphologyOp<dilate>(t[p - 1], t[p]);
+                }
+                for (x = 0; x < width; ++x)
+                    h[x] = MorphologyOp<dilate>(h[x], t[x + size - 1]);
+                for (x = 0; x < width16; x += 16)
+                {
+                    Sse41::Transpose16x16(hb + x * A, A, d + x, dstStride);
+                    Sse41::Transpose16x16(hb + x * A + 16, A, d + 16 * dstStride + x, dstStride);
+                }
+                for (; x < width; ++x)
+                    for (size_t j = 0; j < A; ++j)
+                        d[j * dstStride + x] = hb[x * A + j];
+            }
+            if (rowsA < rows)
+                Sse41::MorphologyHorizontal(src + rowsA * srcStride, srcStride, width, rows - rowsA, size, anchor, dilate, buf, dst + rowsA * dstStride, dstStride);
+        }
+
+        void MorphologyHorizontal(const uint8_t* src, size_t srcStride, size_t width, size_t rows, size_t size, size_t anchor, bool dilate, uint8_t* buf, uint8_t* dst, size_t dstStride)
+        {
+            if (dilate)
+                MorphologyHorizontal<true>(src, srcStride, width, rows, size, anchor, buf, dst, dstStride);
+            else
+                MorphologyHorizontal<false>(src, srcStride, width, rows, size, anchor, buf, dst, dstStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        MorphologyDefault::MorphologyDefault(const MorphParam& param)
+            : Sse41::MorphologyDefault(param)
+        {
+            _rowOp[0] = MorphologyRowOp<false>;
+            _rowOp[1] = MorphologyRowOp<true>;
+            _horizontal[0] = MorphologyHorizontal<false>;
+            _horizontal[1] = MorphologyHorizontal<true>;
+            Init(A);
+        }
+
+        //---------------------------------------------------------------------
+
+        void* MorphologyInit(size_t width, size_t height, SimdMorphologyOperationType operation, size_t kernelX, size_t kernelY)
+        {
+            MorphParam param(width, height, operation, kernelX, kernelY);
+            if (!param.Valid())
+                return NULL;
+            return new MorphologyDefault(param);
+        }
+    }
+#endif
+}
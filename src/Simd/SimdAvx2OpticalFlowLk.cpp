@@ -0,0 +1,172 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdOpticalFlowLk.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdSse41.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i OpticalFlowLkSample(__m256i s00, __m256i s01, __m256i s10, __m256i s11, const __m256i* weight, __m256i round, int shift)
+        {
+            __m256i lo = _mm256_add_epi32(_mm256_madd_epi16(_mm256_unpacklo_epi16(s00, s01), weight[0]), _mm256_madd_epi16(_mm256_unpacklo_epi16(s10, s11), weight[1]));
+            __m256i hi = _mm256_add_epi32(_mm256_madd_epi16(_mm256_unpackhi_epi16(s00, s01), weight[0]), _mm256_madd_epi16(_mm256_unpackhi_epi16(s10, s11), weight[1]));
+            return _mm256_packs_epi32(_mm256_srai_epi32(_mm256_add_epi32(lo, round), shift), _mm256_srai_epi32(_mm256_add_epi32(hi, round), shift));
+        }
+
+        SIMD_INLINE __m256i OpticalFlowLkSample(const uint8_t* s0, const uint8_t* s1, const __m256i* weight)
+        {
+            return OpticalFlowLkSample(
+                _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)s0)), _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(s0 + 1))),
+                _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)s1)), _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(s1 + 1))),
+                weight, _mm256_set1_epi32(Base::LK_I_ROUND), Base::LK_I_SHIFT);
+        }
+
+        SIMD_INLINE __m256i OpticalFlowLkSample(const int16_t* s0, const int16_t* s1, const __m256i* weight)
+        {
+            return OpticalFlowLkSample(
+                _mm256_loadu_si256((__m256i*)s0), _mm256_loadu_si256((__m256i*)(s0 + 1)),
+                _mm256_loadu_si256((__m256i*)s1), _mm256_loadu_si256((__m256i*)(s1 + 1)),
+                weight, _mm256_set1_epi32(Base::LK_W_ROUND), Base::LK_W_BITS);
+        }
+
+        SIMD_INLINE void OpticalFlowLkSetWeight(const int32_t* src, __m256i* dst)
+        {
+            dst[0] = _mm256_set1_epi32(src[0] | (src[1] << 16));
+            dst[1] = _mm256_set1_epi32(src[2] | (src[3] << 16));
+        }
+
+        SIMD_INLINE __m256i OpticalFlowLkWiden(__m256i sum)
+        {
+            return _mm256_add_epi64(_mm256_cvtepi32_epi64(_mm256_castsi256_si128(sum)), _mm256_cvtepi32_epi64(_mm256_extracti128_si256(sum, 1)));
+        }
+
+        SIMD_INLINE int64_t OpticalFlowLkSum(__m256i sum)
+        {
+            __m128i sum2 = _mm_add_epi64(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+            return _mm_cvtsi128_si64(_mm_add_epi64(sum2, _mm_srli_si128(sum2, 8)));
+        }
+
+        static void OpticalFlowLkTemplate(const uint8_t* img, size_t imgStride, const int16_t* dx, const int16_t* dy, size_t dStride,
+            const int32_t* weight, size_t window, int16_t* I, int16_t* Ix, int16_t* Iy, size_t patchStride, int64_t* G)
+        {
+            size_t windowHA = AlignHi(window, HA);
+            __m256i _weight[2];
+            OpticalFlowLkSetWeight(weight, _weight);
+            __m256i gxx = _mm256_setzero_si256(), gxy = _mm256_setzero_si256(), gyy = _mm256_setzero_si256();
+            for (size_t y = 0; y < window; ++y)
+            {
+                for (size_t x = 0; x < windowHA; x += HA)
+                {
+                    _mm256_storeu_si256((__m256i*)(I + x), OpticalFlowLkSample(img + x, img + imgStride + x, _weight));
+                    _mm256_storeu_si256((__m256i*)(Ix + x), OpticalFlowLkSample(dx + x, dx + dStride + x, _weight));
+                    _mm256_storeu_si256((__m256i*)(Iy + x), OpticalFlowLkSample(dy + x, dy + dStride + x, _weight));
+                }
+                for (size_t x = window; x < windowHA; ++x)
+                    Ix[x] = 0, Iy[x] = 0;
+                __m256i sxx = _mm256_setzero_si256(), sxy = _mm256_setzero_si256(), syy = _mm256_setzero_si256();
+                for (size_t x = 0; x < windowHA; x += HA)
+                {
+                    __m256i _Ix = _mm256_loadu_si256((__m256i*)(Ix + x));
+                    __m256i _Iy = _mm256_loadu_si256((__m256i*)(Iy + x));
+                    sxx = _mm256_add_epi32(sxx, _mm256_madd_epi16(_Ix, _Ix));
+                    sxy = _mm256_add_epi32(sxy, _mm256_madd_epi16(_Ix, _Iy));
+                    syy = _mm256_add_epi32(syy, _mm256_madd_epi16(_Iy, _Iy));
+                }
+                gxx = _mm256_add_epi64(gxx, OpticalFlowLkWiden(sxx));
+                gxy = _mm256_add_epi64(gxy, OpticalFlowLkWiden(sxy));
+                gyy = _mm256_add_epi64(gyy, OpticalFlowLkWiden(syy));
+                img += imgStride, dx += dStride, dy += dStride;
+                I += patchStride, Ix += patchStride, Iy += patchStride;
+            }
+            G[0] = OpticalFlowLkSum(gxx);
+            G[1] = OpticalFlowLkSum(gxy);
+            G[2] = OpticalFlowLkSum(gyy);
+        }
+
+        static void OpticalFlowLkResidual(const uint8_t* img, size_t imgStride, const int32_t* weight, size_t window,
+            const int16_t* I, const int16_t* Ix, const int16_t* Iy, size_t patchStride, int64_t* b)
+        {
+            size_t windowHA = AlignHi(window, HA);
+            __m256i _weight[2];
+            OpticalFlowLkSetWeight(weight, _weight);
+            __m256i bx = _mm256_setzero_si256(), by = _mm256_setzero_si256();
+            for (size_t y = 0; y < window; ++y)
+            {
+                __m256i sx = _mm256_setzero_si256(), sy = _mm256_setzero_si256();
+                for (size_t x = 0; x < windowHA; x += HA)
+                {
+                    __m256i diff = _mm256_sub_epi16(OpticalFlowLkSample(img + x, img + imgStride + x, _weight), _mm256_loadu_si256((__m256i*)(I + x)));
+                    sx = _mm256_add_epi32(sx, _mm256_madd_epi16(diff, _mm256_loadu_si256((__m256i*)(Ix + x))));
+                    sy = _mm256_add_epi32(sy, _mm256_madd_epi16(diff, _mm256_loadu_si256((__m256i*)(Iy + x))));
+                }
+                bx = _mm256_add_epi64(bx, OpticalFlowLkWiden(sx));
+                by = _mm256_add_epi64(by, OpticalFlowLkWiden(sy));
+                img += imgStride;
+                I += patchStride, Ix += patchStride, Iy += patchStride;
+            }
+            b[0] = OpticalFlowLkSum(bx);
+            b[1] = OpticalFlowLkSum(by);
+        }
+
+        static void OpticalFlowLkReduce(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t* dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
+        {
+            if (srcWidth >= DA)
+                ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, 1);
+            else if (srcWidth >= Sse41::A)
+                Sse41::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, 1);
+            else
+                Base::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, 1);
+        }
+
+        //---------------------------------------------------------------------
+
+        OpticalFlowLkDefault::OpticalFlowLkDefault(const OpticalFlowLkParam& param)
+            : Sse41::OpticalFlowLkDefault(param)
+        {
+            _reduce = OpticalFlowLkReduce;
+            _sobelDx = SobelDx;
+            _sobelDy = SobelDy;
+            _template = OpticalFlowLkTemplate;
+            _residual = OpticalFlowLkResidual;
+        }
+
+        //---------------------------------------------------------------------
+
+        void* OpticalFlowLkInit(size_t width, size_t height, size_t levels, size_t radius, size_t iterations, float epsilon, float minEigenvalue)
+        {
+            OpticalFlowLkParam param(width, height, levels, radius, iterations, epsilon, minEigenvalue, A);
+            if (!param.Valid())
+                return NULL;
+            return new OpticalFlowLkDefault(param);
+        }
+    }
+#endif
+}
@@ -0,0 +1,163 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2022 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdRemap.h"
+#include "Simd/SimdWarpAffineCommon.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        template<int N, bool soft> void RemapNearestRun(const RemapParam& p, int yBeg, int yEnd, const int32_t* rows, const RemapSpan* spans, const uint32_t* offs, const uint8_t* src, uint8_t* dst)
+        {
+            bool fill = p.NeedFill();
+            __m256i _border = InitBorder<N>(p.border);
+            dst += yBeg * p.dstS;
+            offs += yBeg * p.dstW;
+            for (int y = yBeg; y < yEnd; ++y)
+            {
+                for (int i = rows[y]; i < rows[y + 1]; ++i)
+                {
+                    const RemapSpan& span = spans[i];
+                    if (span.type == RemapSpan::Main)
+                        NearestGather<N, soft>(src, offs + span.beg, span.end - span.beg, dst + span.beg * N);
+                    else if (fill)
+                        FillBorder<N>(dst + span.beg * N, span.end - span.beg, _border, p.border);
+                }
+                dst += p.dstS;
+                offs += p.dstW;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        RemapNearest::RemapNearest(const RemapParam& param)
+            : Sse41::RemapNearest(param)
+        {
+            bool soft = SlowGather;
+            switch (_param.channels)
+            {
+            case 1: _run = soft ? RemapNearestRun<1, true> : RemapNearestRun<1, false>; break;
+            case 2: _run = soft ? RemapNearestRun<2, true> : RemapNearestRun<2, false>; break;
+            case 3: _run = soft ? RemapNearestRun<3, true> : RemapNearestRun<3, false>; break;
+            case 4: _run = soft ? RemapNearestRun<4, true> : RemapNearestRun<4, false>; break;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<int N, bool soft> void RemapByteBilinearRun(const RemapParam& p, int yBeg, int yEnd, const int32_t* rows, const RemapSpan* spans,
+            const uint32_t* offs, const uint8_t* fx, const uint16_t* fy, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            constexpr int M = (N == 3 ? 4 : N);
+            bool fill = p.NeedFill();
+            int s = (int)p.srcS, w = (int)p.srcW - 2, h = (int)p.srcH - 2, n = A / M;
+            uint8_t* rb0 = buf;
+            uint8_t* rb1 = rb0 + AlignHi(p.dstW, p.align) * M * 2;
+            __m256i _border = InitBorder<N>(p.border);
+            dst += yBeg * p.dstS;
+            offs += yBeg * p.dstW;
+            fx += yBeg * p.dstW * 2;
+            fy += yBeg * p.dstW * 2;
+            for (int y = yBeg; y < yEnd; ++y)
+            {
+                for (int i = rows[y]; i < rows[y + 1]; ++i)
+                {
+                    const RemapSpan& span = spans[i];
+                    if (span.type == RemapSpan::Main)
+                    {
+                        int x = span.beg, o = 0, endN = (int)AlignLo(span.end - span.beg, n) + span.beg;
+                        ByteBilinearGather<M, soft>(src, src + s, offs + span.beg, span.end - span.beg, rb0, rb1);
+                        for (; x < endN; x += n, o += n * M * 2)
+                            ByteBilinearInterpMainN<N>(rb0 + o, rb1 + o, fx + 2 * x, fy + 2 * x, dst + x * N);
+                        for (; x < span.end; x += 1, o += M * 2)
+                            Base::ByteBilinearInterpMain<N>(rb0 + o, rb1 + o, fx + 2 * x, fy + 2 * x, dst + x * N);
+                    }
+                    else if (span.type == RemapSpan::Edge)
+                    {
+                        for (int x = span.beg; x < span.end; ++x)
+                            Base::RemapByteBilinearInterpEdge<N>(offs[x], fx + 2 * x, fy + 2 * x, w, h, s, src, fill ? p.border : dst + x * N, dst + x * N);
+                    }
+                    else if (fill)
+                        FillBorder<N>(dst + span.beg * N, span.end - span.beg, _border, p.border);
+                }
+                dst += p.dstS;
+                offs += p.dstW;
+                fx += p.dstW * 2;
+                fy += p.dstW * 2;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        RemapByteBilinear::RemapByteBilinear(const RemapParam& param)
+            : Sse41::RemapByteBilinear(param)
+        {
+            bool soft = SlowGather;
+            switch (_param.channels)
+            {
+            case 1: _run = soft ? RemapByteBilinearRun<1, true> : RemapByteBilinearRun<1, false>; break;
+            case 2: _run = soft ? RemapByteBilinearRun<2, true> : RemapByteBilinearRun<2, false>; break;
+            case 3: _run = soft ? RemapByteBilinearRun<3, true> : RemapByteBilinearRun<3, false>; break;
+            case 4: _run = soft ? RemapByteBilinearRun<4, true> : RemapByteBilinearRun<4, false>; break;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* RemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+            const float* mapX, const float* mapY, size_t mapStride, SimdRemapFlags flags, const uint8_t* border)
+        {
+            RemapParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, flags, border, A);
+            if (!param.Valid())
+                return NULL;
+            Remap* remap = NULL;
+            if (param.IsNearest())
+                remap = new RemapNearest(param);
+            else if (param.IsByteBilinear())
+                remap = new RemapByteBilinear(param);
+            if (remap)
+                remap->SetMap(mapX, mapY, mapStride);
+            return remap;
+        }
+
+        void* RemapInitUndistortion(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+            const float* camera, const float* distortion, SimdRemapFlags flags, const uint8_t* border)
+        {
+            RemapParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, flags, border, A);
+            if (!param.Valid())
+                return NULL;
+            Remap* remap = NULL;
+            if (param.IsNearest())
+                remap = new RemapNearest(param);
+            else if (param.IsByteBilinear())
+                remap = new RemapByteBilinear(param);
+            if (remap)
+                remap->SetUndistortion(camera, distortion);
+            return remap;
+        }
+    }
+#endif
+}
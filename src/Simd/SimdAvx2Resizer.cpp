@@ -54,9 +54,18 @@ namespace Simd
 #endif
             else if (param.IsByteArea1x1())
                 return new ResizerByteArea1x1(param);
+            else if (param.IsByteFilter())
+                return new ResizerByteFilter(param);
+            else if (param.IsFloatFilter())
+                return new ResizerFloatFilter(param);
             else
                 return Sse41::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
         }
+
+        void* ResizerBandInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+        {
+            return Simd::ResizerBandInit(ResizerInit, srcX, srcY, dstX, dstY, channels, type, method);
+        }
     }
 #endif //SIMD_AVX2_ENABLE 
 }
@@ -0,0 +1,81 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdResizer.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        ResizerBatch::ResizerBatch(const ResParam& param, SimdTensorFormatType format)
+            : Sse41::ResizerBatch(param, format)
+        {
+        }
+
+        SIMD_INLINE __m256i ResizerBatchRowY(const int32_t* src0, const int32_t* src1, __m256i fy)
+        {
+            __m256i s0 = _mm256_loadu_si256((__m256i*)src0);
+            __m256i s1 = _mm256_loadu_si256((__m256i*)src1);
+            __m256i sum = _mm256_add_epi32(_mm256_slli_epi32(s0, Base::LINEAR_SHIFT), _mm256_mullo_epi32(_mm256_sub_epi32(s1, s0), fy));
+            return _mm256_srai_epi32(_mm256_add_epi32(sum, _mm256_set1_epi32(Base::BILINEAR_ROUND_TERM)), Base::BILINEAR_SHIFT);
+        }
+
+        void ResizerBatch::ByteRowY(const int32_t* src0, const int32_t* src1, size_t size, int32_t fy, uint8_t* dst)
+        {
+            size_t sizeA = AlignLo(size, A), i = 0;
+            __m256i _fy = _mm256_set1_epi32(fy);
+            for (; i < sizeA; i += A)
+            {
+                __m256i lo = PackI32ToI16(ResizerBatchRowY(src0 + i + 0, src1 + i + 0, _fy), ResizerBatchRowY(src0 + i + 8, src1 + i + 8, _fy));
+                __m256i hi = PackI32ToI16(ResizerBatchRowY(src0 + i + 16, src1 + i + 16, _fy), ResizerBatchRowY(src0 + i + 24, src1 + i + 24, _fy));
+                _mm256_storeu_si256((__m256i*)(dst + i), PackI16ToU8(lo, hi));
+            }
+            if (i < size)
+                Sse41::ResizerBatch::ByteRowY(src0 + i, src1 + i, size - i, fy, dst + i);
+        }
+
+        void ResizerBatch::FloatRowY(const float* src0, const float* src1, size_t size, float fy, float* dst)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __m256 fy1 = _mm256_set1_ps(fy), fy0 = _mm256_set1_ps(1.0f - fy);
+            for (; i < sizeF; i += F)
+                _mm256_storeu_ps(dst + i, _mm256_fmadd_ps(_mm256_loadu_ps(src0 + i), fy0, _mm256_mul_ps(_mm256_loadu_ps(src1 + i), fy1)));
+            if (i < size)
+                Sse41::ResizerBatch::FloatRowY(src0 + i, src1 + i, size - i, fy, dst + i);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ResizerBatchInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method, SimdTensorFormatType format)
+        {
+            if (!Base::ResizerBatchValid(srcX, srcY, dstX, dstY, channels, type, method, format))
+                return NULL;
+            ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(__m256i));
+            return new ResizerBatch(param, format);
+        }
+    }
+#endif
+}
@@ -148,10 +148,10 @@ namespace Simd
             assert(_xn == 0 && _xt == _param.dstW);
             size_t step = 4 / N * 2;
             size_t body = AlignLoAny(_param.dstW - (N == 3 ? 1 : 0), step);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            for (size_t dy = _dyBeg; dy < _dyEnd; dy++, dst += dstStride)
             {
                 size_t sy = _iy[dy];
-                const uint8_t* src1 = src + sy * srcStride;
+                const uint8_t* src1 = src + (sy - _syBeg) * srcStride;
                 const uint8_t* src2 = src1 + srcStride;
                 const uint8_t* src0 = sy ? src1 - srcStride : src1;
                 const uint8_t* src3 = sy < _param.srcH - 2 ? src2 + srcStride : src2;
@@ -265,15 +265,15 @@ namespace Simd
 
         template<int N> void ResizerByteBicubic::RunB(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
         {
-            int32_t prev = -1;
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            int32_t prev = _iy[_dyBeg] - 1;
+            for (size_t dy = _dyBeg; dy < _dyEnd; dy++, dst += dstStride)
             {
                 int32_t sy = _iy[dy], next = prev;
                 for (int32_t curr = sy - 1, end = sy + 3; curr < end; ++curr)
                 {
                     if (curr < prev)
                         continue;
-                    const uint8_t* ps = src + RestrictRange(curr, 0, (int)_param.srcH - 1) * srcStride;
+                    const uint8_t* ps = src + (RestrictRange(curr, 0, (int)_param.srcH - 1) - _syBeg) * srcStride;
                     int32_t* pb = _bx[(curr + 1) & 3].data;
                     RowCubicSumX<N>(ps, _xn, _xt, _param.dstW, _ix.data, _ax.data, pb);
                     next++;
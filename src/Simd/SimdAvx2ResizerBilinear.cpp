@@ -43,6 +43,27 @@ namespace Simd
         {
             if (_ax.data)
                 return;
+            _coefsX = ResizerCacheFind(_param, ResCoefsByteBilinearX8uShuffle32);
+            if (_coefsX)
+            {
+                _coefsX->Share(0, _ax), _coefsX->Share(1, _ix), _coefsX->Share(2, _ixg);
+                _blocks = _coefsX->value;
+            }
+            else
+            {
+                EstimateIndexAlphaX();
+                _coefsX.reset(new ResCoefs());
+                _coefsX->Keep(_ax), _coefsX->Keep(_ix), _coefsX->Keep(_ixg);
+                _coefsX->value = _blocks;
+                ResizerCacheInsert(_param, ResCoefsByteBilinearX8uShuffle32, _coefsX);
+            }
+            size_t size = AlignHi(_param.dstW, _param.align)*_param.channels * 2 + SIMD_ALIGN;
+            _bx[0].Resize(size, false, _param.align);
+            _bx[1].Resize(size, false, _param.align);
+        }
+
+        void ResizerByteBilinear::EstimateIndexAlphaX()
+        {
             if (_param.channels == 1 && _param.srcW < 4 * _param.dstW)
                 _blocks = BlockCountMax(A);
             float scale = (float)_param.srcW / _param.dstW;
@@ -120,9 +141,6 @@ namespace Simd
                     alphas += 2 * _param.channels;
                 }
             }
-            size_t size = AlignHi(_param.dstW, _param.align)*_param.channels * 2 + SIMD_ALIGN;
-            _bx[0].Resize(size, false, _param.align);
-            _bx[1].Resize(size, false, _param.align);
         }
 
         template <size_t channelCount> void ResizerByteBilinearInterpolateX(const __m256i * alpha, __m256i * buffer);
@@ -243,7 +261,7 @@ namespace Simd
             const uint8_t * ax = _ax.data;
             const int32_t * ix = _ix.data;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            for (size_t yDst = _dyBeg; yDst < _dyEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm256_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = _mm256_set1_epi16(int16_t(_ay[yDst]));
@@ -264,7 +282,7 @@ namespace Simd
                 for (; k < 2; k++)
                 {
                     Two * pb = (Two *)bx[k];
-                    const One * psrc = (const One *)(src + (sy + k)*srcStride);
+                    const One * psrc = (const One *)(src + (sy + k - _syBeg)*srcStride);
                     for (size_t x = 0; x < dstW; x++)
                         pb[x] = *(Two *)(psrc + ix[x]);
 
@@ -292,7 +310,7 @@ namespace Simd
             const uint8_t * ax = _ax.data;
             const Idx * ixg = _ixg.data;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            for (size_t yDst = _dyBeg; yDst < _dyEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm256_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = _mm256_set1_epi16(int16_t(_ay[yDst]));
@@ -312,7 +330,7 @@ namespace Simd
 
                 for (; k < 2; k++)
                 {
-                    const uint8_t * psrc = src + (sy + k)*srcStride;
+                    const uint8_t * psrc = src + (sy + k - _syBeg)*srcStride;
                     uint8_t * pdst = bx[k];
                     for (size_t i = 0; i < blocks; ++i)
                         ResizerByteBilinearLoadGrayInterpolated(psrc, ixg[i], ax, pdst);
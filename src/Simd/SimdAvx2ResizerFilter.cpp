@@ -0,0 +1,190 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdLoad.h"
+#include "Simd/SimdFmadd.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        ResizerByteFilter::ResizerByteFilter(const ResParam& param)
+            : Sse41::ResizerByteFilter(param)
+        {
+            if (_param.channels == 1)
+                _alignX = 16;
+        }
+
+        void ResizerByteFilter::RunX(const uint8_t* src, int16_t* dst)
+        {
+            if (_param.channels == 1)
+            {
+                size_t taps = _tx;
+                const int16_t* ax = _ax.data;
+                for (size_t dx = 0; dx < _param.dstW; dx++, ax += taps)
+                {
+                    const uint8_t* s = src + _ix[dx];
+                    __m256i sum = _mm256_setzero_si256();
+                    for (size_t k = 0; k < taps; k += 16)
+                    {
+                        __m256i _s = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(s + k)));
+                        sum = _mm256_add_epi32(sum, _mm256_madd_epi16(_s, _mm256_loadu_si256((__m256i*)(ax + k))));
+                    }
+                    dst[dx] = int16_t(((int32_t)ExtractSum<uint32_t>(sum) + Base::FILTER_X_ROUND) >> Base::FILTER_X_SHIFT);
+                }
+            }
+            else
+                Sse41::ResizerByteFilter::RunX(src, dst);
+        }
+
+        SIMD_INLINE void ByteFilterY(const int16_t* src0, const int16_t* src1, __m256i alpha, __m256i* sums)
+        {
+            __m256i s00 = _mm256_loadu_si256((__m256i*)src0 + 0);
+            __m256i s01 = _mm256_loadu_si256((__m256i*)src0 + 1);
+            __m256i s10 = _mm256_loadu_si256((__m256i*)src1 + 0);
+            __m256i s11 = _mm256_loadu_si256((__m256i*)src1 + 1);
+            sums[0] = _mm256_add_epi32(sums[0], _mm256_madd_epi16(_mm256_unpacklo_epi16(s00, s10), alpha));
+            sums[1] = _mm256_add_epi32(sums[1], _mm256_madd_epi16(_mm256_unpackhi_epi16(s00, s10), alpha));
+            sums[2] = _mm256_add_epi32(sums[2], _mm256_madd_epi16(_mm256_unpacklo_epi16(s01, s11), alpha));
+            sums[3] = _mm256_add_epi32(sums[3], _mm256_madd_epi16(_mm256_unpackhi_epi16(s01, s11), alpha));
+        }
+
+        SIMD_INLINE void ByteFilterY(const int16_t* const* src, size_t n, const int16_t* ay, size_t i, uint8_t* dst)
+        {
+            static const __m256i ROUND = SIMD_MM256_SET1_EPI32(Base::FILTER_Y_ROUND);
+            __m256i sums[4] = { _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256() };
+            size_t k = 0;
+            for (; k + 1 < n; k += 2)
+                ByteFilterY(src[k] + i, src[k + 1] + i, _mm256_set1_epi32(uint16_t(ay[k]) | (int32_t(ay[k + 1]) << 16)), sums);
+            if (k < n)
+                ByteFilterY(src[k] + i, src[k] + i, _mm256_set1_epi32(uint16_t(ay[k])), sums);
+            for (size_t j = 0; j < 4; ++j)
+                sums[j] = _mm256_srai_epi32(_mm256_add_epi32(sums[j], ROUND), Base::FILTER_Y_SHIFT);
+            _mm256_storeu_si256((__m256i*)(dst + i), PackI16ToU8(_mm256_packs_epi32(sums[0], sums[1]), _mm256_packs_epi32(sums[2], sums[3])));
+        }
+
+        void ResizerByteFilter::RunY(const int16_t* const* src, size_t n, const int16_t* ay, uint8_t* dst)
+        {
+            size_t size = _param.dstW * _param.channels, sizeA = AlignLo(size, A);
+            if (sizeA == 0)
+            {
+                Sse41::ResizerByteFilter::RunY(src, n, ay, dst);
+                return;
+            }
+            for (size_t i = 0; i < sizeA; i += A)
+                ByteFilterY(src, n, ay, i, dst);
+            if (sizeA < size)
+                ByteFilterY(src, n, ay, size - A, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ResizerFloatFilter::ResizerFloatFilter(const ResParam& param)
+            : Sse41::ResizerFloatFilter(param)
+        {
+        }
+
+        SIMD_INLINE __m256 FloatFilterX1x8(const float* src, size_t taps, const int32_t* ix, const float* ax)
+        {
+            const float* s0 = src + ix[0], * s1 = src + ix[1], * s2 = src + ix[2], * s3 = src + ix[3];
+            const float* s4 = src + ix[4], * s5 = src + ix[5], * s6 = src + ix[6], * s7 = src + ix[7];
+            const float* a0 = ax, * a1 = a0 + taps, * a2 = a1 + taps, * a3 = a2 + taps;
+            const float* a4 = a3 + taps, * a5 = a4 + taps, * a6 = a5 + taps, * a7 = a6 + taps;
+            __m256 sum = _mm256_setzero_ps();
+            for (size_t k = 0; k < taps; k += 4)
+            {
+                __m256 p0 = _mm256_mul_ps(Load<false>(s0 + k, s4 + k), Load<false>(a0 + k, a4 + k));
+                __m256 p1 = _mm256_mul_ps(Load<false>(s1 + k, s5 + k), Load<false>(a1 + k, a5 + k));
+                __m256 p2 = _mm256_mul_ps(Load<false>(s2 + k, s6 + k), Load<false>(a2 + k, a6 + k));
+                __m256 p3 = _mm256_mul_ps(Load<false>(s3 + k, s7 + k), Load<false>(a3 + k, a7 + k));
+                __m256 t0 = _mm256_unpacklo_ps(p0, p1), t1 = _mm256_unpacklo_ps(p2, p3);
+                __m256 t2 = _mm256_unpackhi_ps(p0, p1), t3 = _mm256_unpackhi_ps(p2, p3);
+                sum = _mm256_add_ps(sum, _mm256_shuffle_ps(t0, t1, 0x44));
+                sum = _mm256_add_ps(sum, _mm256_shuffle_ps(t0, t1, 0xEE));
+                sum = _mm256_add_ps(sum, _mm256_shuffle_ps(t2, t3, 0x44));
+                sum = _mm256_add_ps(sum, _mm256_shuffle_ps(t2, t3, 0xEE));
+            }
+            return sum;
+        }
+
+        void ResizerFloatFilter::RunX(const float* src, float* dst)
+        {
+            size_t width = _param.dstW, taps = _tx;
+            if (_param.channels == 1 && width >= 8)
+            {
+                size_t width8 = AlignLo(width, 8);
+                for (size_t dx = 0; dx < width8; dx += 8)
+                    _mm256_storeu_ps(dst + dx, FloatFilterX1x8(src, taps, _ix.data + dx, _ax.data + dx * taps));
+                if (width8 < width)
+                    _mm256_storeu_ps(dst + width - 8, FloatFilterX1x8(src, taps, _ix.data + width - 8, _ax.data + (width - 8) * taps));
+            }
+            else
+                Sse41::ResizerFloatFilter::RunX(src, dst);
+        }
+
+        SIMD_INLINE __m256 FloatFilterY(const float* const* src, size_t n, const float* ay, size_t i)
+        {
+            __m256 sum = _mm256_setzero_ps();
+            for (size_t k = 0; k < n; ++k)
+                sum = Fmadd<true>(_mm256_loadu_ps(src[k] + i), _mm256_set1_ps(ay[k]), sum);
+            return sum;
+        }
+
+        SIMD_INLINE void FloatFilterY(const float* const* src, size_t n, const float* ay, size_t i, uint16_t* dst)
+        {
+            __m256i val = _mm256_cvtps_epi32(FloatFilterY(src, n, ay, i));
+            val = _mm256_permute4x64_epi64(_mm256_packus_epi32(val, val), 0x08);
+            _mm_storeu_si128((__m128i*)(dst + i), _mm256_castsi256_si128(val));
+        }
+
+        SIMD_INLINE void FloatFilterY(const float* const* src, size_t n, const float* ay, size_t i, float* dst)
+        {
+            _mm256_storeu_ps(dst + i, FloatFilterY(src, n, ay, i));
+        }
+
+        template<class T> void FloatFilterRowY(const float* const* src, size_t n, const float* ay, size_t size, T* dst)
+        {
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                FloatFilterY(src, n, ay, i, dst);
+            if (sizeF < size)
+                FloatFilterY(src, n, ay, size - F, dst);
+        }
+
+        void ResizerFloatFilter::RunY(const float* const* src, size_t n, const float* ay, uint8_t* dst)
+        {
+            size_t size = _param.dstW * _param.channels;
+            if (size < F)
+                Sse41::ResizerFloatFilter::RunY(src, n, ay, dst);
+            else if (_param.type == SimdResizeChannelShort)
+                FloatFilterRowY(src, n, ay, size, (uint16_t*)dst);
+            else
+                FloatFilterRowY(src, n, ay, size, (float*)dst);
+        }
+    }
+#endif
+}
@@ -67,9 +67,9 @@ namespace Simd
         {
             size_t body = AlignLo(_param.dstW, 8);
             size_t tail = _param.dstW - 8;
-            for (size_t dy = 0; dy < _param.dstH; dy++)
+            for (size_t dy = _dyBeg; dy < _dyEnd; dy++)
             {
-                const uint8_t* srcRow = src + _iy[dy] * srcStride;
+                const uint8_t* srcRow = src + (_iy[dy] - _syBeg) * srcStride;
                 for (size_t dx = 0, offs = 0; dx < body; dx += 8, offs += 16)
                     Avx2::Gather8x2(srcRow, _ix.data + dx, dst + offs);
                 Avx2::Gather8x2(srcRow, _ix.data + tail, dst + tail * 2);
@@ -88,9 +88,9 @@ namespace Simd
         {
             size_t body = AlignLo(_param.dstW - 1, 8);
             size_t tail = _param.dstW - 8;
-            for (size_t dy = 0; dy < _param.dstH; dy++)
+            for (size_t dy = _dyBeg; dy < _dyEnd; dy++)
             {
-                const uint8_t* srcRow = src + _iy[dy] * srcStride;
+                const uint8_t* srcRow = src + (_iy[dy] - _syBeg) * srcStride;
                 for (size_t dx = 0, offs = 0; dx < body; dx +=8, offs += 24)
                     _mm256_storeu_si256((__m256i*)(dst + offs), Gather8x3(srcRow, _ix.data + dx));
                 Store24<false>(dst + tail * 3, Gather8x3(srcRow, _ix.data + tail));
@@ -109,9 +109,9 @@ namespace Simd
         {
             size_t body = AlignLo(_param.dstW, 8);
             size_t tail = _param.dstW - 8;
-            for (size_t dy = 0; dy < _param.dstH; dy++)
+            for (size_t dy = _dyBeg; dy < _dyEnd; dy++)
             {
-                const int32_t* srcRow = (int32_t*)(src + _iy[dy] * srcStride);
+                const int32_t* srcRow = (int32_t*)(src + (_iy[dy] - _syBeg) * srcStride);
                 for (size_t dx = 0; dx < body; dx += 8)
                     Avx2::Gather8x4(srcRow, _ix.data + dx, (int32_t*)dst + dx);
                 Avx2::Gather8x4(srcRow, _ix.data + tail, (int32_t*)dst + tail);
@@ -130,9 +130,9 @@ namespace Simd
         {
             size_t body = AlignLo(_param.dstW, 4);
             size_t tail = _param.dstW - 4;
-            for (size_t dy = 0; dy < _param.dstH; dy++)
+            for (size_t dy = _dyBeg; dy < _dyEnd; dy++)
             {
-                const int64_t* srcRow = (int64_t*)(src + _iy[dy] * srcStride);
+                const int64_t* srcRow = (int64_t*)(src + (_iy[dy] - _syBeg) * srcStride);
                 for (size_t dx = 0; dx < body; dx += 4)
                     Avx2::Gather4x8(srcRow, _ix.data + dx, (int64_t*)dst + dx);
                 Avx2::Gather4x8(srcRow, _ix.data + tail, (int64_t*)dst + tail);
@@ -0,0 +1,84 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdAvx2.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        ResizerYuv420::ResizerYuv420(const ResParam& param, SimdPixelFormatType format, SimdYuvType yuvType)
+            : Sse41::ResizerYuv420(param, format, yuvType)
+        {
+            if (_param.dstW >= A)
+                _convert = format == SimdPixelFormatRgb24 ? Avx2::Yuv444pToRgbV2 : Avx2::Yuv444pToBgrV2;
+        }
+
+        SIMD_INLINE __m256i ResizerYuv420RowY(const uint16_t* src0, const uint16_t* src1, __m256i fy0, __m256i fy1)
+        {
+            __m256i s0 = _mm256_mullo_epi16(_mm256_loadu_si256((__m256i*)src0), fy0);
+            __m256i s1 = _mm256_mullo_epi16(_mm256_loadu_si256((__m256i*)src1), fy1);
+            return _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(s0, s1), K16_0080), Base::BILINEAR_SHIFT);
+        }
+
+        SIMD_INLINE void ResizerYuv420RowY(const uint16_t* src0, const uint16_t* src1, __m256i fy0, __m256i fy1, uint8_t* dst)
+        {
+            __m256i lo = ResizerYuv420RowY(src0 + 0, src1 + 0, fy0, fy1);
+            __m256i hi = ResizerYuv420RowY(src0 + HA, src1 + HA, fy0, fy1);
+            _mm256_storeu_si256((__m256i*)dst, PackI16ToU8(lo, hi));
+        }
+
+        void ResizerYuv420::RunY(const uint16_t* src0, const uint16_t* src1, int32_t fy, uint8_t* dst)
+        {
+            size_t width = _param.dstW, widthA = AlignLo(width, A);
+            if (widthA == 0)
+            {
+                Sse41::ResizerYuv420::RunY(src0, src1, fy, dst);
+                return;
+            }
+            __m256i fy0 = _mm256_set1_epi16(Base::FRACTION_RANGE - fy);
+            __m256i fy1 = _mm256_set1_epi16(fy);
+            for (size_t dx = 0; dx < widthA; dx += A)
+                ResizerYuv420RowY(src0 + dx, src1 + dx, fy0, fy1, dst + dx);
+            if (widthA < width)
+            {
+                size_t dx = width - A;
+                ResizerYuv420RowY(src0 + dx, src1 + dx, fy0, fy1, dst + dx);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ResizerYuv420Init(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType format, SimdYuvType yuvType, SimdResizeMethodType method)
+        {
+            if (!Base::ResizerYuv420Valid(srcX, srcY, dstX, dstY, format, yuvType, method))
+                return NULL;
+            ResParam param(srcX, srcY, dstX, dstY, 3, SimdResizeChannelByte, method, sizeof(__m256i));
+            return new ResizerYuv420(param, format, yuvType);
+        }
+    }
+#endif
+}
@@ -0,0 +1,206 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSeparableFilter.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i SepFilterRowInt(const uint8_t* src, size_t channels, const int16_t* kernel, size_t kernelSize)
+        {
+            __m256i sum = _mm256_setzero_si256();
+            for (size_t k = 0; k < kernelSize; ++k, src += channels)
+            {
+                __m256i val = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)src));
+                sum = _mm256_add_epi16(sum, _mm256_mullo_epi16(val, _mm256_set1_epi16(kernel[k])));
+            }
+            return sum;
+        }
+
+        static void SepFilterRowInt(const uint8_t* src, size_t size, size_t channels, const int16_t* kernel, size_t kernelSize, int16_t* dst)
+        {
+            size_t sizeHA = AlignLo(size, HA);
+            for (size_t i = 0; i < sizeHA; i += HA)
+                _mm256_storeu_si256((__m256i*)(dst + i), SepFilterRowInt(src + i, channels, kernel, kernelSize));
+            if (sizeHA < size)
+            {
+                size_t i = size - HA;
+                _mm256_storeu_si256((__m256i*)(dst + i), SepFilterRowInt(src + i, channels, kernel, kernelSize));
+            }
+        }
+
+        SIMD_INLINE __m256i SepFilterColInt(const int16_t* const* src, size_t offset, const int16_t* kernel, size_t kernelSize, __m256i round, int shift)
+        {
+            __m256i lo = _mm256_setzero_si256(), hi = _mm256_setzero_si256();
+            size_t k = 0;
+            for (; k + 1 < kernelSize; k += 2)
+            {
+                __m256i s0 = _mm256_loadu_si256((__m256i*)(src[k + 0] + offset));
+                __m256i s1 = _mm256_loadu_si256((__m256i*)(src[k + 1] + offset));
+                __m256i w = _mm256_unpacklo_epi16(_mm256_set1_epi16(kernel[k + 0]), _mm256_set1_epi16(kernel[k + 1]));
+                lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(s0, s1), w));
+                hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(s0, s1), w));
+            }
+            if (k < kernelSize)
+            {
+                __m256i s0 = _mm256_loadu_si256((__m256i*)(src[k] + offset));
+                __m256i w = _mm256_unpacklo_epi16(_mm256_set1_epi16(kernel[k]), K_ZERO);
+                lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(s0, K_ZERO), w));
+                hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(s0, K_ZERO), w));
+            }
+            lo = _mm256_srai_epi32(_mm256_add_epi32(lo, round), shift);
+            hi = _mm256_srai_epi32(_mm256_add_epi32(hi, round), shift);
+            return _mm256_packs_epi32(lo, hi);
+        }
+
+        SIMD_INLINE void SepFilterColIntStore(__m256i sum, uint8_t* dst)
+        {
+            __m256i u8 = _mm256_permute4x64_epi64(_mm256_packus_epi16(sum, K_ZERO), 0x08);
+            _mm_storeu_si128((__m128i*)dst, _mm256_castsi256_si128(u8));
+        }
+
+        static void SepFilterColInt(const int16_t* const* src, size_t size, const int16_t* kernel, size_t kernelSize, int shift, uint8_t* dst)
+        {
+            __m256i round = _mm256_set1_epi32(shift ? 1 << (shift - 1) : 0);
+            size_t sizeHA = AlignLo(size, HA);
+            for (size_t i = 0; i < sizeHA; i += HA)
+                SepFilterColIntStore(SepFilterColInt(src, i, kernel, kernelSize, round, shift), dst + i);
+            if (sizeHA < size)
+            {
+                size_t i = size - HA;
+                SepFilterColIntStore(SepFilterColInt(src, i, kernel, kernelSize, round, shift), dst + i);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        template<class T> SIMD_INLINE __m256 SepFilterLoad(const T* src);
+
+        template<> SIMD_INLINE __m256 SepFilterLoad(const uint8_t* src)
+        {
+            return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)src)));
+        }
+
+        template<> SIMD_INLINE __m256 SepFilterLoad(const uint16_t* src)
+        {
+            return _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128((__m128i*)src)));
+        }
+
+        template<class T> SIMD_INLINE __m256 SepFilterRowFloat(const T* src, size_t channels, const float* kernel, size_t kernelSize)
+        {
+            __m256 sum = _mm256_setzero_ps();
+            for (size_t k = 0; k < kernelSize; ++k, src += channels)
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(SepFilterLoad(src), _mm256_set1_ps(kernel[k])));
+            return sum;
+        }
+
+        template<class T> void SepFilterRowFloat(const uint8_t* src, size_t size, size_t channels, const float* kernel, size_t kernelSize, float* dst)
+        {
+            const T* s = (const T*)src;
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                _mm256_storeu_ps(dst + i, SepFilterRowFloat(s + i, channels, kernel, kernelSize));
+            if (sizeF < size)
+            {
+                size_t i = size - F;
+                _mm256_storeu_ps(dst + i, SepFilterRowFloat(s + i, channels, kernel, kernelSize));
+            }
+        }
+
+        SIMD_INLINE __m256i SepFilterColFloat(const float* const* src, size_t offset, const float* kernel, size_t kernelSize)
+        {
+            __m256 sum = _mm256_setzero_ps();
+            for (size_t k = 0; k < kernelSize; ++k)
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(src[k] + offset), _mm256_set1_ps(kernel[k])));
+            return _mm256_cvtps_epi32(sum);
+        }
+
+        template<class T> SIMD_INLINE void SepFilterColFloatStore(__m256i value, T* dst);
+
+        template<> SIMD_INLINE void SepFilterColFloatStore(__m256i value, uint8_t* dst)
+        {
+            __m128i i16 = _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packs_epi32(value, K_ZERO), 0x08));
+            _mm_storel_epi64((__m128i*)dst, _mm_packus_epi16(i16, Sse41::K_ZERO));
+        }
+
+        template<> SIMD_INLINE void SepFilterColFloatStore(__m256i value, uint16_t* dst)
+        {
+            __m256i u16 = _mm256_permute4x64_epi64(_mm256_packus_epi32(value, K_ZERO), 0x08);
+            _mm_storeu_si128((__m128i*)dst, _mm256_castsi256_si128(u16));
+        }
+
+        template<class T> void SepFilterColFloat(const float* const* src, size_t size, const float* kernel, size_t kernelSize, uint8_t* dst)
+        {
+            T* d = (T*)dst;
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                SepFilterColFloatStore(SepFilterColFloat(src, i, kernel, kernelSize), d + i);
+            if (sizeF < size)
+            {
+                size_t i = size - F;
+                SepFilterColFloatStore(SepFilterColFloat(src, i, kernel, kernelSize), d + i);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SeparableFilterDefault::SeparableFilterDefault(const SepFilterParam& param)
+            : Sse41::SeparableFilterDefault(param)
+        {
+            if (_alg.size >= HA)
+            {
+                _rowInt = SepFilterRowInt;
+                _colInt = SepFilterColInt;
+            }
+            if (_alg.size >= F)
+            {
+                if (_param.type == SimdSeparableFilterChannel8u)
+                {
+                    _rowFloat = SepFilterRowFloat<uint8_t>;
+                    _colFloat = SepFilterColFloat<uint8_t>;
+                }
+                else
+                {
+                    _rowFloat = SepFilterRowFloat<uint16_t>;
+                    _colFloat = SepFilterColFloat<uint16_t>;
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void* SeparableFilterInit(size_t width, size_t height, size_t channels, SimdSeparableFilterChannelType type,
+            const float* rowKernel, size_t rowSize, const float* colKernel, size_t colSize)
+        {
+            SepFilterParam param(width, height, channels, type, rowKernel, rowSize, colKernel, colSize, A);
+            if (!param.Valid())
+                return NULL;
+            return new SeparableFilterDefault(param);
+        }
+    }
+#endif
+}
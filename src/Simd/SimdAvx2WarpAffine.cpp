@@ -26,6 +26,7 @@
 #include "Simd/SimdCopy.h"
 #include "Simd/SimdUnpack.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdAvx2.h"
 #include "Simd/SimdEnable.h"
 
 #include "Simd/SimdPoint.hpp"
@@ -35,40 +36,6 @@ namespace Simd
 #ifdef SIMD_AVX2_ENABLE
     namespace Avx2
     {
-        template<int N> SIMD_INLINE void FillBorder(uint8_t* dst, int count, const __m256i& bv, const uint8_t* bs)
-        {
-            int i = 0, size = count * N, size16 = (int)AlignLo(size, 16), size32 = (int)AlignLo(size, 32);
-            for (; i < size32; i += 32)
-                _mm256_storeu_si256((__m256i*)(dst + i), bv);
-            for (; i < size16; i += 16)
-                _mm_storeu_si128((__m128i*)(dst + i), _mm256_castsi256_si128(bv));
-            for (; i < size; i += N)
-                Base::CopyPixel<N>(bs, dst + i);
-        }
-
-        template<> SIMD_INLINE void FillBorder<3>(uint8_t* dst, int count, const __m256i& bv, const uint8_t* bs)
-        {
-            int i = 0, size = count * 3, size3 = size - 3;
-            for (; i < size3; i += 3)
-                Base::CopyPixel<4>(bs, dst + i);
-            for (; i < size; i += 3)
-                Base::CopyPixel<3>(bs, dst + i);
-        }
-
-        template<int N> SIMD_INLINE __m256i InitBorder(const uint8_t* border)
-        {
-            switch (N)
-            {
-            case 1: return _mm256_set1_epi8(*border);
-            case 2: return _mm256_set1_epi16(*(uint16_t*)border);
-            case 3: return _mm256_setzero_si256();
-            case 4: return _mm256_set1_epi32(*(uint32_t*)border);
-            }
-            return _mm256_setzero_si256();
-        }
-
-        //-----------------------------------------------------------------------------------------
-
         SIMD_INLINE __m256i NearestOffset(__m256 x, __m256 y, const __m256* m, __m256i w, const __m256i & h, const __m256i & n, const __m256i & s)
         {
             __m256 dx = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m[0]), _mm256_mul_ps(y, m[1])), m[2]);
@@ -80,92 +47,6 @@ namespace Simd
 
         //-----------------------------------------------------------------------------------------
 
-        template<int N, bool soft> SIMD_INLINE void NearestGather(const uint8_t* src, uint32_t* offset, int count, uint8_t* dst)
-        {
-            int i = 0;
-            for (; i < count; i++, dst += N)
-                Base::CopyPixel<N>(src + offset[i], dst);
-        }
-
-        template<> SIMD_INLINE void NearestGather<3, true>(const uint8_t* src, uint32_t* offset, int count, uint8_t* dst)
-        {
-            int i = 0, count1 = count - 1;
-            for (; i < count1; i++, dst += 3)
-                Base::CopyPixel<4>(src + offset[i], dst);
-            if (i < count)
-                Base::CopyPixel<3>(src + offset[i], dst);
-        }
-
-        template<> SIMD_INLINE void NearestGather<1, false>(const uint8_t* src, uint32_t* offset, int count, uint8_t* dst)
-        {
-            static const __m256i SHUFFLE = SIMD_MM256_SETR_EPI8(
-                0x0, 0x4, 0x8, 0xC, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-                0x0, 0x4, 0x8, 0xC, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
-            static const __m256i PERMUTE = SIMD_MM256_SETR_EPI32(0, 4, 0, 0, 0, 0, 0, 0);
-            int i = 0, count8 = (int)AlignLo(count, 8);
-            for (; i < count8; i += 8, dst += 8)
-            {
-                __m256i _offs = _mm256_loadu_si256((__m256i*)(offset + i));
-                __m256i _dst = _mm256_i32gather_epi32((int*)src, _offs, 1);
-                _dst = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(_dst, SHUFFLE), PERMUTE);
-                Sse41::StoreHalf<false>((__m128i*)dst, _mm256_castsi256_si128(_dst));
-            }
-            for (; i < count; i++, dst += 1)
-                Base::CopyPixel<1>(src + offset[i], dst);
-        }
-
-        template<> SIMD_INLINE void NearestGather<2, false>(const uint8_t* src, uint32_t* offset, int count, uint8_t* dst)
-        {
-            static const __m256i SHUFFLE = SIMD_MM256_SETR_EPI8(
-                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1,
-                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1);
-            int i = 0, count8 = (int)AlignLo(count, 8);
-            for (; i < count8; i += 8, dst += 16)
-            {
-                __m256i _offs = _mm256_loadu_si256((__m256i*)(offset + i));
-                __m256i _dst = _mm256_i32gather_epi32((int*)src, _offs, 1);
-                _dst = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(_dst, SHUFFLE), 0x08);
-                Sse41::Store<false>((__m128i*)dst, _mm256_castsi256_si128(_dst));
-            }
-            for (; i < count; i++, dst += 2)
-                Base::CopyPixel<2>(src + offset[i], dst);
-        }
-
-        template<> SIMD_INLINE void NearestGather<3, false>(const uint8_t* src, uint32_t* offset, int count, uint8_t* dst)
-        {
-            static const __m256i SHUFFLE = SIMD_MM256_SETR_EPI8(
-                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
-                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
-            static const __m256i PERMUTE = SIMD_MM256_SETR_EPI32(0, 1, 2, 4, 5, 6, 0, 0);
-            int i = 0, count8 = (int)AlignLo(count, 8), count1 = count - 1;
-            for (; i < count8; i += 8, dst += 24)
-            {
-                __m256i _offs = _mm256_loadu_si256((__m256i*)(offset + i));
-                __m256i _dst = _mm256_i32gather_epi32((int*)src, _offs, 1);
-                _dst = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(_dst, SHUFFLE), PERMUTE);
-                Store24<false>(dst, _dst);
-            }
-            for (; i < count1; i++, dst += 3)
-                Base::CopyPixel<4>(src + offset[i], dst);
-            if (i < count)
-                Base::CopyPixel<3>(src + offset[i], dst);
-        }
-
-        template<> SIMD_INLINE void NearestGather<4, false>(const uint8_t* src, uint32_t* offset, int count, uint8_t* dst)
-        {
-            int i = 0, count8 = (int)AlignLo(count, 8);
-            for (; i < count8; i += 8, dst += 32)
-            {
-                __m256i _offs = _mm256_loadu_si256((__m256i*)(offset + i));
-                __m256i _dst = _mm256_i32gather_epi32((int*)src, _offs, 1);
-                _mm256_storeu_si256((__m256i*)dst, _dst);
-            }
-            for (; i < count; i++, dst += 4)
-                Base::CopyPixel<4>(src + offset[i], dst);
-        }
-
-        //-----------------------------------------------------------------------------------------
-
         template<int N, bool soft> void NearestRun(const WarpAffParam& p, int yBeg, int yEnd, const int32_t* beg, const int32_t* end, const uint8_t* src, uint8_t* dst, uint32_t* buf)
         {
             bool fill = p.NeedFill();
@@ -209,12 +90,16 @@ namespace Simd
             : Sse41::WarpAffineNearest(param)
         {
             bool soft = SlowGather;
-            switch (_param.channels)
+            switch (_param.PixelSize())
             {
             case 1: _run = soft ? NearestRun<1, true> : NearestRun<1, false>; break;
             case 2: _run = soft ? NearestRun<2, true> : NearestRun<2, false>; break;
             case 3: _run = soft ? NearestRun<3, true> : NearestRun<3, false>; break;
             case 4: _run = soft ? NearestRun<4, true> : NearestRun<4, false>; break;
+            case 6: _run = NearestRun<6, true>; break;
+            case 8: _run = NearestRun<8, true>; break;
+            case 12: _run = NearestRun<12, true>; break;
+            case 16: _run = NearestRun<16, true>; break;
             }
         }
 
@@ -306,8 +191,6 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
-        const __m256i K32_WA_FRACTION_RANGE = SIMD_MM256_SET1_EPI32(Base::WA_FRACTION_RANGE);
-
         SIMD_INLINE void ByteBilinearPrepMain8(__m256 x, __m256 y, const __m256* m, __m256i n, const __m256i & s, uint32_t* offs, uint8_t* fx, uint16_t* fy)
         {
             __m256 dx = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m[0]), _mm256_mul_ps(y, m[1])), m[2]);
@@ -326,207 +209,6 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
-        template<int N, bool soft> SIMD_INLINE void ByteBilinearGather(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
-        {
-            int i = 0;
-            for (; i < count; i++, dst0 += 2 * N, dst1 += 2 * N)
-            {
-                int offs = offset[i];
-                Base::CopyPixel<N * 2>(src0 + offs, dst0);
-                Base::CopyPixel<N * 2>(src1 + offs, dst1);
-            }
-        }
-
-        template<> SIMD_INLINE void ByteBilinearGather<1, false>(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
-        {
-            static const __m256i SHUFFLE = SIMD_MM256_SETR_EPI8(
-                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1,
-                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1);
-            int i = 0, count8 = (int)AlignLo(count, 8);
-            for (; i < count8; i += 8, dst0 += 16, dst1 += 16)
-            {
-                __m256i _offs = _mm256_loadu_si256((__m256i*)(offset + i));
-                __m256i _dst0 = _mm256_shuffle_epi8(_mm256_i32gather_epi32((int*)src0, _offs, 1), SHUFFLE);
-                _mm_storeu_si128((__m128i*)dst0, _mm256_castsi256_si128(_mm256_permute4x64_epi64(_dst0, 0x08)));
-                __m256i _dst1 = _mm256_shuffle_epi8(_mm256_i32gather_epi32((int*)src1, _offs, 1), SHUFFLE);
-                _mm_storeu_si128((__m128i*)dst1, _mm256_castsi256_si128(_mm256_permute4x64_epi64(_dst1, 0x08)));
-            }
-            for (; i < count; i++, dst0 += 2, dst1 += 2)
-            {
-                int offs = offset[i];
-                Base::CopyPixel<2>(src0 + offs, dst0);
-                Base::CopyPixel<2>(src1 + offs, dst1);
-            }
-        }
-
-        template<> SIMD_INLINE void ByteBilinearGather<2, false>(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
-        {
-            int i = 0, count8 = (int)AlignLo(count, 8);
-            for (; i < count8; i += 8, dst0 += 32, dst1 += 32)
-            {
-                __m256i _offs = _mm256_loadu_si256((__m256i*)(offset + i));
-                _mm256_storeu_si256((__m256i*)dst0, _mm256_i32gather_epi32((int*)src0, _offs, 1));
-                _mm256_storeu_si256((__m256i*)dst1, _mm256_i32gather_epi32((int*)src1, _offs, 1));
-            }
-            for (; i < count; i++, dst0 += 4, dst1 += 4)
-            {
-                int offs = offset[i];
-                Base::CopyPixel<4>(src0 + offs, dst0);
-                Base::CopyPixel<4>(src1 + offs, dst1);
-            }
-        }
-
-        template<> SIMD_INLINE void ByteBilinearGather<4, false>(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
-        {
-            int i = 0, count4 = (int)AlignLo(count, 4);
-            for (; i < count4; i += 4, dst0 += 32, dst1 += 32)
-            {
-                __m128i _offs = _mm_loadu_si128((__m128i*)(offset + i));
-                _mm256_storeu_si256((__m256i*)dst0, _mm256_i32gather_epi64((long long*)src0, _offs, 1));
-                _mm256_storeu_si256((__m256i*)dst1, _mm256_i32gather_epi64((long long*)src1, _offs, 1));
-            }
-            for (; i < count; i++, dst0 += 8, dst1 += 8)
-            {
-                int offs = offset[i];
-                Base::CopyPixel<8>(src0 + offs, dst0);
-                Base::CopyPixel<8>(src1 + offs, dst1);
-            }
-        }
-
-        //-------------------------------------------------------------------------------------------------
-
-        const __m256i K32_WA_BILINEAR_ROUND_TERM = SIMD_MM256_SET1_EPI32(Base::WA_BILINEAR_ROUND_TERM);
-
-        template<int N> void ByteBilinearInterpMainN(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst);
-
-        template<> SIMD_INLINE void ByteBilinearInterpMainN<1>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
-        {
-            __m256i fx0 = _mm256_loadu_si256((__m256i*)fx + 0);
-            __m256i fx1 = _mm256_loadu_si256((__m256i*)fx + 1);
-            __m256i r00 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)src0 + 0), fx0);
-            __m256i r01 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)src0 + 1), fx1);
-            __m256i r10 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)src1 + 0), fx0);
-            __m256i r11 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)src1 + 1), fx1);
-
-            __m256i s0 = _mm256_madd_epi16(UnpackU16<0>(r00, r10), Load<false>((__m128i*)fy + 0, (__m128i*)fy + 2));
-            __m256i d0 = _mm256_srli_epi32(_mm256_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i s1 = _mm256_madd_epi16(UnpackU16<1>(r00, r10), Load<false>((__m128i*)fy + 1, (__m128i*)fy + 3));
-            __m256i d1 = _mm256_srli_epi32(_mm256_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i s2 = _mm256_madd_epi16(UnpackU16<0>(r01, r11), Load<false>((__m128i*)fy + 4, (__m128i*)fy + 6));
-            __m256i d2 = _mm256_srli_epi32(_mm256_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i s3 = _mm256_madd_epi16(UnpackU16<1>(r01, r11), Load<false>((__m128i*)fy + 5, (__m128i*)fy + 7));
-            __m256i d3 = _mm256_srli_epi32(_mm256_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            _mm256_storeu_si256((__m256i*)dst, PackI16ToU8(_mm256_packus_epi32(d0, d1), _mm256_packus_epi32(d2, d3)));
-        }
-
-        template<> SIMD_INLINE void ByteBilinearInterpMainN<2>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
-        {
-            static const __m256i SHUFFLE = SIMD_MM256_SETR_EPI8(
-                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF,
-                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF);
-
-            __m256i _fx = LoadPermuted<false>((__m256i*)fx);
-            __m256i fx0 = UnpackU16<0>(_fx, _fx);
-            __m256i fx1 = UnpackU16<1>(_fx, _fx);
-            __m256i r00 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 0), SHUFFLE), fx0);
-            __m256i r01 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 1), SHUFFLE), fx1);
-            __m256i r10 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 0), SHUFFLE), fx0);
-            __m256i r11 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 1), SHUFFLE), fx1);
-
-            __m256i fy0 = _mm256_loadu_si256((__m256i*)fy + 0);
-            __m256i s0 = _mm256_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
-            __m256i d0 = _mm256_srli_epi32(_mm256_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i s1 = _mm256_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
-            __m256i d1 = _mm256_srli_epi32(_mm256_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i fy1 = _mm256_loadu_si256((__m256i*)fy + 1);
-            __m256i s2 = _mm256_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
-            __m256i d2 = _mm256_srli_epi32(_mm256_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i s3 = _mm256_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
-            __m256i d3 = _mm256_srli_epi32(_mm256_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            _mm256_storeu_si256((__m256i*)dst, PackI16ToU8(_mm256_packus_epi32(d0, d1), _mm256_packus_epi32(d2, d3)));
-        }
-
-        template<> SIMD_INLINE void ByteBilinearInterpMainN<3>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
-        {
-            static const __m256i SRC_SHUFFLE = SIMD_MM256_SETR_EPI8(
-                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1,
-                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1);
-            static const __m256i DST_SHUFFLE = SIMD_MM256_SETR_EPI8(
-                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
-                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
-            static const __m256i DST_PERMUTE = SIMD_MM256_SETR_EPI32(0, 1, 2, 4, 5, 6, 0, 0);
-
-            __m256i _fx = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((__m256i*)fx), K32_TWO_UNPACK_PERMUTE);
-            _fx = UnpackU16<0>(_fx, _fx);
-            __m256i fx0 = UnpackU16<0>(_fx, _fx);
-            __m256i fx1 = UnpackU16<1>(_fx, _fx);
-            __m256i r00 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 0), SRC_SHUFFLE), fx0);
-            __m256i r01 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 1), SRC_SHUFFLE), fx1);
-            __m256i r10 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 0), SRC_SHUFFLE), fx0);
-            __m256i r11 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 1), SRC_SHUFFLE), fx1);
-
-            __m256i _fy = LoadPermuted<false>((__m256i*)fy);
-            __m256i fy0 = UnpackU32<0>(_fy, _fy);
-            __m256i s0 = _mm256_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
-            __m256i d0 = _mm256_srli_epi32(_mm256_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i s1 = _mm256_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
-            __m256i d1 = _mm256_srli_epi32(_mm256_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i fy1 = UnpackU32<1>(_fy, _fy);
-            __m256i s2 = _mm256_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
-            __m256i d2 = _mm256_srli_epi32(_mm256_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i s3 = _mm256_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
-            __m256i d3 = _mm256_srli_epi32(_mm256_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i _dst = PackI16ToU8(_mm256_packus_epi32(d0, d1), _mm256_packus_epi32(d2, d3));
-            Store24<false>(dst, _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(_dst, DST_SHUFFLE), DST_PERMUTE));
-        }
-
-        template<> SIMD_INLINE void ByteBilinearInterpMainN<4>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
-        {
-            static const __m256i SHUFFLE = SIMD_MM256_SETR_EPI8(
-                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF,
-                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF);
-
-            __m256i _fx = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((__m256i*)fx), K32_TWO_UNPACK_PERMUTE);
-            _fx = UnpackU16<0>(_fx, _fx);
-            __m256i fx0 = UnpackU16<0>(_fx, _fx);
-            __m256i fx1 = UnpackU16<1>(_fx, _fx);
-            __m256i r00 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 0), SHUFFLE), fx0);
-            __m256i r01 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 1), SHUFFLE), fx1);
-            __m256i r10 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 0), SHUFFLE), fx0);
-            __m256i r11 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 1), SHUFFLE), fx1);
-
-            __m256i _fy = LoadPermuted<false>((__m256i*)fy);
-            __m256i fy0 = UnpackU32<0>(_fy, _fy);
-            __m256i s0 = _mm256_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
-            __m256i d0 = _mm256_srli_epi32(_mm256_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i s1 = _mm256_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
-            __m256i d1 = _mm256_srli_epi32(_mm256_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i fy1 = UnpackU32<1>(_fy, _fy);
-            __m256i s2 = _mm256_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
-            __m256i d2 = _mm256_srli_epi32(_mm256_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m256i s3 = _mm256_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
-            __m256i d3 = _mm256_srli_epi32(_mm256_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            _mm256_storeu_si256((__m256i*)dst, PackI16ToU8(_mm256_packus_epi32(d0, d1), _mm256_packus_epi32(d2, d3)));
-        }
-
-        //-------------------------------------------------------------------------------------------------
-
         template<int N, bool soft> void ByteBilinearRun(const WarpAffParam& p, int yBeg, int yEnd, const int* ib, const int* ie, const int* ob, const int* oe, const uint8_t* src, uint8_t* dst, uint8_t* buf)
         {
             constexpr int M = (N == 3 ? 4 : N);
@@ -688,6 +370,186 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        template<class T> SIMD_INLINE void InterpGather2(const uint8_t* src, __m256i offs, __m256& t0, __m256& t1);
+
+        template<> SIMD_INLINE void InterpGather2<float>(const uint8_t* src, __m256i offs, __m256& t0, __m256& t1)
+        {
+            t0 = _mm256_i32gather_ps((float*)src + 0, offs, 1);
+            t1 = _mm256_i32gather_ps((float*)src + 1, offs, 1);
+        }
+
+        template<> SIMD_INLINE void InterpGather2<uint16_t>(const uint8_t* src, __m256i offs, __m256& t0, __m256& t1)
+        {
+            __m256i val = _mm256_i32gather_epi32((int32_t*)src, offs, 1);
+            t0 = _mm256_cvtepi32_ps(_mm256_and_si256(val, K32_0000FFFF));
+            t1 = _mm256_cvtepi32_ps(_mm256_srli_epi32(val, 16));
+        }
+
+        SIMD_INLINE void InterpStore8(__m256 value, float* dst)
+        {
+            _mm256_storeu_ps(dst, value);
+        }
+
+        SIMD_INLINE void InterpStore8(__m256 value, uint16_t* dst)
+        {
+            __m256i u16 = _mm256_permute4x64_epi64(_mm256_packus_epi32(_mm256_cvtps_epi32(value), _mm256_setzero_si256()), 0xD8);
+            _mm_storeu_si128((__m128i*)dst, _mm256_castsi256_si128(u16));
+        }
+
+        SIMD_INLINE void CubicWeights(__m256 d, __m256* w)
+        {
+            __m256 _1 = _mm256_set1_ps(1.0f), _2 = _mm256_set1_ps(2.0f);
+            __m256 nd = _mm256_sub_ps(_mm256_setzero_ps(), d), d1 = _mm256_sub_ps(_1, d), d2 = _mm256_sub_ps(_2, d), dp = _mm256_add_ps(_1, d);
+            w[0] = _mm256_div_ps(_mm256_mul_ps(_mm256_mul_ps(nd, d1), d2), _mm256_set1_ps(6.0f));
+            w[1] = _mm256_div_ps(_mm256_mul_ps(_mm256_mul_ps(d1, dp), d2), _2);
+            w[2] = _mm256_div_ps(_mm256_mul_ps(_mm256_mul_ps(d, dp), d2), _2);
+            w[3] = _mm256_div_ps(_mm256_mul_ps(_mm256_mul_ps(nd, d1), dp), _mm256_set1_ps(6.0f));
+        }
+
+        template<class T, int K> struct Interp1;
+
+        template<class T> struct Interp1<T, 2>
+        {
+            static SIMD_INLINE void Main(const uint8_t* src, int s, const uint32_t* offs, const float* fx, const float* fy, const int32_t* coef, uint8_t* dst)
+            {
+                __m256i o = _mm256_loadu_si256((__m256i*)offs);
+                __m256 t00, t01, t10, t11;
+                InterpGather2<T>(src, o, t00, t01);
+                InterpGather2<T>(src + s, o, t10, t11);
+                __m256 kx1 = _mm256_loadu_ps(fx), kx0 = _mm256_sub_ps(_mm256_set1_ps(1.0f), kx1);
+                __m256 ky1 = _mm256_loadu_ps(fy), ky0 = _mm256_sub_ps(_mm256_set1_ps(1.0f), ky1);
+                __m256 r0 = _mm256_add_ps(_mm256_mul_ps(t00, kx0), _mm256_mul_ps(t01, kx1));
+                __m256 r1 = _mm256_add_ps(_mm256_mul_ps(t10, kx0), _mm256_mul_ps(t11, kx1));
+                InterpStore8(_mm256_add_ps(_mm256_mul_ps(r0, ky0), _mm256_mul_ps(r1, ky1)), (T*)dst);
+            }
+        };
+
+        template<class T> struct Interp1<T, 4>
+        {
+            static SIMD_INLINE __m256 Row(const uint8_t* src, __m256i offs, const __m256* kx)
+            {
+                __m256 t0, t1, t2, t3;
+                InterpGather2<T>(src, offs, t0, t1);
+                InterpGather2<T>(src + 2 * sizeof(T), offs, t2, t3);
+                __m256 sum = _mm256_mul_ps(t0, kx[0]);
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(t1, kx[1]));
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(t2, kx[2]));
+                return _mm256_add_ps(sum, _mm256_mul_ps(t3, kx[3]));
+            }
+
+            static SIMD_INLINE void Main(const uint8_t* src, int s, const uint32_t* offs, const float* fx, const float* fy, const int32_t* coef, uint8_t* dst)
+            {
+                __m256i o = _mm256_loadu_si256((__m256i*)offs);
+                __m256 kx[4], ky[4];
+                CubicWeights(_mm256_loadu_ps(fx), kx);
+                CubicWeights(_mm256_loadu_ps(fy), ky);
+                __m256 sum = _mm256_mul_ps(Row(src + 0 * s, o, kx), ky[0]);
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(Row(src + 1 * s, o, kx), ky[1]));
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(Row(src + 2 * s, o, kx), ky[2]));
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(Row(src + 3 * s, o, kx), ky[3]));
+                InterpStore8(sum, (T*)dst);
+            }
+        };
+
+        template<> struct Interp1<uint8_t, 4>
+        {
+            static SIMD_INLINE __m256i Index(const float* f)
+            {
+                __m256i index = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(f), _mm256_set1_ps((float)Base::WA_BICUBIC_FRACTION_RANGE)));
+                return _mm256_min_epi32(_mm256_max_epi32(index, _mm256_setzero_si256()), _mm256_set1_epi32(Base::WA_BICUBIC_FRACTION_RANGE));
+            }
+
+            static SIMD_INLINE __m256i Row(const uint8_t* src, __m256i offs, __m256i kx)
+            {
+                __m256i taps = _mm256_i32gather_epi32((int32_t*)src, offs, 1);
+                return _mm256_madd_epi16(_mm256_maddubs_epi16(taps, kx), K16_0001);
+            }
+
+            static SIMD_INLINE void Main(const uint8_t* src, int s, const uint32_t* offs, const float* fx, const float* fy, const int32_t* coef, uint8_t* dst)
+            {
+                __m256i o = _mm256_loadu_si256((__m256i*)offs);
+                __m256i kx = _mm256_i32gather_epi32(coef, Index(fx), 4);
+                __m256i iy = _mm256_slli_epi32(Index(fy), 1);
+                __m256i ky01 = _mm256_i32gather_epi32(coef + Base::WA_BICUBIC_FRACTION_RANGE + 1, iy, 4);
+                __m256i ky23 = _mm256_i32gather_epi32(coef + Base::WA_BICUBIC_FRACTION_RANGE + 2, iy, 4);
+                __m256i sum = _mm256_mullo_epi32(Row(src + 0 * s, o, kx), _mm256_srai_epi32(_mm256_slli_epi32(ky01, 16), 16));
+                sum = _mm256_add_epi32(sum, _mm256_mullo_epi32(Row(src + 1 * s, o, kx), _mm256_srai_epi32(ky01, 16)));
+                sum = _mm256_add_epi32(sum, _mm256_mullo_epi32(Row(src + 2 * s, o, kx), _mm256_srai_epi32(_mm256_slli_epi32(ky23, 16), 16)));
+                sum = _mm256_add_epi32(sum, _mm256_mullo_epi32(Row(src + 3 * s, o, kx), _mm256_srai_epi32(ky23, 16)));
+                sum = _mm256_srai_epi32(_mm256_add_epi32(sum, _mm256_set1_epi32(Base::WA_BICUBIC_ROUND_TERM)), Base::WA_BICUBIC_SHIFT);
+                __m256i u8 = _mm256_packus_epi16(_mm256_packs_epi32(sum, _mm256_setzero_si256()), _mm256_setzero_si256());
+                ((int32_t*)dst)[0] = _mm_cvtsi128_si32(_mm256_castsi256_si128(u8));
+                ((int32_t*)dst)[1] = _mm_cvtsi128_si32(_mm256_extracti128_si256(u8, 1));
+            }
+        };
+
+        template<class T, int K> void InterpRun1(const WarpAffParam& p, int yBeg, int yEnd, const int* range, const float* cx, const float* cy, const int32_t* coef, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            const int P = sizeof(T), A = K / 2 - 1;
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW, height = (int)p.dstH, s = (int)p.srcS, w = (int)p.srcW, h = (int)p.srcH, xs = (int)p.CoordStride();
+            const int* ib = range + 0 * height, * ie = range + 1 * height, * ob = range + 2 * height, * oe = range + 3 * height;
+            uint32_t* offs = (uint32_t*)buf;
+            float* fx = (float*)(offs + xs);
+            float* fy = fx + xs;
+            __m256i _border = InitBorder<P>(p.border);
+            __m256i _min = _mm256_set1_epi32(A), _maxX = _mm256_set1_epi32(w - K + A), _maxY = _mm256_set1_epi32(h - K + A);
+            __m256i _p = _mm256_set1_epi32(P), _s = _mm256_set1_epi32(s), _a = _mm256_set1_epi32(A * P + A * s);
+            dst += yBeg * p.dstS;
+            for (int y = yBeg; y < yEnd; ++y)
+            {
+                float yx = cy[2 * y + 0], yy = cy[2 * y + 1];
+                int iB = ib[y], iE = ie[y], oB = ob[y], oE = oe[y];
+                if (fill)
+                    FillBorder<P>(dst, oB, _border, p.border);
+                for (int x = oB; x < iB; ++x)
+                    Base::InterpEdge<T, 1, K>(cx[x] + yx, cx[x + xs] + yy, w, h, s, src, coef, fill ? p.border : dst + x * P, dst + x * P);
+                {
+                    __m256 _yx = _mm256_set1_ps(yx), _yy = _mm256_set1_ps(yy);
+                    for (int x = iB; x < iE; x += 8)
+                    {
+                        __m256 dx = _mm256_add_ps(_mm256_loadu_ps(cx + x), _yx);
+                        __m256 dy = _mm256_add_ps(_mm256_loadu_ps(cx + x + xs), _yy);
+                        __m256i ix = _mm256_min_epi32(_mm256_max_epi32(_mm256_cvtps_epi32(_mm256_floor_ps(dx)), _min), _maxX);
+                        __m256i iy = _mm256_min_epi32(_mm256_max_epi32(_mm256_cvtps_epi32(_mm256_floor_ps(dy)), _min), _maxY);
+                        _mm256_storeu_si256((__m256i*)(offs + x), _mm256_sub_epi32(_mm256_add_epi32(_mm256_mullo_epi32(ix, _p), _mm256_mullo_epi32(iy, _s)), _a));
+                        _mm256_storeu_ps(fx + x, _mm256_sub_ps(dx, _mm256_cvtepi32_ps(ix)));
+                        _mm256_storeu_ps(fy + x, _mm256_sub_ps(dy, _mm256_cvtepi32_ps(iy)));
+                    }
+                    int x = iB, iE8 = iB + (int)AlignLo(iE - iB, 8);
+                    for (; x < iE8; x += 8)
+                        Interp1<T, K>::Main(src, s, offs + x, fx + x, fy + x, coef, dst + x * P);
+                    for (; x < iE; ++x)
+                        Base::Interp<T, 1, K>::Pixel(src + offs[x], s, fx[x], fy[x], coef, dst + x * P);
+                }
+                for (int x = iE; x < oE; ++x)
+                    Base::InterpEdge<T, 1, K>(cx[x] + yx, cx[x + xs] + yy, w, h, s, src, coef, fill ? p.border : dst + x * P, dst + x * P);
+                if (fill)
+                    FillBorder<P>(dst + oE * P, width - oE, _border, p.border);
+                dst += p.dstS;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        WarpAffineInterp::WarpAffineInterp(const WarpAffParam& param)
+            : Sse41::WarpAffineInterp(param)
+        {
+            if (_param.channels == 1 && !SlowGather)
+            {
+                bool cubic = _param.IsBicubic();
+                switch (_param.Channel())
+                {
+                case SimdWarpAffineChannelByte: _run = InterpRun1<uint8_t, 4>; break;
+                case SimdWarpAffineChannelShort: _run = cubic ? InterpRun1<uint16_t, 4> : InterpRun1<uint16_t, 2>; break;
+                case SimdWarpAffineChannelFloat: _run = cubic ? InterpRun1<float, 4> : InterpRun1<float, 2>; break;
+                default: break;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
         void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
         {
             WarpAffParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, mat, flags, border, A);
@@ -698,7 +560,26 @@ namespace Simd
             else if (param.IsByteBilinear())
                 return new WarpAffineByteBilinear(param);
             else
+                return new WarpAffineInterp(param);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        WarpAffineBatch::WarpAffineBatch(const WarpAffParam& param, SimdTensorDataType type, const float* lower, const float* upper)
+            : Base::WarpAffineBatch(param, type, lower, upper)
+        {
+            _warpAffineInit = WarpAffineInit;
+            _synetSetInput = SynetSetInput;
+        }
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border, SimdTensorDataType type, const float* lower, const float* upper)
+        {
+            static const float identity[6] = { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+            WarpAffParam param(srcW, srcH, srcS, dstW, dstH, 0, channels, identity, flags, border, A);
+            param.dstS = dstW * param.PixelSize();
+            if (!Base::WarpAffineBatchValid(param, type, lower, upper))
                 return NULL;
+            return new WarpAffineBatch(param, type, lower, upper);
         }
     }
 #endif
@@ -0,0 +1,211 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdWarpPerspective.h"
+#include "Simd/SimdWarpAffineCommon.h"
+#include "Simd/SimdCopy.h"
+#include "Simd/SimdUnpack.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdAvx2.h"
+#include "Simd/SimdEnable.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        SIMD_INLINE void PerspectiveCoord(const float* cx, size_t xs, const __m256* cy, __m256& dx, __m256& dy)
+        {
+            __m256 dz = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_add_ps(_mm256_loadu_ps(cx + 2 * xs), cy[2]));
+            dx = _mm256_mul_ps(_mm256_add_ps(_mm256_loadu_ps(cx), cy[0]), dz);
+            dy = _mm256_mul_ps(_mm256_add_ps(_mm256_loadu_ps(cx + xs), cy[1]), dz);
+        }
+
+        SIMD_INLINE __m256i PerspNearestOffset(const float* cx, size_t xs, const __m256* cy, __m256i w, const __m256i& h, const __m256i& n, const __m256i& s)
+        {
+            __m256 dx, dy;
+            PerspectiveCoord(cx, xs, cy, dx, dy);
+            __m256i ix = _mm256_min_epi32(_mm256_max_epi32(_mm256_cvtps_epi32(dx), _mm256_setzero_si256()), w);
+            __m256i iy = _mm256_min_epi32(_mm256_max_epi32(_mm256_cvtps_epi32(dy), _mm256_setzero_si256()), h);
+            return _mm256_add_epi32(_mm256_mullo_epi32(ix, n), _mm256_mullo_epi32(iy, s));
+        }
+
+        template<int N, bool soft> void PerspNearestRun(const WarpPersParam& p, int yBeg, int yEnd, const float* cx, const float* cy, const int32_t* beg, const int32_t* end, const uint8_t* src, uint8_t* dst, uint32_t* buf)
+        {
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW, s = (int)p.srcS, w = (int)p.srcW - 1, h = (int)p.srcH - 1;
+            size_t xs = p.CoordStride();
+            __m256 _cy[3];
+            __m256i _w = _mm256_set1_epi32(w);
+            __m256i _h = _mm256_set1_epi32(h);
+            __m256i _n = _mm256_set1_epi32(N);
+            __m256i _s = _mm256_set1_epi32(s);
+            __m256i _border = InitBorder<N>(p.border);
+            dst += yBeg * p.dstS;
+            for (int y = yBeg; y < yEnd; ++y)
+            {
+                const float* cr = cy + 3 * y;
+                for (int i = 0; i < 3; ++i)
+                    _cy[i] = _mm256_set1_ps(cr[i]);
+                int nose = beg[y], tail = end[y];
+                for (int x = nose; x < tail; x += 8)
+                    _mm256_storeu_si256((__m256i*)(buf + x), PerspNearestOffset(cx + x, xs, _cy, _w, _h, _n, _s));
+                if (fill)
+                    FillBorder<N>(dst, nose, _border, p.border);
+                NearestGather<N, soft>(src, buf + nose, tail - nose, dst + N * nose);
+                if (fill)
+                    FillBorder<N>(dst + tail * N, width - tail, _border, p.border);
+                dst += p.dstS;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        WarpPerspectiveNearest::WarpPerspectiveNearest(const WarpPersParam& param)
+            : Sse41::WarpPerspectiveNearest(param)
+        {
+            bool soft = SlowGather;
+            switch (_param.channels)
+            {
+            case 1: _run = soft ? PerspNearestRun<1, true> : PerspNearestRun<1, false>; break;
+            case 2: _run = soft ? PerspNearestRun<2, true> : PerspNearestRun<2, false>; break;
+            case 3: _run = soft ? PerspNearestRun<3, true> : PerspNearestRun<3, false>; break;
+            case 4: _run = soft ? PerspNearestRun<4, true> : PerspNearestRun<4, false>; break;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE void PerspByteBilinearPrepMain8(const float* cx, size_t xs, const __m256* cy, const __m256* wh, __m256i n, const __m256i& s, uint32_t* offs, uint8_t* fx, uint16_t* fy)
+        {
+            __m256 dx, dy;
+            PerspectiveCoord(cx, xs, cy, dx, dy);
+            dx = _mm256_min_ps(_mm256_max_ps(dx, _mm256_setzero_ps()), wh[0]);
+            dy = _mm256_min_ps(_mm256_max_ps(dy, _mm256_setzero_ps()), wh[1]);
+            __m256 ix = _mm256_min_ps(_mm256_floor_ps(dx), wh[2]);
+            __m256 iy = _mm256_min_ps(_mm256_floor_ps(dy), wh[3]);
+            __m256 range = _mm256_cvtepi32_ps(K32_WA_FRACTION_RANGE);
+            __m256i _fx = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_sub_ps(dx, ix), range));
+            __m256i _fy = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_sub_ps(dy, iy), range));
+            _mm256_storeu_si256((__m256i*)offs, _mm256_add_epi32(_mm256_mullo_epi32(_mm256_cvtps_epi32(ix), n), _mm256_mullo_epi32(_mm256_cvtps_epi32(iy), s)));
+            _fx = _mm256_or_si256(_mm256_sub_epi32(K32_WA_FRACTION_RANGE, _fx), _mm256_slli_epi32(_fx, 16));
+            _fy = _mm256_or_si256(_mm256_sub_epi32(K32_WA_FRACTION_RANGE, _fy), _mm256_slli_epi32(_fy, 16));
+            _mm_storeu_si128((__m128i*)fx, _mm256_castsi256_si128(PackI16ToU8(_fx, _mm256_setzero_si256())));
+            _mm256_storeu_si256((__m256i*)fy, _fy);
+        }
+
+        template<int N, bool soft> void PerspByteBilinearRun(const WarpPersParam& p, int yBeg, int yEnd, const float* cx, const float* cy, const int* ib, const int* ie, const int* ob, const int* oe, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            constexpr int M = (N == 3 ? 4 : N);
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW, s = (int)p.srcS, w = (int)p.srcW - 1, h = (int)p.srcH - 1, n = A / M;
+            size_t wa = AlignHi(p.dstW, p.align) + p.align, xs = p.CoordStride();
+            uint32_t* offs = (uint32_t*)buf;
+            uint8_t* fx = (uint8_t*)(offs + wa);
+            uint16_t* fy = (uint16_t*)(fx + wa * 2);
+            uint8_t* rb0 = (uint8_t*)(fy + wa * 2);
+            uint8_t* rb1 = (uint8_t*)(rb0 + wa * M * 2);
+            __m256 _cy[3];
+            __m256 _wh[4];
+            _wh[0] = _mm256_set1_ps((float)w);
+            _wh[1] = _mm256_set1_ps((float)h);
+            _wh[2] = _mm256_set1_ps((float)w - 1.0f);
+            _wh[3] = _mm256_set1_ps((float)h - 1.0f);
+            __m256i _n = _mm256_set1_epi32(N);
+            __m256i _s = _mm256_set1_epi32(s);
+            __m256i _border = InitBorder<N>(p.border);
+            dst += yBeg * p.dstS;
+            for (int y = yBeg; y < yEnd; ++y)
+            {
+                const float* cr = cy + 3 * y;
+                for (int i = 0; i < 3; ++i)
+                    _cy[i] = _mm256_set1_ps(cr[i]);
+                int iB = ib[y], iE = ie[y], oB = ob[y], oE = oe[y];
+                if (fill)
+                {
+                    FillBorder<N>(dst, oB, _border, p.border);
+                    for (int x = oB; x < iB; ++x)
+                        Base::PerspByteBilinearInterpEdge<N>(x, cx, xs, cr, w, h, s, src, p.border, dst + x * N);
+                }
+                else
+                {
+                    for (int x = oB; x < iB; ++x)
+                        Base::PerspByteBilinearInterpEdge<N>(x, cx, xs, cr, w, h, s, src, dst + x * N, dst + x * N);
+                }
+                {
+                    int x = iB, iEn = (int)AlignLo(iE - iB, n) + iB;
+                    for (; x < iE; x += 8)
+                        PerspByteBilinearPrepMain8(cx + x, xs, _cy, _wh, _n, _s, offs + x, fx + 2 * x, fy + 2 * x);
+                    ByteBilinearGather<M, soft>(src, src + s, offs + iB, iE - iB, rb0 + 2 * M * iB, rb1 + 2 * M * iB);
+                    for (x = iB; x < iEn; x += n)
+                        ByteBilinearInterpMainN<N>(rb0 + x * M * 2, rb1 + x * M * 2, fx + 2 * x, fy + 2 * x, dst + x * N);
+                    for (; x < iE; ++x)
+                        Base::ByteBilinearInterpMain<N>(rb0 + x * M * 2, rb1 + x * M * 2, fx + 2 * x, fy + 2 * x, dst + x * N);
+                }
+                if (fill)
+                {
+                    for (int x = iE; x < oE; ++x)
+                        Base::PerspByteBilinearInterpEdge<N>(x, cx, xs, cr, w, h, s, src, p.border, dst + x * N);
+                    FillBorder<N>(dst + oE * N, width - oE, _border, p.border);
+                }
+                else
+                {
+                    for (int x = iE; x < oE; ++x)
+                        Base::PerspByteBilinearInterpEdge<N>(x, cx, xs, cr, w, h, s, src, dst + x * N, dst + x * N);
+                }
+                dst += p.dstS;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        WarpPerspectiveByteBilinear::WarpPerspectiveByteBilinear(const WarpPersParam& param)
+            : Sse41::WarpPerspectiveByteBilinear(param)
+        {
+            bool soft = SlowGather;
+            switch (_param.channels)
+            {
+            case 1: _run = soft ? PerspByteBilinearRun<1, true> : PerspByteBilinearRun<1, false>; break;
+            case 2: _run = soft ? PerspByteBilinearRun<2, true> : PerspByteBilinearRun<2, false>; break;
+            case 3: _run = soft ? PerspByteBilinearRun<3, true> : PerspByteBilinearRun<3, false>; break;
+            case 4: _run = soft ? PerspByteBilinearRun<4, true> : PerspByteBilinearRun<4, false>; break;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            WarpPersParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, mat, flags, border, A);
+            if (!param.Valid())
+                return NULL;
+            if (param.IsNearest())
+                return new WarpPerspectiveNearest(param);
+            else if (param.IsByteBilinear())
+                return new WarpPerspectiveByteBilinear(param);
+            else
+                return NULL;
+        }
+    }
+#endif
+}
@@ -0,0 +1,162 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdBoxFilter.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        SIMD_INLINE void BoxFilterColUpdate8u(__m512i add, __m512i sub, uint32_t* sum, uint32_t* sqsum)
+        {
+            _mm512_storeu_si512(sum, _mm512_add_epi32(_mm512_loadu_si512(sum), _mm512_sub_epi32(add, sub)));
+            if (sqsum)
+            {
+                __m512i sq = _mm512_sub_epi32(_mm512_madd_epi16(add, add), _mm512_madd_epi16(sub, sub));
+                _mm512_storeu_si512(sqsum, _mm512_add_epi32(_mm512_loadu_si512(sqsum), sq));
+            }
+        }
+
+        void BoxFilterColUpdate8u(const uint8_t* add, const uint8_t* sub, size_t size, uint32_t* sum, uint32_t* sqsum)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+            {
+                __m512i _add = _mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i*)(add + i)));
+                __m512i _sub = sub ? _mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i*)(sub + i))) : _mm512_setzero_si512();
+                BoxFilterColUpdate8u(_add, _sub, sum + i, sqsum ? sqsum + i : NULL);
+            }
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                __m512i _add = _mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(tail, add + i));
+                __m512i _sub = sub ? _mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(tail, sub + i)) : _mm512_setzero_si512();
+                _mm512_mask_storeu_epi32(sum + i, tail, _mm512_add_epi32(_mm512_maskz_loadu_epi32(tail, sum + i), _mm512_sub_epi32(_add, _sub)));
+                if (sqsum)
+                {
+                    __m512i sq = _mm512_sub_epi32(_mm512_madd_epi16(_add, _add), _mm512_madd_epi16(_sub, _sub));
+                    _mm512_mask_storeu_epi32(sqsum + i, tail, _mm512_add_epi32(_mm512_maskz_loadu_epi32(tail, sqsum + i), sq));
+                }
+            }
+        }
+
+        SIMD_INLINE void BoxFilterColUpdate32f(__m512d add, __m512d sub, double* sum, double* sqsum, __mmask8 tail = -1)
+        {
+            _mm512_mask_storeu_pd(sum, tail, _mm512_add_pd(_mm512_maskz_loadu_pd(tail, sum), _mm512_sub_pd(add, sub)));
+            if (sqsum)
+                _mm512_mask_storeu_pd(sqsum, tail, _mm512_add_pd(_mm512_maskz_loadu_pd(tail, sqsum), _mm512_sub_pd(_mm512_mul_pd(add, add), _mm512_mul_pd(sub, sub))));
+        }
+
+        static void BoxFilterColUpdate32f(const float* add, const float* sub, size_t size, double* sum, double* sqsum)
+        {
+            const size_t DF = F / 2;
+            size_t sizeDF = AlignLo(size, DF), i = 0;
+            for (; i < sizeDF; i += DF)
+            {
+                __m512d _add = _mm512_cvtps_pd(_mm256_loadu_ps(add + i));
+                __m512d _sub = sub ? _mm512_cvtps_pd(_mm256_loadu_ps(sub + i)) : _mm512_setzero_pd();
+                BoxFilterColUpdate32f(_add, _sub, sum + i, sqsum ? sqsum + i : NULL);
+            }
+            if (i < size)
+            {
+                __mmask8 tail = __mmask8(TailMask16(size - i));
+                __m512d _add = _mm512_cvtps_pd(_mm256_maskz_loadu_ps(tail, add + i));
+                __m512d _sub = sub ? _mm512_cvtps_pd(_mm256_maskz_loadu_ps(tail, sub + i)) : _mm512_setzero_pd();
+                BoxFilterColUpdate32f(_add, _sub, sum + i, sqsum ? sqsum + i : NULL, tail);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void BoxFilterRow8u(const uint32_t* sum, const uint32_t* sqsum, size_t step, __m512 norm, uint8_t* mean, float* var, __mmask16 tail = -1)
+        {
+            __m512i s = _mm512_sub_epi32(_mm512_maskz_loadu_epi32(tail, sum + step), _mm512_maskz_loadu_epi32(tail, sum));
+            __m512 m = _mm512_mul_ps(_mm512_cvtepi32_ps(s), norm);
+            if (var)
+            {
+                __m512i q = _mm512_sub_epi32(_mm512_maskz_loadu_epi32(tail, sqsum + step), _mm512_maskz_loadu_epi32(tail, sqsum));
+                _mm512_mask_storeu_ps(var, tail, _mm512_max_ps(_mm512_sub_ps(_mm512_mul_ps(_mm512_cvtepi32_ps(q), norm), _mm512_mul_ps(m, m)), _mm512_setzero_ps()));
+            }
+            __m512i i32 = _mm512_cvttps_epi32(_mm512_add_ps(m, _mm512_set1_ps(0.5f)));
+            _mm_mask_storeu_epi8(mean, tail, _mm512_cvtusepi32_epi8(_mm512_max_epi32(i32, _mm512_setzero_si512())));
+        }
+
+        static void BoxFilterRow8u(const uint32_t* sum, const uint32_t* sqsum, size_t size, size_t step, float norm, uint8_t* mean, float* var)
+        {
+            __m512 _norm = _mm512_set1_ps(norm);
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                BoxFilterRow8u(sum + i, sqsum ? sqsum + i : NULL, step, _norm, mean + i, var ? var + i : NULL);
+            if (i < size)
+                BoxFilterRow8u(sum + i, sqsum ? sqsum + i : NULL, step, _norm, mean + i, var ? var + i : NULL, TailMask16(size - i));
+        }
+
+        SIMD_INLINE void BoxFilterRow32f(const double* sum, const double* sqsum, size_t step, __m512d norm, float* mean, float* var, __mmask8 tail = -1)
+        {
+            __m512d m = _mm512_mul_pd(_mm512_sub_pd(_mm512_maskz_loadu_pd(tail, sum + step), _mm512_maskz_loadu_pd(tail, sum)), norm);
+            if (var)
+            {
+                __m512d q = _mm512_sub_pd(_mm512_maskz_loadu_pd(tail, sqsum + step), _mm512_maskz_loadu_pd(tail, sqsum));
+                __m512d v = _mm512_sub_pd(_mm512_mul_pd(q, norm), _mm512_mul_pd(m, m));
+                _mm256_mask_storeu_ps(var, tail, _mm512_cvtpd_ps(_mm512_max_pd(v, _mm512_setzero_pd())));
+            }
+            _mm256_mask_storeu_ps(mean, tail, _mm512_cvtpd_ps(m));
+        }
+
+        static void BoxFilterRow32f(const double* sum, const double* sqsum, size_t size, size_t step, double norm, float* mean, float* var)
+        {
+            const size_t DF = F / 2;
+            __m512d _norm = _mm512_set1_pd(norm);
+            size_t sizeDF = AlignLo(size, DF), i = 0;
+            for (; i < sizeDF; i += DF)
+                BoxFilterRow32f(sum + i, sqsum ? sqsum + i : NULL, step, _norm, mean + i, var ? var + i : NULL);
+            if (i < size)
+                BoxFilterRow32f(sum + i, sqsum ? sqsum + i : NULL, step, _norm, mean + i, var ? var + i : NULL, __mmask8(TailMask16(size - i)));
+        }
+
+        //---------------------------------------------------------------------
+
+        BoxFilterDefault::BoxFilterDefault(const BoxFilterParam& param)
+            : Avx2::BoxFilterDefault(param)
+        {
+            _colUpdate8u = BoxFilterColUpdate8u;
+            _colUpdate32f = BoxFilterColUpdate32f;
+            _row8u = BoxFilterRow8u;
+            _row32f = BoxFilterRow32f;
+        }
+
+        //---------------------------------------------------------------------
+
+        void* BoxFilterInit(size_t width, size_t height, size_t channels, SimdBoxFilterChannelType type, size_t radiusX, size_t radiusY)
+        {
+            BoxFilterParam param(width, height, channels, type, radiusX, radiusY, A);
+            if (!param.Valid())
+                return NULL;
+            return new BoxFilterDefault(param);
+        }
+    }
+#endif
+}
@@ -0,0 +1,140 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdCanny.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        const __m512i K16_CANNY_TAN = SIMD_MM512_SET1_EPI16(Base::CANNY_TAN_22_5);
+        const __m512i K8_CANNY_EDGE = SIMD_MM512_SET1_EPI8(Base::CannyMapEdge);
+
+        SIMD_INLINE void CannyMagnitude(const int16_t* dx, const int16_t* dy, int16_t* mag, __mmask32 tail = -1)
+        {
+            __m512i _dx = _mm512_abs_epi16(_mm512_maskz_loadu_epi16(tail, dx));
+            __m512i _dy = _mm512_abs_epi16(_mm512_maskz_loadu_epi16(tail, dy));
+            _mm512_mask_storeu_epi16(mag, tail, _mm512_add_epi16(_dx, _dy));
+        }
+
+        static void CannyMagnitude(const int16_t* dx, const int16_t* dy, size_t width, int16_t* mag)
+        {
+            size_t widthHA = AlignLo(width, HA), x = 0;
+            __mmask32 tail = TailMask32(width - widthHA);
+            for (; x < widthHA; x += HA)
+                CannyMagnitude(dx + x, dy + x, mag + x);
+            if (x < width)
+                CannyMagnitude(dx + x, dy + x, mag + x, tail);
+        }
+
+        SIMD_INLINE __m512i CannyTan(__m512i a)
+        {
+            __mmask32 exact = _mm512_cmpeq_epi16_mask(_mm512_mullo_epi16(a, K16_CANNY_TAN), K_ZERO);
+            return _mm512_mask_add_epi16(_mm512_mulhi_epu16(a, K16_CANNY_TAN), ~exact, _mm512_mulhi_epu16(a, K16_CANNY_TAN), K16_0001);
+        }
+
+        SIMD_INLINE __mmask32 CannyNms(const int16_t* dx, const int16_t* dy, const int16_t* mag0, const int16_t* mag1, const int16_t* mag2, __m512i low, __m512i high, __mmask32 tail, __mmask32& strong)
+        {
+            __m512i _dx = _mm512_maskz_loadu_epi16(tail, dx);
+            __m512i _dy = _mm512_maskz_loadu_epi16(tail, dy);
+            __m512i ax = _mm512_abs_epi16(_dx), ay = _mm512_abs_epi16(_dy);
+            __mmask32 hor = _mm512_cmpgt_epi16_mask(CannyTan(ax), ay);
+            __mmask32 ver = _mm512_cmpgt_epi16_mask(CannyTan(ay), ax);
+            __mmask32 neg = _mm512_movepi16_mask(_mm512_xor_si512(_dx, _dy));
+            __m512i a = _mm512_mask_blend_epi16(neg, _mm512_maskz_loadu_epi16(tail, mag0 - 1), _mm512_maskz_loadu_epi16(tail, mag0 + 1));
+            __m512i b = _mm512_mask_blend_epi16(neg, _mm512_maskz_loadu_epi16(tail, mag2 + 1), _mm512_maskz_loadu_epi16(tail, mag2 - 1));
+            a = _mm512_mask_blend_epi16(hor, a, _mm512_maskz_loadu_epi16(tail, mag1 - 1));
+            b = _mm512_mask_blend_epi16(hor, b, _mm512_sub_epi16(_mm512_maskz_loadu_epi16(tail, mag1 + 1), K16_0001));
+            a = _mm512_mask_blend_epi16(ver, a, _mm512_maskz_loadu_epi16(tail, mag0));
+            b = _mm512_mask_blend_epi16(ver, b, _mm512_sub_epi16(_mm512_maskz_loadu_epi16(tail, mag2), K16_0001));
+            __m512i m = _mm512_maskz_loadu_epi16(tail, mag1);
+            __mmask32 max = _mm512_cmpgt_epi16_mask(m, low) & _mm512_cmpgt_epi16_mask(m, a) & _mm512_cmpgt_epi16_mask(m, b);
+            strong = max & _mm512_cmpgt_epi16_mask(m, high);
+            return max;
+        }
+
+        SIMD_INLINE void CannyNms(const int16_t* dx, const int16_t* dy, const int16_t* mag0, const int16_t* mag1, const int16_t* mag2, __m512i low, __m512i high, uint8_t* map, __mmask32 tail = -1)
+        {
+            __mmask32 strong, max = CannyNms(dx, dy, mag0, mag1, mag2, low, high, tail, strong);
+            __m256i value = _mm256_add_epi8(_mm256_maskz_mov_epi8(max, Avx2::K8_01), _mm256_maskz_mov_epi8(strong, Avx2::K8_01));
+            _mm256_mask_storeu_epi8(map, tail, value);
+        }
+
+        static void CannyNms(const int16_t* dx, const int16_t* dy, const int16_t* mag0, const int16_t* mag1, const int16_t* mag2, size_t width, int16_t low, int16_t high, uint8_t* map)
+        {
+            size_t widthHA = AlignLo(width, HA), x = 0;
+            __mmask32 tail = TailMask32(width - widthHA);
+            __m512i _low = _mm512_set1_epi16(low), _high = _mm512_set1_epi16(high);
+            for (; x < widthHA; x += HA)
+                CannyNms(dx + x, dy + x, mag0 + x, mag1 + x, mag2 + x, _low, _high, map + x);
+            if (x < width)
+                CannyNms(dx + x, dy + x, mag0 + x, mag1 + x, mag2 + x, _low, _high, map + x, tail);
+        }
+
+        SIMD_INLINE void CannyOutput(const uint8_t* map, uint8_t* dst, __mmask64 tail = -1)
+        {
+            __mmask64 edge = _mm512_cmpeq_epi8_mask(_mm512_maskz_loadu_epi8(tail, map), K8_CANNY_EDGE);
+            _mm512_mask_storeu_epi8(dst, tail, _mm512_maskz_mov_epi8(edge, K_INV_ZERO));
+        }
+
+        static void CannyOutput(const uint8_t* map, size_t width, uint8_t* dst)
+        {
+            size_t widthA = AlignLo(width, A), x = 0;
+            __mmask64 tail = TailMask64(width - widthA);
+            for (; x < widthA; x += A)
+                CannyOutput(map + x, dst + x);
+            if (x < width)
+                CannyOutput(map + x, dst + x, tail);
+        }
+
+        //---------------------------------------------------------------------
+
+        CannyDefault::CannyDefault(const CannyParam& param)
+            : Avx2::CannyDefault(param)
+        {
+            if (_param.width > A)
+            {
+                _sobelDx = Avx512bw::SobelDx;
+                _sobelDy = Avx512bw::SobelDy;
+            }
+            _magnitude = CannyMagnitude;
+            _nms = CannyNms;
+            _output = CannyOutput;
+        }
+
+        //---------------------------------------------------------------------
+
+        void* CannyInit(size_t width, size_t height, float lowThreshold, float highThreshold)
+        {
+            CannyParam param(width, height, lowThreshold, highThreshold);
+            if (!param.Valid())
+                return NULL;
+            return new CannyDefault(param);
+        }
+    }
+#endif
+}
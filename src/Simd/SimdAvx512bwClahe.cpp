@@ -0,0 +1,86 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdClahe.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        SIMD_INLINE __m512i ClaheLerp(__m512i a, __m512i b, __m512i w)
+        {
+            return _mm512_add_epi32(_mm512_slli_epi32(a, Base::CLAHE_SHIFT), _mm512_mullo_epi32(_mm512_sub_epi32(b, a), w));
+        }
+
+        SIMD_INLINE void ClaheInterpolate16(const uint8_t* src, const int32_t* ix0, const int32_t* ix1, const int32_t* wx,
+            const int32_t* lut0, const int32_t* lut1, __m512i wy, uint8_t* dst, __mmask16 tail = -1)
+        {
+            __m512i v = _mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(tail, src));
+            __m512i i0 = _mm512_add_epi32(_mm512_maskz_loadu_epi32(tail, ix0), v);
+            __m512i i1 = _mm512_add_epi32(_mm512_maskz_loadu_epi32(tail, ix1), v);
+            __m512i _wx = _mm512_maskz_loadu_epi32(tail, wx);
+            __m512i a = _mm512_mask_i32gather_epi32(K_ZERO, tail, i0, lut0, 4);
+            __m512i b = _mm512_mask_i32gather_epi32(K_ZERO, tail, i1, lut0, 4);
+            __m512i c = _mm512_mask_i32gather_epi32(K_ZERO, tail, i0, lut1, 4);
+            __m512i d = _mm512_mask_i32gather_epi32(K_ZERO, tail, i1, lut1, 4);
+            __m512i top = ClaheLerp(a, b, _wx);
+            __m512i bot = ClaheLerp(c, d, _wx);
+            __m512i sum = _mm512_add_epi32(ClaheLerp(top, bot, wy), _mm512_set1_epi32(Base::CLAHE_ROUND));
+            _mm512_mask_cvtusepi32_storeu_epi8(dst, tail, _mm512_srli_epi32(sum, 2 * Base::CLAHE_SHIFT));
+        }
+
+        static void ClaheInterpolate(const uint8_t* src, size_t width, const int32_t* ix0, const int32_t* ix1, const int32_t* wx,
+            const int32_t* lut0, const int32_t* lut1, int32_t wy, uint8_t* dst)
+        {
+            size_t width16 = AlignLo(width, 16), x = 0;
+            __mmask16 tail = TailMask16(width - width16);
+            __m512i _wy = _mm512_set1_epi32(wy);
+            for (; x < width16; x += 16)
+                ClaheInterpolate16(src + x, ix0 + x, ix1 + x, wx + x, lut0, lut1, _wy, dst + x);
+            if (x < width)
+                ClaheInterpolate16(src + x, ix0 + x, ix1 + x, wx + x, lut0, lut1, _wy, dst + x, tail);
+        }
+
+        //---------------------------------------------------------------------
+
+        ClaheDefault::ClaheDefault(const ClaheParam& param)
+            : Avx2::ClaheDefault(param)
+        {
+            _interpolate = ClaheInterpolate;
+        }
+
+        //---------------------------------------------------------------------
+
+        void* ClaheInit(size_t width, size_t height, size_t tilesX, size_t tilesY, float clipLimit)
+        {
+            ClaheParam param(width, height, tilesX, tilesY, clipLimit);
+            if (!param.Valid())
+                return NULL;
+            return new ClaheDefault(param);
+        }
+    }
+#endif
+}
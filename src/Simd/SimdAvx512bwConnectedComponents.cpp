@@ -0,0 +1,75 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdConnectedComponents.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        SIMD_INLINE int32_t* ConnectedComponentsRuns(const uint8_t* mask, size_t x, __m512i index, uint32_t& inside, int32_t* runs, __mmask64 tail = -1)
+        {
+            __mmask64 bits = _mm512_cmpeq_epi8_mask(_mm512_maskz_loadu_epi8(tail, mask + x), index) & tail;
+            runs = Base::ConnectedComponentsEdges<32>(uint32_t(bits), int32_t(x), inside, runs);
+            return Base::ConnectedComponentsEdges<32>(uint32_t(bits >> 32), int32_t(x + 32), inside, runs);
+        }
+
+        static size_t ConnectedComponentsRuns(const uint8_t* mask, size_t width, uint8_t index, int32_t* runs)
+        {
+            size_t widthA = AlignLo(width, A), x = 0;
+            __mmask64 tail = TailMask64(width - widthA);
+            __m512i _index = _mm512_set1_epi8(index);
+            uint32_t inside = 0;
+            int32_t* end = runs;
+            for (; x < widthA; x += A)
+                end = ConnectedComponentsRuns(mask, x, _index, inside, end);
+            if (x < width)
+                end = ConnectedComponentsRuns(mask, x, _index, inside, end, tail);
+            if (inside)
+                *end++ = int32_t(width);
+            return (end - runs) / 2;
+        }
+
+        //---------------------------------------------------------------------
+
+        ConnectedComponentsDefault::ConnectedComponentsDefault(const ConnectedComponentsParam& param)
+            : Avx2::ConnectedComponentsDefault(param)
+        {
+            _runs = ConnectedComponentsRuns;
+        }
+
+        //---------------------------------------------------------------------
+
+        void* ConnectedComponentsInit(size_t width, size_t height, SimdConnectivityType connectivity, SimdBool moments)
+        {
+            ConnectedComponentsParam param(width, height, connectivity, moments);
+            if (!param.Valid())
+                return NULL;
+            return new ConnectedComponentsDefault(param);
+        }
+    }
+#endif
+}
@@ -0,0 +1,209 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdDistanceTransform.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        SIMD_INLINE __m512i Load(const int32_t* src, __mmask16 tail = -1)
+        {
+            return _mm512_maskz_loadu_epi32(tail, src);
+        }
+
+        SIMD_INLINE __mmask16 DistanceMask(const uint8_t* mask, __m512i index, __mmask16 tail = -1)
+        {
+            return _mm512_cmpeq_epi32_mask(_mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(tail, mask)), index);
+        }
+
+        //---------------------------------------------------------------------
+
+        template<bool root> SIMD_INLINE __m512 DistanceValue(const int32_t* src, __m512 scale, __mmask16 tail = -1)
+        {
+            __m512 value = _mm512_cvtepi32_ps(Load(src, tail));
+            if (root)
+                value = _mm512_sqrt_ps(value);
+            return _mm512_div_ps(value, scale);
+        }
+
+        template<bool root> SIMD_INLINE void DistanceStore32f(const int32_t* src, __m512 scale, float* dst, __mmask16 tail = -1)
+        {
+            _mm512_mask_storeu_ps(dst, tail, DistanceValue<root>(src, scale, tail));
+        }
+
+        template<bool root> SIMD_INLINE void DistanceStore16u(const int32_t* src, __m512 scale, uint16_t* dst, __mmask16 tail = -1)
+        {
+            __m512 value = _mm512_min_ps(_mm512_add_ps(DistanceValue<root>(src, scale, tail), _mm512_set1_ps(0.5f)), _mm512_set1_ps(65535.0f));
+            _mm512_mask_cvtusepi32_storeu_epi16(dst, tail, _mm512_cvttps_epi32(value));
+        }
+
+        template<bool root> void DistanceConvert32f(const int32_t* src, size_t width, float scale, uint8_t* dst)
+        {
+            size_t widthF = AlignLo(width, F);
+            __mmask16 tail = TailMask16(width - widthF);
+            float* _dst = (float*)dst;
+            __m512 _scale = _mm512_set1_ps(scale);
+            size_t x = 0;
+            for (; x < widthF; x += F)
+                DistanceStore32f<root>(src + x, _scale, _dst + x);
+            if (x < width)
+                DistanceStore32f<root>(src + x, _scale, _dst + x, tail);
+        }
+
+        template<bool root> void DistanceConvert16u(const int32_t* src, size_t width, float scale, uint8_t* dst)
+        {
+            size_t widthF = AlignLo(width, F);
+            __mmask16 tail = TailMask16(width - widthF);
+            uint16_t* _dst = (uint16_t*)dst;
+            __m512 _scale = _mm512_set1_ps(scale);
+            size_t x = 0;
+            for (; x < widthF; x += F)
+                DistanceStore16u<root>(src + x, _scale, _dst + x);
+            if (x < width)
+                DistanceStore16u<root>(src + x, _scale, _dst + x, tail);
+        }
+
+        template<bool root> Base::DistanceConvertPtr GetDistanceConvert(SimdDistanceTransformDataType data)
+        {
+            return data == SimdDistanceTransform32f ? DistanceConvert32f<root> : DistanceConvert16u<root>;
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void DistanceEdtFirst(const uint8_t* mask, __m512i index, __m512i limit, int32_t* dst, __mmask16 tail = -1)
+        {
+            _mm512_mask_storeu_epi32(dst, tail, _mm512_maskz_mov_epi32(~DistanceMask(mask, index, tail), limit));
+        }
+
+        SIMD_INLINE void DistanceEdtDown(const uint8_t* mask, __m512i index, __m512i limit, const int32_t* up, int32_t* dst, __mmask16 tail = -1)
+        {
+            __m512i _up = _mm512_min_epi32(_mm512_add_epi32(Load(up, tail), K32_00000001), limit);
+            _mm512_mask_storeu_epi32(dst, tail, _mm512_maskz_mov_epi32(~DistanceMask(mask, index, tail), _up));
+        }
+
+        SIMD_INLINE void DistanceEdtUp(const int32_t* down, int32_t* dst, __mmask16 tail = -1)
+        {
+            _mm512_mask_storeu_epi32(dst, tail, _mm512_min_epi32(Load(dst, tail), _mm512_add_epi32(Load(down, tail), K32_00000001)));
+        }
+
+        static void DistanceEdtColumns(const uint8_t* mask, size_t maskStride, size_t width, size_t height,
+            uint8_t index, int32_t limit, int32_t* dst, size_t dstStride)
+        {
+            size_t widthF = AlignLo(width, F), x;
+            __mmask16 tail = TailMask16(width - widthF);
+            __m512i _index = _mm512_set1_epi32(index), _limit = _mm512_set1_epi32(limit);
+            for (x = 0; x < widthF; x += F)
+                DistanceEdtFirst(mask + x, _index, _limit, dst + x);
+            if (x < width)
+                DistanceEdtFirst(mask + x, _index, _limit, dst + x, tail);
+            for (size_t y = 1; y < height; ++y)
+            {
+                const uint8_t* m = mask + y * maskStride;
+                const int32_t* up = dst + (y - 1) * dstStride;
+                int32_t* g = dst + y * dstStride;
+                for (x = 0; x < widthF; x += F)
+                    DistanceEdtDown(m + x, _index, _limit, up + x, g + x);
+                if (x < width)
+                    DistanceEdtDown(m + x, _index, _limit, up + x, g + x, tail);
+            }
+            for (size_t y = height - 1; y > 0; --y)
+            {
+                const int32_t* down = dst + y * dstStride;
+                int32_t* g = dst + (y - 1) * dstStride;
+                for (x = 0; x < widthF; x += F)
+                    DistanceEdtUp(down + x, g + x);
+                if (x < width)
+                    DistanceEdtUp(down + x, g + x, tail);
+            }
+        }
+
+        DistanceTransformEdt::DistanceTransformEdt(const DistanceTransformParam& param)
+            : Avx2::DistanceTransformEdt(param)
+        {
+            _columns = DistanceEdtColumns;
+            _convert = GetDistanceConvert<true>(_param.data);
+        }
+
+        //---------------------------------------------------------------------
+
+        static void DistanceChamferInit(const uint8_t* mask, size_t width, uint8_t index, int32_t* dst)
+        {
+            size_t widthF = AlignLo(width, F), x = 0;
+            __mmask16 tail = TailMask16(width - widthF);
+            __m512i _index = _mm512_set1_epi32(index), inf = _mm512_set1_epi32(Base::DISTANCE_CHAMFER_INF);
+            for (; x < widthF; x += F)
+                DistanceEdtFirst(mask + x, _index, inf, dst + x);
+            if (x < width)
+                DistanceEdtFirst(mask + x, _index, inf, dst + x, tail);
+        }
+
+        template<int size> SIMD_INLINE void DistanceChamferMin(const int32_t* row1, const int32_t* row2, __m512i a, __m512i b, __m512i c, int32_t* dst, __mmask16 tail = -1)
+        {
+            __m512i d = _mm512_min_epi32(Load(dst, tail), _mm512_add_epi32(Load(row1, tail), a));
+            d = _mm512_min_epi32(d, _mm512_add_epi32(_mm512_min_epi32(Load(row1 - 1, tail), Load(row1 + 1, tail)), b));
+            if (size == 5)
+            {
+                d = _mm512_min_epi32(d, _mm512_add_epi32(_mm512_min_epi32(Load(row1 - 2, tail), Load(row1 + 2, tail)), c));
+                d = _mm512_min_epi32(d, _mm512_add_epi32(_mm512_min_epi32(Load(row2 - 1, tail), Load(row2 + 1, tail)), c));
+            }
+            _mm512_mask_storeu_epi32(dst, tail, d);
+        }
+
+        template<int size> void DistanceChamferRow(const int32_t* row1, const int32_t* row2, size_t width, const int32_t* weights, int32_t* dst)
+        {
+            size_t widthF = AlignLo(width, F), x = 0;
+            __mmask16 tail = TailMask16(width - widthF);
+            __m512i a = _mm512_set1_epi32(weights[0]), b = _mm512_set1_epi32(weights[1]), c = _mm512_set1_epi32(weights[2]);
+            for (; x < widthF; x += F)
+                DistanceChamferMin<size>(row1 + x, row2 + x, a, b, c, dst + x);
+            if (x < width)
+                DistanceChamferMin<size>(row1 + x, row2 + x, a, b, c, dst + x, tail);
+        }
+
+        DistanceTransformChamfer::DistanceTransformChamfer(const DistanceTransformParam& param)
+            : Avx2::DistanceTransformChamfer(param)
+        {
+            _init = DistanceChamferInit;
+            _row = _param.type == SimdDistanceTransformChamfer3x3 ? DistanceChamferRow<3> : DistanceChamferRow<5>;
+            _convert = GetDistanceConvert<false>(_param.data);
+        }
+
+        //---------------------------------------------------------------------
+
+        void* DistanceTransformInit(size_t width, size_t height, SimdDistanceTransformType type, SimdDistanceTransformDataType data)
+        {
+            DistanceTransformParam param(width, height, type, data);
+            if (!param.Valid())
+                return NULL;
+            if (type == SimdDistanceTransformEuclidean)
+                return new DistanceTransformEdt(param);
+            else
+                return new DistanceTransformChamfer(param);
+        }
+    }
+#endif
+}
@@ -25,6 +25,7 @@
 #include "Simd/SimdLoadBlock.h"
 #include "Simd/SimdStore.h"
 #include "Simd/SimdGaussianBlur.h"
+#include "Simd/SimdFmadd.h"
 #include "Simd/SimdUnpack.h"
 
 namespace Simd
@@ -37,7 +38,17 @@ namespace Simd
             return _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(tail, src)));
         }
 
-        SIMD_INLINE void BlurColsAny(const uint8_t* src, size_t size, __mmask16 tail, size_t channels, const float* weight, size_t kernel, float* dst)
+        SIMD_INLINE __m512 LoadAs32f(const uint16_t* src, __mmask16 tail = -1)
+        {
+            return _mm512_cvtepi32_ps(_mm512_cvtepu16_epi32(_mm256_maskz_loadu_epi16(tail, src)));
+        }
+
+        SIMD_INLINE __m512 LoadAs32f(const float* src, __mmask16 tail = -1)
+        {
+            return _mm512_maskz_loadu_ps(tail, src);
+        }
+
+        template<class T> SIMD_INLINE void BlurColsAny(const T* src, size_t size, __mmask16 tail, size_t channels, const float* weight, size_t kernel, float* dst)
         {
             size_t sizeF = AlignLo(size, F);
             size_t i = 0;
@@ -57,18 +68,18 @@ namespace Simd
             }
         }
 
-        SIMD_INLINE void StoreAs8u(uint8_t* dst, const __m512& f0, __mmask16 tail = -1)
+        SIMD_INLINE void StoreAs(uint8_t* dst, const __m512& f0, __mmask16 tail = -1)
         {
 #if 0
             __m512i i0 = _mm512_cvtps_epi32(f0);
             __m512i u8 = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, _mm512_packus_epi16(_mm512_packs_epi32(i0, K_ZERO), K_ZERO));
             _mm_mask_storeu_epi8(dst, tail, _mm512_extracti32x4_epi32(u8, 0));
 #else
-            _mm_mask_storeu_epi8(dst, tail, _mm512_cvtusepi32_epi8(_mm512_cvtps_epi32(f0)));
+            _mm_mask_storeu_epi8(dst, tail, _mm512_cvtusepi32_epi8(_mm512_max_epi32(_mm512_cvtps_epi32(f0), K_ZERO)));
 #endif
         }
 
-        SIMD_INLINE void StoreAs8u(uint8_t* dst, const __m512& f0, const __m512& f1, const __m512& f2, const __m512& f3)
+        SIMD_INLINE void StoreAs(uint8_t* dst, const __m512& f0, const __m512& f1, const __m512& f2, const __m512& f3)
         {
             __m512i i0 = _mm512_cvtps_epi32(f0);
             __m512i i1 = _mm512_cvtps_epi32(f1);
@@ -77,7 +88,31 @@ namespace Simd
             _mm512_storeu_si512(dst, _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, _mm512_packus_epi16(_mm512_packs_epi32(i0, i1), _mm512_packs_epi32(i2, i3))));
         }
 
-        SIMD_INLINE void BlurRowsAny(const float* src, size_t size, __mmask16 tail, size_t stride, const float* weight, size_t kernel, uint8_t* dst)
+        SIMD_INLINE void StoreAs(uint16_t* dst, const __m512& f0, __mmask16 tail = -1)
+        {
+            _mm256_mask_storeu_epi16(dst, tail, _mm512_cvtusepi32_epi16(_mm512_max_epi32(_mm512_cvtps_epi32(f0), K_ZERO)));
+        }
+
+        SIMD_INLINE void StoreAs(uint16_t* dst, const __m512& f0, const __m512& f1, const __m512& f2, const __m512& f3)
+        {
+            _mm512_storeu_si512(dst + 0 * F, PackU32ToI16(_mm512_cvtps_epi32(f0), _mm512_cvtps_epi32(f1)));
+            _mm512_storeu_si512(dst + 2 * F, PackU32ToI16(_mm512_cvtps_epi32(f2), _mm512_cvtps_epi32(f3)));
+        }
+
+        SIMD_INLINE void StoreAs(float* dst, const __m512& f0, __mmask16 tail = -1)
+        {
+            _mm512_mask_storeu_ps(dst, tail, f0);
+        }
+
+        SIMD_INLINE void StoreAs(float* dst, const __m512& f0, const __m512& f1, const __m512& f2, const __m512& f3)
+        {
+            _mm512_storeu_ps(dst + 0 * F, f0);
+            _mm512_storeu_ps(dst + 1 * F, f1);
+            _mm512_storeu_ps(dst + 2 * F, f2);
+            _mm512_storeu_ps(dst + 3 * F, f3);
+        }
+
+        template<class T> SIMD_INLINE void BlurRowsAny(const float* src, size_t size, __mmask16 tail, size_t stride, const float* weight, size_t kernel, T* dst)
         {
             size_t sizeA = AlignLo(size, A);
             size_t sizeF = AlignLo(size, F);
@@ -97,60 +132,42 @@ namespace Simd
                     sum2 = _mm512_fmadd_ps(w, _mm512_loadu_ps(ps + 2 * F), sum2);
                     sum3 = _mm512_fmadd_ps(w, _mm512_loadu_ps(ps + 3 * F), sum3);
                 }
-                StoreAs8u(dst + i, sum0, sum1, sum2, sum3);
+                StoreAs(dst + i, sum0, sum1, sum2, sum3);
             }
             for (; i < sizeF; i += F)
             {
                 __m512 sum = _mm512_setzero_ps();
                 for (size_t k = 0; k < kernel; ++k)
                     sum = _mm512_fmadd_ps(_mm512_set1_ps(weight[k]), _mm512_loadu_ps(src + i + k * stride), sum);
-                StoreAs8u(dst + i, sum);
+                StoreAs(dst + i, sum);
             }
             if (i < size)
             {
                 __m512 sum = _mm512_setzero_ps();
                 for (size_t k = 0; k < kernel; ++k)
                     sum = _mm512_fmadd_ps(_mm512_set1_ps(weight[k]), _mm512_loadu_ps(src + i + k * stride), sum);
-                StoreAs8u(dst + i, sum, tail);
+                StoreAs(dst + i, sum, tail);
             }
         }
 
-        template<int channels> void BlurImageAny(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
+        template<class T, int channels> void BlurImageAny(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, 
+            size_t yBeg, size_t yEnd, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
         {
             __mmask16 tail = TailMask16(a.size - AlignLo(a.size, F));
-            Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-            BlurColsAny(cols, a.size, tail, p.channels, a.weight.data, a.kernel, rows + a.half * a.stride);
-            for (size_t row = 0; row < a.half; ++row)
-                memcpy(rows + row * a.stride, rows + a.half * a.stride, a.size * sizeof(float));
-            for (size_t row = 1; row < a.nose; ++row)
+            ptrdiff_t beg = yBeg - a.half, end = yEnd + a.half, last = p.height - 1;
+            for (ptrdiff_t sy = beg; sy < end; ++sy)
             {
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurColsAny(cols, a.size, tail, p.channels, a.weight.data, a.kernel, rows + (a.half + row) * a.stride);
-            }
-            for (size_t row = a.nose; row <= a.half; ++row)
-                memcpy(rows + (a.half + row) * a.stride, rows + (a.half + a.nose - 1) * a.stride, a.size * sizeof(float));
-            BlurRowsAny(rows, a.size, tail, a.stride, a.weight.data, a.kernel, dst), dst += dstStride;
-
-            for (size_t row = 1, b = row % a.kernel + 2 * a.half, w = a.kernel - row % a.kernel; row < a.body; ++row, ++b, --w)
-            {
-                if (b >= a.kernel)
-                    b -= a.kernel;
-                if (w == 0)
-                    w += a.kernel;
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurColsAny(cols, a.size, tail, p.channels, a.weight.data, a.kernel, rows + b * a.stride);
-                BlurRowsAny(rows, a.size, tail, a.stride, a.weight.data + w, a.kernel, dst), dst += dstStride;
-            }
-
-            size_t last = (a.body + 2 * a.half - 1) % a.kernel;
-            for (size_t row = a.body, b = row % a.kernel + 2 * a.half, w = a.kernel - row % a.kernel; row < p.height; ++row, ++b, --w)
-            {
-                if (b >= a.kernel)
-                    b -= a.kernel;
-                if (w == 0)
-                    w += a.kernel;
-                memcpy(rows + b * a.stride, rows + last * a.stride, a.size * sizeof(float));
-                BlurRowsAny(rows, a.size, tail, a.stride, a.weight.data + w, a.kernel, dst), dst += dstStride;
+                float* row = rows + (sy + a.half) % a.kernel * a.stride;
+                if (sy > beg && (sy <= 0 || sy > last))
+                    memcpy(row, rows + (sy + a.half - 1) % a.kernel * a.stride, a.size * sizeof(float));
+                else
+                {
+                    Base::PadCols<int(channels * sizeof(T))>(src + Simd::RestrictRange<ptrdiff_t>(sy, 0, last) * srcStride, a.half, a.size * sizeof(T), cols);
+                    BlurColsAny((T*)cols, a.size, tail, channels, a.weight.data, a.kernel, row);
+                }
+                ptrdiff_t y = sy - a.half;
+                if (y >= (ptrdiff_t)yBeg)
+                    BlurRowsAny(rows, a.size, tail, a.stride, a.weight.data + a.kernel - y % a.kernel, a.kernel, (T*)(dst + y * dstStride));
             }
         }
 
@@ -253,60 +270,42 @@ namespace Simd
                     sum2 = _mm512_fmadd_ps(w[k], _mm512_loadu_ps(ps + 2 * F), sum2);
                     sum3 = _mm512_fmadd_ps(w[k], _mm512_loadu_ps(ps + 3 * F), sum3);
                 }
-                StoreAs8u(dst + i, sum0, sum1, sum2, sum3);
+                StoreAs(dst + i, sum0, sum1, sum2, sum3);
             }
             for (; i < sizeF; i += F)
             {
                 __m512 sum = _mm512_setzero_ps();
                 for (size_t k = 0; k < kernel; ++k)
                     sum = _mm512_fmadd_ps(w[k], _mm512_loadu_ps(src + i + k * stride), sum);
-                StoreAs8u(dst + i, sum);
+                StoreAs(dst + i, sum);
             }
             if (i < size)
             {
                 __m512 sum = _mm512_setzero_ps();
                 for (size_t k = 0; k < kernel; ++k)
                     sum = _mm512_fmadd_ps(w[k], _mm512_maskz_loadu_ps(tail, src + i + k * stride), sum);
-                StoreAs8u(dst + i, sum, tail);
+                StoreAs(dst + i, sum, tail);
             }
         }
 
-        template<int channels, int kernel> void BlurImage(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
+        template<int channels, int kernel> void BlurImage(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, 
+            size_t yBeg, size_t yEnd, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
         {
             __mmask16 tail = TailMask16(a.size - AlignLo(a.size, F));
-            Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-            BlurCols<kernel>(cols, a.size, tail, p.channels, a.weight.data, rows + a.half * a.stride);
-            for (size_t row = 0; row < a.half; ++row)
-                memcpy(rows + row * a.stride, rows + a.half * a.stride, a.size * sizeof(float));
-            for (size_t row = 1; row < a.nose; ++row)
-            {
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurCols<kernel>(cols, a.size, tail, p.channels, a.weight.data, rows + (a.half + row) * a.stride);
-            }
-            for (size_t row = a.nose; row <= a.half; ++row)
-                memcpy(rows + (a.half + row) * a.stride, rows + (a.half + a.nose - 1) * a.stride, a.size * sizeof(float));
-            BlurRows<kernel>(rows, a.size, tail, a.stride, a.weight.data, dst), dst += dstStride;
-
-            for (size_t row = 1, b = row % a.kernel + 2 * a.half, w = kernel - row % kernel; row < a.body; ++row, ++b, --w)
-            {
-                if (b >= kernel)
-                    b -= kernel;
-                if (w == 0)
-                    w += kernel;
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurCols<kernel>(cols, a.size, tail, p.channels, a.weight.data, rows + b * a.stride);
-                BlurRows<kernel>(rows, a.size, tail, a.stride, a.weight.data + w, dst), dst += dstStride;
-            }
-
-            size_t last = (a.body + 2 * a.half - 1) % kernel;
-            for (size_t row = a.body, b = row % kernel + 2 * a.half, w = kernel - row % kernel; row < p.height; ++row, ++b, --w)
+            ptrdiff_t beg = yBeg - a.half, end = yEnd + a.half, last = p.height - 1;
+            for (ptrdiff_t sy = beg; sy < end; ++sy)
             {
-                if (b >= kernel)
-                    b -= kernel;
-                if (w == 0)
-                    w += kernel;
-                memcpy(rows + b * a.stride, rows + last * a.stride, a.size * sizeof(float));
-                BlurRows<kernel>(rows, a.size, tail, a.stride, a.weight.data + w, dst), dst += dstStride;
+                float* row = rows + (sy + a.half) % kernel * a.stride;
+                if (sy > beg && (sy <= 0 || sy > last))
+                    memcpy(row, rows + (sy + a.half - 1) % kernel * a.stride, a.size * sizeof(float));
+                else
+                {
+                    Base::PadCols<channels>(src + Simd::RestrictRange<ptrdiff_t>(sy, 0, last) * srcStride, a.half, a.size, cols);
+                    BlurCols<kernel>(cols, a.size, tail, p.channels, a.weight.data, row);
+                }
+                ptrdiff_t y = sy - a.half;
+                if (y >= (ptrdiff_t)yBeg)
+                    BlurRows<kernel>(rows, a.size, tail, a.stride, a.weight.data + kernel - y % kernel, dst + y * dstStride);
             }
         }
 
@@ -314,13 +313,19 @@ namespace Simd
 
         template<int channels> Base::BlurDefaultPtr GetBlurDefaultPtr(const BlurParam& p, const Base::AlgDefault& a)
         {
+            switch (p.type)
+            {
+            case SimdGaussianBlurChannel16u: return BlurImageAny<uint16_t, channels>;
+            case SimdGaussianBlurChannel32f: return BlurImageAny<float, channels>;
+            default: break;
+            }
             switch (a.kernel)
             {
             case 3: return BlurImage<channels, 3>;
             case 5: return BlurImage<channels, 5>;
             case 7: return BlurImage<channels, 7>;
             case 9: return BlurImage<channels, 9>;
-            default: return BlurImageAny<channels>;
+            default: return BlurImageAny<uint8_t, channels>;
             }
         }
 
@@ -340,6 +345,109 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        SIMD_INLINE void IirForward(const __m512* k, float* w0, const float* w1, const float* w2, const float* w3, __mmask16 tail = -1)
+        {
+            __m512 sum = Fmadd<true>(k[0], _mm512_maskz_loadu_ps(tail, w0), k[1], _mm512_maskz_loadu_ps(tail, w1));
+            sum = Fmadd<true>(k[2], _mm512_maskz_loadu_ps(tail, w2), sum);
+            sum = Fmadd<true>(k[3], _mm512_maskz_loadu_ps(tail, w3), sum);
+            _mm512_mask_storeu_ps(w0, tail, sum);
+        }
+
+        SIMD_INLINE __m512 IirInit(const __m512* m, const __m512& e, const __m512& u0, const __m512& u1, const __m512& u2)
+        {
+            return Fmadd<true>(m[2], u2, Fmadd<true>(m[1], u1, Fmadd<true>(m[0], u0, e)));
+        }
+
+        template<class T> SIMD_INLINE void IirInit(const __m512* m, float* y0, const float* w1, const float* w2,
+            const float* last, float* next1, float* next2, T* dst, __mmask16 tail = -1)
+        {
+            __m512 e = _mm512_maskz_loadu_ps(tail, last);
+            __m512 u0 = _mm512_sub_ps(_mm512_maskz_loadu_ps(tail, y0), e);
+            __m512 u1 = _mm512_sub_ps(_mm512_maskz_loadu_ps(tail, w1), e);
+            __m512 u2 = _mm512_sub_ps(_mm512_maskz_loadu_ps(tail, w2), e);
+            __m512 v0 = IirInit(m + 0, e, u0, u1, u2);
+            _mm512_mask_storeu_ps(y0, tail, v0);
+            _mm512_mask_storeu_ps(next1, tail, IirInit(m + 3, e, u0, u1, u2));
+            _mm512_mask_storeu_ps(next2, tail, IirInit(m + 6, e, u0, u1, u2));
+            StoreAs(dst, v0, tail);
+        }
+
+        template<class T> SIMD_INLINE void IirBackward(const __m512* k, float* y0, const float* y1, const float* y2, const float* y3, T* dst, __mmask16 tail = -1)
+        {
+            __m512 sum = Fmadd<true>(k[0], _mm512_maskz_loadu_ps(tail, y0), k[1], _mm512_maskz_loadu_ps(tail, y1));
+            sum = Fmadd<true>(k[2], _mm512_maskz_loadu_ps(tail, y2), sum);
+            sum = Fmadd<true>(k[3], _mm512_maskz_loadu_ps(tail, y3), sum);
+            _mm512_mask_storeu_ps(y0, tail, sum);
+            StoreAs(dst, sum, tail);
+        }
+
+        template<class T> void BlurIirVer(const Base::AlgIir& a, size_t size, size_t height, float* img, size_t stride, float* buf, uint8_t* dst, size_t dstStride)
+        {
+            size_t sizeF = AlignLo(size, F), i;
+            __mmask16 tail = TailMask16(size - sizeF);
+            __m512 k[4], m[9];
+            k[0] = _mm512_set1_ps(a.b);
+            k[1] = _mm512_set1_ps(a.a1);
+            k[2] = _mm512_set1_ps(a.a2);
+            k[3] = _mm512_set1_ps(a.a3);
+            for (size_t j = 0; j < 9; ++j)
+                m[j] = _mm512_set1_ps(a.m[j]);
+            float* first = buf, * last = buf + size, * next1 = buf + 2 * size, * next2 = buf + 3 * size;
+            memcpy(first, img, size * sizeof(float));
+            memcpy(last, img + (height - 1) * stride, size * sizeof(float));
+            for (ptrdiff_t y = 0; y < (ptrdiff_t)height; ++y)
+            {
+                float* w0 = img + y * stride;
+                const float* w1 = y > 0 ? w0 - stride : first;
+                const float* w2 = y > 1 ? w0 - 2 * stride : first;
+                const float* w3 = y > 2 ? w0 - 3 * stride : first;
+                for (i = 0; i < sizeF; i += F)
+                    IirForward(k, w0 + i, w1 + i, w2 + i, w3 + i);
+                if (i < size)
+                    IirForward(k, w0 + i, w1 + i, w2 + i, w3 + i, tail);
+            }
+            {
+                ptrdiff_t y = height - 1;
+                float* y0 = img + y * stride;
+                const float* w1 = y > 0 ? y0 - stride : first;
+                const float* w2 = y > 1 ? y0 - 2 * stride : first;
+                T* d = (T*)(dst + y * dstStride);
+                for (i = 0; i < sizeF; i += F)
+                    IirInit(m, y0 + i, w1 + i, w2 + i, last + i, next1 + i, next2 + i, d + i);
+                if (i < size)
+                    IirInit(m, y0 + i, w1 + i, w2 + i, last + i, next1 + i, next2 + i, d + i, tail);
+            }
+            for (ptrdiff_t y = height - 2; y >= 0; --y)
+            {
+                float* y0 = img + y * stride;
+                const float* y1 = y0 + stride;
+                const float* y2 = y + 2 < (ptrdiff_t)height ? y0 + 2 * stride : next1;
+                const float* y3 = y + 3 < (ptrdiff_t)height ? y0 + 3 * stride : (y + 3 == (ptrdiff_t)height ? next1 : next2);
+                T* d = (T*)(dst + y * dstStride);
+                for (i = 0; i < sizeF; i += F)
+                    IirBackward(k, y0 + i, y1 + i, y2 + i, y3 + i, d + i);
+                if (i < size)
+                    IirBackward(k, y0 + i, y1 + i, y2 + i, y3 + i, d + i, tail);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        GaussianBlurIir::GaussianBlurIir(const BlurParam& param)
+            : Avx2::GaussianBlurIir(param)
+        {
+            switch (_param.type)
+            {
+            case SimdGaussianBlurChannel8u: _ver = BlurIirVer<uint8_t>; break;
+            case SimdGaussianBlurChannel16u: _ver = BlurIirVer<uint16_t>; break;
+            case SimdGaussianBlurChannel32f: _ver = BlurIirVer<float>; break;
+            default:
+                assert(0);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon)
         {
             BlurParam param(width, height, channels, sigma, epsilon, A);
@@ -348,6 +456,17 @@ namespace Simd
             return new GaussianBlurDefault(param);
         }
 
+        void* GaussianBlurInitEx(size_t width, size_t height, size_t channels, SimdGaussianBlurChannelType type,
+            const float* sigma, const float* epsilon, SimdGaussianBlurMethod method)
+        {
+            BlurParam param(width, height, channels, type, sigma, epsilon, method, A);
+            if (!param.Valid())
+                return NULL;
+            if (param.Iir())
+                return new GaussianBlurIir(param);
+            return new GaussianBlurDefault(param);
+        }
+
         //---------------------------------------------------------------------
 
         namespace
@@ -102,6 +102,7 @@ namespace Simd
             case SimdImageFilePpmBin: return new ImagePpmBinSaver(param);
             case SimdImageFilePng: return new ImagePngSaver(param);
             case SimdImageFileJpeg: return new ImageJpegSaver(param);
+            case SimdImageFileQoi: return new Avx2::ImageQoiSaver(param);
             default:
                 return NULL;
             }
@@ -121,6 +122,25 @@ namespace Simd
             }
             return NULL;
         }
+
+        SimdBool ImageSaveToFile(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, const char* path)
+        {
+            return Simd::ImageSaveToFile(CreateImageSaver, src, stride, width, height, format, file, quality, path);
+        }
+
+        void* ImageSaveBandInit(size_t width, size_t height, SimdPixelFormatType format, int quality, const char* path)
+        {
+            ImageSaverParam param(width, height, format, SimdImageFileJpeg, quality);
+            if (!param.Validate())
+                return NULL;
+            ImageJpegSaver* saver = new ImageJpegSaver(param);
+            if (!saver->Open(path))
+            {
+                delete saver;
+                return NULL;
+            }
+            return saver;
+        }
     }
 #endif// SIMD_AVX512BW_ENABLE
 }
@@ -0,0 +1,80 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdLocalBinarization.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdFmadd.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        SIMD_INLINE void LocalBinarization16(const uint32_t* sum, const uint32_t* sqsum, size_t step, const __m512* alg,
+            const uint8_t* src, __m128i positive, __m128i negative, uint8_t* dst, __mmask16 tail = -1)
+        {
+            __m512i s = _mm512_sub_epi32(_mm512_maskz_loadu_epi32(tail, sum + step), _mm512_maskz_loadu_epi32(tail, sum));
+            __m512i q = _mm512_sub_epi32(_mm512_maskz_loadu_epi32(tail, sqsum + step), _mm512_maskz_loadu_epi32(tail, sqsum));
+            __m512 mean = _mm512_mul_ps(_mm512_cvtepi32_ps(s), alg[0]);
+            __m512 var = Fmadd<true>(_mm512_cvtepi32_ps(q), alg[0], mean, _mm512_sub_ps(_mm512_setzero_ps(), mean));
+            __m512 dev = _mm512_sqrt_ps(_mm512_max_ps(var, _mm512_setzero_ps()));
+            __m512 threshold = Fmadd<true>(mean, Fmadd<true>(alg[2], dev, alg[1]), alg[3], dev);
+            __m512 value = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(tail, src)));
+            __mmask16 mask = _mm512_cmp_ps_mask(value, threshold, _CMP_GT_OQ);
+            _mm_mask_storeu_epi8(dst, tail, _mm_mask_blend_epi8(mask, negative, positive));
+        }
+
+        static void LocalBinarizationRow(const uint32_t* sum, const uint32_t* sqsum, size_t width, const Base::LocalBinarizationAlg& alg,
+            const uint8_t* src, uint8_t positive, uint8_t negative, uint8_t* dst)
+        {
+            __m512 _alg[4] = { _mm512_set1_ps(alg.norm), _mm512_set1_ps(alg.alpha), _mm512_set1_ps(alg.beta), _mm512_set1_ps(alg.gamma) };
+            __m128i _positive = _mm_set1_epi8(positive), _negative = _mm_set1_epi8(negative);
+            size_t widthF = AlignLo(width, F), i = 0;
+            for (; i < widthF; i += F)
+                LocalBinarization16(sum + i, sqsum + i, alg.step, _alg, src + i, _positive, _negative, dst + i);
+            if (i < width)
+                LocalBinarization16(sum + i, sqsum + i, alg.step, _alg, src + i, _positive, _negative, dst + i, TailMask16(width - i));
+        }
+
+        //---------------------------------------------------------------------
+
+        LocalBinarizationDefault::LocalBinarizationDefault(const LocalBinarizationParam& param)
+            : Avx2::LocalBinarizationDefault(param)
+        {
+            _colUpdate = BoxFilterColUpdate8u;
+            _row = LocalBinarizationRow;
+        }
+
+        //---------------------------------------------------------------------
+
+        void* LocalBinarizationInit(size_t width, size_t height, SimdLocalBinarizationType type, size_t radius, float k, float r)
+        {
+            LocalBinarizationParam param(width, height, type, radius, k, r, A);
+            if (!param.Valid())
+                return NULL;
+            return new LocalBinarizationDefault(param);
+        }
+    }
+#endif
+}
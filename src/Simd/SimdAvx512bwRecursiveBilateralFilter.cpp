@@ -0,0 +1,547 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdRecursiveBilateralFilter.h"
+#include "Simd/SimdFmadd.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        typedef RecursiveBilateralFilter::FilterPtr FilterPtr;
+
+        SIMD_INLINE __m512i AbsDiff8u(__m512i s0, __m512i s1)
+        {
+            return _mm512_sub_epi8(_mm512_max_epu8(s0, s1), _mm512_min_epu8(s0, s1));
+        }
+
+        template<RbfDiffType type> SIMD_INLINE __m512i Diff(__m512i ch0, __m512i ch1)
+        {
+            switch (type)
+            {
+            case RbfDiffAvg: return _mm512_avg_epu8(ch0, ch1);
+            case RbfDiffMax: return _mm512_max_epu8(ch0, ch1);
+            case RbfDiffSum: return _mm512_adds_epu8(ch0, ch1);
+            default:
+                assert(0); return _mm512_setzero_si512();
+            }
+        }
+
+        template<RbfDiffType type> SIMD_INLINE __m512i Diff(__m512i ch0, __m512i ch1, __m512i ch2)
+        {
+            switch (type)
+            {
+            case RbfDiffAvg: return _mm512_avg_epu8(ch1, _mm512_avg_epu8(ch0, ch2));
+            case RbfDiffMax: return _mm512_max_epu8(_mm512_max_epu8(ch0, ch1), ch2);
+            case RbfDiffSum: return _mm512_adds_epu8(ch0, _mm512_adds_epu8(ch1, ch2));
+            default:
+                assert(0); return _mm512_setzero_si512();
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m512i PixelDiff1(const uint8_t* src0, const uint8_t* src1, size_t size)
+        {
+            __mmask16 tail = TailMask16(size);
+            __m128i s0 = _mm_maskz_loadu_epi8(tail, src0);
+            __m128i s1 = _mm_maskz_loadu_epi8(tail, src1);
+            return _mm512_cvtepu8_epi32(_mm_sub_epi8(_mm_max_epu8(s0, s1), _mm_min_epu8(s0, s1)));
+        }
+
+        template<RbfDiffType type> SIMD_INLINE __m512i PixelDiff2(const uint8_t* src0, const uint8_t* src1, size_t size)
+        {
+            __mmask32 tail = TailMask32(size * 2);
+            __m256i s0 = _mm256_maskz_loadu_epi8(tail, src0);
+            __m256i s1 = _mm256_maskz_loadu_epi8(tail, src1);
+            __m512i ad = _mm512_cvtepu16_epi32(_mm256_sub_epi8(_mm256_max_epu8(s0, s1), _mm256_min_epu8(s0, s1)));
+            return Diff<type>(_mm512_and_si512(ad, K32_000000FF), _mm512_srli_epi32(ad, 8));
+        }
+
+        template<RbfDiffType type> SIMD_INLINE __m512i PixelDiff3(const uint8_t* src0, const uint8_t* src1, size_t size)
+        {
+            static const __m512i PERM = SIMD_MM512_SETR_EPI32(0x0, 0x1, 0x2, 0x3, 0x3, 0x4, 0x5, 0x6, 0x6, 0x7, 0x8, 0x9, 0x9, 0xA, 0xB, 0xC);
+            static const __m512i K0 = SIMD_MM512_SETR_EPI8(
+                0x0, -1, -1, -1, 0x3, -1, -1, -1, 0x6, -1, -1, -1, 0x9, -1, -1, -1,
+                0x0, -1, -1, -1, 0x3, -1, -1, -1, 0x6, -1, -1, -1, 0x9, -1, -1, -1,
+                0x0, -1, -1, -1, 0x3, -1, -1, -1, 0x6, -1, -1, -1, 0x9, -1, -1, -1,
+                0x0, -1, -1, -1, 0x3, -1, -1, -1, 0x6, -1, -1, -1, 0x9, -1, -1, -1);
+            static const __m512i K1 = SIMD_MM512_SETR_EPI8(
+                0x1, -1, -1, -1, 0x4, -1, -1, -1, 0x7, -1, -1, -1, 0xA, -1, -1, -1,
+                0x1, -1, -1, -1, 0x4, -1, -1, -1, 0x7, -1, -1, -1, 0xA, -1, -1, -1,
+                0x1, -1, -1, -1, 0x4, -1, -1, -1, 0x7, -1, -1, -1, 0xA, -1, -1, -1,
+                0x1, -1, -1, -1, 0x4, -1, -1, -1, 0x7, -1, -1, -1, 0xA, -1, -1, -1);
+            static const __m512i K2 = SIMD_MM512_SETR_EPI8(
+                0x2, -1, -1, -1, 0x5, -1, -1, -1, 0x8, -1, -1, -1, 0xB, -1, -1, -1,
+                0x2, -1, -1, -1, 0x5, -1, -1, -1, 0x8, -1, -1, -1, 0xB, -1, -1, -1,
+                0x2, -1, -1, -1, 0x5, -1, -1, -1, 0x8, -1, -1, -1, 0xB, -1, -1, -1,
+                0x2, -1, -1, -1, 0x5, -1, -1, -1, 0x8, -1, -1, -1, 0xB, -1, -1, -1);
+            __mmask64 tail = TailMask64(size * 3);
+            __m512i ad = AbsDiff8u(_mm512_maskz_loadu_epi8(tail, src0), _mm512_maskz_loadu_epi8(tail, src1));
+            ad = _mm512_permutexvar_epi32(PERM, ad);
+            return Diff<type>(_mm512_shuffle_epi8(ad, K0), _mm512_shuffle_epi8(ad, K1), _mm512_shuffle_epi8(ad, K2));
+        }
+
+        template<RbfDiffType type> SIMD_INLINE __m512i PixelDiff4(const uint8_t* src0, const uint8_t* src1, size_t size)
+        {
+            __mmask64 tail = TailMask64(size * 4);
+            __m512i ad = AbsDiff8u(_mm512_maskz_loadu_epi8(tail, src0), _mm512_maskz_loadu_epi8(tail, src1));
+            return Diff<type>(_mm512_and_si512(ad, K32_000000FF), _mm512_and_si512(_mm512_srli_epi32(ad, 8), K32_000000FF),
+                _mm512_and_si512(_mm512_srli_epi32(ad, 16), K32_000000FF));
+        }
+
+        template<int channels, RbfDiffType type> SIMD_INLINE __m512i PixelDiff(const uint8_t* src0, const uint8_t* src1, size_t size)
+        {
+            switch (channels)
+            {
+            case 1: return PixelDiff1(src0, src1, size);
+            case 2: return PixelDiff2<type>(src0, src1, size);
+            case 3: return PixelDiff3<type>(src0, src1, size);
+            case 4: return PixelDiff4<type>(src0, src1, size);
+            default:
+                assert(0); return _mm512_setzero_si512();
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        template<int channels> SIMD_INLINE void ExpandIndex(__m512i* index)
+        {
+            static const __m512i K32_SEQ = SIMD_MM512_SETR_EPI32(0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xA, 0xB, 0xC, 0xD, 0xE, 0xF);
+            for (int i = 0; i < channels; ++i)
+            {
+                __m512i element = _mm512_add_epi32(K32_SEQ, _mm512_set1_epi32(i * F));
+                switch (channels)
+                {
+                case 1: index[i] = element; break;
+                case 2: index[i] = _mm512_srli_epi32(element, 1); break;
+                case 3: index[i] = _mm512_srli_epi32(_mm512_mullo_epi32(element, _mm512_set1_epi32(21846)), 16); break;
+                case 4: index[i] = _mm512_srli_epi32(element, 2); break;
+                }
+            }
+        }
+
+        SIMD_INLINE __m512 Load8u(const uint8_t* src, __mmask16 tail)
+        {
+            return _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(tail, src)));
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        namespace Prec
+        {
+            template<int channels, RbfDiffType type> void RowRanges(const uint8_t* src0, const uint8_t* src1, size_t width, const float* ranges, float* dst)
+            {
+                for (size_t x = 0; x < width; x += F)
+                {
+                    size_t size = Simd::Min(width - x, F);
+                    __mmask16 tail = TailMask16(size);
+                    __m512i diff = PixelDiff<channels, type>(src0 + x * channels, src1 + x * channels, size);
+                    _mm512_mask_storeu_ps(dst + x, tail, _mm512_mask_i32gather_ps(_mm512_setzero_ps(), tail, diff, ranges, 4));
+                }
+            }
+
+            template<int channels> SIMD_INLINE void SetOut(const float* bc, const float* bf, const float* ec, const float* ef, size_t width, uint8_t* dst)
+            {
+                __m512i index[channels];
+                ExpandIndex<channels>(index);
+                for (size_t x = 0; x < width; x += F)
+                {
+                    size_t size = Simd::Min(width - x, F);
+                    __mmask16 tail = TailMask16(size);
+                    __m512 factor = _mm512_div_ps(_mm512_set1_ps(1.0f), _mm512_add_ps(_mm512_maskz_loadu_ps(tail, bf + x), _mm512_maskz_loadu_ps(tail, ef + x)));
+                    for (size_t i = 0, o = x * channels; i < channels; ++i, o += F)
+                    {
+                        __mmask16 part = TailMask16(size * channels - i * F);
+                        __m512 colors = _mm512_add_ps(_mm512_maskz_loadu_ps(part, bc + o), _mm512_maskz_loadu_ps(part, ec + o));
+                        __m512i value = _mm512_cvttps_epi32(_mm512_mul_ps(_mm512_permutexvar_ps(index[i], factor), colors));
+                        _mm_mask_storeu_epi8(dst + o, part, _mm512_cvtepi32_epi8(value));
+                    }
+                }
+            }
+
+            template<int channels> void VerSetEdge(const uint8_t* src, size_t width, float* factor, float* colors)
+            {
+                for (size_t x = 0; x < width; x += F)
+                    _mm512_mask_storeu_ps(factor + x, TailMask16(width - x), _mm512_set1_ps(1.0f));
+                for (size_t i = 0, n = width * channels; i < n; i += F)
+                {
+                    __mmask16 tail = TailMask16(n - i);
+                    _mm512_mask_storeu_ps(colors + i, tail, Load8u(src + i, tail));
+                }
+            }
+
+            template<int channels, bool nofma> void VerSetMain(const uint8_t* hor, size_t width, float alpha,
+                const float* ranges, const float* pf, const float* pc, float* cf, float* cc)
+            {
+                __m512 _alpha = _mm512_set1_ps(alpha);
+                __m512i index[channels];
+                ExpandIndex<channels>(index);
+                for (size_t x = 0; x < width; x += F)
+                {
+                    size_t size = Simd::Min(width - x, F);
+                    __mmask16 tail = TailMask16(size);
+                    __m512 range = _mm512_maskz_loadu_ps(tail, ranges + x);
+                    _mm512_mask_storeu_ps(cf + x, tail, Fmadd<nofma>(range, _mm512_maskz_loadu_ps(tail, pf + x), _alpha));
+                    for (size_t i = 0, o = x * channels; i < channels; ++i, o += F)
+                    {
+                        __mmask16 part = TailMask16(size * channels - i * F);
+                        __m512 colors = Fmadd<nofma>(_alpha, Load8u(hor + o, part), _mm512_permutexvar_ps(index[i], range), _mm512_maskz_loadu_ps(part, pc + o));
+                        _mm512_mask_storeu_ps(cc + o, part, colors);
+                    }
+                }
+            }
+
+            template<int channels, RbfDiffType type, bool nofma> void VerFilter(const RbfParam& p, float* buf, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+            {
+                size_t size = p.width * channels;
+                float* rb0 = buf, * dcb = rb0 + p.width, * dfb = dcb + size * 2, * ucb = dfb + p.width * 2, * ufb = ucb + size * p.height;
+
+                const uint8_t* suc = src + srcStride * (p.height - 1);
+                const uint8_t* duc = dst + dstStride * (p.height - 1);
+                float* uf = ufb + p.width * (p.height - 1);
+                float* uc = ucb + size * (p.height - 1);
+                VerSetEdge<channels>(duc, p.width, uf, uc);
+                for (size_t y = 1; y < p.height; y++)
+                {
+                    duc -= dstStride;
+                    suc -= srcStride;
+                    uf -= p.width;
+                    uc -= size;
+                    RowRanges<channels, type>(suc, suc + srcStride, p.width, p.ranges, rb0);
+                    VerSetMain<channels, nofma>(duc, p.width, p.alpha, rb0, uf + p.width, uc + size, uf, uc);
+                }
+
+                VerSetEdge<channels>(dst, p.width, dfb, dcb);
+                SetOut<channels>(dcb, dfb, ucb, ufb, p.width, dst);
+                for (size_t y = 1; y < p.height; y++)
+                {
+                    src += srcStride;
+                    dst += dstStride;
+                    float* dc = dcb + (y & 1) * size;
+                    float* df = dfb + (y & 1) * p.width;
+                    const float* dpc = dcb + ((y - 1) & 1) * size;
+                    const float* dpf = dfb + ((y - 1) & 1) * p.width;
+                    RowRanges<channels, type>(src, src - srcStride, p.width, p.ranges, rb0);
+                    VerSetMain<channels, nofma>(dst, p.width, p.alpha, rb0, dpf, dpc, df, dc);
+                    SetOut<channels>(dc, df, ucb + y * size, ufb + y * p.width, p.width, dst);
+                }
+            }
+
+            //-----------------------------------------------------------------------------------------
+
+            template <int channels, RbfDiffType type> void Set(const RbfParam& param, FilterPtr& verFilter)
+            {
+                verFilter = FmaAvoid(param.flags) ? VerFilter<channels, type, true> : VerFilter<channels, type, false>;
+            }
+
+            template <RbfDiffType type> void Set(const RbfParam& param, FilterPtr& verFilter)
+            {
+                switch (param.channels)
+                {
+                case 1: Set<1, type>(param, verFilter); break;
+                case 2: Set<2, type>(param, verFilter); break;
+                case 3: Set<3, type>(param, verFilter); break;
+                case 4: Set<4, type>(param, verFilter); break;
+                default:
+                    assert(0);
+                }
+            }
+
+            void Set(const RbfParam& param, FilterPtr& verFilter)
+            {
+                switch (DiffType(param.flags))
+                {
+                case RbfDiffAvg: Set<RbfDiffAvg>(param, verFilter); break;
+                case RbfDiffMax: Set<RbfDiffAvg>(param, verFilter); break;
+                case RbfDiffSum: Set<RbfDiffAvg>(param, verFilter); break;
+                default:
+                    assert(0);
+                }
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        RecursiveBilateralFilterPrecize::RecursiveBilateralFilterPrecize(const RbfParam& param)
+            : Sse41::RecursiveBilateralFilterPrecize(param)
+        {
+            Prec::Set(_param, _vFilter);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        namespace Fast
+        {
+            template<int dir> SIMD_INLINE void Set(int value, uint8_t* dst);
+
+            template<> SIMD_INLINE void Set<+1>(int value, uint8_t* dst)
+            {
+                dst[0] = uint8_t(value);
+            }
+
+            template<> SIMD_INLINE void Set<-1>(int value, uint8_t* dst)
+            {
+                dst[0] = uint8_t((value + dst[0] + 1) / 2);
+            }
+
+            template<int dir> SIMD_INLINE void Set(__m128i value, uint8_t* dst, __mmask16 tail);
+
+            template<> SIMD_INLINE void Set<+1>(__m128i value, uint8_t* dst, __mmask16 tail)
+            {
+                _mm_mask_storeu_epi8(dst, tail, value);
+            }
+
+            template<> SIMD_INLINE void Set<-1>(__m128i value, uint8_t* dst, __mmask16 tail)
+            {
+                _mm_mask_storeu_epi8(dst, tail, _mm_avg_epu8(value, _mm_maskz_loadu_epi8(tail, dst)));
+            }
+
+            //-----------------------------------------------------------------------------------------
+
+            template<int channels, RbfDiffType type> void RowDiff(const uint8_t* src0, const uint8_t* src1, size_t width, uint8_t* dst)
+            {
+                for (size_t x = 0; x < width; x += F)
+                {
+                    size_t size = Simd::Min(width - x, F);
+                    __m512i diff = PixelDiff<channels, type>(src0 + x * channels, src1 + x * channels, size);
+                    _mm_mask_storeu_epi8(dst + x, TailMask16(size), _mm512_cvtepi32_epi8(diff));
+                }
+            }
+
+            SIMD_INLINE __m512i LoadRows(const uint8_t* src, size_t stride, size_t rows)
+            {
+                SIMD_ALIGNED(64) int32_t buf[F] = { 0 };
+                for (size_t r = 0; r < rows; ++r)
+                    buf[r] = src[r * stride];
+                return _mm512_load_si512(buf);
+            }
+
+            template<int dir> SIMD_INLINE void SetRows(__m512i value, uint8_t* dst, size_t stride, size_t rows)
+            {
+                SIMD_ALIGNED(64) int32_t buf[F];
+                _mm512_store_si512(buf, value);
+                for (size_t r = 0; r < rows; ++r)
+                    Set<dir>(buf[r], dst + r * stride);
+            }
+
+            template<int channels, int dir, bool nofma> void HorRows(const uint8_t* src, size_t srcStride, const uint8_t* diff, size_t diffStride,
+                size_t rows, size_t width, float alpha, const float* ranges, uint8_t* dst, size_t dstStride)
+            {
+                static const __m512i K32_SEQ = SIMD_MM512_SETR_EPI32(0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0xA, 0xB, 0xC, 0xD, 0xE, 0xF);
+                __mmask16 mask = TailMask16(rows);
+                __m512i srcOffs = _mm512_mullo_epi32(K32_SEQ, _mm512_set1_epi32(int(srcStride)));
+                __m512i diffOffs = _mm512_mullo_epi32(K32_SEQ, _mm512_set1_epi32(int(diffStride)));
+                __m512i dstOffs = _mm512_mullo_epi32(K32_SEQ, _mm512_set1_epi32(int(dstStride)));
+                __m512 _alpha = _mm512_set1_ps(alpha), factor = _mm512_set1_ps(1.0f), colors[channels];
+                ptrdiff_t x = dir > 0 ? 0 : width - 1;
+                for (int c = 0; c < channels; c++)
+                {
+                    __m512i value = LoadRows(src + x * channels + c, srcStride, rows);
+                    colors[c] = _mm512_cvtepi32_ps(value);
+                    SetRows<dir>(value, dst + x * channels + c, dstStride, rows);
+                }
+                x += dir;
+                size_t steps = width - 1, steps4 = AlignLo(steps, 4), s = 0;
+                for (; s < steps4; s += 4, x += 4 * dir)
+                {
+                    ptrdiff_t lo = dir > 0 ? x : x - 3;
+                    __m512i d4 = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, diffOffs, diff + lo - (dir > 0 ? 1 : 0), 1);
+                    __m512i s4[channels], d[channels];
+                    for (int c = 0; c < channels; c++)
+                    {
+                        s4[c] = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, srcOffs, src + lo * channels + 4 * c, 1);
+                        d[c] = _mm512_setzero_si512();
+                    }
+                    for (int i = 0; i < 4; ++i)
+                    {
+                        int m = dir > 0 ? i : 3 - i;
+                        __m512i index = _mm512_and_si512(_mm512_srli_epi32(d4, 8 * m), K32_000000FF);
+                        __m512 range = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), mask, index, ranges, 4);
+                        factor = Fmadd<nofma>(range, factor, _alpha);
+                        for (int c = 0; c < channels; c++)
+                        {
+                            int b = m * channels + c;
+                            __m512 value = _mm512_cvtepi32_ps(_mm512_and_si512(_mm512_srli_epi32(s4[b / 4], 8 * (b % 4)), K32_000000FF));
+                            colors[c] = Fmadd<nofma>(_alpha, value, range, colors[c]);
+                            __m512i out = _mm512_and_si512(_mm512_cvttps_epi32(_mm512_div_ps(colors[c], factor)), K32_000000FF);
+                            d[b / 4] = _mm512_or_si512(d[b / 4], _mm512_slli_epi32(out, 8 * (b % 4)));
+                        }
+                    }
+                    for (int c = 0; c < channels; c++)
+                    {
+                        uint8_t* pd = dst + lo * channels + 4 * c;
+                        if (dir < 0)
+                            d[c] = _mm512_avg_epu8(d[c], _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, dstOffs, pd, 1));
+                        _mm512_mask_i32scatter_epi32(pd, mask, dstOffs, d[c], 1);
+                    }
+                }
+                for (; s < steps; s += 1, x += dir)
+                {
+                    __m512i index = LoadRows(diff + x - (dir > 0 ? 1 : 0), diffStride, rows);
+                    __m512 range = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), mask, index, ranges, 4);
+                    factor = Fmadd<nofma>(range, factor, _alpha);
+                    for (int c = 0; c < channels; c++)
+                    {
+                        __m512 value = _mm512_cvtepi32_ps(LoadRows(src + x * channels + c, srcStride, rows));
+                        colors[c] = Fmadd<nofma>(_alpha, value, range, colors[c]);
+                        SetRows<dir>(_mm512_cvttps_epi32(_mm512_div_ps(colors[c], factor)), dst + x * channels + c, dstStride, rows);
+                    }
+                }
+            }
+
+            template<int channels, RbfDiffType type, bool nofma> void HorFilter(const RbfParam& p, float* buf, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+            {
+                uint8_t* diff = (uint8_t*)buf;
+                for (size_t y = 0; y < p.height; y += F)
+                {
+                    size_t rows = Simd::Min(p.height - y, F);
+                    for (size_t r = 0; r < rows; ++r)
+                        RowDiff<channels, type>(src + r * srcStride, src + r * srcStride + channels, p.width - 1, diff + r * dstStride);
+                    HorRows<channels, +1, nofma>(src, srcStride, diff, dstStride, rows, p.width, p.alpha, p.ranges, dst, dstStride);
+                    HorRows<channels, -1, nofma>(src, srcStride, diff, dstStride, rows, p.width, p.alpha, p.ranges, dst, dstStride);
+                    src += srcStride * F;
+                    dst += dstStride * F;
+                }
+            }
+
+            //-----------------------------------------------------------------------------------------
+
+            template<int channels, int dir> void VerEdge(const uint8_t* src, size_t width, float* factor, float* colors, uint8_t* dst)
+            {
+                for (size_t x = 0; x < width; x += F)
+                    _mm512_mask_storeu_ps(factor + x, TailMask16(width - x), _mm512_set1_ps(1.0f));
+                for (size_t i = 0, n = width * channels; i < n; i += F)
+                {
+                    __mmask16 tail = TailMask16(n - i);
+                    __m128i value = _mm_maskz_loadu_epi8(tail, src + i);
+                    _mm512_mask_storeu_ps(colors + i, tail, _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(value)));
+                    Set<dir>(value, dst + i, tail);
+                }
+            }
+
+            template<int channels, RbfDiffType type, int dir, bool nofma> void VerMain(const uint8_t* src0, const uint8_t* src1, size_t width, float alpha,
+                const float* ranges, float* factor, float* colors, uint8_t* dst)
+            {
+                __m512 _alpha = _mm512_set1_ps(alpha);
+                __m512i index[channels];
+                ExpandIndex<channels>(index);
+                for (size_t x = 0; x < width; x += F)
+                {
+                    size_t size = Simd::Min(width - x, F);
+                    __mmask16 tail = TailMask16(size);
+                    __m512i diff = PixelDiff<channels, type>(src0 + x * channels, src1 + x * channels, size);
+                    __m512 range = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), tail, diff, ranges, 4);
+                    __m512 _factor = Fmadd<nofma>(range, _mm512_maskz_loadu_ps(tail, factor + x), _alpha);
+                    _mm512_mask_storeu_ps(factor + x, tail, _factor);
+                    for (size_t i = 0, o = x * channels; i < channels; ++i, o += F)
+                    {
+                        __mmask16 part = TailMask16(size * channels - i * F);
+                        __m512 _colors = Fmadd<nofma>(_alpha, Load8u(src0 + o, part), _mm512_permutexvar_ps(index[i], range), _mm512_maskz_loadu_ps(part, colors + o));
+                        _mm512_mask_storeu_ps(colors + o, part, _colors);
+                        __m512i value = _mm512_cvttps_epi32(_mm512_div_ps(_colors, _mm512_permutexvar_ps(index[i], _factor)));
+                        Set<dir>(_mm512_cvtepi32_epi8(value), dst + o, part);
+                    }
+                }
+            }
+
+            template<int channels, RbfDiffType type, bool nofma> void VerFilter(const RbfParam& p, float* buf, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+            {
+                size_t size = p.width * channels;
+                VerEdge<channels, +1>(src, p.width, buf + size, buf, dst);
+                for (size_t y = 1; y < p.height; y++)
+                {
+                    src += srcStride;
+                    dst += dstStride;
+                    VerMain<channels, type, +1, nofma>(src, src - srcStride, p.width, p.alpha, p.ranges, buf + size, buf, dst);
+                }
+                VerEdge<channels, -1>(src, p.width, buf + size, buf, dst);
+                for (size_t y = 1; y < p.height; y++)
+                {
+                    src -= srcStride;
+                    dst -= dstStride;
+                    VerMain<channels, type, -1, nofma>(src, src + srcStride, p.width, p.alpha, p.ranges, buf + size, buf, dst);
+                }
+            }
+
+            //-----------------------------------------------------------------------------------------
+
+            template <int channels, RbfDiffType type> void Set(const RbfParam& param, FilterPtr& horFilter, FilterPtr& verFilter)
+            {
+                horFilter = FmaAvoid(param.flags) ? HorFilter<channels, type, true> : HorFilter<channels, type, false>;
+                verFilter = FmaAvoid(param.flags) ? VerFilter<channels, type, true> : VerFilter<channels, type, false>;
+            }
+
+            template <RbfDiffType type> void Set(const RbfParam& param, FilterPtr& horFilter, FilterPtr& verFilter)
+            {
+                switch (param.channels)
+                {
+                case 1: Set<1, type>(param, horFilter, verFilter); break;
+                case 2: Set<2, type>(param, horFilter, verFilter); break;
+                case 3: Set<3, type>(param, horFilter, verFilter); break;
+                case 4: Set<4, type>(param, horFilter, verFilter); break;
+                default:
+                    assert(0);
+                }
+            }
+
+            void Set(const RbfParam& param, FilterPtr& horFilter, FilterPtr& verFilter)
+            {
+                switch (DiffType(param.flags))
+                {
+                case RbfDiffAvg: Set<RbfDiffAvg>(param, horFilter, verFilter); break;
+                case RbfDiffMax: Set<RbfDiffAvg>(param, horFilter, verFilter); break;
+                case RbfDiffSum: Set<RbfDiffAvg>(param, horFilter, verFilter); break;
+                default:
+                    assert(0);
+                }
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        RecursiveBilateralFilterFast::RecursiveBilateralFilterFast(const RbfParam& param)
+            : Avx2::RecursiveBilateralFilterFast(param)
+        {
+            Fast::Set(_param, _hFilter, _vFilter);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void* RecursiveBilateralFilterInit(size_t width, size_t height, size_t channels,
+            const float* sigmaSpatial, const float* sigmaRange, SimdRecursiveBilateralFilterFlags flags)
+        {
+            RbfParam param(width, height, channels, sigmaSpatial, sigmaRange, flags, A);
+            if (!param.Valid())
+                return NULL;
+            if (Precise(flags))
+                return new RecursiveBilateralFilterPrecize(param);
+            else
+                return new RecursiveBilateralFilterFast(param);
+        }
+    }
+#endif
+}
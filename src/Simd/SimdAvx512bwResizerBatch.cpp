@@ -0,0 +1,84 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        ResizerBatch::ResizerBatch(const ResParam& param, SimdTensorFormatType format)
+            : Base::ResizerBatch(param, format)
+        {
+        }
+
+        SIMD_INLINE void ByteRowY(const int32_t* src0, const int32_t* src1, __m512i fy, uint8_t* dst, __mmask16 tail = -1)
+        {
+            __m512i s0 = _mm512_maskz_loadu_epi32(tail, src0);
+            __m512i s1 = _mm512_maskz_loadu_epi32(tail, src1);
+            __m512i sum = _mm512_add_epi32(_mm512_slli_epi32(s0, Base::LINEAR_SHIFT), _mm512_mullo_epi32(_mm512_sub_epi32(s1, s0), fy));
+            sum = _mm512_srai_epi32(_mm512_add_epi32(sum, _mm512_set1_epi32(Base::BILINEAR_ROUND_TERM)), Base::BILINEAR_SHIFT);
+            _mm512_mask_cvtepi32_storeu_epi8(dst, tail, sum);
+        }
+
+        void ResizerBatch::ByteRowY(const int32_t* src0, const int32_t* src1, size_t size, int32_t fy, uint8_t* dst)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __m512i _fy = _mm512_set1_epi32(fy);
+            for (; i < sizeF; i += F)
+                Avx512bw::ByteRowY(src0 + i, src1 + i, _fy, dst + i);
+            if (i < size)
+                Avx512bw::ByteRowY(src0 + i, src1 + i, _fy, dst + i, TailMask16(size - i));
+        }
+
+        SIMD_INLINE void FloatRowY(const float* src0, const float* src1, __m512 fy0, __m512 fy1, float* dst, __mmask16 tail = -1)
+        {
+            __m512 s0 = _mm512_maskz_loadu_ps(tail, src0);
+            __m512 s1 = _mm512_maskz_loadu_ps(tail, src1);
+            _mm512_mask_storeu_ps(dst, tail, _mm512_fmadd_ps(s0, fy0, _mm512_mul_ps(s1, fy1)));
+        }
+
+        void ResizerBatch::FloatRowY(const float* src0, const float* src1, size_t size, float fy, float* dst)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __m512 fy1 = _mm512_set1_ps(fy), fy0 = _mm512_set1_ps(1.0f - fy);
+            for (; i < sizeF; i += F)
+                Avx512bw::FloatRowY(src0 + i, src1 + i, fy0, fy1, dst + i);
+            if (i < size)
+                Avx512bw::FloatRowY(src0 + i, src1 + i, fy0, fy1, dst + i, TailMask16(size - i));
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ResizerBatchInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method, SimdTensorFormatType format)
+        {
+            if (!Base::ResizerBatchValid(srcX, srcY, dstX, dstY, channels, type, method, format))
+                return NULL;
+            ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(__m512i));
+            return new ResizerBatch(param, format);
+        }
+    }
+#endif
+}
@@ -137,10 +137,10 @@ namespace Simd
             assert(_xn == 0 && _xt == _param.dstW);
             size_t step = 4 / N * 4;
             size_t body = AlignLoAny(_param.dstW, step);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            for (size_t dy = _dyBeg; dy < _dyEnd; dy++, dst += dstStride)
             {
                 size_t sy = _iy[dy];
-                const uint8_t* src1 = src + sy * srcStride;
+                const uint8_t* src1 = src + (sy - _syBeg) * srcStride;
                 const uint8_t* src2 = src1 + srcStride;
                 const uint8_t* src0 = sy ? src1 - srcStride : src1;
                 const uint8_t* src3 = sy < _param.srcH - 2 ? src2 + srcStride : src2;
@@ -191,10 +191,10 @@ namespace Simd
             size_t step = 16;
             size_t body = AlignLoAny(_param.dstW, step);
             __mmask16 tail = TailMask16(_param.dstW - body);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            for (size_t dy = _dyBeg; dy < _dyEnd; dy++, dst += dstStride)
             {
                 size_t sy = _iy[dy];
-                const uint8_t* src1 = src + sy * srcStride;
+                const uint8_t* src1 = src + (sy - _syBeg) * srcStride;
                 const uint8_t* src2 = src1 + srcStride;
                 const uint8_t* src0 = sy ? src1 - srcStride : src1;
                 const uint8_t* src3 = sy < _param.srcH - 2 ? src2 + srcStride : src2;
@@ -251,10 +251,10 @@ namespace Simd
             size_t step = 8;
             size_t body = AlignLoAny(_param.dstW, step);
             __mmask8 tail = TailMask8(_param.dstW - body);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            for (size_t dy = _dyBeg; dy < _dyEnd; dy++, dst += dstStride)
             {
                 size_t sy = _iy[dy];
-                const uint8_t* src1 = src + sy * srcStride;
+                const uint8_t* src1 = src + (sy - _syBeg) * srcStride;
                 const uint8_t* src2 = src1 + srcStride;
                 const uint8_t* src0 = sy ? src1 - srcStride : src1;
                 const uint8_t* src3 = sy < _param.srcH - 2 ? src2 + srcStride : src2;
@@ -322,10 +322,10 @@ namespace Simd
             srcMaskTail[3] = tail > 3 ? 0x7 : 0x0;
             srcMaskTail[4] = TailMask8(tail);
             __mmask16 dstMaskTail = TailMask16(tail * 3);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            for (size_t dy = _dyBeg; dy < _dyEnd; dy++, dst += dstStride)
             {
                 size_t sy = _iy[dy];
-                const uint8_t* src1 = src + sy * srcStride;
+                const uint8_t* src1 = src + (sy - _syBeg) * srcStride;
                 const uint8_t* src2 = src1 + srcStride;
                 const uint8_t* src0 = sy ? src1 - srcStride : src1;
                 const uint8_t* src3 = sy < _param.srcH - 2 ? src2 + srcStride : src2;
@@ -392,10 +392,10 @@ namespace Simd
             srcMaskTail[3] = tail > 3 ? 0xF : 0x0;
             srcMaskTail[4] = TailMask8(tail);
             __mmask16 dstMaskTail = TailMask16(tail * 4);
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            for (size_t dy = _dyBeg; dy < _dyEnd; dy++, dst += dstStride)
             {
                 size_t sy = _iy[dy];
-                const uint8_t* src1 = src + sy * srcStride;
+                const uint8_t* src1 = src + (sy - _syBeg) * srcStride;
                 const uint8_t* src2 = src1 + srcStride;
                 const uint8_t* src0 = sy ? src1 - srcStride : src1;
                 const uint8_t* src3 = sy < _param.srcH - 2 ? src2 + srcStride : src2;
@@ -516,15 +516,15 @@ namespace Simd
             size_t rowBody = AlignLo(_bx[0].size, F);
             __mmask16 rowTail = TailMask16(_bx[0].size - rowBody);
 
-            int32_t prev = -1;
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            int32_t prev = _iy[_dyBeg] - 1;
+            for (size_t dy = _dyBeg; dy < _dyEnd; dy++, dst += dstStride)
             {
                 int32_t sy = _iy[dy], next = prev;
                 for (int32_t curr = sy - 1, end = sy + 3; curr < end; ++curr)
                 {
                     if (curr < prev)
                         continue;
-                    const uint8_t* ps = src + RestrictRange(curr, 0, (int)_param.srcH - 1) * srcStride;
+                    const uint8_t* ps = src + (RestrictRange(curr, 0, (int)_param.srcH - 1) - _syBeg) * srcStride;
                     int32_t* pb = _bx[(curr + 1) & 3].data;
                     RowCubicSumX<N>(ps, _xn, _xt, _param.dstW, _ix.data, _ax.data, pb);
                     next++;
@@ -571,15 +571,15 @@ namespace Simd
             size_t rowBody = AlignLo(_bx[0].size, F);
             __mmask16 rowTail = TailMask16(_bx[0].size - rowBody);
 
-            int32_t prev = -1;
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            int32_t prev = _iy[_dyBeg] - 1;
+            for (size_t dy = _dyBeg; dy < _dyEnd; dy++, dst += dstStride)
             {
                 int32_t sy = _iy[dy], next = prev;
                 for (int32_t curr = sy - 1, end = sy + 3; curr < end; ++curr)
                 {
                     if (curr < prev)
                         continue;
-                    const uint8_t* ps = src + RestrictRange(curr, 0, (int)_param.srcH - 1) * srcStride;
+                    const uint8_t* ps = src + (RestrictRange(curr, 0, (int)_param.srcH - 1) - _syBeg) * srcStride;
                     int32_t* pb = _bx[(curr + 1) & 3].data;
                     RowCubicSumX1(ps, _xn, _xt, _param.dstW, _ix.data, _ax.data, pb);
                     next++;
@@ -219,7 +219,7 @@ namespace Simd
             const int32_t * ix = _ix.data;
             size_t dstW = _param.dstW;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            for (size_t yDst = _dyBeg; yDst < _dyEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm512_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = _mm512_set1_epi16(int16_t(_ay[yDst]));
@@ -239,7 +239,7 @@ namespace Simd
 
                 for (; k < 2; k++)
                 {
-                    ResizerByteBilinearGather<N>(src + (sy + k)*srcStride, ix, dstW, bx[k]);
+                    ResizerByteBilinearGather<N>(src + (sy + k - _syBeg)*srcStride, ix, dstW, bx[k]);
 
                     uint8_t * pbx = bx[k];
                     for (size_t i = 0; i < size; i += step)
@@ -265,7 +265,7 @@ namespace Simd
             const uint8_t * ax = _ax.data;
             const Idx * ixg = _ixg.data;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            for (size_t yDst = _dyBeg; yDst < _dyEnd; yDst++, dst += dstStride)
             {
                 a[0] = _mm512_set1_epi16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = _mm512_set1_epi16(int16_t(_ay[yDst]));
@@ -285,7 +285,7 @@ namespace Simd
 
                 for (; k < 2; k++)
                 {
-                    const uint8_t * psrc = src + (sy + k)*srcStride;
+                    const uint8_t * psrc = src + (sy + k - _syBeg)*srcStride;
                     uint8_t * pdst = bx[k];
                     for (size_t i = 0; i < blocks; ++i)
                         Avx2::ResizerByteBilinearLoadGrayInterpolated(psrc, ixg[i], ax, pdst);
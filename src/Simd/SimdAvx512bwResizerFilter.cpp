@@ -0,0 +1,160 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdLoad.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdFmadd.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        ResizerByteFilter::ResizerByteFilter(const ResParam& param)
+            : Avx2::ResizerByteFilter(param)
+        {
+        }
+
+        SIMD_INLINE void ByteFilterY(const int16_t* src0, const int16_t* src1, __m512i alpha, const __mmask32* tails, __m512i* sums)
+        {
+            __m512i s00 = _mm512_maskz_loadu_epi16(tails[0], src0 + 0 * HA);
+            __m512i s01 = _mm512_maskz_loadu_epi16(tails[1], src0 + 1 * HA);
+            __m512i s10 = _mm512_maskz_loadu_epi16(tails[0], src1 + 0 * HA);
+            __m512i s11 = _mm512_maskz_loadu_epi16(tails[1], src1 + 1 * HA);
+            sums[0] = _mm512_add_epi32(sums[0], _mm512_madd_epi16(_mm512_unpacklo_epi16(s00, s10), alpha));
+            sums[1] = _mm512_add_epi32(sums[1], _mm512_madd_epi16(_mm512_unpackhi_epi16(s00, s10), alpha));
+            sums[2] = _mm512_add_epi32(sums[2], _mm512_madd_epi16(_mm512_unpacklo_epi16(s01, s11), alpha));
+            sums[3] = _mm512_add_epi32(sums[3], _mm512_madd_epi16(_mm512_unpackhi_epi16(s01, s11), alpha));
+        }
+
+        SIMD_INLINE void ByteFilterY(const int16_t* const* src, size_t n, const int16_t* ay, size_t i, __mmask64 tail, uint8_t* dst)
+        {
+            static const __m512i ROUND = SIMD_MM512_SET1_EPI32(Base::FILTER_Y_ROUND);
+            __mmask32 tails[2] = { __mmask32(tail), __mmask32(tail >> 32) };
+            __m512i sums[4] = { _mm512_setzero_si512(), _mm512_setzero_si512(), _mm512_setzero_si512(), _mm512_setzero_si512() };
+            size_t k = 0;
+            for (; k + 1 < n; k += 2)
+                ByteFilterY(src[k] + i, src[k + 1] + i, _mm512_set1_epi32(uint16_t(ay[k]) | (int32_t(ay[k + 1]) << 16)), tails, sums);
+            if (k < n)
+                ByteFilterY(src[k] + i, src[k] + i, _mm512_set1_epi32(uint16_t(ay[k])), tails, sums);
+            for (size_t j = 0; j < 4; ++j)
+                sums[j] = _mm512_srai_epi32(_mm512_add_epi32(sums[j], ROUND), Base::FILTER_Y_SHIFT);
+            _mm512_mask_storeu_epi8(dst + i, tail, PackI16ToU8(_mm512_packs_epi32(sums[0], sums[1]), _mm512_packs_epi32(sums[2], sums[3])));
+        }
+
+        void ResizerByteFilter::RunY(const int16_t* const* src, size_t n, const int16_t* ay, uint8_t* dst)
+        {
+            size_t size = _param.dstW * _param.channels, sizeA = AlignLo(size, A), i = 0;
+            __mmask64 tail = TailMask64(size - sizeA);
+            for (; i < sizeA; i += A)
+                ByteFilterY(src, n, ay, i, __mmask64(-1), dst);
+            if (i < size)
+                ByteFilterY(src, n, ay, i, tail, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ResizerFloatFilter::ResizerFloatFilter(const ResParam& param)
+            : Avx2::ResizerFloatFilter(param)
+        {
+        }
+
+        SIMD_INLINE __m512 FloatFilterX1x16(const float* src, size_t taps, const int32_t* ix, const float* ax)
+        {
+            const float* s[16], * a[16];
+            for (size_t j = 0; j < 16; ++j)
+                s[j] = src + ix[j], a[j] = ax + j * taps;
+            __m512 sum = _mm512_setzero_ps();
+            for (size_t k = 0; k < taps; k += 4)
+            {
+                __m512 p0 = _mm512_mul_ps(Load<false>(s[0] + k, s[4] + k, s[8] + k, s[12] + k), Load<false>(a[0] + k, a[4] + k, a[8] + k, a[12] + k));
+                __m512 p1 = _mm512_mul_ps(Load<false>(s[1] + k, s[5] + k, s[9] + k, s[13] + k), Load<false>(a[1] + k, a[5] + k, a[9] + k, a[13] + k));
+                __m512 p2 = _mm512_mul_ps(Load<false>(s[2] + k, s[6] + k, s[10] + k, s[14] + k), Load<false>(a[2] + k, a[6] + k, a[10] + k, a[14] + k));
+                __m512 p3 = _mm512_mul_ps(Load<false>(s[3] + k, s[7] + k, s[11] + k, s[15] + k), Load<false>(a[3] + k, a[7] + k, a[11] + k, a[15] + k));
+                __m512 t0 = _mm512_unpacklo_ps(p0, p1), t1 = _mm512_unpacklo_ps(p2, p3);
+                __m512 t2 = _mm512_unpackhi_ps(p0, p1), t3 = _mm512_unpackhi_ps(p2, p3);
+                sum = _mm512_add_ps(sum, _mm512_shuffle_ps(t0, t1, 0x44));
+                sum = _mm512_add_ps(sum, _mm512_shuffle_ps(t0, t1, 0xEE));
+                sum = _mm512_add_ps(sum, _mm512_shuffle_ps(t2, t3, 0x44));
+                sum = _mm512_add_ps(sum, _mm512_shuffle_ps(t2, t3, 0xEE));
+            }
+            return sum;
+        }
+
+        void ResizerFloatFilter::RunX(const float* src, float* dst)
+        {
+            size_t width = _param.dstW, taps = _tx;
+            if (_param.channels == 1 && width >= 16)
+            {
+                size_t width16 = AlignLo(width, 16);
+                for (size_t dx = 0; dx < width16; dx += 16)
+                    _mm512_storeu_ps(dst + dx, FloatFilterX1x16(src, taps, _ix.data + dx, _ax.data + dx * taps));
+                if (width16 < width)
+                    _mm512_storeu_ps(dst + width - 16, FloatFilterX1x16(src, taps, _ix.data + width - 16, _ax.data + (width - 16) * taps));
+            }
+            else
+                Avx2::ResizerFloatFilter::RunX(src, dst);
+        }
+
+        SIMD_INLINE __m512 FloatFilterY(const float* const* src, size_t n, const float* ay, size_t i, __mmask16 tail)
+        {
+            __m512 sum = _mm512_setzero_ps();
+            for (size_t k = 0; k < n; ++k)
+                sum = Fmadd<true>(_mm512_maskz_loadu_ps(tail, src[k] + i), _mm512_set1_ps(ay[k]), sum);
+            return sum;
+        }
+
+        SIMD_INLINE void FloatFilterY(const float* const* src, size_t n, const float* ay, size_t i, __mmask16 tail, uint16_t* dst)
+        {
+            __m512i val = _mm512_cvtps_epi32(FloatFilterY(src, n, ay, i, tail));
+            _mm256_mask_storeu_epi16(dst + i, tail, _mm512_cvtusepi32_epi16(_mm512_max_epi32(val, _mm512_setzero_si512())));
+        }
+
+        SIMD_INLINE void FloatFilterY(const float* const* src, size_t n, const float* ay, size_t i, __mmask16 tail, float* dst)
+        {
+            _mm512_mask_storeu_ps(dst + i, tail, FloatFilterY(src, n, ay, i, tail));
+        }
+
+        template<class T> void FloatFilterRowY(const float* const* src, size_t n, const float* ay, size_t size, T* dst)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __mmask16 tail = TailMask16(size - sizeF);
+            for (; i < sizeF; i += F)
+                FloatFilterY(src, n, ay, i, __mmask16(-1), dst);
+            if (i < size)
+                FloatFilterY(src, n, ay, i, tail, dst);
+        }
+
+        void ResizerFloatFilter::RunY(const float* const* src, size_t n, const float* ay, uint8_t* dst)
+        {
+            size_t size = _param.dstW * _param.channels;
+            if (_param.type == SimdResizeChannelShort)
+                FloatFilterRowY(src, n, ay, size, (uint16_t*)dst);
+            else
+                FloatFilterRowY(src, n, ay, size, (float*)dst);
+        }
+    }
+#endif
+}
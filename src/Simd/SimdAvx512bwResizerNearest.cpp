@@ -94,9 +94,9 @@ namespace Simd
         {
             size_t body = AlignLo(_param.dstW, F);
             __mmask16 tail = TailMask16(_param.dstW - body);
-            for (size_t dy = 0; dy < _param.dstH; dy++)
+            for (size_t dy = _dyBeg; dy < _dyEnd; dy++)
             {
-                const int32_t* srcRow = (int32_t*)(src + _iy[dy] * srcStride);
+                const int32_t* srcRow = (int32_t*)(src + (_iy[dy] - _syBeg) * srcStride);
                 size_t dx = 0;
                 for (; dx < body; dx += F)
                     Avx512bw::Gather4(srcRow, _ix.data + dx, (int32_t*)dst + dx);
@@ -117,9 +117,9 @@ namespace Simd
         {
             size_t body = AlignLo(_param.dstW, 8);
             size_t tail = _param.dstW - 8;
-            for (size_t dy = 0; dy < _param.dstH; dy++)
+            for (size_t dy = _dyBeg; dy < _dyEnd; dy++)
             {
-                const int64_t* srcRow = (int64_t*)(src + _iy[dy] * srcStride);
+                const int64_t* srcRow = (int64_t*)(src + (_iy[dy] - _syBeg) * srcStride);
                 for (size_t dx = 0; dx < body; dx += 8)
                     Avx512bw::Gather8(srcRow, _ix.data + dx, (int64_t*)dst + dx);
                 Avx512bw::Gather8(srcRow, _ix.data + tail, (int64_t*)dst + tail);
@@ -130,9 +130,9 @@ namespace Simd
         void ResizerNearest::Shuffle32x2(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
         {
             size_t body = _blocks - _tails;
-            for (size_t dy = 0; dy < _param.dstH; dy++)
+            for (size_t dy = _dyBeg; dy < _dyEnd; dy++)
             {
-                const uint8_t* srcRow = src + _iy[dy] * srcStride;
+                const uint8_t* srcRow = src + (_iy[dy] - _syBeg) * srcStride;
                 size_t i = 0, t = 0;
                 for (; i < body; ++i)
                 {
@@ -0,0 +1,85 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdBFloat16.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        ResizerTensor::ResizerTensor(const ResParam& param, const ResTensorParam& tensor, const float* scale, const float* shift)
+            : Base::ResizerTensor(param, tensor, scale, shift)
+        {
+        }
+
+        SIMD_INLINE __m512 ResizerTensorRowY(const int32_t* src0, const int32_t* src1, __m512i fy, const float* scale, const float* shift, __mmask16 tail)
+        {
+            __m512i s0 = _mm512_maskz_loadu_epi32(tail, src0);
+            __m512i s1 = _mm512_maskz_loadu_epi32(tail, src1);
+            __m512i sum = _mm512_add_epi32(_mm512_slli_epi32(s0, Base::LINEAR_SHIFT), _mm512_mullo_epi32(_mm512_sub_epi32(s1, s0), fy));
+            return _mm512_fmadd_ps(_mm512_cvtepi32_ps(sum), _mm512_maskz_loadu_ps(tail, scale), _mm512_maskz_loadu_ps(tail, shift));
+        }
+
+        void ResizerTensor::RowY32f(const int32_t* src0, const int32_t* src1, size_t size, int32_t fy, const float* scale, const float* shift, float* dst)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __m512i _fy = _mm512_set1_epi32(fy);
+            for (; i < sizeF; i += F)
+                _mm512_storeu_ps(dst + i, ResizerTensorRowY(src0 + i, src1 + i, _fy, scale + i, shift + i, -1));
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                _mm512_mask_storeu_ps(dst + i, tail, ResizerTensorRowY(src0 + i, src1 + i, _fy, scale + i, shift + i, tail));
+            }
+        }
+
+        void ResizerTensor::RowY16b(const int32_t* src0, const int32_t* src1, size_t size, int32_t fy, const float* scale, const float* shift, uint16_t* dst)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __m512i _fy = _mm512_set1_epi32(fy);
+            for (; i < sizeF; i += F)
+                _mm256_storeu_si256((__m256i*)(dst + i), _mm512_cvtepi32_epi16(Float32ToBFloat16(ResizerTensorRowY(src0 + i, src1 + i, _fy, scale + i, shift + i, -1))));
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                _mm512_mask_cvtepi32_storeu_epi16(dst + i, tail, Float32ToBFloat16(ResizerTensorRowY(src0 + i, src1 + i, _fy, scale + i, shift + i, tail)));
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ResizerTensorInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method,
+            SimdTensorFormatType format, SimdTensorDataType type, const float* scale, const float* shift, SimdBool letterbox, float fill)
+        {
+            if (!Base::ResizerTensorValid(srcX, srcY, dstX, dstY, channels, method, format, type))
+                return NULL;
+            ResTensorParam tensor(srcX, srcY, dstX, dstY, format, type, letterbox, fill);
+            ResParam param(srcX, srcY, tensor.imgW, tensor.imgH, channels, SimdResizeChannelByte, method, sizeof(__m512i));
+            return new ResizerTensor(param, tensor, scale, shift);
+        }
+    }
+#endif
+}
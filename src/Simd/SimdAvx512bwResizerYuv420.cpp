@@ -0,0 +1,69 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        ResizerYuv420::ResizerYuv420(const ResParam& param, SimdPixelFormatType format, SimdYuvType yuvType)
+            : Avx2::ResizerYuv420(param, format, yuvType)
+        {
+            _convert = format == SimdPixelFormatRgb24 ? Avx512bw::Yuv444pToRgbV2 : Avx512bw::Yuv444pToBgrV2;
+        }
+
+        SIMD_INLINE void ResizerYuv420RowY(const uint16_t* src0, const uint16_t* src1, __m512i fy0, __m512i fy1, uint8_t* dst, __mmask32 tail = -1)
+        {
+            __m512i s0 = _mm512_mullo_epi16(_mm512_maskz_loadu_epi16(tail, src0), fy0);
+            __m512i s1 = _mm512_mullo_epi16(_mm512_maskz_loadu_epi16(tail, src1), fy1);
+            __m512i val = _mm512_srli_epi16(_mm512_add_epi16(_mm512_add_epi16(s0, s1), K16_0080), Base::BILINEAR_SHIFT);
+            _mm256_mask_storeu_epi8(dst, tail, _mm512_cvtepi16_epi8(val));
+        }
+
+        void ResizerYuv420::RunY(const uint16_t* src0, const uint16_t* src1, int32_t fy, uint8_t* dst)
+        {
+            size_t width = _param.dstW, widthHA = AlignLo(width, HA), dx = 0;
+            __mmask32 tail = TailMask32(width - widthHA);
+            __m512i fy0 = _mm512_set1_epi16(Base::FRACTION_RANGE - fy);
+            __m512i fy1 = _mm512_set1_epi16(fy);
+            for (; dx < widthHA; dx += HA)
+                ResizerYuv420RowY(src0 + dx, src1 + dx, fy0, fy1, dst + dx);
+            if (dx < width)
+                ResizerYuv420RowY(src0 + dx, src1 + dx, fy0, fy1, dst + dx, tail);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ResizerYuv420Init(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType format, SimdYuvType yuvType, SimdResizeMethodType method)
+        {
+            if (!Base::ResizerYuv420Valid(srcX, srcY, dstX, dstY, format, yuvType, method))
+                return NULL;
+            ResParam param(srcX, srcY, dstX, dstY, 3, SimdResizeChannelByte, method, sizeof(__m512i));
+            return new ResizerYuv420(param, format, yuvType);
+        }
+    }
+#endif
+}
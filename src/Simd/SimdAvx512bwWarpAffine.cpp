@@ -26,6 +26,7 @@
 #include "Simd/SimdCopy.h"
 #include "Simd/SimdUnpack.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdAvx512bw.h"
 #include "Simd/SimdEnable.h"
 #include "Simd/SimdSet.h"
 #include "Simd/SimdLog.h"
@@ -38,41 +39,6 @@ namespace Simd
     namespace Avx512bw
     {
 #if !defined(SIMD_AVX512_FLOOR_CEIL_ABSENT)
-        template<int N> SIMD_INLINE void FillBorder(uint8_t* dst, int count, const __m512i& bv, const uint8_t* bs)
-        {
-            int i = 0, size = count * N, size64 = (int)AlignLo(size, 64);
-            for (; i < size64; i += 64)
-                _mm512_storeu_si512((__m512i*)(dst + i), bv);
-            if (i < size)
-            {
-                __mmask64 mask = TailMask64(size - size64);
-                _mm512_mask_storeu_epi8(dst + i, mask, bv);
-            }
-        }
-
-        template<> SIMD_INLINE void FillBorder<3>(uint8_t* dst, int count, const __m512i& bv, const uint8_t* bs)
-        {
-            int i = 0, size = count * 3, size3 = size - 3;
-            for (; i < size3; i += 3)
-                Base::CopyPixel<4>(bs, dst + i);
-            for (; i < size; i += 3)
-                Base::CopyPixel<3>(bs, dst + i);
-        }
-
-        template<int N> SIMD_INLINE __m512i InitBorder(const uint8_t* border)
-        {
-            switch (N)
-            {
-            case 1: return _mm512_set1_epi8(*border);
-            case 2: return _mm512_set1_epi16(*(uint16_t*)border);
-            case 3: return _mm512_setzero_si512();
-            case 4: return _mm512_set1_epi32(*(uint32_t*)border);
-            }
-            return _mm512_setzero_si512();
-        }
-
-        //-----------------------------------------------------------------------------------------
-
         SIMD_INLINE __m512i NearestOffset(__m512 x, __m512 y, const __m512* m, __m512i w, __m512i h, __m512i n, __m512i s)
         {
             __m512 dx = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(x, m[0]), _mm512_mul_ps(y, m[1])), m[2]);
@@ -84,121 +50,6 @@ namespace Simd
 
         //-----------------------------------------------------------------------------------------
 
-        template<int N, bool soft> SIMD_INLINE void NearestGather(const uint8_t* src, uint32_t* offset, int count, uint8_t* dst)
-        {
-            int i = 0;
-            for (; i < count; i++, dst += N)
-                Base::CopyPixel<N>(src + offset[i], dst);
-        }
-
-        template<> SIMD_INLINE void NearestGather<3, true>(const uint8_t* src, uint32_t* offset, int count, uint8_t* dst)
-        {
-            int i = 0, count1 = count - 1;
-            for (; i < count1; i++, dst += 3)
-                Base::CopyPixel<4>(src + offset[i], dst);
-            if (i < count)
-                Base::CopyPixel<3>(src + offset[i], dst);
-        }
-
-        template<> SIMD_INLINE void NearestGather<1, false>(const uint8_t* src, uint32_t* offset, int count, uint8_t* dst)
-        {
-            static const __m512i SHUFFLE = SIMD_MM512_SETR_EPI8(
-                0x0, 0x4, 0x8, 0xC, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-                0x0, 0x4, 0x8, 0xC, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-                0x0, 0x4, 0x8, 0xC, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 
-                0x0, 0x4, 0x8, 0xC, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
-            static const __m512i PERMUTE = SIMD_MM512_SETR_EPI32(0x0, 0x4, 0x8, 0xC, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
-            int i = 0, count16 = (int)AlignLo(count, 16);
-            for (; i < count16; i += 16, dst += 16)
-            {
-                __m512i _offs = _mm512_loadu_si512((__m512i*)(offset + i));
-                __m512i _dst = _mm512_i32gather_epi32(_offs, src, 1);
-                _dst = _mm512_permutexvar_epi32(PERMUTE, _mm512_shuffle_epi8(_dst, SHUFFLE));
-                _mm_storeu_si128((__m128i*)dst, _mm512_castsi512_si128(_dst));
-            }
-            if(i < count)
-            {
-                __mmask16 mask = TailMask16(count - count16);
-                __m512i _offs = _mm512_maskz_loadu_epi32(mask, offset + i);
-                __m512i _dst = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, _offs, src, 1);
-                _dst = _mm512_permutexvar_epi32(PERMUTE, _mm512_shuffle_epi8(_dst, SHUFFLE));
-                _mm_mask_storeu_epi8(dst, mask, _mm512_castsi512_si128(_dst));
-            }
-        }
-
-        template<> SIMD_INLINE void NearestGather<2, false>(const uint8_t* src, uint32_t* offset, int count, uint8_t* dst)
-        {
-            static const __m512i SHUFFLE = SIMD_MM512_SETR_EPI8(
-                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1,
-                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1,
-                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1,
-                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1);
-            static const __m512i PERMUTE = SIMD_MM512_SETR_EPI64(0x0, 0x2, 0x4, 0x6, 0, 0, 0, 0);
-            int i = 0, count16 = (int)AlignLo(count, 16);
-            for (; i < count16; i += 16, dst += 32)
-            {
-                __m512i _offs = _mm512_loadu_si512((__m512i*)(offset + i));
-                __m512i _dst = _mm512_i32gather_epi32(_offs, src, 1);
-                _dst = _mm512_permutexvar_epi64(PERMUTE, _mm512_shuffle_epi8(_dst, SHUFFLE));
-                _mm256_storeu_si256((__m256i*)dst, _mm512_castsi512_si256(_dst));
-            }
-            if (i < count)
-            {
-                __mmask16 mask = TailMask16(count - count16);
-                __m512i _offs = _mm512_maskz_loadu_epi32(mask, offset + i);
-                __m512i _dst = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, _offs, src, 1);
-                _dst = _mm512_permutexvar_epi64(PERMUTE, _mm512_shuffle_epi8(_dst, SHUFFLE));
-                _mm256_mask_storeu_epi16(dst, mask, _mm512_castsi512_si256(_dst));
-            }
-        }
-
-        template<> SIMD_INLINE void NearestGather<3, false>(const uint8_t* src, uint32_t* offset, int count, uint8_t* dst)
-        {
-            static const __m512i SHUFFLE = SIMD_MM512_SETR_EPI8(
-                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
-                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
-                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
-                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
-            static const __m512i PERMUTE = SIMD_MM512_SETR_EPI32(0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, 0, 0, 0, 0);
-            int i = 0, count16 = (int)AlignLo(count, 16), count1 = count - 1;
-            for (; i < count16; i += 16, dst += 48)
-            {
-                __m512i _offs = _mm512_loadu_si512((__m512i*)(offset + i));
-                __m512i _dst = _mm512_i32gather_epi32(_offs, src, 1);
-                _dst = _mm512_permutexvar_epi32(PERMUTE, _mm512_shuffle_epi8(_dst, SHUFFLE));
-                _mm512_mask_storeu_epi8(dst, 0x0000FFFFFFFFFFFF, _dst);
-            }
-            if (i < count)
-            {
-                __mmask16 srcMask = TailMask16(count - count16);
-                __mmask64 dstMask = TailMask64((count - count16) * 3);
-                __m512i _offs = _mm512_maskz_loadu_epi32(srcMask, offset + i);
-                __m512i _dst = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), srcMask, _offs, src, 1);
-                _dst = _mm512_permutexvar_epi32(PERMUTE, _mm512_shuffle_epi8(_dst, SHUFFLE));
-                _mm512_mask_storeu_epi8(dst, dstMask, _dst);
-            }
-        }
-
-        template<> SIMD_INLINE void NearestGather<4, false>(const uint8_t* src, uint32_t* offset, int count, uint8_t* dst)
-        {
-            int i = 0, count16 = (int)AlignLo(count, 16);
-            for (; i < count16; i += 16, dst += 64)
-            {
-                __m512i _offs = _mm512_loadu_si512((__m512i*)(offset + i));
-                __m512i _dst = _mm512_i32gather_epi32(_offs, src, 1);
-                _mm512_storeu_si512((__m512i*)dst, _dst);
-            }
-            if (i < count)
-            {
-                __mmask16 mask = TailMask16(count - count16);
-                __m512i _offs = _mm512_maskz_loadu_epi32(mask, offset + i);
-                __m512i _dst = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, _offs, src, 1);
-                _mm512_mask_storeu_epi32(dst, mask, _dst);
-            }
-        }
-
-        //-----------------------------------------------------------------------------------------
-
         template<int N, bool soft> void NearestRun(const WarpAffParam& p, int yBeg, int yEnd, const int32_t* beg, const int32_t* end, const uint8_t* src, uint8_t* dst, uint32_t* buf)
         {
             bool fill = p.NeedFill();
@@ -242,12 +93,16 @@ namespace Simd
             : Avx2::WarpAffineNearest(param)
         {
             bool soft = Avx2::SlowGather;
-            switch (_param.channels)
+            switch (_param.PixelSize())
             {
             case 1: _run = soft ? NearestRun<1, true> : NearestRun<1, false>; break;
             case 2: _run = soft ? NearestRun<2, true> : NearestRun<2, false>; break;
             case 3: _run = soft ? NearestRun<3, true> : NearestRun<3, false>; break;
             case 4: _run = soft ? NearestRun<4, true> : NearestRun<4, false>; break;
+            case 6: _run = NearestRun<6, true>; break;
+            case 8: _run = NearestRun<8, true>; break;
+            case 12: _run = NearestRun<12, true>; break;
+            case 16: _run = NearestRun<16, true>; break;
             }
         }
 
@@ -351,9 +206,6 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
-        const __m512i K32_WA_FRACTION_RANGE = SIMD_MM512_SET1_EPI32(Base::WA_FRACTION_RANGE);
-        const __m512i K32_WA_BILINEAR_ROUND_TERM = SIMD_MM512_SET1_EPI32(Base::WA_BILINEAR_ROUND_TERM);
-
         SIMD_INLINE void ByteBilinearPrepMain16(__m512 x, __m512 y, const __m512* m, __m512i n, __m512i s, uint32_t* offs, uint8_t* fx, uint16_t* fy)
         {
             __m512 dx = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(x, m[0]), _mm512_mul_ps(y, m[1])), m[2]);
@@ -401,225 +253,6 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
-        template<int N, bool soft> SIMD_INLINE void ByteBilinearGather(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
-        {
-            int i = 0;
-            for (; i < count; i++, dst0 += 2 * N, dst1 += 2 * N)
-            {
-                int offs = offset[i];
-                Base::CopyPixel<N * 2>(src0 + offs, dst0);
-                Base::CopyPixel<N * 2>(src1 + offs, dst1);
-            }
-        }
-
-        template<> SIMD_INLINE void ByteBilinearGather<1, false>(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
-        {
-            static const __m512i SHUFFLE = SIMD_MM512_SETR_EPI8(
-                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1,
-                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1,
-                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1,
-                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1);
-            static const __m512i PERMUTE = SIMD_MM512_SETR_EPI64(0x0, 0x2, 0x4, 0x6, 0, 0, 0, 0);
-            int i = 0, count16 = (int)AlignLo(count, 16);
-            for (; i < count16; i += 16, dst0 += 32, dst1 += 32)
-            {
-                __m512i _offs = _mm512_loadu_si512((__m512i*)(offset + i));
-                __m512i _dst0 = _mm512_shuffle_epi8(_mm512_i32gather_epi32(_offs, src0, 1), SHUFFLE);
-                _mm256_storeu_si256((__m256i*)dst0, _mm512_castsi512_si256(_mm512_permutexvar_epi64(PERMUTE, _dst0)));
-                __m512i _dst1 = _mm512_shuffle_epi8(_mm512_i32gather_epi32(_offs, src1, 1), SHUFFLE);
-                _mm256_storeu_si256((__m256i*)dst1, _mm512_castsi512_si256(_mm512_permutexvar_epi64(PERMUTE, _dst1)));
-            }
-            if (i < count)
-            {
-                __mmask16 mask = __mmask16(-1) >> (16 + count16 - count);
-                __m512i _offs = _mm512_maskz_loadu_epi32(mask, offset + i);
-                __m512i _dst0 = _mm512_shuffle_epi8(_mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, _offs, src0, 1), SHUFFLE);
-                _mm256_mask_storeu_epi16(dst0, mask, _mm512_castsi512_si256(_mm512_permutexvar_epi64(PERMUTE, _dst0)));
-                __m512i _dst1 = _mm512_shuffle_epi8(_mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, _offs, src1, 1), SHUFFLE);
-                _mm256_mask_storeu_epi16(dst1, mask, _mm512_castsi512_si256(_mm512_permutexvar_epi64(PERMUTE, _dst1)));
-            }
-        }
-
-        template<> SIMD_INLINE void ByteBilinearGather<2, false>(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
-        {
-            int i = 0, count16 = (int)AlignLo(count, 16);
-            for (; i < count16; i += 16, dst0 += 64, dst1 += 64)
-            {
-                __m512i _offs = _mm512_loadu_si512((__m512i*)(offset + i));
-                _mm512_storeu_si512((__m512i*)dst0, _mm512_i32gather_epi32(_offs, src0, 1));
-                _mm512_storeu_si512((__m512i*)dst1, _mm512_i32gather_epi32(_offs, src1, 1));
-            }
-            if(i < count)
-            {
-                __mmask16 mask = __mmask16(-1) >> (16 + count16 - count);
-                __m512i _offs = _mm512_maskz_loadu_epi32(mask, offset + i);
-                _mm512_mask_storeu_epi32(dst0, mask, _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, _offs, src0, 1));
-                _mm512_mask_storeu_epi32(dst1, mask, _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, _offs, src1, 1));
-            }
-        }
-
-        template<> SIMD_INLINE void ByteBilinearGather<4, false>(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
-        {
-            int i = 0, count8 = (int)AlignLo(count, 8);
-            for (; i < count8; i += 8, dst0 += 64, dst1 += 64)
-            {
-                __m256i _offs = _mm256_loadu_si256((__m256i*)(offset + i));
-                _mm512_storeu_si512((__m512i*)dst0, _mm512_i32gather_epi64(_offs, src0, 1));
-                _mm512_storeu_si512((__m512i*)dst1, _mm512_i32gather_epi64(_offs, src1, 1));
-            }
-            if (i < count)
-            {
-                __mmask8 mask = __mmask8(-1) >> (8 + count8 - count);
-                __m256i _offs = _mm256_maskz_loadu_epi32(mask, offset + i);
-                _mm512_mask_storeu_epi64(dst0, mask, _mm512_mask_i32gather_epi64(_mm512_setzero_si512(), mask, _offs, src0, 1));
-                _mm512_mask_storeu_epi64(dst1, mask, _mm512_mask_i32gather_epi64(_mm512_setzero_si512(), mask, _offs, src1, 1));
-            }
-        }
-
-        //-------------------------------------------------------------------------------------------------
-
-        template<int N> void ByteBilinearInterpMainN(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst, int count);
-
-        template<> SIMD_INLINE void ByteBilinearInterpMainN<1>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst, int count)
-        {
-            __m512i fx0 = _mm512_loadu_si512((__m512i*)fx + 0);
-            __m512i fx1 = _mm512_loadu_si512((__m512i*)fx + 1);
-            __m512i r00 = _mm512_maddubs_epi16(_mm512_loadu_si512((__m512i*)src0 + 0), fx0);
-            __m512i r01 = _mm512_maddubs_epi16(_mm512_loadu_si512((__m512i*)src0 + 1), fx1);
-            __m512i r10 = _mm512_maddubs_epi16(_mm512_loadu_si512((__m512i*)src1 + 0), fx0);
-            __m512i r11 = _mm512_maddubs_epi16(_mm512_loadu_si512((__m512i*)src1 + 1), fx1);
-
-            __m512i s0 = _mm512_madd_epi16(UnpackU16<0>(r00, r10), Load<false>((__m128i*)fy + 0x0, (__m128i*)fy + 0x2, (__m128i*)fy + 0x4, (__m128i*)fy + 0x6));
-            __m512i d0 = _mm512_srli_epi32(_mm512_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m512i s1 = _mm512_madd_epi16(UnpackU16<1>(r00, r10), Load<false>((__m128i*)fy + 0x1, (__m128i*)fy + 0x3, (__m128i*)fy + 0x5, (__m128i*)fy + 0x7));
-            __m512i d1 = _mm512_srli_epi32(_mm512_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m512i s2 = _mm512_madd_epi16(UnpackU16<0>(r01, r11), Load<false>((__m128i*)fy + 0x8, (__m128i*)fy + 0xA, (__m128i*)fy + 0xC, (__m128i*)fy + 0xE));
-            __m512i d2 = _mm512_srli_epi32(_mm512_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m512i s3 = _mm512_madd_epi16(UnpackU16<1>(r01, r11), Load<false>((__m128i*)fy + 0x9, (__m128i*)fy + 0xB, (__m128i*)fy + 0xD, (__m128i*)fy + 0xF));
-            __m512i d3 = _mm512_srli_epi32(_mm512_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __mmask64 mask = __mmask64(-1) >> (64 - count * 1);
-            _mm512_mask_storeu_epi8(dst, mask, PackI16ToU8(_mm512_packus_epi32(d0, d1), _mm512_packus_epi32(d2, d3)));
-        }
-
-        template<> SIMD_INLINE void ByteBilinearInterpMainN<2>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst, int count)
-        {
-            static const __m512i SHUFFLE = SIMD_MM512_SETR_EPI8(
-                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF,
-                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF,
-                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF,
-                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF);
-
-            __m512i _fx = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, _mm512_loadu_si512((__m512i*)fx));
-            __m512i fx0 = UnpackU16<0>(_fx, _fx);
-            __m512i fx1 = UnpackU16<1>(_fx, _fx);
-            __m512i r00 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src0 + 0), SHUFFLE), fx0);
-            __m512i r01 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src0 + 1), SHUFFLE), fx1);
-            __m512i r10 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src1 + 0), SHUFFLE), fx0);
-            __m512i r11 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src1 + 1), SHUFFLE), fx1);
-
-            __m512i fy0 = _mm512_loadu_si512((__m512i*)fy + 0);
-            __m512i s0 = _mm512_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
-            __m512i d0 = _mm512_srli_epi32(_mm512_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m512i s1 = _mm512_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
-            __m512i d1 = _mm512_srli_epi32(_mm512_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m512i fy1 = _mm512_loadu_si512((__m512i*)fy + 1);
-            __m512i s2 = _mm512_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
-            __m512i d2 = _mm512_srli_epi32(_mm512_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m512i s3 = _mm512_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
-            __m512i d3 = _mm512_srli_epi32(_mm512_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __mmask64 mask = __mmask64(-1) >> (64 - count * 2);
-            _mm512_mask_storeu_epi8(dst, mask, PackI16ToU8(_mm512_packus_epi32(d0, d1), _mm512_packus_epi32(d2, d3)));
-        }
-
-        template<> SIMD_INLINE void ByteBilinearInterpMainN<3>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst, int count)
-        {
-            static const __m512i SRC_SHUFFLE = SIMD_MM512_SETR_EPI8(
-                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1,
-                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1,
-                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1,
-                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1);
-            static const __m512i DST_SHUFFLE = SIMD_MM512_SETR_EPI8(
-                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
-                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
-                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
-                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
-            static const __m512i DST_PERMUTE = SIMD_MM512_SETR_EPI32(0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, 0x0, 0x0, 0x0, 0x0);
-
-            __m512i _fx = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, _mm512_loadu_si512((__m512i*)fx));
-            _fx = UnpackU16<0>(_fx, _fx);
-            __m512i fx0 = UnpackU16<0>(_fx, _fx);
-            __m512i fx1 = UnpackU16<1>(_fx, _fx);
-            __m512i r00 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src0 + 0), SRC_SHUFFLE), fx0);
-            __m512i r01 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src0 + 1), SRC_SHUFFLE), fx1);
-            __m512i r10 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src1 + 0), SRC_SHUFFLE), fx0);
-            __m512i r11 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src1 + 1), SRC_SHUFFLE), fx1);
-
-            __m512i _fy = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, _mm512_loadu_si512((__m512i*)fy));
-            __m512i fy0 = UnpackU32<0>(_fy, _fy);
-            __m512i s0 = _mm512_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
-            __m512i d0 = _mm512_srli_epi32(_mm512_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m512i s1 = _mm512_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
-            __m512i d1 = _mm512_srli_epi32(_mm512_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m512i fy1 = UnpackU32<1>(_fy, _fy);
-            __m512i s2 = _mm512_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
-            __m512i d2 = _mm512_srli_epi32(_mm512_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m512i s3 = _mm512_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
-            __m512i d3 = _mm512_srli_epi32(_mm512_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __mmask64 mask = __mmask64(-1) >> (64 - count * 3);
-            __m512i _dst = PackI16ToU8(_mm512_packus_epi32(d0, d1), _mm512_packus_epi32(d2, d3));
-            _mm512_mask_storeu_epi8(dst, mask, _mm512_permutexvar_epi32(DST_PERMUTE, _mm512_shuffle_epi8(_dst, DST_SHUFFLE)));
-        }
-
-        template<> SIMD_INLINE void ByteBilinearInterpMainN<4>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst, int count)
-        {
-            static const __m512i SHUFFLE = SIMD_MM512_SETR_EPI8(
-                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF,
-                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF,
-                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF,
-                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF);
-
-            __m512i _fx = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, _mm512_loadu_si512((__m512i*)fx));
-            _fx = UnpackU16<0>(_fx, _fx);
-            __m512i fx0 = UnpackU16<0>(_fx, _fx);
-            __m512i fx1 = UnpackU16<1>(_fx, _fx);
-            __m512i r00 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src0 + 0), SHUFFLE), fx0);
-            __m512i r01 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src0 + 1), SHUFFLE), fx1);
-            __m512i r10 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src1 + 0), SHUFFLE), fx0);
-            __m512i r11 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src1 + 1), SHUFFLE), fx1);
-
-            __m512i _fy = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, _mm512_loadu_si512((__m512i*)fy));
-            __m512i fy0 = UnpackU32<0>(_fy, _fy);
-            __m512i s0 = _mm512_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
-            __m512i d0 = _mm512_srli_epi32(_mm512_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m512i s1 = _mm512_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
-            __m512i d1 = _mm512_srli_epi32(_mm512_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m512i fy1 = UnpackU32<1>(_fy, _fy);
-            __m512i s2 = _mm512_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
-            __m512i d2 = _mm512_srli_epi32(_mm512_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m512i s3 = _mm512_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
-            __m512i d3 = _mm512_srli_epi32(_mm512_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __mmask64 mask = __mmask64(-1) >> (64 - count * 4);
-            _mm512_mask_storeu_epi8(dst, mask, PackI16ToU8(_mm512_packus_epi32(d0, d1), _mm512_packus_epi32(d2, d3)));
-        }
-
-        //-------------------------------------------------------------------------------------------------
-
         template<int N, bool soft> void ByteBilinearRun(const WarpAffParam& p, int yBeg, int yEnd, const int* ib, const int* ie, const int* ob, const int* oe, const uint8_t* src, uint8_t* dst, uint8_t* buf)
         {
             constexpr int M = (N == 3 ? 4 : N);
@@ -794,6 +427,184 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        template<class T> SIMD_INLINE void InterpGather2(const uint8_t* src, __m512i offs, __mmask16 mask, __m512& t0, __m512& t1);
+
+        template<> SIMD_INLINE void InterpGather2<float>(const uint8_t* src, __m512i offs, __mmask16 mask, __m512& t0, __m512& t1)
+        {
+            t0 = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), mask, offs, (float*)src + 0, 1);
+            t1 = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), mask, offs, (float*)src + 1, 1);
+        }
+
+        template<> SIMD_INLINE void InterpGather2<uint16_t>(const uint8_t* src, __m512i offs, __mmask16 mask, __m512& t0, __m512& t1)
+        {
+            __m512i val = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, offs, (int32_t*)src, 1);
+            t0 = _mm512_cvtepi32_ps(_mm512_and_si512(val, K32_0000FFFF));
+            t1 = _mm512_cvtepi32_ps(_mm512_srli_epi32(val, 16));
+        }
+
+        SIMD_INLINE void InterpStore16(__m512 value, float* dst, __mmask16 mask)
+        {
+            _mm512_mask_storeu_ps(dst, mask, value);
+        }
+
+        SIMD_INLINE void InterpStore16(__m512 value, uint16_t* dst, __mmask16 mask)
+        {
+            __m512i i32 = _mm512_max_epi32(_mm512_cvtps_epi32(value), _mm512_setzero_si512());
+            _mm256_mask_storeu_epi16(dst, mask, _mm512_cvtusepi32_epi16(i32));
+        }
+
+        SIMD_INLINE void CubicWeights(__m512 d, __m512* w)
+        {
+            __m512 _1 = _mm512_set1_ps(1.0f), _2 = _mm512_set1_ps(2.0f);
+            __m512 nd = _mm512_sub_ps(_mm512_setzero_ps(), d), d1 = _mm512_sub_ps(_1, d), d2 = _mm512_sub_ps(_2, d), dp = _mm512_add_ps(_1, d);
+            w[0] = _mm512_div_ps(_mm512_mul_ps(_mm512_mul_ps(nd, d1), d2), _mm512_set1_ps(6.0f));
+            w[1] = _mm512_div_ps(_mm512_mul_ps(_mm512_mul_ps(d1, dp), d2), _2);
+            w[2] = _mm512_div_ps(_mm512_mul_ps(_mm512_mul_ps(d, dp), d2), _2);
+            w[3] = _mm512_div_ps(_mm512_mul_ps(_mm512_mul_ps(nd, d1), dp), _mm512_set1_ps(6.0f));
+        }
+
+        template<class T, int K> struct Interp1;
+
+        template<class T> struct Interp1<T, 2>
+        {
+            static SIMD_INLINE void Main(const uint8_t* src, int s, const uint32_t* offs, const float* fx, const float* fy, const int32_t* coef, uint8_t* dst, __mmask16 mask)
+            {
+                __m512i o = _mm512_maskz_loadu_epi32(mask, offs);
+                __m512 t00, t01, t10, t11;
+                InterpGather2<T>(src, o, mask, t00, t01);
+                InterpGather2<T>(src + s, o, mask, t10, t11);
+                __m512 kx1 = _mm512_maskz_loadu_ps(mask, fx), kx0 = _mm512_sub_ps(_mm512_set1_ps(1.0f), kx1);
+                __m512 ky1 = _mm512_maskz_loadu_ps(mask, fy), ky0 = _mm512_sub_ps(_mm512_set1_ps(1.0f), ky1);
+                __m512 r0 = _mm512_add_ps(_mm512_mul_ps(t00, kx0), _mm512_mul_ps(t01, kx1));
+                __m512 r1 = _mm512_add_ps(_mm512_mul_ps(t10, kx0), _mm512_mul_ps(t11, kx1));
+                InterpStore16(_mm512_add_ps(_mm512_mul_ps(r0, ky0), _mm512_mul_ps(r1, ky1)), (T*)dst, mask);
+            }
+        };
+
+        template<class T> struct Interp1<T, 4>
+        {
+            static SIMD_INLINE __m512 Row(const uint8_t* src, __m512i offs, __mmask16 mask, const __m512* kx)
+            {
+                __m512 t0, t1, t2, t3;
+                InterpGather2<T>(src, offs, mask, t0, t1);
+                InterpGather2<T>(src + 2 * sizeof(T), offs, mask, t2, t3);
+                __m512 sum = _mm512_mul_ps(t0, kx[0]);
+                sum = _mm512_add_ps(sum, _mm512_mul_ps(t1, kx[1]));
+                sum = _mm512_add_ps(sum, _mm512_mul_ps(t2, kx[2]));
+                return _mm512_add_ps(sum, _mm512_mul_ps(t3, kx[3]));
+            }
+
+            static SIMD_INLINE void Main(const uint8_t* src, int s, const uint32_t* offs, const float* fx, const float* fy, const int32_t* coef, uint8_t* dst, __mmask16 mask)
+            {
+                __m512i o = _mm512_maskz_loadu_epi32(mask, offs);
+                __m512 kx[4], ky[4];
+                CubicWeights(_mm512_maskz_loadu_ps(mask, fx), kx);
+                CubicWeights(_mm512_maskz_loadu_ps(mask, fy), ky);
+                __m512 sum = _mm512_mul_ps(Row(src + 0 * s, o, mask, kx), ky[0]);
+                sum = _mm512_add_ps(sum, _mm512_mul_ps(Row(src + 1 * s, o, mask, kx), ky[1]));
+                sum = _mm512_add_ps(sum, _mm512_mul_ps(Row(src + 2 * s, o, mask, kx), ky[2]));
+                sum = _mm512_add_ps(sum, _mm512_mul_ps(Row(src + 3 * s, o, mask, kx), ky[3]));
+                InterpStore16(sum, (T*)dst, mask);
+            }
+        };
+
+        template<> struct Interp1<uint8_t, 4>
+        {
+            static SIMD_INLINE __m512i Index(const float* f, __mmask16 mask)
+            {
+                __m512i index = _mm512_cvtps_epi32(_mm512_mul_ps(_mm512_maskz_loadu_ps(mask, f), _mm512_set1_ps((float)Base::WA_BICUBIC_FRACTION_RANGE)));
+                return _mm512_min_epi32(_mm512_max_epi32(index, _mm512_setzero_si512()), _mm512_set1_epi32(Base::WA_BICUBIC_FRACTION_RANGE));
+            }
+
+            static SIMD_INLINE __m512i Row(const uint8_t* src, __m512i offs, __mmask16 mask, __m512i kx)
+            {
+                __m512i taps = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, offs, (int32_t*)src, 1);
+                return _mm512_madd_epi16(_mm512_maddubs_epi16(taps, kx), K16_0001);
+            }
+
+            static SIMD_INLINE void Main(const uint8_t* src, int s, const uint32_t* offs, const float* fx, const float* fy, const int32_t* coef, uint8_t* dst, __mmask16 mask)
+            {
+                __m512i o = _mm512_maskz_loadu_epi32(mask, offs);
+                __m512i kx = _mm512_i32gather_epi32(Index(fx, mask), coef, 4);
+                __m512i iy = _mm512_slli_epi32(Index(fy, mask), 1);
+                __m512i ky01 = _mm512_i32gather_epi32(iy, coef + Base::WA_BICUBIC_FRACTION_RANGE + 1, 4);
+                __m512i ky23 = _mm512_i32gather_epi32(iy, coef + Base::WA_BICUBIC_FRACTION_RANGE + 2, 4);
+                __m512i sum = _mm512_mullo_epi32(Row(src + 0 * s, o, mask, kx), _mm512_srai_epi32(_mm512_slli_epi32(ky01, 16), 16));
+                sum = _mm512_add_epi32(sum, _mm512_mullo_epi32(Row(src + 1 * s, o, mask, kx), _mm512_srai_epi32(ky01, 16)));
+                sum = _mm512_add_epi32(sum, _mm512_mullo_epi32(Row(src + 2 * s, o, mask, kx), _mm512_srai_epi32(_mm512_slli_epi32(ky23, 16), 16)));
+                sum = _mm512_add_epi32(sum, _mm512_mullo_epi32(Row(src + 3 * s, o, mask, kx), _mm512_srai_epi32(ky23, 16)));
+                sum = _mm512_srai_epi32(_mm512_add_epi32(sum, _mm512_set1_epi32(Base::WA_BICUBIC_ROUND_TERM)), Base::WA_BICUBIC_SHIFT);
+                _mm_mask_storeu_epi8(dst, mask, _mm512_cvtusepi32_epi8(_mm512_max_epi32(sum, _mm512_setzero_si512())));
+            }
+        };
+
+        template<class T, int K> void InterpRun1(const WarpAffParam& p, int yBeg, int yEnd, const int* range, const float* cx, const float* cy, const int32_t* coef, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            const int P = sizeof(T), A = K / 2 - 1;
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW, height = (int)p.dstH, s = (int)p.srcS, w = (int)p.srcW, h = (int)p.srcH, xs = (int)p.CoordStride();
+            const int* ib = range + 0 * height, * ie = range + 1 * height, * ob = range + 2 * height, * oe = range + 3 * height;
+            uint32_t* offs = (uint32_t*)buf;
+            float* fx = (float*)(offs + xs);
+            float* fy = fx + xs;
+            __m512i _border = InitBorder<P>(p.border);
+            __m512i _min = _mm512_set1_epi32(A), _maxX = _mm512_set1_epi32(w - K + A), _maxY = _mm512_set1_epi32(h - K + A);
+            __m512i _p = _mm512_set1_epi32(P), _s = _mm512_set1_epi32(s), _a = _mm512_set1_epi32(A * P + A * s);
+            dst += yBeg * p.dstS;
+            for (int y = yBeg; y < yEnd; ++y)
+            {
+                float yx = cy[2 * y + 0], yy = cy[2 * y + 1];
+                int iB = ib[y], iE = ie[y], oB = ob[y], oE = oe[y];
+                if (fill)
+                    FillBorder<P>(dst, oB, _border, p.border);
+                for (int x = oB; x < iB; ++x)
+                    Base::InterpEdge<T, 1, K>(cx[x] + yx, cx[x + xs] + yy, w, h, s, src, coef, fill ? p.border : dst + x * P, dst + x * P);
+                {
+                    __m512 _yx = _mm512_set1_ps(yx), _yy = _mm512_set1_ps(yy);
+                    for (int x = iB; x < iE; x += 16)
+                    {
+                        __m512 dx = _mm512_add_ps(_mm512_loadu_ps(cx + x), _yx);
+                        __m512 dy = _mm512_add_ps(_mm512_loadu_ps(cx + x + xs), _yy);
+                        __m512i ix = _mm512_min_epi32(_mm512_max_epi32(_mm512_cvtps_epi32(_mm512_floor_ps(dx)), _min), _maxX);
+                        __m512i iy = _mm512_min_epi32(_mm512_max_epi32(_mm512_cvtps_epi32(_mm512_floor_ps(dy)), _min), _maxY);
+                        _mm512_storeu_si512((__m512i*)(offs + x), _mm512_sub_epi32(_mm512_add_epi32(_mm512_mullo_epi32(ix, _p), _mm512_mullo_epi32(iy, _s)), _a));
+                        _mm512_storeu_ps(fx + x, _mm512_sub_ps(dx, _mm512_cvtepi32_ps(ix)));
+                        _mm512_storeu_ps(fy + x, _mm512_sub_ps(dy, _mm512_cvtepi32_ps(iy)));
+                    }
+                    int x = iB, iE16 = iB + (int)AlignLo(iE - iB, 16);
+                    for (; x < iE16; x += 16)
+                        Interp1<T, K>::Main(src, s, offs + x, fx + x, fy + x, coef, dst + x * P, __mmask16(-1));
+                    if (x < iE)
+                        Interp1<T, K>::Main(src, s, offs + x, fx + x, fy + x, coef, dst + x * P, TailMask16(iE - x));
+                }
+                for (int x = iE; x < oE; ++x)
+                    Base::InterpEdge<T, 1, K>(cx[x] + yx, cx[x + xs] + yy, w, h, s, src, coef, fill ? p.border : dst + x * P, dst + x * P);
+                if (fill)
+                    FillBorder<P>(dst + oE * P, width - oE, _border, p.border);
+                dst += p.dstS;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        WarpAffineInterp::WarpAffineInterp(const WarpAffParam& param)
+            : Avx2::WarpAffineInterp(param)
+        {
+            if (_param.channels == 1 && !Avx2::SlowGather)
+            {
+                bool cubic = _param.IsBicubic();
+                switch (_param.Channel())
+                {
+                case SimdWarpAffineChannelByte: _run = InterpRun1<uint8_t, 4>; break;
+                case SimdWarpAffineChannelShort: _run = cubic ? InterpRun1<uint16_t, 4> : InterpRun1<uint16_t, 2>; break;
+                case SimdWarpAffineChannelFloat: _run = cubic ? InterpRun1<float, 4> : InterpRun1<float, 2>; break;
+                default: break;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
         void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
         {
             WarpAffParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, mat, flags, border, A);
@@ -804,7 +615,7 @@ namespace Simd
             else if (param.IsByteBilinear())
                 return new WarpAffineByteBilinear(param);
             else
-                return NULL;
+                return new WarpAffineInterp(param);
         }
 #else
         void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
@@ -817,9 +628,28 @@ namespace Simd
             else if (param.IsByteBilinear())
                 return new Avx2::WarpAffineByteBilinear(param);
             else
-                return NULL;
+                return new Avx2::WarpAffineInterp(param);
         }
 #endif
+
+        //-----------------------------------------------------------------------------------------
+
+        WarpAffineBatch::WarpAffineBatch(const WarpAffParam& param, SimdTensorDataType type, const float* lower, const float* upper)
+            : Base::WarpAffineBatch(param, type, lower, upper)
+        {
+            _warpAffineInit = WarpAffineInit;
+            _synetSetInput = SynetSetInput;
+        }
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border, SimdTensorDataType type, const float* lower, const float* upper)
+        {
+            static const float identity[6] = { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+            WarpAffParam param(srcW, srcH, srcS, dstW, dstH, 0, channels, identity, flags, border, A);
+            param.dstS = dstW * param.PixelSize();
+            if (!Base::WarpAffineBatchValid(param, type, lower, upper))
+                return NULL;
+            return new WarpAffineBatch(param, type, lower, upper);
+        }
     }
 #endif
 }
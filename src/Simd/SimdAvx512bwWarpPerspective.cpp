@@ -0,0 +1,227 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdWarpPerspective.h"
+#include "Simd/SimdWarpAffineCommon.h"
+#include "Simd/SimdCopy.h"
+#include "Simd/SimdUnpack.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdAvx512bw.h"
+#include "Simd/SimdEnable.h"
+#include "Simd/SimdSet.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+#if !defined(SIMD_AVX512_FLOOR_CEIL_ABSENT)
+        SIMD_INLINE void PerspectiveCoord(const float* cx, size_t xs, const __m512* cy, __m512& dx, __m512& dy)
+        {
+            __m512 dz = _mm512_div_ps(_mm512_set1_ps(1.0f), _mm512_add_ps(_mm512_loadu_ps(cx + 2 * xs), cy[2]));
+            dx = _mm512_mul_ps(_mm512_add_ps(_mm512_loadu_ps(cx), cy[0]), dz);
+            dy = _mm512_mul_ps(_mm512_add_ps(_mm512_loadu_ps(cx + xs), cy[1]), dz);
+        }
+
+        SIMD_INLINE __m512i PerspNearestOffset(const float* cx, size_t xs, const __m512* cy, __m512i w, const __m512i& h, const __m512i& n, const __m512i& s)
+        {
+            __m512 dx, dy;
+            PerspectiveCoord(cx, xs, cy, dx, dy);
+            __m512i ix = _mm512_min_epi32(_mm512_max_epi32(_mm512_cvtps_epi32(dx), _mm512_setzero_si512()), w);
+            __m512i iy = _mm512_min_epi32(_mm512_max_epi32(_mm512_cvtps_epi32(dy), _mm512_setzero_si512()), h);
+            return _mm512_add_epi32(_mm512_mullo_epi32(ix, n), _mm512_mullo_epi32(iy, s));
+        }
+
+        template<int N, bool soft> void PerspNearestRun(const WarpPersParam& p, int yBeg, int yEnd, const float* cx, const float* cy, const int32_t* beg, const int32_t* end, const uint8_t* src, uint8_t* dst, uint32_t* buf)
+        {
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW, s = (int)p.srcS, w = (int)p.srcW - 1, h = (int)p.srcH - 1;
+            size_t xs = p.CoordStride();
+            __m512 _cy[3];
+            __m512i _w = _mm512_set1_epi32(w);
+            __m512i _h = _mm512_set1_epi32(h);
+            __m512i _n = _mm512_set1_epi32(N);
+            __m512i _s = _mm512_set1_epi32(s);
+            __m512i _border = InitBorder<N>(p.border);
+            dst += yBeg * p.dstS;
+            for (int y = yBeg; y < yEnd; ++y)
+            {
+                const float* cr = cy + 3 * y;
+                for (int i = 0; i < 3; ++i)
+                    _cy[i] = _mm512_set1_ps(cr[i]);
+                int nose = beg[y], tail = end[y];
+                for (int x = nose; x < tail; x += 16)
+                    _mm512_storeu_si512((__m512i*)(buf + x), PerspNearestOffset(cx + x, xs, _cy, _w, _h, _n, _s));
+                if (fill)
+                    FillBorder<N>(dst, nose, _border, p.border);
+                NearestGather<N, soft>(src, buf + nose, tail - nose, dst + N * nose);
+                if (fill)
+                    FillBorder<N>(dst + tail * N, width - tail, _border, p.border);
+                dst += p.dstS;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        WarpPerspectiveNearest::WarpPerspectiveNearest(const WarpPersParam& param)
+            : Avx2::WarpPerspectiveNearest(param)
+        {
+            bool soft = Avx2::SlowGather;
+            switch (_param.channels)
+            {
+            case 1: _run = soft ? PerspNearestRun<1, true> : PerspNearestRun<1, false>; break;
+            case 2: _run = soft ? PerspNearestRun<2, true> : PerspNearestRun<2, false>; break;
+            case 3: _run = soft ? PerspNearestRun<3, true> : PerspNearestRun<3, false>; break;
+            case 4: _run = soft ? PerspNearestRun<4, true> : PerspNearestRun<4, false>; break;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE void PerspByteBilinearPrepMain16(const float* cx, size_t xs, const __m512* cy, const __m512* wh, __m512i n, const __m512i& s, uint32_t* offs, uint8_t* fx, uint16_t* fy)
+        {
+            __m512 dx, dy;
+            PerspectiveCoord(cx, xs, cy, dx, dy);
+            dx = _mm512_min_ps(_mm512_max_ps(dx, _mm512_setzero_ps()), wh[0]);
+            dy = _mm512_min_ps(_mm512_max_ps(dy, _mm512_setzero_ps()), wh[1]);
+            __m512 ix = _mm512_min_ps(_mm512_floor_ps(dx), wh[2]);
+            __m512 iy = _mm512_min_ps(_mm512_floor_ps(dy), wh[3]);
+            __m512 range = _mm512_cvtepi32_ps(K32_WA_FRACTION_RANGE);
+            __m512i _fx = _mm512_cvtps_epi32(_mm512_mul_ps(_mm512_sub_ps(dx, ix), range));
+            __m512i _fy = _mm512_cvtps_epi32(_mm512_mul_ps(_mm512_sub_ps(dy, iy), range));
+            _mm512_storeu_si512((__m512i*)offs, _mm512_add_epi32(_mm512_mullo_epi32(_mm512_cvtps_epi32(ix), n), _mm512_mullo_epi32(_mm512_cvtps_epi32(iy), s)));
+            _fx = _mm512_or_si512(_mm512_sub_epi32(K32_WA_FRACTION_RANGE, _fx), _mm512_slli_epi32(_fx, 16));
+            _fy = _mm512_or_si512(_mm512_sub_epi32(K32_WA_FRACTION_RANGE, _fy), _mm512_slli_epi32(_fy, 16));
+            _mm256_storeu_si256((__m256i*)fx, _mm512_castsi512_si256(PackI16ToU8(_fx, _mm512_setzero_si512())));
+            _mm512_storeu_si512((__m512i*)fy, _fy);
+        }
+
+        template<int N, bool soft> void PerspByteBilinearRun(const WarpPersParam& p, int yBeg, int yEnd, const float* cx, const float* cy, const int* ib, const int* ie, const int* ob, const int* oe, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            constexpr int M = (N == 3 ? 4 : N);
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW, s = (int)p.srcS, w = (int)p.srcW - 1, h = (int)p.srcH - 1, n = A / M;
+            size_t wa = AlignHi(p.dstW, p.align) + p.align, xs = p.CoordStride();
+            uint32_t* offs = (uint32_t*)buf;
+            uint8_t* fx = (uint8_t*)(offs + wa);
+            uint16_t* fy = (uint16_t*)(fx + wa * 2);
+            uint8_t* rb0 = (uint8_t*)(fy + wa * 2);
+            uint8_t* rb1 = (uint8_t*)(rb0 + wa * M * 2);
+            __m512 _cy[3];
+            __m512 _wh[4];
+            _wh[0] = _mm512_set1_ps((float)w);
+            _wh[1] = _mm512_set1_ps((float)h);
+            _wh[2] = _mm512_set1_ps((float)w - 1.0f);
+            _wh[3] = _mm512_set1_ps((float)h - 1.0f);
+            __m512i _n = _mm512_set1_epi32(N);
+            __m512i _s = _mm512_set1_epi32(s);
+            __m512i _border = InitBorder<N>(p.border);
+            dst += yBeg * p.dstS;
+            for (int y = yBeg; y < yEnd; ++y)
+            {
+                const float* cr = cy + 3 * y;
+                for (int i = 0; i < 3; ++i)
+                    _cy[i] = _mm512_set1_ps(cr[i]);
+                int iB = ib[y], iE = ie[y], oB = ob[y], oE = oe[y];
+                if (fill)
+                {
+                    FillBorder<N>(dst, oB, _border, p.border);
+                    for (int x = oB; x < iB; ++x)
+                        Base::PerspByteBilinearInterpEdge<N>(x, cx, xs, cr, w, h, s, src, p.border, dst + x * N);
+                }
+                else
+                {
+                    for (int x = oB; x < iB; ++x)
+                        Base::PerspByteBilinearInterpEdge<N>(x, cx, xs, cr, w, h, s, src, dst + x * N, dst + x * N);
+                }
+                {
+                    int x = iB, iEn = (int)AlignLo(iE - iB, n) + iB;
+                    for (; x < iE; x += 16)
+                        PerspByteBilinearPrepMain16(cx + x, xs, _cy, _wh, _n, _s, offs + x, fx + 2 * x, fy + 2 * x);
+                    ByteBilinearGather<M, soft>(src, src + s, offs + iB, iE - iB, rb0 + 2 * M * iB, rb1 + 2 * M * iB);
+                    for (x = iB; x < iEn; x += n)
+                        ByteBilinearInterpMainN<N>(rb0 + x * M * 2, rb1 + x * M * 2, fx + 2 * x, fy + 2 * x, dst + x * N, n);
+                    if (x < iE)
+                        ByteBilinearInterpMainN<N>(rb0 + x * M * 2, rb1 + x * M * 2, fx + 2 * x, fy + 2 * x, dst + x * N, iE - iEn);
+                }
+                if (fill)
+                {
+                    for (int x = iE; x < oE; ++x)
+                        Base::PerspByteBilinearInterpEdge<N>(x, cx, xs, cr, w, h, s, src, p.border, dst + x * N);
+                    FillBorder<N>(dst + oE * N, width - oE, _border, p.border);
+                }
+                else
+                {
+                    for (int x = iE; x < oE; ++x)
+                        Base::PerspByteBilinearInterpEdge<N>(x, cx, xs, cr, w, h, s, src, dst + x * N, dst + x * N);
+                }
+                dst += p.dstS;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        WarpPerspectiveByteBilinear::WarpPerspectiveByteBilinear(const WarpPersParam& param)
+            : Avx2::WarpPerspectiveByteBilinear(param)
+        {
+            bool soft = Avx2::SlowGather;
+            switch (_param.channels)
+            {
+            case 1: _run = soft ? PerspByteBilinearRun<1, true> : PerspByteBilinearRun<1, false>; break;
+            case 2: _run = soft ? PerspByteBilinearRun<2, true> : PerspByteBilinearRun<2, false>; break;
+            case 3: _run = soft ? PerspByteBilinearRun<3, true> : PerspByteBilinearRun<3, false>; break;
+            case 4: _run = soft ? PerspByteBilinearRun<4, true> : PerspByteBilinearRun<4, false>; break;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            WarpPersParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, mat, flags, border, A);
+            if (!param.Valid())
+                return NULL;
+            if (param.IsNearest())
+                return new WarpPerspectiveNearest(param);
+            else if (param.IsByteBilinear())
+                return new WarpPerspectiveByteBilinear(param);
+            else
+                return NULL;
+        }
+#else
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            WarpPersParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, mat, flags, border, A);
+            if (!param.Valid())
+                return NULL;
+            if (param.IsNearest())
+                return new Avx2::WarpPerspectiveNearest(param);
+            else if (param.IsByteBilinear())
+                return new Avx2::WarpPerspectiveByteBilinear(param);
+            else
+                return NULL;
+        }
+#endif
+    }
+#endif
+}
@@ -24,6 +24,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdCompare.h"
 #include "Simd/SimdArray.h"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -211,5 +212,37 @@ namespace Simd
                 dst += dstStride;
             }
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        uint8_t OtsuThreshold(const uint32_t* histogram)
+        {
+            double total = 0, sum = 0;
+            for (size_t i = 0; i < HISTOGRAM_SIZE; ++i)
+            {
+                total += histogram[i];
+                sum += double(i) * histogram[i];
+            }
+            double count0 = 0, sum0 = 0, best = -1.0;
+            size_t threshold = 0;
+            for (size_t i = 0; i < HISTOGRAM_SIZE; ++i)
+            {
+                count0 += histogram[i];
+                sum0 += double(i) * histogram[i];
+                double count1 = total - count0;
+                if (count0 == 0)
+                    continue;
+                if (count1 == 0)
+                    break;
+                double diff = sum0 * total - sum * count0;
+                double between = diff * diff / (count0 * count1);
+                if (between > best)
+                {
+                    best = between;
+                    threshold = i;
+                }
+            }
+            return (uint8_t)threshold;
+        }
     }
 }
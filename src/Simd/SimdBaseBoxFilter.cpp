@@ -0,0 +1,232 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdBoxFilter.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    BoxFilterParam::BoxFilterParam(size_t w, size_t h, size_t c, SimdBoxFilterChannelType t, size_t rx, size_t ry, size_t a)
+        : width(w)
+        , height(h)
+        , channels(c)
+        , type(t)
+        , radiusX(rx)
+        , radiusY(ry)
+        , align(a)
+    {
+    }
+
+    bool BoxFilterParam::Valid() const
+    {
+        return
+            height > 0 &&
+            width > 0 &&
+            channels > 0 && channels <= 4 &&
+            (type == SimdBoxFilterChannel8u || type == SimdBoxFilterChannel32f) &&
+            (type == SimdBoxFilterChannel32f || Area() <= size_t(INT32_MAX) / (255 * 255));
+    }
+
+    //---------------------------------------------------------------------
+
+    BoxFilter::BoxFilter(const BoxFilterParam& param)
+        : _param(param)
+    {
+    }
+
+    //---------------------------------------------------------------------
+
+    namespace Base
+    {
+        void BoxFilterColUpdate8u(const uint8_t* add, const uint8_t* sub, size_t size, uint32_t* sum, uint32_t* sqsum)
+        {
+            if (sub)
+            {
+                for (size_t i = 0; i < size; ++i)
+                    sum[i] += add[i] - sub[i];
+                if (sqsum)
+                {
+                    for (size_t i = 0; i < size; ++i)
+                        sqsum[i] += Square(add[i]) - Square(sub[i]);
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < size; ++i)
+                    sum[i] += add[i];
+                if (sqsum)
+                {
+                    for (size_t i = 0; i < size; ++i)
+                        sqsum[i] += Square(add[i]);
+                }
+            }
+        }
+
+        static void BoxFilterColUpdate32f(const float* add, const float* sub, size_t size, double* sum, double* sqsum)
+        {
+            if (sub)
+            {
+                for (size_t i = 0; i < size; ++i)
+                    sum[i] += double(add[i]) - double(sub[i]);
+                if (sqsum)
+                {
+                    for (size_t i = 0; i < size; ++i)
+                        sqsum[i] += double(add[i]) * double(add[i]) - double(sub[i]) * double(sub[i]);
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < size; ++i)
+                    sum[i] += double(add[i]);
+                if (sqsum)
+                {
+                    for (size_t i = 0; i < size; ++i)
+                        sqsum[i] += double(add[i]) * double(add[i]);
+                }
+            }
+        }
+
+        static void BoxFilterRow8u(const uint32_t* sum, const uint32_t* sqsum, size_t size, size_t step, float norm, uint8_t* mean, float* var)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                float m = float(sum[i + step] - sum[i]) * norm;
+                mean[i] = (uint8_t)(int)(m + 0.5f);
+                if (var)
+                    var[i] = Simd::Max(float(sqsum[i + step] - sqsum[i]) * norm - m * m, 0.0f);
+            }
+        }
+
+        static void BoxFilterRow32f(const double* sum, const double* sqsum, size_t size, size_t step, double norm, float* mean, float* var)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                double m = (sum[i + step] - sum[i]) * norm;
+                mean[i] = float(m);
+                if (var)
+                    var[i] = float(Simd::Max((sqsum[i + step] - sqsum[i]) * norm - m * m, 0.0));
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        BoxFilterDefault::BoxFilterDefault(const BoxFilterParam& param)
+            : Simd::BoxFilter(param)
+        {
+            const BoxFilterParam& p = _param;
+            BoxFilterAlg& a = _alg;
+            size_t elem = p.type == SimdBoxFilterChannel8u ? sizeof(uint32_t) : sizeof(double);
+            a.size = p.width * p.channels;
+            a.step = (2 * p.radiusX + 1) * p.channels;
+            a.padSize = a.size + a.step;
+            a.colBuf = AlignHi(a.size * elem, p.align);
+            a.padBuf = AlignHi(a.padSize * elem, p.align);
+            a.bufSize = 2 * a.colBuf + 2 * a.padBuf;
+            a.threads = Simd::Max<size_t>(1, Simd::Min(Base::GetThreadNumber(), p.height / Simd::Max<size_t>((2 * p.radiusY + 1) * 4, 16)));
+            a.norm32f = 1.0f / float(p.Area());
+            a.norm64f = 1.0 / double(p.Area());
+            _buffer.Resize(a.bufSize * a.threads);
+
+            _colUpdate8u = BoxFilterColUpdate8u;
+            _colUpdate32f = BoxFilterColUpdate32f;
+            _row8u = BoxFilterRow8u;
+            _row32f = BoxFilterRow32f;
+        }
+
+        void BoxFilterDefault::Run(const uint8_t* src, size_t srcStride, uint8_t* mean, size_t meanStride, float* var, size_t varStride)
+        {
+            Simd::Parallel(0, _param.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                uint8_t* buf = _buffer.data + thread * _alg.bufSize;
+                if (_param.type == SimdBoxFilterChannel8u)
+                    Run<uint32_t, uint8_t>(src, srcStride, begin, end, buf, mean, meanStride, var, varStride);
+                else
+                    Run<double, float>(src, srcStride, begin, end, buf, mean, meanStride, var, varStride);
+            }, _alg.threads, 1);
+        }
+
+        SIMD_INLINE void BoxFilterColUpdate(BoxFilterColUpdate8uPtr update8u, BoxFilterColUpdate32fPtr, const uint8_t* add, const uint8_t* sub, size_t size, uint32_t* sum, uint32_t* sqsum)
+        {
+            update8u(add, sub, size, sum, sqsum);
+        }
+
+        SIMD_INLINE void BoxFilterColUpdate(BoxFilterColUpdate8uPtr, BoxFilterColUpdate32fPtr update32f, const uint8_t* add, const uint8_t* sub, size_t size, double* sum, double* sqsum)
+        {
+            update32f((const float*)add, (const float*)sub, size, sum, sqsum);
+        }
+
+        SIMD_INLINE void BoxFilterRow(BoxFilterRow8uPtr row8u, BoxFilterRow32fPtr, const uint32_t* sum, const uint32_t* sqsum, 
+            const BoxFilterAlg& alg, uint8_t* mean, float* var)
+        {
+            row8u(sum, sqsum, alg.size, alg.step, alg.norm32f, mean, var);
+        }
+
+        SIMD_INLINE void BoxFilterRow(BoxFilterRow8uPtr, BoxFilterRow32fPtr row32f, const double* sum, const double* sqsum, 
+            const BoxFilterAlg& alg, uint8_t* mean, float* var)
+        {
+            row32f(sum, sqsum, alg.size, alg.step, alg.norm64f, (float*)mean, var);
+        }
+
+        template<class S, class T> void BoxFilterDefault::Run(const uint8_t* src, size_t srcStride, size_t yBeg, size_t yEnd, 
+            uint8_t* buf, uint8_t* mean, size_t meanStride, float* var, size_t varStride)
+        {
+            const BoxFilterParam& p = _param;
+            const BoxFilterAlg& a = _alg;
+            S* sum = (S*)buf, * rowSum = (S*)(buf + 2 * a.colBuf);
+            S* sqsum = var ? (S*)(buf + a.colBuf) : NULL, * rowSqsum = var ? (S*)(buf + 2 * a.colBuf + a.padBuf) : NULL;
+            ptrdiff_t height = p.height, radius = p.radiusY, beg = yBeg;
+            memset(sum, 0, a.colBuf);
+            if (sqsum)
+                memset(sqsum, 0, a.colBuf);
+            for (ptrdiff_t k = -radius; k <= radius; ++k)
+            {
+                const uint8_t* add = src + Simd::RestrictRange<ptrdiff_t>(beg + k, 0, height - 1) * srcStride;
+                BoxFilterColUpdate(_colUpdate8u, _colUpdate32f, add, NULL, a.size, sum, sqsum);
+            }
+            for (ptrdiff_t y = beg, end = yEnd; y < end; ++y)
+            {
+                if (y > beg)
+                {
+                    const uint8_t* add = src + Simd::RestrictRange<ptrdiff_t>(y + radius, 0, height - 1) * srcStride;
+                    const uint8_t* sub = src + Simd::RestrictRange<ptrdiff_t>(y - radius - 1, 0, height - 1) * srcStride;
+                    BoxFilterColUpdate(_colUpdate8u, _colUpdate32f, add, sub, a.size, sum, sqsum);
+                }
+                BoxFilterPrefix(sum, p.width, p.channels, p.radiusX, rowSum);
+                if (sqsum)
+                    BoxFilterPrefix(sqsum, p.width, p.channels, p.radiusX, rowSqsum);
+                BoxFilterRow(_row8u, _row32f, rowSum, rowSqsum, a, mean + y * meanStride, var ? (float*)((uint8_t*)var + y * varStride) : NULL);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void* BoxFilterInit(size_t width, size_t height, size_t channels, SimdBoxFilterChannelType type, size_t radiusX, size_t radiusY)
+        {
+            BoxFilterParam param(width, height, channels, type, radiusX, radiusY, sizeof(void*));
+            if (!param.Valid())
+                return NULL;
+            return new BoxFilterDefault(param);
+        }
+    }
+}
@@ -0,0 +1,207 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdCanny.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    CannyParam::CannyParam(size_t w, size_t h, float lt, float ht)
+        : width(w)
+        , height(h)
+        , lowThreshold(lt)
+        , highThreshold(ht)
+    {
+    }
+
+    bool CannyParam::Valid() const
+    {
+        return
+            height > 0 &&
+            width > 1 &&
+            lowThreshold >= 0.0f &&
+            lowThreshold <= highThreshold;
+    }
+
+    //---------------------------------------------------------------------
+
+    Canny::Canny(const CannyParam& param)
+        : _param(param)
+    {
+    }
+
+    //---------------------------------------------------------------------
+
+    namespace Base
+    {
+        static void CannyMagnitude(const int16_t* dx, const int16_t* dy, size_t width, int16_t* mag)
+        {
+            for (size_t x = 0; x < width; ++x)
+                mag[x] = int16_t(Simd::Abs(dx[x]) + Simd::Abs(dy[x]));
+        }
+
+        static void CannyNms(const int16_t* dx, const int16_t* dy, const int16_t* mag0, const int16_t* mag1, const int16_t* mag2, size_t width, int16_t low, int16_t high, uint8_t* map)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                int m = mag1[x];
+                uint8_t value = CannyMapNone;
+                if (m > low)
+                {
+                    int ax = Simd::Abs(dx[x]), ay = Simd::Abs(dy[x]);
+                    int tx = (ax * CANNY_TAN_22_5 + 0xFFFF) >> 16, ty = (ay * CANNY_TAN_22_5 + 0xFFFF) >> 16;
+                    int a, b;
+                    if (ay < tx)
+                        a = mag1[x - 1], b = mag1[x + 1] - 1;
+                    else if (ax < ty)
+                        a = mag0[x], b = mag2[x] - 1;
+                    else if ((dx[x] ^ dy[x]) < 0)
+                        a = mag0[x + 1], b = mag2[x - 1];
+                    else
+                        a = mag0[x - 1], b = mag2[x + 1];
+                    if (m > a && m > b)
+                        value = m > high ? CannyMapStrong : CannyMapWeak;
+                }
+                map[x] = value;
+            }
+        }
+
+        static void CannyOutput(const uint8_t* map, size_t width, uint8_t* dst)
+        {
+            for (size_t x = 0; x < width; ++x)
+                dst[x] = map[x] == CannyMapEdge ? 0xFF : 0x00;
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE int16_t CannyThreshold(float threshold)
+        {
+            return (int16_t)Simd::Min<float>(::floor(threshold), float(CANNY_MAGNITUDE_MAX));
+        }
+
+        CannyDefault::CannyDefault(const CannyParam& param)
+            : Simd::Canny(param)
+        {
+            const CannyParam& p = _param;
+            _low = CannyThreshold(p.lowThreshold);
+            _high = CannyThreshold(p.highThreshold);
+            _gradStride = AlignHi(p.width, 32);
+            _magStride = AlignHi(p.width + 2, 32);
+            _mapStride = AlignHi(p.width + 2, 32);
+            _band = Simd::Max<size_t>(4, Base::AlgCacheL2() / (8 * _gradStride));
+            _threads = Simd::Max<size_t>(1, Simd::Min(Base::GetThreadNumber(), p.height / _band));
+            _band = Simd::Min(_band, DivHi(p.height, _threads));
+            _bufSize = 2 * (_band + 4) * _gradStride + (_band + 2) * _magStride;
+            _buffer.Resize(_bufSize * _threads);
+            _map.Resize((p.height + 2) * _mapStride, true);
+            _sobelDx = Base::SobelDx;
+            _sobelDy = Base::SobelDy;
+            _magnitude = CannyMagnitude;
+            _nms = CannyNms;
+            _output = CannyOutput;
+        }
+
+        void CannyDefault::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            const CannyParam& p = _param;
+            Simd::Parallel(0, p.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                int16_t* buf = _buffer.data + thread * _bufSize;
+                for (size_t y = begin; y < end; y += _band)
+                    Band(src, srcStride, y, Simd::Min(y + _band, end), buf);
+            }, _threads, 1);
+            Hysteresis();
+            for (size_t y = 0; y < p.height; ++y)
+                _output(_map.data + (y + 1) * _mapStride + 1, p.width, dst + y * dstStride);
+        }
+
+        void CannyDefault::Band(const uint8_t* src, size_t srcStride, size_t yBeg, size_t yEnd, int16_t* buf)
+        {
+            const CannyParam& p = _param;
+            size_t sBeg = yBeg > 1 ? yBeg - 2 : 0, sEnd = Simd::Min(yEnd + 2, p.height);
+            int16_t* dx = buf, * dy = dx + (_band + 4) * _gradStride, * mag = dy + (_band + 4) * _gradStride + 1;
+            _sobelDx(src + sBeg * srcStride, srcStride, p.width, sEnd - sBeg, (uint8_t*)dx, _gradStride * 2);
+            _sobelDy(src + sBeg * srcStride, srcStride, p.width, sEnd - sBeg, (uint8_t*)dy, _gradStride * 2);
+            for (size_t y = yBeg - 1, r = 0; y != yEnd + 1; ++y, ++r)
+            {
+                int16_t* m = mag + r * _magStride;
+                if (y < p.height)
+                {
+                    m[-1] = 0;
+                    m[p.width] = 0;
+                    _magnitude(dx + (y - sBeg) * _gradStride, dy + (y - sBeg) * _gradStride, p.width, m);
+                }
+                else
+                    memset(m - 1, 0, (p.width + 2) * sizeof(int16_t));
+            }
+            for (size_t y = yBeg, r = 1; y < yEnd; ++y, ++r)
+            {
+                const int16_t* m = mag + r * _magStride;
+                size_t o = (y - sBeg) * _gradStride;
+                _nms(dx + o, dy + o, m - _magStride, m, m + _magStride, p.width, _low, _high, _map.data + (y + 1) * _mapStride + 1);
+            }
+        }
+
+        void CannyDefault::Hysteresis()
+        {
+            const CannyParam& p = _param;
+            const ptrdiff_t s = _mapStride;
+            const ptrdiff_t offsets[8] = { -s - 1, -s, -s + 1, -1, 1, s - 1, s, s + 1 };
+            for (size_t y = 1; y <= p.height; ++y)
+            {
+                uint8_t* beg = _map.data + y * _mapStride + 1, * end = beg + p.width;
+                while ((beg = (uint8_t*)memchr(beg, CannyMapStrong, end - beg)) != NULL)
+                {
+                    *beg = CannyMapEdge;
+                    _stack.push_back(beg++);
+                    while (_stack.size())
+                    {
+                        uint8_t* curr = _stack.back();
+                        _stack.pop_back();
+                        for (size_t i = 0; i < 8; ++i)
+                        {
+                            uint8_t* next = curr + offsets[i];
+                            if (*next == CannyMapWeak || *next == CannyMapStrong)
+                            {
+                                *next = CannyMapEdge;
+                                _stack.push_back(next);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void* CannyInit(size_t width, size_t height, float lowThreshold, float highThreshold)
+        {
+            CannyParam param(width, height, lowThreshold, highThreshold);
+            if (!param.Valid())
+                return NULL;
+            return new CannyDefault(param);
+        }
+    }
+}
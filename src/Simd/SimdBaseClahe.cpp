@@ -0,0 +1,182 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdClahe.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    ClaheParam::ClaheParam(size_t w, size_t h, size_t tx, size_t ty, float cl)
+        : width(w)
+        , height(h)
+        , tilesX(tx)
+        , tilesY(ty)
+        , clipLimit(cl)
+    {
+    }
+
+    bool ClaheParam::Valid() const
+    {
+        return
+            height > 0 &&
+            width > 0 &&
+            tilesX > 0 && tilesX <= width &&
+            tilesY > 0 && tilesY <= height &&
+            clipLimit >= 0.0f;
+    }
+
+    //---------------------------------------------------------------------
+
+    Clahe::Clahe(const ClaheParam& param)
+        : _param(param)
+    {
+    }
+
+    //---------------------------------------------------------------------
+
+    namespace Base
+    {
+        static void ClaheInterpolate(const uint8_t* src, size_t width, const int32_t* ix0, const int32_t* ix1, const int32_t* wx,
+            const int32_t* lut0, const int32_t* lut1, int32_t wy, uint8_t* dst)
+        {
+            for (size_t x = 0; x < width; ++x)
+                dst[x] = ClaheInterpolate(src[x], ix0[x], ix1[x], wx[x], lut0, lut1, wy);
+        }
+
+        static void ClaheInterpolationTable(const uint32_t* bounds, size_t tiles, size_t size, int32_t step, int32_t* i0, int32_t* i1, int32_t* w)
+        {
+            for (size_t p = 0, t = 0; p < size; ++p)
+            {
+                int64_t pos = 2 * p;
+                while (t + 1 < tiles && int64_t(bounds[t + 1] + bounds[t + 2] - 1) <= pos)
+                    t++;
+                int64_t c0 = bounds[t] + bounds[t + 1] - 1;
+                if (pos < c0 || t + 1 == tiles)
+                {
+                    i0[p] = int32_t(t) * step;
+                    i1[p] = int32_t(t) * step;
+                    w[p] = 0;
+                }
+                else
+                {
+                    int64_t c1 = bounds[t + 1] + bounds[t + 2] - 1;
+                    i0[p] = int32_t(t) * step;
+                    i1[p] = int32_t(t + 1) * step;
+                    w[p] = int32_t(((pos - c0) * 2 * CLAHE_RANGE + (c1 - c0)) / (2 * (c1 - c0)));
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        ClaheDefault::ClaheDefault(const ClaheParam& param)
+            : Simd::Clahe(param)
+        {
+            const ClaheParam& p = _param;
+            _bx.Resize(p.tilesX + 1);
+            for (size_t i = 0; i <= p.tilesX; ++i)
+                _bx[i] = uint32_t(i * p.width / p.tilesX);
+            _by.Resize(p.tilesY + 1);
+            for (size_t i = 0; i <= p.tilesY; ++i)
+                _by[i] = uint32_t(i * p.height / p.tilesY);
+            _ix0.Resize(p.width);
+            _ix1.Resize(p.width);
+            _wx.Resize(p.width);
+            ClaheInterpolationTable(_bx.data, p.tilesX, p.width, HISTOGRAM_SIZE, _ix0.data, _ix1.data, _wx.data);
+            _iy0.Resize(p.height);
+            _iy1.Resize(p.height);
+            _wy.Resize(p.height);
+            ClaheInterpolationTable(_by.data, p.tilesY, p.height, int32_t(p.tilesX * HISTOGRAM_SIZE), _iy0.data, _iy1.data, _wy.data);
+            _lut.Resize(p.tilesY * p.tilesX * HISTOGRAM_SIZE);
+            _lutThreads = Simd::Max<size_t>(1, Simd::Min(Base::GetThreadNumber(), p.tilesY));
+            _runThreads = Simd::Max<size_t>(1, Simd::Min(Base::GetThreadNumber(), p.height / 16));
+            _interpolate = ClaheInterpolate;
+        }
+
+        void ClaheDefault::BuildLut(const uint8_t* src, size_t srcStride, size_t tx, size_t ty)
+        {
+            const ClaheParam& p = _param;
+            size_t x0 = _bx[tx], w = _bx[tx + 1] - x0, y0 = _by[ty], h = _by[ty + 1] - y0, area = w * h;
+            uint32_t hist[HISTOGRAM_SIZE];
+            Base::Histogram(src + y0 * srcStride + x0, w, h, srcStride, hist);
+            if (p.clipLimit > 0.0f)
+            {
+                uint32_t clip = Simd::Max<uint32_t>(1, uint32_t(p.clipLimit * float(area) / float(HISTOGRAM_SIZE)));
+                size_t excess = 0;
+                for (size_t i = 0; i < HISTOGRAM_SIZE; ++i)
+                {
+                    if (hist[i] > clip)
+                    {
+                        excess += hist[i] - clip;
+                        hist[i] = clip;
+                    }
+                }
+                uint32_t batch = uint32_t(excess / HISTOGRAM_SIZE);
+                size_t residual = excess - batch * HISTOGRAM_SIZE;
+                for (size_t i = 0; i < HISTOGRAM_SIZE; ++i)
+                    hist[i] += batch;
+                if (residual)
+                {
+                    size_t step = Simd::Max<size_t>(HISTOGRAM_SIZE / residual, 1);
+                    for (size_t i = 0; i < HISTOGRAM_SIZE && residual > 0; i += step, residual--)
+                        hist[i]++;
+                }
+            }
+            int32_t* lut = _lut.data + (ty * p.tilesX + tx) * HISTOGRAM_SIZE;
+            uint64_t sum = 0;
+            for (size_t i = 0; i < HISTOGRAM_SIZE; ++i)
+            {
+                sum += hist[i];
+                lut[i] = int32_t(Simd::Min<uint64_t>((sum * 255 + area / 2) / area, 255));
+            }
+        }
+
+        void ClaheDefault::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            const ClaheParam& p = _param;
+            Simd::Parallel(0, p.tilesY, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t ty = begin; ty < end; ++ty)
+                    for (size_t tx = 0; tx < p.tilesX; ++tx)
+                        BuildLut(src, srcStride, tx, ty);
+            }, _lutThreads, 1);
+            Simd::Parallel(0, p.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t y = begin; y < end; ++y)
+                    _interpolate(src + y * srcStride, p.width, _ix0.data, _ix1.data, _wx.data, 
+                        _lut.data + _iy0[y], _lut.data + _iy1[y], _wy[y], dst + y * dstStride);
+            }, _runThreads, 1);
+        }
+
+        //---------------------------------------------------------------------
+
+        void* ClaheInit(size_t width, size_t height, size_t tilesX, size_t tilesY, float clipLimit)
+        {
+            ClaheParam param(width, height, tilesX, tilesY, clipLimit);
+            if (!param.Valid())
+                return NULL;
+            return new ClaheDefault(param);
+        }
+    }
+}
@@ -0,0 +1,290 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdConnectedComponents.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+#include <algorithm>
+
+namespace Simd
+{
+    ConnectedComponentsParam::ConnectedComponentsParam(size_t w, size_t h, SimdConnectivityType c, SimdBool m)
+        : width(w)
+        , height(h)
+        , connectivity(c)
+        , moments(m == SimdTrue)
+    {
+    }
+
+    bool ConnectedComponentsParam::Valid() const
+    {
+        return
+            height > 0 &&
+            width > 0 && width < INT32_MAX &&
+            (connectivity == SimdConnectivity4 || connectivity == SimdConnectivity8);
+    }
+
+    //---------------------------------------------------------------------
+
+    ConnectedComponents::ConnectedComponents(const ConnectedComponentsParam& param)
+        : _param(param)
+    {
+    }
+
+    //---------------------------------------------------------------------
+
+    namespace Base
+    {
+        static size_t ConnectedComponentsRuns(const uint8_t* mask, size_t width, uint8_t index, int32_t* runs)
+        {
+            uint32_t inside = 0;
+            int32_t* end = ConnectedComponentsEdges(mask, 0, width, index, inside, runs);
+            if (inside)
+                *end++ = int32_t(width);
+            return (end - runs) / 2;
+        }
+
+        SIMD_INLINE uint32_t ConnectedComponentsFind(uint32_t* parent, uint32_t i)
+        {
+            while (parent[i] != i)
+            {
+                parent[i] = parent[parent[i]];
+                i = parent[i];
+            }
+            return i;
+        }
+
+        SIMD_INLINE void ConnectedComponentsUnion(uint32_t* parent, uint32_t a, uint32_t b)
+        {
+            a = ConnectedComponentsFind(parent, a);
+            b = ConnectedComponentsFind(parent, b);
+            if (a < b)
+                parent[b] = a;
+            else if (b < a)
+                parent[a] = b;
+        }
+
+        SIMD_INLINE int64_t SquareSum(int64_t n)
+        {
+            return n * (n + 1) * (2 * n + 1) / 6;
+        }
+
+        //---------------------------------------------------------------------
+
+        ConnectedComponentsDefault::ConnectedComponentsDefault(const ConnectedComponentsParam& param)
+            : Simd::ConnectedComponents(param)
+        {
+            const ConnectedComponentsParam& p = _param;
+            _threads = Simd::Max<size_t>(1, Simd::Min(Base::GetThreadNumber(), p.height / 64));
+            _strips.resize(_threads);
+            for (size_t s = 0; s < _threads; ++s)
+            {
+                _strips[s].yBeg = s * p.height / _threads;
+                _strips[s].yEnd = (s + 1) * p.height / _threads;
+            }
+            _runs = ConnectedComponentsRuns;
+        }
+
+        size_t ConnectedComponentsDefault::Run(const uint8_t* mask, size_t maskStride, uint8_t index, uint32_t* labels, size_t labelsStride,
+            const SimdConnectedComponent** components)
+        {
+            Simd::Parallel(0, _strips.size(), [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t s = begin; s < end; ++s)
+                    LabelStrip(mask, maskStride, index, _strips[s]);
+            }, _threads, 1);
+
+            size_t total = 0;
+            for (size_t s = 0; s < _strips.size(); ++s)
+            {
+                _strips[s].offset = total;
+                total += _strips[s].parent.size();
+            }
+            _parent.resize(total);
+            for (size_t s = 0; s < _strips.size(); ++s)
+            {
+                const Strip& strip = _strips[s];
+                for (size_t i = 0, n = strip.parent.size(); i < n; ++i)
+                    _parent[strip.offset + i] = uint32_t(strip.offset + strip.parent[i]);
+            }
+            for (size_t s = 1; s < _strips.size(); ++s)
+            {
+                const Strip& a = _strips[s - 1], & b = _strips[s];
+                size_t aBeg = a.rows[a.rows.size() - 2], aEnd = a.rows.back(), bEnd = b.rows[1];
+                MergeRows(a.runs.data() + 2 * aBeg, aEnd - aBeg, uint32_t(a.offset + aBeg), b.runs.data(), bEnd, uint32_t(b.offset), _parent.data());
+            }
+
+            size_t count = SetLabels();
+            Statistic(count);
+
+            if (labels)
+            {
+                Simd::Parallel(0, _strips.size(), [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t s = begin; s < end; ++s)
+                        FillLabels(_strips[s], labels, labelsStride);
+                }, _threads, 1);
+            }
+            if (components)
+                *components = count ? _components.data() : NULL;
+            return count;
+        }
+
+        void ConnectedComponentsDefault::LabelStrip(const uint8_t* mask, size_t maskStride, uint8_t index, Strip& strip)
+        {
+            size_t width = _param.width;
+            strip.buf.resize(width + 2);
+            strip.runs.clear();
+            strip.parent.clear();
+            strip.rows.clear();
+            strip.rows.push_back(0);
+            for (size_t y = strip.yBeg; y < strip.yEnd; ++y)
+            {
+                size_t n = _runs(mask + y * maskStride, width, index, strip.buf.data());
+                size_t beg = strip.rows.back();
+                strip.runs.insert(strip.runs.end(), strip.buf.data(), strip.buf.data() + 2 * n);
+                for (size_t i = 0; i < n; ++i)
+                    strip.parent.push_back(uint32_t(beg + i));
+                if (y > strip.yBeg)
+                {
+                    size_t prev = strip.rows[strip.rows.size() - 2];
+                    MergeRows(strip.runs.data() + 2 * prev, beg - prev, uint32_t(prev), strip.runs.data() + 2 * beg, n, uint32_t(beg), strip.parent.data());
+                }
+                strip.rows.push_back(uint32_t(beg + n));
+            }
+        }
+
+        void ConnectedComponentsDefault::MergeRows(const int32_t* a, size_t aN, uint32_t aIdx, const int32_t* b, size_t bN, uint32_t bIdx, uint32_t* parent) const
+        {
+            int32_t d = _param.connectivity == SimdConnectivity8 ? 1 : 0;
+            for (size_t i = 0, j = 0; i < aN && j < bN;)
+            {
+                const int32_t* ra = a + 2 * i, * rb = b + 2 * j;
+                if (ra[1] + d <= rb[0])
+                    i++;
+                else if (rb[1] + d <= ra[0])
+                    j++;
+                else
+                {
+                    ConnectedComponentsUnion(parent, aIdx + uint32_t(i), bIdx + uint32_t(j));
+                    if (ra[1] < rb[1])
+                        i++;
+                    else
+                        j++;
+                }
+            }
+        }
+
+        size_t ConnectedComponentsDefault::SetLabels()
+        {
+            size_t total = _parent.size();
+            uint32_t count = 0;
+            _label.resize(total);
+            for (size_t i = 0; i < total; ++i)
+            {
+                uint32_t p = _parent[i];
+                if (p == i)
+                    _label[i] = ++count;
+                else
+                {
+                    p = _parent[p];
+                    _parent[i] = p;
+                    _label[i] = _label[p];
+                }
+            }
+            return count;
+        }
+
+        void ConnectedComponentsDefault::Statistic(size_t count)
+        {
+            SimdConnectedComponent empty;
+            memset(&empty, 0, sizeof(empty));
+            empty.left = INT32_MAX;
+            empty.top = INT32_MAX;
+            _components.assign(count, empty);
+            bool moments = _param.moments;
+            for (size_t s = 0; s < _strips.size(); ++s)
+            {
+                const Strip& strip = _strips[s];
+                for (size_t r = 0, n = strip.rows.size() - 1; r < n; ++r)
+                {
+                    int64_t y = int64_t(strip.yBeg + r);
+                    for (size_t i = strip.rows[r]; i < strip.rows[r + 1]; ++i)
+                    {
+                        int64_t beg = strip.runs[2 * i + 0], end = strip.runs[2 * i + 1], len = end - beg;
+                        int64_t sx = (beg + end - 1) * len / 2;
+                        SimdConnectedComponent& c = _components[_label[strip.offset + i] - 1];
+                        c.area += len;
+                        c.x += sx;
+                        c.y += y * len;
+                        if (moments)
+                        {
+                            c.xx += SquareSum(end - 1) - SquareSum(beg - 1);
+                            c.xy += y * sx;
+                            c.yy += y * y * len;
+                        }
+                        c.left = Simd::Min(c.left, int32_t(beg));
+                        c.right = Simd::Max(c.right, int32_t(end));
+                        c.top = Simd::Min(c.top, int32_t(y));
+                        c.bottom = Simd::Max(c.bottom, int32_t(y + 1));
+                    }
+                }
+            }
+            for (size_t i = 0; i < count; ++i)
+            {
+                SimdConnectedComponent& c = _components[i];
+                c.centerX = float(double(c.x) / double(c.area));
+                c.centerY = float(double(c.y) / double(c.area));
+            }
+        }
+
+        void ConnectedComponentsDefault::FillLabels(const Strip& strip, uint32_t* labels, size_t labelsStride) const
+        {
+            uint32_t width = uint32_t(_param.width);
+            for (size_t r = 0, n = strip.rows.size() - 1; r < n; ++r)
+            {
+                uint32_t* dst = (uint32_t*)((uint8_t*)labels + (strip.yBeg + r) * labelsStride);
+                int32_t x = 0;
+                for (size_t i = strip.rows[r]; i < strip.rows[r + 1]; ++i)
+                {
+                    int32_t beg = strip.runs[2 * i + 0], end = strip.runs[2 * i + 1];
+                    std::fill(dst + x, dst + beg, 0);
+                    std::fill(dst + beg, dst + end, _label[strip.offset + i]);
+                    x = end;
+                }
+                std::fill(dst + x, dst + width, 0);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void* ConnectedComponentsInit(size_t width, size_t height, SimdConnectivityType connectivity, SimdBool moments)
+        {
+            ConnectedComponentsParam param(width, height, connectivity, moments);
+            if (!param.Valid())
+                return NULL;
+            return new ConnectedComponentsDefault(param);
+        }
+    }
+}
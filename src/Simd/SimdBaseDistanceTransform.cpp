@@ -0,0 +1,287 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdDistanceTransform.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+#include <atomic>
+
+namespace Simd
+{
+    DistanceTransformParam::DistanceTransformParam(size_t w, size_t h, SimdDistanceTransformType t, SimdDistanceTransformDataType d)
+        : width(w)
+        , height(h)
+        , type(t)
+        , data(d)
+    {
+    }
+
+    bool DistanceTransformParam::Valid() const
+    {
+        return
+            height > 0 &&
+            width > 0 && width + height < 32768 &&
+            (type == SimdDistanceTransformEuclidean || type == SimdDistanceTransformChamfer3x3 || type == SimdDistanceTransformChamfer5x5) &&
+            (data == SimdDistanceTransform32f || data == SimdDistanceTransform16u);
+    }
+
+    //---------------------------------------------------------------------
+
+    DistanceTransform::DistanceTransform(const DistanceTransformParam& param)
+        : _param(param)
+    {
+    }
+
+    //---------------------------------------------------------------------
+
+    namespace Base
+    {
+        template<class T, bool root> void DistanceConvert(const int32_t* src, size_t width, float scale, uint8_t* dst)
+        {
+            T* _dst = (T*)dst;
+            for (size_t x = 0; x < width; ++x)
+                _dst[x] = DistanceStore<T>(DistanceValue<root>(src[x], scale));
+        }
+
+        template<bool root> DistanceConvertPtr GetDistanceConvert(SimdDistanceTransformDataType data)
+        {
+            return data == SimdDistanceTransform32f ? DistanceConvert<float, root> : DistanceConvert<uint16_t, root>;
+        }
+
+        //---------------------------------------------------------------------
+
+        static void DistanceEdtColumns(const uint8_t* mask, size_t maskStride, size_t width, size_t height,
+            uint8_t index, int32_t limit, int32_t* dst, size_t dstStride)
+        {
+            for (size_t x = 0; x < width; ++x)
+                dst[x] = mask[x] == index ? 0 : limit;
+            for (size_t y = 1; y < height; ++y)
+            {
+                const uint8_t* m = mask + y * maskStride;
+                const int32_t* up = dst + (y - 1) * dstStride;
+                int32_t* g = dst + y * dstStride;
+                for (size_t x = 0; x < width; ++x)
+                    g[x] = m[x] == index ? 0 : Simd::Min(up[x] + 1, limit);
+            }
+            for (size_t y = height - 1; y > 0; --y)
+            {
+                const int32_t* down = dst + y * dstStride;
+                int32_t* g = dst + (y - 1) * dstStride;
+                for (size_t x = 0; x < width; ++x)
+                    g[x] = Simd::Min(g[x], down[x] + 1);
+            }
+        }
+
+        DistanceTransformEdt::DistanceTransformEdt(const DistanceTransformParam& param)
+            : Simd::DistanceTransform(param)
+        {
+            const DistanceTransformParam& p = _param;
+            _colThreads = Simd::Max<size_t>(1, Simd::Min(Base::GetThreadNumber(), p.width / 64));
+            _rowThreads = Simd::Max<size_t>(1, Simd::Min(Base::GetThreadNumber(), p.height / 16));
+            _g.Resize(p.width * p.height);
+            _buf.Resize(_rowThreads * p.width * 3);
+            _zn.Resize(_rowThreads * p.width);
+            _columns = DistanceEdtColumns;
+            _convert = GetDistanceConvert<true>(p.data);
+        }
+
+        void DistanceTransformEdt::Run(const uint8_t* mask, size_t maskStride, uint8_t index, uint8_t* dst, size_t dstStride)
+        {
+            const DistanceTransformParam& p = _param;
+            int32_t limit = int32_t(p.width + p.height);
+            Simd::Parallel(0, p.width, [&](size_t thread, size_t begin, size_t end)
+            {
+                _columns(mask + begin, maskStride, end - begin, p.height, index, limit, _g.data + begin, p.width);
+            }, _colThreads, 64);
+            Simd::Parallel(0, p.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                int32_t* v = _buf.data + thread * p.width * 3, * zd = v + p.width, * d2 = zd + p.width;
+                int64_t* zn = _zn.data + thread * p.width;
+                for (size_t y = begin; y < end; ++y)
+                {
+                    RowPass(_g.data + y * p.width, v, zn, zd, d2);
+                    _convert(d2, p.width, 1.0f, dst + y * dstStride);
+                }
+            }, _rowThreads, 1);
+        }
+
+        void DistanceTransformEdt::RowPass(const int32_t* g, int32_t* v, int64_t* zn, int32_t* zd, int32_t* d2) const
+        {
+            int32_t width = int32_t(_param.width), k = 0;
+            v[0] = 0;
+            for (int32_t q = 1; q < width; ++q)
+            {
+                int64_t fq = int64_t(g[q]) * g[q] + int64_t(q) * q, n;
+                int32_t d;
+                for (;;)
+                {
+                    int32_t r = v[k];
+                    n = fq - int64_t(g[r]) * g[r] - int64_t(r) * r;
+                    d = 2 * (q - r);
+                    if (k > 0 && n * zd[k] <= zn[k] * d)
+                        k--;
+                    else
+                        break;
+                }
+                k++;
+                v[k] = q;
+                zn[k] = n;
+                zd[k] = d;
+            }
+            for (int32_t q = 0, i = 0; q < width; ++q)
+            {
+                while (i < k && zn[i + 1] < int64_t(q) * zd[i + 1])
+                    i++;
+                int32_t r = v[i];
+                d2[q] = (q - r) * (q - r) + g[r] * g[r];
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        static void DistanceChamferInit(const uint8_t* mask, size_t width, uint8_t index, int32_t* dst)
+        {
+            for (size_t x = 0; x < width; ++x)
+                dst[x] = mask[x] == index ? 0 : DISTANCE_CHAMFER_INF;
+        }
+
+        template<int size> void DistanceChamferRow(const int32_t* row1, const int32_t* row2, size_t width, const int32_t* weights, int32_t* dst)
+        {
+            int32_t a = weights[0], b = weights[1], c = weights[2];
+            for (size_t x = 0; x < width; ++x)
+            {
+                int32_t d = Simd::Min(dst[x], row1[x] + a);
+                d = Simd::Min(d, Simd::Min(row1[x - 1], row1[x + 1]) + b);
+                if (size == 5)
+                {
+                    d = Simd::Min(d, Simd::Min(row1[x - 2], row1[x + 2]) + c);
+                    d = Simd::Min(d, Simd::Min(row2[x - 1], row2[x + 1]) + c);
+                }
+                dst[x] = d;
+            }
+        }
+
+        SIMD_INLINE void DistanceChamferWait(const std::atomic<size_t>& done, size_t rows)
+        {
+            while (done.load(std::memory_order_acquire) < rows)
+                std::this_thread::yield();
+        }
+
+        DistanceTransformChamfer::DistanceTransformChamfer(const DistanceTransformParam& param)
+            : Simd::DistanceTransform(param)
+        {
+            const DistanceTransformParam& p = _param;
+            _threads = Simd::Max<size_t>(1, Simd::Min(Base::GetThreadNumber(), p.height / 16));
+            _tiles = Simd::Max<size_t>(1, Simd::Min(Base::GetThreadNumber(), p.width / 256));
+            _stride = p.width + 4;
+            _buf.Resize(_stride * (p.height + 4));
+            for (size_t i = 0; i < _buf.size; ++i)
+                _buf[i] = DISTANCE_CHAMFER_INF;
+            if (p.type == SimdDistanceTransformChamfer3x3)
+            {
+                _weights[0] = 3, _weights[1] = 4, _weights[2] = 0;
+                _row = DistanceChamferRow<3>;
+            }
+            else
+            {
+                _weights[0] = 5, _weights[1] = 7, _weights[2] = 11;
+                _row = DistanceChamferRow<5>;
+            }
+            _scale = float(_weights[0]);
+            _init = DistanceChamferInit;
+            _convert = GetDistanceConvert<false>(p.data);
+        }
+
+        void DistanceTransformChamfer::Run(const uint8_t* mask, size_t maskStride, uint8_t index, uint8_t* dst, size_t dstStride)
+        {
+            const DistanceTransformParam& p = _param;
+            const size_t stride = _stride;
+            const int32_t a = _weights[0];
+            int32_t* buf = _buf.data + 2 * stride + 2;
+            Simd::Parallel(0, p.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t y = begin; y < end; ++y)
+                    _init(mask + y * maskStride, p.width, index, buf + y * stride);
+            }, _threads, 1);
+            // Raster scans are pipelined over column tiles: a tile processes a row when its left (right in backward scan) 
+            // neighbour has finished the same row and its other neighbour has finished the previous row.
+            std::vector<std::atomic<size_t>> done(_tiles);
+            for (size_t i = 0; i < _tiles; ++i)
+                done[i].store(0);
+            auto column = [&](size_t tile) { return tile < _tiles ? AlignLo(p.width * tile / _tiles, 16) : p.width; };
+            Simd::Parallel(0, _tiles, [&](size_t thread, size_t begin, size_t end)
+            {
+                size_t xBeg = column(begin), width = column(end) - xBeg;
+                for (size_t y = 0; y < p.height; ++y)
+                {
+                    if (begin > 0)
+                        DistanceChamferWait(done[thread - 1], y + 1);
+                    if (end < _tiles)
+                        DistanceChamferWait(done[thread + 1], y);
+                    int32_t* d = buf + y * stride + xBeg;
+                    _row(d - stride, d - 2 * stride, width, _weights, d);
+                    for (size_t x = 0; x < width; ++x)
+                        d[x] = Simd::Min(d[x], d[x - 1] + a);
+                    done[thread].store(y + 1, std::memory_order_release);
+                }
+            }, _tiles, 1);
+            for (size_t i = 0; i < _tiles; ++i)
+                done[i].store(0);
+            Simd::Parallel(0, _tiles, [&](size_t thread, size_t begin, size_t end)
+            {
+                size_t xBeg = column(begin), width = column(end) - xBeg;
+                for (size_t i = 0; i < p.height; ++i)
+                {
+                    if (end < _tiles)
+                        DistanceChamferWait(done[thread + 1], i + 1);
+                    if (begin > 0)
+                        DistanceChamferWait(done[thread - 1], i);
+                    int32_t* d = buf + (p.height - 1 - i) * stride + xBeg;
+                    _row(d + stride, d + 2 * stride, width, _weights, d);
+                    for (size_t x = width - 1; x < width; --x)
+                        d[x] = Simd::Min(d[x], d[x + 1] + a);
+                    done[thread].store(i + 1, std::memory_order_release);
+                }
+            }, _tiles, 1);
+            Simd::Parallel(0, p.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t y = begin; y < end; ++y)
+                    _convert(buf + y * stride, p.width, _scale, dst + y * dstStride);
+            }, _threads, 1);
+        }
+
+        //---------------------------------------------------------------------
+
+        void* DistanceTransformInit(size_t width, size_t height, SimdDistanceTransformType type, SimdDistanceTransformDataType data)
+        {
+            DistanceTransformParam param(width, height, type, data);
+            if (!param.Valid())
+                return NULL;
+            if (type == SimdDistanceTransformEuclidean)
+                return new DistanceTransformEdt(param);
+            else
+                return new DistanceTransformChamfer(param);
+        }
+    }
+}
@@ -24,6 +24,7 @@
 #include "Simd/SimdDefs.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdGaussianBlur.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -31,8 +32,22 @@ namespace Simd
         : width(w)
         , height(h)
         , channels(c)
+        , type(SimdGaussianBlurChannel8u)
         , sigma(*s)
         , epsilon(e ? *e : 0.001f)
+        , method(SimdGaussianBlurFir)
+        , align(a)
+    {
+    }
+
+    BlurParam::BlurParam(size_t w, size_t h, size_t c, SimdGaussianBlurChannelType t, const float* s, const float* e, SimdGaussianBlurMethod m, size_t a)
+        : width(w)
+        , height(h)
+        , channels(c)
+        , type(t)
+        , sigma(*s)
+        , epsilon(e ? *e : 0.001f)
+        , method(m)
         , align(a)
     {
     }
@@ -43,6 +58,8 @@ namespace Simd
             height > 0 &&
             width > 0 &&
             channels > 0 && channels <= 4 &&
+            (type == SimdGaussianBlurChannel8u || type == SimdGaussianBlurChannel16u || type == SimdGaussianBlurChannel32f) &&
+            (method == SimdGaussianBlurAuto || method == SimdGaussianBlurFir || method == SimdGaussianBlurIir) &&
             sigma >= 0.000001f &&
             epsilon >= 0.000001f && epsilon <= 1.0f &&
             align >= sizeof(float);
@@ -59,7 +76,7 @@ namespace Simd
 
     namespace Base
     {
-        SIMD_INLINE void BlurColsAny(const uint8_t* src, size_t size, size_t channels, const float* weight, size_t kernel, float* dst)
+        template<class T> SIMD_INLINE void BlurColsAny(const T* src, size_t size, size_t channels, const float* weight, size_t kernel, float* dst)
         {
             for (size_t i = 0; i < size; ++i)
             {
@@ -70,52 +87,34 @@ namespace Simd
             }
         }
 
-        SIMD_INLINE void BlurRowsAny(const float* src, size_t size, size_t stride, const float* weight, size_t kernel, uint8_t* dst)
+        template<class T> SIMD_INLINE void BlurRowsAny(const float* src, size_t size, size_t stride, const float* weight, size_t kernel, T* dst)
         {
             for (size_t i = 0; i < size; ++i)
             {
                 float sum = 0;
                 for (size_t k = 0; k < kernel; ++k)
                     sum += weight[k] * src[i + k * stride];
-                dst[i] = Round(sum);
+                dst[i] = BlurConvert<T>(sum);
             }
         }
 
-        template<int channels> void BlurImageAny(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
+        template<class T, int channels> void BlurImageAny(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, 
+            size_t yBeg, size_t yEnd, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
         {
-            PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-            BlurColsAny(cols, a.size, p.channels, a.weight.data, a.kernel, rows + a.half * a.stride);
-            for (size_t row = 0; row < a.half; ++row)
-                memcpy(rows + row * a.stride, rows + a.half * a.stride, a.size * sizeof(float));
-            for (size_t row = 1; row < a.nose; ++row)
+            ptrdiff_t beg = yBeg - a.half, end = yEnd + a.half, last = p.height - 1;
+            for (ptrdiff_t sy = beg; sy < end; ++sy)
             {
-                PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurColsAny(cols, a.size, p.channels, a.weight.data, a.kernel, rows + (a.half + row) * a.stride);
-            }
-            for (size_t row = a.nose; row <= a.half; ++row)
-                memcpy(rows + (a.half + row) * a.stride, rows + (a.half + a.nose - 1) * a.stride, a.size * sizeof(float));
-            BlurRowsAny(rows, a.size, a.stride, a.weight.data, a.kernel, dst), dst += dstStride;
-
-            for (size_t row = 1, b = row % a.kernel + 2 * a.half, w = a.kernel - row % a.kernel; row < a.body; ++row, ++b, --w)
-            {
-                if (b >= a.kernel)
-                    b -= a.kernel;
-                if (w == 0)
-                    w += a.kernel;
-                PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurColsAny(cols, a.size, p.channels, a.weight.data, a.kernel, rows + b * a.stride);
-                BlurRowsAny(rows, a.size, a.stride, a.weight.data + w, a.kernel, dst), dst += dstStride;
-            }
-
-            size_t last = (a.body + 2 * a.half - 1) % a.kernel;
-            for (size_t row = a.body, b = row % a.kernel + 2 * a.half, w = a.kernel - row % a.kernel; row < p.height; ++row, ++b, --w)
-            {
-                if (b >= a.kernel)
-                    b -= a.kernel;
-                if (w == 0)
-                    w += a.kernel;
-                memcpy(rows + b * a.stride, rows + last * a.stride, a.size * sizeof(float));
-                BlurRowsAny(rows, a.size, a.stride, a.weight.data + w, a.kernel, dst), dst += dstStride;
+                float* row = rows + (sy + a.half) % a.kernel * a.stride;
+                if (sy > beg && (sy <= 0 || sy > last))
+                    memcpy(row, rows + (sy + a.half - 1) % a.kernel * a.stride, a.size * sizeof(float));
+                else
+                {
+                    PadCols<int(channels * sizeof(T))>(src + Simd::RestrictRange<ptrdiff_t>(sy, 0, last) * srcStride, a.half, a.size * sizeof(T), cols);
+                    BlurColsAny((T*)cols, a.size, channels, a.weight.data, a.kernel, row);
+                }
+                ptrdiff_t y = sy - a.half;
+                if (y >= (ptrdiff_t)yBeg)
+                    BlurRowsAny(rows, a.size, a.stride, a.weight.data + a.kernel - y % a.kernel, a.kernel, (T*)(dst + y * dstStride));
             }
         }
 
@@ -143,41 +142,23 @@ namespace Simd
             }
         }
 
-        template<int channels, int kernel> void BlurImage(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
+        template<int channels, int kernel> void BlurImage(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, 
+            size_t yBeg, size_t yEnd, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
         {
-            PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-            BlurCols<kernel>(cols, a.size, p.channels, a.weight.data, rows + a.half * a.stride);
-            for (size_t row = 0; row < a.half; ++row)
-                memcpy(rows + row * a.stride, rows + a.half * a.stride, a.size * sizeof(float));
-            for (size_t row = 1; row < a.nose; ++row)
-            {
-                PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurCols<kernel>(cols, a.size, p.channels, a.weight.data, rows + (a.half + row) * a.stride);
-            }
-            for (size_t row = a.nose; row <= a.half; ++row)
-                memcpy(rows + (a.half + row) * a.stride, rows + (a.half + a.nose - 1) * a.stride, a.size * sizeof(float));
-            BlurRows<kernel>(rows, a.size, a.stride, a.weight.data, dst), dst += dstStride;
-
-            for (size_t row = 1, b = row % a.kernel + 2 * a.half, w = kernel - row % kernel; row < a.body; ++row, ++b, --w)
+            ptrdiff_t beg = yBeg - a.half, end = yEnd + a.half, last = p.height - 1;
+            for (ptrdiff_t sy = beg; sy < end; ++sy)
             {
-                if (b >= kernel)
-                    b -= kernel;
-                if (w == 0)
-                    w += kernel;
-                PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurCols<kernel>(cols, a.size, p.channels, a.weight.data, rows + b * a.stride);
-                BlurRows<kernel>(rows, a.size, a.stride, a.weight.data + w, dst), dst += dstStride;
-            }
-
-            size_t last = (a.body + 2 * a.half - 1) % kernel;
-            for (size_t row = a.body, b = row % kernel + 2 * a.half, w = kernel - row % kernel; row < p.height; ++row, ++b, --w)
-            {
-                if (b >= kernel)
-                    b -= kernel;
-                if (w == 0)
-                    w += kernel;
-                memcpy(rows + b * a.stride, rows + last * a.stride, a.size * sizeof(float));
-                BlurRows<kernel>(rows, a.size, a.stride, a.weight.data + w, dst), dst += dstStride;
+                float* row = rows + (sy + a.half) % kernel * a.stride;
+                if (sy > beg && (sy <= 0 || sy > last))
+                    memcpy(row, rows + (sy + a.half - 1) % kernel * a.stride, a.size * sizeof(float));
+                else
+                {
+                    PadCols<channels>(src + Simd::RestrictRange<ptrdiff_t>(sy, 0, last) * srcStride, a.half, a.size, cols);
+                    BlurCols<kernel>(cols, a.size, p.channels, a.weight.data, row);
+                }
+                ptrdiff_t y = sy - a.half;
+                if (y >= (ptrdiff_t)yBeg)
+                    BlurRows<kernel>(rows, a.size, a.stride, a.weight.data + kernel - y % kernel, dst + y * dstStride);
             }
         }
 
@@ -185,13 +166,19 @@ namespace Simd
 
         template<int channels> Base::BlurDefaultPtr GetBlurDefaultPtr(const BlurParam& p, const Base::AlgDefault& a)
         {
+            switch (p.type)
+            {
+            case SimdGaussianBlurChannel16u: return BlurImageAny<uint16_t, channels>;
+            case SimdGaussianBlurChannel32f: return BlurImageAny<float, channels>;
+            default: break;
+            }
             switch (a.kernel)
             {
             case 3: return BlurImage<channels, 3>;
             case 5: return BlurImage<channels, 5>;
             case 7: return BlurImage<channels, 7>;
             case 9: return BlurImage<channels, 9>;
-            default: return BlurImageAny<channels>;
+            default: return BlurImageAny<uint8_t, channels>;
             }
         }
 
@@ -200,7 +187,7 @@ namespace Simd
         GaussianBlurDefault::GaussianBlurDefault(const BlurParam& param)
             : Simd::GaussianBlur(param)
         {
-            _alg.half = (int)::floor(::sqrt(-::log(_param.epsilon)) * _param.sigma);
+            _alg.half = _param.Half();
             _alg.kernel = 2 * _alg.half + 1;
             _alg.weight.Resize(2 * _alg.kernel);
             _alg.weight[_alg.half] = 1.0f;
@@ -219,13 +206,14 @@ namespace Simd
             }
             _alg.size = _param.width * _param.channels;
             _alg.stride = AlignHi(_alg.size, _param.align / sizeof(float));
-            _alg.edge = AlignHi(_alg.half * _param.channels, _param.align);
-            _alg.start = _alg.edge - _alg.half * _param.channels;
-            _alg.nose = Simd::Min(_alg.half + 1, _param.height);
-            _alg.body = Simd::Max<ptrdiff_t>(_param.height - _alg.half, 1);
+            _alg.edge = AlignHi(_alg.half * _param.PixelSize(), _param.align);
+            _alg.start = _alg.edge - _alg.half * _param.PixelSize();
+            _alg.colsSize = AlignHi(_alg.size * _param.ChannelSize() + 2 * _alg.edge, _param.align);
+            _alg.rowsSize = _alg.kernel * _alg.stride;
+            _alg.threads = Simd::Max<size_t>(1, Simd::Min(Base::GetThreadNumber(), _param.height / Simd::Max<size_t>(_alg.kernel * 4, 16)));
 
-            _cols.Resize(_alg.size + 2 * _alg.edge, true);
-            _rows.Resize(_alg.kernel * _alg.stride);
+            _cols.Resize(_alg.colsSize * _alg.threads, true);
+            _rows.Resize(_alg.rowsSize * _alg.threads);
 
             switch (_param.channels)
             {
@@ -241,10 +229,168 @@ namespace Simd
             if (_alg.half == 0)
             {
                 if (src != dst)
-                    Copy(src, srcStride, _param.width, _param.height, _param.channels, dst, dstStride);
+                    Copy(src, srcStride, _param.width, _param.height, _param.PixelSize(), dst, dstStride);
             }
             else
-                _blur(_param, _alg, src, srcStride, _cols.data + _alg.start, _rows.data, dst, dstStride);
+            {
+                Simd::Parallel(0, _param.height, [&](size_t thread, size_t begin, size_t end)
+                {
+                    uint8_t* cols = _cols.data + thread * _alg.colsSize + _alg.start;
+                    float* rows = _rows.data + thread * _alg.rowsSize;
+                    _blur(_param, _alg, src, srcStride, begin, end, cols, rows, dst, dstStride);
+                }, _alg.threads, 1);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        template<class T, int channels> void BlurIirHor(const AlgIir& a, size_t width, const uint8_t* src8, float* buf, float* dst)
+        {
+            const T* src = (const T*)src8;
+            float w1[channels], w2[channels], w3[channels];
+            for (size_t c = 0; c < channels; ++c)
+                w1[c] = w2[c] = w3[c] = float(src[c]);
+            for (size_t i = 0, n = width * channels; i < n; i += channels)
+            {
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    float w0 = a.b * float(src[i + c]) + a.a1 * w1[c] + a.a2 * w2[c] + a.a3 * w3[c];
+                    buf[i + c] = w0;
+                    w3[c] = w2[c], w2[c] = w1[c], w1[c] = w0;
+                }
+            }
+            size_t last = (width - 1) * channels;
+            for (size_t c = 0; c < channels; ++c)
+            {
+                float e = float(src[last + c]), u0 = w1[c] - e, u1 = w2[c] - e, u2 = w3[c] - e;
+                w1[c] = e + a.m[0] * u0 + a.m[1] * u1 + a.m[2] * u2;
+                w2[c] = e + a.m[3] * u0 + a.m[4] * u1 + a.m[5] * u2;
+                w3[c] = e + a.m[6] * u0 + a.m[7] * u1 + a.m[8] * u2;
+                dst[last + c] = w1[c];
+            }
+            for (ptrdiff_t i = last - channels; i >= 0; i -= channels)
+            {
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    float y0 = a.b * buf[i + c] + a.a1 * w1[c] + a.a2 * w2[c] + a.a3 * w3[c];
+                    dst[i + c] = y0;
+                    w3[c] = w2[c], w2[c] = w1[c], w1[c] = y0;
+                }
+            }
+        }
+
+        template<class T> void BlurIirVer(const AlgIir& a, size_t size, size_t height, float* img, size_t stride, float* buf, uint8_t* dst, size_t dstStride)
+        {
+            float* first = buf, * last = buf + size, * next1 = buf + 2 * size, * next2 = buf + 3 * size;
+            memcpy(first, img, size * sizeof(float));
+            memcpy(last, img + (height - 1) * stride, size * sizeof(float));
+            for (ptrdiff_t y = 0; y < (ptrdiff_t)height; ++y)
+            {
+                float* w0 = img + y * stride;
+                const float* w1 = y > 0 ? w0 - stride : first;
+                const float* w2 = y > 1 ? w0 - 2 * stride : first;
+                const float* w3 = y > 2 ? w0 - 3 * stride : first;
+                for (size_t i = 0; i < size; ++i)
+                    w0[i] = a.b * w0[i] + a.a1 * w1[i] + a.a2 * w2[i] + a.a3 * w3[i];
+            }
+            {
+                ptrdiff_t y = height - 1;
+                float* y0 = img + y * stride;
+                const float* w1 = y > 0 ? y0 - stride : first;
+                const float* w2 = y > 1 ? y0 - 2 * stride : first;
+                T* d = (T*)(dst + y * dstStride);
+                for (size_t i = 0; i < size; ++i)
+                {
+                    float e = last[i], u0 = y0[i] - e, u1 = w1[i] - e, u2 = w2[i] - e;
+                    y0[i] = e + a.m[0] * u0 + a.m[1] * u1 + a.m[2] * u2;
+                    next1[i] = e + a.m[3] * u0 + a.m[4] * u1 + a.m[5] * u2;
+                    next2[i] = e + a.m[6] * u0 + a.m[7] * u1 + a.m[8] * u2;
+                    d[i] = BlurConvert<T>(y0[i]);
+                }
+            }
+            for (ptrdiff_t y = height - 2; y >= 0; --y)
+            {
+                float* y0 = img + y * stride;
+                const float* y1 = y0 + stride;
+                const float* y2 = y + 2 < (ptrdiff_t)height ? y0 + 2 * stride : next1;
+                const float* y3 = y + 3 < (ptrdiff_t)height ? y0 + 3 * stride : (y + 3 == (ptrdiff_t)height ? next1 : next2);
+                T* d = (T*)(dst + y * dstStride);
+                for (size_t i = 0; i < size; ++i)
+                {
+                    y0[i] = a.b * y0[i] + a.a1 * y1[i] + a.a2 * y2[i] + a.a3 * y3[i];
+                    d[i] = BlurConvert<T>(y0[i]);
+                }
+            }
+        }
+
+        template<class T> BlurIirHorPtr GetBlurIirHorPtr(size_t channels)
+        {
+            switch (channels)
+            {
+            case 1: return BlurIirHor<T, 1>;
+            case 2: return BlurIirHor<T, 2>;
+            case 3: return BlurIirHor<T, 3>;
+            case 4: return BlurIirHor<T, 4>;
+            default: 
+                assert(0); return NULL;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        GaussianBlurIir::GaussianBlurIir(const BlurParam& param)
+            : Simd::GaussianBlur(param)
+        {
+            double s = _param.sigma, q = s >= 2.5 ? 0.98711 * s - 0.96330 : 3.97156 - 4.14554 * ::sqrt(1.0 - 0.26891 * s);
+            double b0 = 1.57825 + 2.44413 * q + 1.4281 * q * q + 0.422205 * q * q * q;
+            double a1 = (2.44413 * q + 2.85619 * q * q + 1.26661 * q * q * q) / b0;
+            double a2 = -(1.4281 * q * q + 1.26661 * q * q * q) / b0;
+            double a3 = 0.422205 * q * q * q / b0;
+            double b = 1.0 - (a1 + a2 + a3);
+            double k = b / ((1.0 + a1 - a2 + a3) * (1.0 - a1 - a2 - a3) * (1.0 + a2 + (a1 - a3) * a3));
+            double m[9] = {
+                k * (-a3 * a1 + 1.0 - a3 * a3 - a2), k * (a3 + a1) * (a2 + a3 * a1), k * a3 * (a1 + a3 * a2),
+                k * (a1 + a3 * a2), -k * (a2 - 1.0) * (a2 + a3 * a1), -k * a3 * (a3 * a1 + a3 * a3 + a2 - 1.0),
+                k * (a3 * a1 + a2 + a1 * a1 - a2 * a2), k * (a1 * a2 + a3 * a2 * a2 - a1 * a3 * a3 - a3 * a3 * a3 - a3 * a2 + a3), k * a3 * (a1 + a3 * a2) };
+            _alg.b = float(b);
+            _alg.a1 = float(a1);
+            _alg.a2 = float(a2);
+            _alg.a3 = float(a3);
+            for (size_t i = 0; i < 9; ++i)
+                _alg.m[i] = float(m[i]);
+            _alg.size = _param.width * _param.channels;
+            _alg.stride = AlignHi(_alg.size, _param.align / sizeof(float));
+            _alg.hThreads = Simd::Max<size_t>(1, Simd::Min(Base::GetThreadNumber(), _param.height / 16));
+            _alg.vThreads = Simd::Max<size_t>(1, Simd::Min(Base::GetThreadNumber(), _alg.size / 128));
+            _buffer.Resize(_alg.stride * _param.height + _alg.size * (_alg.hThreads + 4));
+
+            switch (_param.type)
+            {
+            case SimdGaussianBlurChannel8u: _hor = GetBlurIirHorPtr<uint8_t>(_param.channels), _ver = BlurIirVer<uint8_t>; break;
+            case SimdGaussianBlurChannel16u: _hor = GetBlurIirHorPtr<uint16_t>(_param.channels), _ver = BlurIirVer<uint16_t>; break;
+            case SimdGaussianBlurChannel32f: _hor = GetBlurIirHorPtr<float>(_param.channels), _ver = BlurIirVer<float>; break;
+            default:
+                assert(0);
+            }
+        }
+
+        void GaussianBlurIir::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            const BlurParam& p = _param;
+            float* img = _buffer.data, * hBuf = img + _alg.stride * p.height, * vBuf = hBuf + _alg.size * _alg.hThreads;
+            Simd::Parallel(0, p.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t y = begin; y < end; ++y)
+                    _hor(_alg, p.width, src + y * srcStride, hBuf + thread * _alg.size, img + y * _alg.stride);
+            }, _alg.hThreads, 1);
+            Simd::Parallel(0, _alg.vThreads, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t block = begin; block < end; ++block)
+                {
+                    size_t x0 = VerBlockBeg(block), x1 = VerBlockBeg(block + 1);
+                    _ver(_alg, x1 - x0, p.height, img + x0, _alg.stride, vBuf + 4 * x0, dst + x0 * p.ChannelSize(), dstStride);
+                }
+            }, _alg.vThreads, 1);
         }
 
         //---------------------------------------------------------------------
@@ -257,6 +403,17 @@ namespace Simd
             return new GaussianBlurDefault(param);
         }
 
+        void* GaussianBlurInitEx(size_t width, size_t height, size_t channels, SimdGaussianBlurChannelType type,
+            const float* sigma, const float* epsilon, SimdGaussianBlurMethod method)
+        {
+            BlurParam param(width, height, channels, type, sigma, epsilon, method, sizeof(void*));
+            if (!param.Valid())
+                return NULL;
+            if (param.Iir())
+                return new GaussianBlurIir(param);
+            return new GaussianBlurDefault(param);
+        }
+
         //---------------------------------------------------------------------
 
         SIMD_INLINE int DivideBy16(int value)
@@ -25,6 +25,7 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdCpu.h"
 #include "Simd/SimdBase.h"
+#include "Simd/SimdFileMapping.h"
 
 #include <stdio.h>
 
@@ -38,6 +39,9 @@ namespace Simd
     uint8_t* ImageLoadFromFile(const ImageLoadFromMemoryPtr loader, const char* path, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
     {
         uint8_t* data = NULL;
+        InputFileMapping mapping;
+        if (mapping.Open(path))
+            return loader(mapping.Data(), mapping.Size(), stride, width, height, format);
         ::FILE* file = ::fopen(path, "rb");
         if (file)
         {
@@ -88,12 +92,34 @@ namespace Simd
             if (data[0] == 0xFF && data[1] == 0xD8)
                 file = SimdImageFileJpeg;
         }
+        if (size >= 4)
+        {
+            if (data[0] == 'q' && data[1] == 'o' && data[2] == 'i' && data[3] == 'f')
+                file = SimdImageFileQoi;
+        }
         return
             file != SimdImageFileUndefined && 
                 (format == SimdPixelFormatNone || format == SimdPixelFormatGray8 || 
                 format == SimdPixelFormatBgr24 || format == SimdPixelFormatBgra32 || 
                 format == SimdPixelFormatRgb24 || format == SimdPixelFormatRgba32);
     }
+
+    //-------------------------------------------------------------------------
+
+    ImageBandLoader::ImageBandLoader(InputFileMapping* mapping, const ImageLoaderParam& param)
+        : _mapping(mapping)
+        , _param(param)
+        , _stream(_param.data, _param.size)
+        , _width(0)
+        , _height(0)
+        , _row(0)
+    {
+    }
+
+    ImageBandLoader::~ImageBandLoader()
+    {
+        delete _mapping;
+    }
         
     namespace Base
     {
@@ -334,6 +360,84 @@ namespace Simd
 
         //-------------------------------------------------------------------------
 
+        ImagePxmBandLoader::ImagePxmBandLoader(InputFileMapping* mapping, const ImageLoaderParam& param)
+            : ImageBandLoader(mapping, param)
+            , _toAny(NULL)
+            , _toBgra(NULL)
+            , _size(0)
+        {
+        }
+
+        bool ImagePxmBandLoader::ReadHeader()
+        {
+            size_t version = _param.file == SimdImageFilePgmBin ? 5 : 6;
+            if (_stream.Size() < 3 ||
+                _stream.Data()[0] != 'P' ||
+                _stream.Data()[1] != '0' + version ||
+                _stream.Data()[2] != '\n')
+                return false;
+            _stream.Seek(3);
+            uint32_t width, height, max;
+            if (!(_stream.ReadUnsigned(width) && _stream.ReadUnsigned(height) && _stream.ReadUnsigned(max)))
+                return false;
+            if (!(width > 0 && height > 0 && max == 255))
+                return false;
+            uint8_t byte;
+            if (!(_stream.Read(byte) && byte == '\n'))
+                return false;
+            _width = width;
+            _height = height;
+            if (version == 5)
+            {
+                _size = _width * 1;
+                if (_param.format == SimdPixelFormatNone)
+                    _param.format = SimdPixelFormatGray8;
+                switch (_param.format)
+                {
+                case SimdPixelFormatBgr24: _toAny = Base::GrayToBgr; break;
+                case SimdPixelFormatBgra32: _toBgra = Base::GrayToBgra; break;
+                case SimdPixelFormatRgb24: _toAny = Base::GrayToBgr; break;
+                case SimdPixelFormatRgba32: _toBgra = Base::GrayToBgra; break;
+                default: break;
+                }
+            }
+            else
+            {
+                _size = _width * 3;
+                if (_param.format == SimdPixelFormatNone)
+                    _param.format = SimdPixelFormatRgb24;
+                switch (_param.format)
+                {
+                case SimdPixelFormatGray8: _toAny = Base::RgbToGray; break;
+                case SimdPixelFormatBgr24: _toAny = Base::BgrToRgb; break;
+                case SimdPixelFormatBgra32: _toBgra = Base::RgbToBgra; break;
+                case SimdPixelFormatRgba32: _toBgra = Base::BgrToBgra; break;
+                default: break;
+                }
+            }
+            return _stream.CanRead(_size * _height);
+        }
+
+        size_t ImagePxmBandLoader::Run(uint8_t* dst, size_t stride, size_t rows)
+        {
+            rows = Simd::Min(rows, _height - _row);
+            const uint8_t* src = _stream.Current();
+            if (_toAny)
+                _toAny(src, _width, rows, _size, dst, stride);
+            else if (_toBgra)
+                _toBgra(src, _width, rows, _size, dst, stride, 0xFF);
+            else
+            {
+                for (size_t row = 0; row < rows; ++row)
+                    memcpy(dst + row * stride, src + row * _size, _size);
+            }
+            _stream.Skip(rows * _size);
+            _row += rows;
+            return rows;
+        }
+
+        //-------------------------------------------------------------------------
+
         ImageLoader* CreateImageLoader(const ImageLoaderParam& param)
         {
             switch (param.file)
@@ -344,6 +448,7 @@ namespace Simd
             case SimdImageFilePpmBin: return new ImagePpmBinLoader(param);
             case SimdImageFilePng: return new ImagePngLoader(param);
             case SimdImageFileJpeg: return new ImageJpegLoader(param);
+            case SimdImageFileQoi: return new ImageQoiLoader(param);
             default:
                 return NULL;
             }
@@ -363,6 +468,39 @@ namespace Simd
             }
             return NULL;
         }
+
+        void* ImageLoadBandInit(const char* path, SimdPixelFormatType* format, size_t* width, size_t* height)
+        {
+            InputFileMapping* mapping = new InputFileMapping();
+            if (!mapping->Open(path))
+            {
+                delete mapping;
+                return NULL;
+            }
+            ImageLoaderParam param(mapping->Data(), mapping->Size(), *format);
+            ImageBandLoader* loader = NULL;
+            if (param.Validate())
+            {
+                if (param.file == SimdImageFilePgmBin || param.file == SimdImageFilePpmBin)
+                    loader = new ImagePxmBandLoader(mapping, param);
+                else if (param.file == SimdImageFilePng)
+                    loader = new ImagePngBandLoader(mapping, param);
+            }
+            if (loader == NULL)
+            {
+                delete mapping;
+                return NULL;
+            }
+            if (!loader->ReadHeader())
+            {
+                delete loader;
+                return NULL;
+            }
+            *format = loader->Format();
+            *width = loader->Width();
+            *height = loader->Height();
+            return loader;
+        }
     }
 }
 
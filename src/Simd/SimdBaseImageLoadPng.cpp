@@ -112,7 +112,7 @@ namespace Simd
             static SIMD_INLINE int ZhuffmanDecode(InputMemoryStream& is, const Zhuffman& z)
             {
                 int b, s;
-                if (is.BitCount() < 16)
+                if (is.BitCount() < 16 || is.BitCount() > sizeof(is.BitBuffer()) * 8) // the latter means that the stream was read past its end
                 {
                     if (is.Eof())
                         return -1;
@@ -158,9 +158,10 @@ namespace Simd
                     if (z < 256)
                     {
                         if (z < 0)
-                            return CorruptPngError("bad huffman code");
+                            return is.Eof() ? 0 : CorruptPngError("bad huffman code");
                         if (dst >= end)
                         {
+                            os.Seek(dst - beg);
                             os.Reserve(end - beg + 1);
                             beg = os.Data();
                             dst = os.Current();
@@ -182,7 +183,7 @@ namespace Simd
                             len += (int)is.ReadBits(zlengthExtra[z]);
                         z = ZhuffmanDecode(is, zDistance);
                         if (z < 0)
-                            return CorruptPngError("bad huffman code");
+                            return is.Eof() ? 0 : CorruptPngError("bad huffman code");
                         dist = zdistBase[z];
                         if (zdistExtra[z])
                             dist += (int)is.ReadBits(zdistExtra[z]);
@@ -190,6 +191,7 @@ namespace Simd
                             return CorruptPngError("bad dist");
                         if (dst + len > end)
                         {
+                            os.Seek(dst - beg);
                             os.Reserve(dst - beg + len);
                             beg = os.Data();
                             dst = os.Current();
@@ -311,7 +313,7 @@ namespace Simd
                 return 1;
             }
 
-            bool Decode(InputMemoryStream& is, OutputMemoryStream& os, bool parseHeader)
+            static bool DecodeBlock(InputMemoryStream& is, OutputMemoryStream& os, int& final)
             {
                 static const uint8_t ZdefaultLength[288] = {
                    8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8, 8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
@@ -329,41 +331,43 @@ namespace Simd
                 };
 
                 Zhuffman zLength, zDistance;
-                int final, type;
-                if (parseHeader)
-                {
-                    if (!ParseHeader(is))
-                        return false;
-                }
-                do
+                final = (int)is.ReadBits(1);
+                int type = (int)is.ReadBits(2);
+                if (type == 0)
+                    return ParseUncompressedBlock(is, os) != 0;
+                else if (type == 3)
+                    return false;
+                else
                 {
-                    final = (int)is.ReadBits(1);
-                    type = (int)is.ReadBits(2);
-                    if (type == 0)
+                    if (type == 1)
                     {
-                        if (!ParseUncompressedBlock(is, os))
+                        if (!zLength.Build(ZdefaultLength, 288))
+                            return false;
+                        if (!zDistance.Build(ZdefaultDistance, 32))
                             return false;
                     }
-                    else if (type == 3)
-                        return false;
                     else
                     {
-                        if (type == 1)
-                        {
-                            if (!zLength.Build(ZdefaultLength, 288))
-                                return false;
-                            if (!zDistance.Build(ZdefaultDistance, 32))
-                                return false;
-                        }
-                        else
-                        {
-                            if (!ComputeHuffmanCodes(is, zLength, zDistance))
-                                return false;
-                        }
-                        if (!ParseHuffmanBlock(is, zLength, zDistance, os))
+                        if (!ComputeHuffmanCodes(is, zLength, zDistance))
                             return false;
                     }
-                } while (!final);
+                    return ParseHuffmanBlock(is, zLength, zDistance, os) != 0;
+                }
+            }
+
+            bool Decode(InputMemoryStream& is, OutputMemoryStream& os, bool parseHeader)
+            {
+                int final = 0;
+                if (parseHeader)
+                {
+                    if (!ParseHeader(is))
+                        return false;
+                }
+                while (!final)
+                {
+                    if (!DecodeBlock(is, os, final))
+                        return is.Eof() ? CorruptPngError("unexpected end of data") != 0 : false;
+                }
                 return true;
             }
         }
@@ -1246,5 +1250,187 @@ namespace Simd
             _image.Recreate(_width, _height, (Image::Format)_param.format);
             _converter(_buffer.data, _width, _height, _width * _outN, _image.data, _image.stride);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ImagePngBandLoader::ImagePngBandLoader(InputFileMapping* mapping, const ImageLoaderParam& param)
+            : ImageBandLoader(mapping, param)
+            , _converter(NULL)
+            , _channels(0)
+            , _size(0)
+            , _idat(0)
+            , _idatPos(0)
+            , _lookahead(0)
+            , _zPos(0)
+            , _final(false)
+        {
+            _decodeLine[0] = Base::DecodeLine0;
+            _decodeLine[1] = Base::DecodeLine1;
+            _decodeLine[2] = Base::DecodeLine2;
+            _decodeLine[3] = Base::DecodeLine3;
+            _decodeLine[4] = Base::DecodeLine4;
+            _decodeLine[5] = Base::DecodeLine5;
+            _decodeLine[6] = Base::DecodeLine6;
+        }
+
+        bool ImagePngBandLoader::ReadHeader()
+        {
+            const uint8_t SIGNATURE[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+            uint8_t signature[8];
+            if (!(_stream.Read(8, signature) == 8 && memcmp(signature, SIGNATURE, 8) == 0))
+                return false;
+            bool header = false;
+            for (bool run = true; run;)
+            {
+                uint32_t size, type, crc32;
+                if (!(_stream.ReadBe32u(size) && _stream.ReadBe32u(type) && _stream.CanRead(size)))
+                    return false;
+                if (type == ChunkType('I', 'H', 'D', 'R'))
+                {
+                    uint32_t width, height;
+                    uint8_t depth, color, comp, filter, interlace;
+                    if (header || size != 13)
+                        return false;
+                    if (!(_stream.ReadBe32u(width) && _stream.ReadBe32u(height) && _stream.Read8u(depth) && _stream.Read8u(color) && 
+                        _stream.Read8u(comp) && _stream.Read8u(filter) && _stream.Read8u(interlace)))
+                        return false;
+                    if (width == 0 || height == 0 || depth != 8 || comp != 0 || filter != 0 || interlace != 0)
+                        return false;
+                    if (color != 0 && color != 2 && color != 4 && color != 6)
+                        return false;
+                    _width = width;
+                    _height = height;
+                    _channels = (color & 2 ? 3 : 1) + (color & 4 ? 1 : 0);
+                    header = true;
+                }
+                else if (type == ChunkType('I', 'D', 'A', 'T'))
+                {
+                    if (!header)
+                        return false;
+                    Chunk chunk;
+                    chunk.offs = _stream.Pos();
+                    chunk.size = size;
+                    _idats.push_back(chunk);
+                    _stream.Skip(size);
+                }
+                else if (type == ChunkType('I', 'E', 'N', 'D'))
+                    run = false;
+                else
+                {
+                    if (!header || type == ChunkType('t', 'R', 'N', 'S') || 
+                        ((type & (1 << 29)) == 0 && type != ChunkType('P', 'L', 'T', 'E')))
+                        return false;
+                    _stream.Skip(size);
+                }
+                if (!_stream.ReadBe32u(crc32))
+                    return false;
+            }
+            if (!header || _idats.empty())
+                return false;
+            if (_param.format == SimdPixelFormatNone)
+                _param.format = SimdPixelFormatRgba32;
+            _converter = GetConverter(8, (int)_channels, _param.format);
+            _size = _width * _channels;
+            _prev.Resize(_size);
+            _curr.Resize(_size);
+            _lookahead = 1 << 16;
+            AppendData(_lookahead);
+            return Zlib::ParseHeader(_zIs) != 0;
+        }
+
+        size_t ImagePngBandLoader::Run(uint8_t* dst, size_t stride, size_t rows)
+        {
+            static const uint8_t FirstRowFilter[5] = { 0, 1, 0, 5, 6 };
+            rows = Simd::Min(rows, _height - _row);
+            for (size_t row = 0; row < rows; ++row)
+            {
+                while (_zDst.Pos() - _zPos < _size + 1)
+                {
+                    if (_final || !DecodeBlock())
+                        return row;
+                }
+                const uint8_t* data = _zDst.Data() + _zPos;
+                int filter = data[0];
+                if (filter > 4)
+                    return row;
+                if (_row == 0)
+                    filter = FirstRowFilter[filter];
+                _decodeLine[filter](data + 1, _prev.data, (int)_width, (int)_channels, (int)_channels, _curr.data);
+                _converter(_curr.data, _width, 1, _size, dst, stride);
+                _curr.Swap(_prev);
+                _zPos += _size + 1;
+                _row += 1;
+                dst += stride;
+            }
+            return rows;
+        }
+
+        bool ImagePngBandLoader::AppendData(size_t size)
+        {
+            size_t pos = _zIs.Pos(), tail = _zIs.Size() - pos, end = tail;
+            if (_zSrc.size < tail + size)
+            {
+                Array8u buffer(tail + size);
+                if (tail)
+                    memcpy(buffer.data, _zSrc.data + pos, tail);
+                _zSrc.Swap(buffer);
+            }
+            else if (tail)
+                memmove(_zSrc.data, _zSrc.data + pos, tail);
+            while (end < tail + size && _idat < _idats.size())
+            {
+                const Chunk& chunk = _idats[_idat];
+                size_t count = Simd::Min(chunk.size - _idatPos, tail + size - end);
+                memcpy(_zSrc.data + end, _param.data + chunk.offs + _idatPos, count);
+                end += count;
+                _idatPos += count;
+                if (_idatPos == chunk.size)
+                {
+                    _idat++;
+                    _idatPos = 0;
+                }
+            }
+            size_t bitBuffer = (size_t)_zIs.BitBuffer();
+            size_t bitCount = _zIs.BitCount();
+            _zIs.Init(_zSrc.data, end);
+            _zIs.BitBuffer() = bitBuffer;
+            _zIs.BitCount() = bitCount;
+            return end > tail;
+        }
+
+        bool ImagePngBandLoader::DecodeBlock()
+        {
+            const size_t WINDOW = 1 << 15;
+            size_t pos = _zDst.Pos(), keep = Simd::Min(_zPos, pos - Simd::Min(pos, WINDOW));
+            if (keep)
+            {
+                memmove(_zDst.Data(), _zDst.Data() + keep, pos - keep);
+                _zDst.Clear();
+                _zDst.Seek(pos - keep);
+                _zPos -= keep;
+                pos -= keep;
+            }
+            for (;;)
+            {
+                if (_zIs.Size() - _zIs.Pos() < _lookahead && _idat < _idats.size())
+                    AppendData(_lookahead);
+                size_t bitBuffer = (size_t)_zIs.BitBuffer();
+                size_t bitCount = _zIs.BitCount(), start = _zIs.Pos();
+                int final = 0;
+                if (Zlib::DecodeBlock(_zIs, _zDst, final) && _zIs.BitCount() <= sizeof(_zIs.BitBuffer()) * 8)
+                {
+                    _final = final != 0;
+                    return true;
+                }
+                if (_idat == _idats.size())
+                    return false;
+                _zIs.Seek(start);
+                _zIs.BitBuffer() = bitBuffer;
+                _zIs.BitCount() = bitCount;
+                _zDst.Clear();
+                _zDst.Seek(pos);
+                _lookahead *= 2;
+            }
+        }
     }
 }
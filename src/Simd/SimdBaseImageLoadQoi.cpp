@@ -0,0 +1,140 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdImageLoad.h"
+#include "Simd/SimdImageQoi.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        ImageQoiLoader::ImageQoiLoader(const ImageLoaderParam& param)
+            : ImageLoader(param)
+            , _converter(NULL)
+            , _channels(0)
+        {
+        }
+
+        bool ImageQoiLoader::ReadHeader()
+        {
+            if (_stream.Size() < QOI_HEADER_SIZE + QOI_PADDING_SIZE || memcmp(_stream.Data(), QOI_MAGIC, 4) != 0)
+                return false;
+            _stream.Seek(4);
+            uint32_t width, height;
+            uint8_t channels, colorspace;
+            if (!(_stream.ReadBe32u(width) && _stream.ReadBe32u(height) && _stream.Read8u(channels) && _stream.Read8u(colorspace)))
+                return false;
+            if (width == 0 || height == 0 || size_t(width) * height > QOI_PIXELS_MAX || channels < 3 || channels > 4 || colorspace > 1)
+                return false;
+            _channels = channels;
+            if (_param.format == SimdPixelFormatNone)
+                _param.format = _channels == 4 ? SimdPixelFormatRgba32 : SimdPixelFormatRgb24;
+            _image.Recreate(width, height, (Image::Format)_param.format);
+            SetConverters();
+            if (_converter)
+                _buffer.Resize(width * 4);
+            return true;
+        }
+
+        bool ImageQoiLoader::FromStream()
+        {
+            if (!ReadHeader())
+                return false;
+            const uint8_t* data = _stream.Current();
+            size_t size = _stream.Size() - _stream.Pos() - QOI_PADDING_SIZE, pos = 0, run = 0;
+            uint32_t index[64], pixel;
+            memset(index, 0, sizeof(index));
+            uint8_t* px = (uint8_t*)&pixel;
+            px[0] = 0, px[1] = 0, px[2] = 0, px[3] = 255;
+            for (size_t row = 0; row < _image.height; ++row)
+            {
+                uint32_t* dst = (uint32_t*)(_converter ? _buffer.data : _image.Row<uint8_t>(row));
+                for (size_t col = 0; col < _image.width; ++col)
+                {
+                    if (run)
+                        run--;
+                    else
+                    {
+                        if (pos >= size)
+                            return false;
+                        uint8_t b1 = data[pos++];
+                        if (b1 == QOI_OP_RGB)
+                        {
+                            if (pos + 3 > size)
+                                return false;
+                            px[0] = data[pos + 0];
+                            px[1] = data[pos + 1];
+                            px[2] = data[pos + 2];
+                            pos += 3;
+                        }
+                        else if (b1 == QOI_OP_RGBA)
+                        {
+                            if (pos + 4 > size)
+                                return false;
+                            pixel = *(uint32_t*)(data + pos);
+                            pos += 4;
+                        }
+                        else if ((b1 & QOI_MASK_2) == QOI_OP_INDEX)
+                            pixel = index[b1];
+                        else if ((b1 & QOI_MASK_2) == QOI_OP_DIFF)
+                        {
+                            px[0] += ((b1 >> 4) & 0x03) - 2;
+                            px[1] += ((b1 >> 2) & 0x03) - 2;
+                            px[2] += ((b1 >> 0) & 0x03) - 2;
+                        }
+                        else if ((b1 & QOI_MASK_2) == QOI_OP_LUMA)
+                        {
+                            if (pos >= size)
+                                return false;
+                            uint8_t b2 = data[pos++];
+                            int vg = (b1 & 0x3f) - 32;
+                            px[0] += vg - 8 + ((b2 >> 4) & 0x0f);
+                            px[1] += vg;
+                            px[2] += vg - 8 + ((b2 >> 0) & 0x0f);
+                        }
+                        else
+                            run = b1 & 0x3f;
+                        index[QoiHash(px)] = pixel;
+                    }
+                    dst[col] = pixel;
+                }
+                if (_converter)
+                    _converter(_buffer.data, _image.width, 1, _image.width * 4, _image.Row<uint8_t>(row), _image.stride);
+            }
+            return true;
+        }
+
+        void ImageQoiLoader::SetConverters()
+        {
+            switch (_param.format)
+            {
+            case SimdPixelFormatGray8: _converter = Base::RgbaToGray; break;
+            case SimdPixelFormatBgr24: _converter = Base::BgraToRgb; break;
+            case SimdPixelFormatBgra32: _converter = Base::BgraToRgba; break;
+            case SimdPixelFormatRgb24: _converter = Base::BgraToBgr; break;
+            default: break;
+            }
+        }
+    }
+}
@@ -49,9 +49,8 @@ namespace Simd
         return dst;
     }
 
-    SimdBool ImageSaveToFile(const ImageSaveToMemoryPtr saver, const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, const char* path)
+    void ImageSaverParam::SetFileByPath(const char* path)
     {
-        SimdBool result = SimdFalse;
         if (file == SimdImageFileUndefined && path)
         {
             const String& str(path);
@@ -71,22 +70,56 @@ namespace Simd
                     if (quality == 100)
                         quality = 85;
                 }
+                else if (ext == "qoi")
+                    file = SimdImageFileQoi;
             }
         }
-        size_t size;
-        uint8_t * data = saver(src, stride, width, height, format, file, quality, &size);
-        if (data)
-        {
-            ::FILE* file = ::fopen(path, "wb");
-            if (file)
-            {
-                if (::fwrite(data, 1, size, file) == size)
-                    result = SimdTrue;
-                ::fclose(file);
-            }
-            Simd::Free(data);
-        }
-        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool ImageSaver::Open(const char* path)
+    {
+        if (_file)
+            ::fclose(_file);
+        _file = ::fopen(path, "wb");
+        _flush = Base::AlgCacheL2();
+        _error = false;
+        return _file != NULL;
+    }
+
+    void ImageSaver::FlushToFile()
+    {
+        if (_stream.Pos() && ::fwrite(_stream.Data(), 1, _stream.Pos(), _file) != _stream.Pos())
+            _error = true;
+        _stream.Clear();
+    }
+
+    bool ImageSaver::Close()
+    {
+        if (_file == NULL)
+            return false;
+        FlushToFile();
+        if (::fclose(_file) != 0)
+            _error = true;
+        _file = NULL;
+        return !_error;
+    }
+
+    SimdBool ImageSaveToFile(ImageSaverFactoryPtr factory, const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, const char* path)
+    {
+        ImageSaverParam param(width, height, format, file, quality);
+        param.SetFileByPath(path);
+        if (!param.Validate())
+            return SimdFalse;
+        Holder<ImageSaver> saver(factory(param));
+        if (!saver || !saver->Open(path))
+            return SimdFalse;
+        if (saver->ToStream(src, stride) && saver->Close())
+            return SimdTrue;
+        saver->Close();
+        ::remove(path);
+        return SimdFalse;
     }
 
     //-------------------------------------------------------------------------
@@ -162,7 +195,7 @@ namespace Simd
         bool ImagePgmTxtSaver::ToStream(const uint8_t* src, size_t stride)
         {
             size_t grayStride = _param.format == SimdPixelFormatGray8 ? stride : _size;
-            _stream.Reserve(32 + _param.height * (_param.width * 4 + DivHi(_param.width, 17)));
+            Reserve(32 + _param.height * (_param.width * 4 + DivHi(_param.width, 17)));
             WriteHeader(2);
             for (size_t row = 0; row < _param.height;)
             {
@@ -191,6 +224,7 @@ namespace Simd
                 }
                 src += stride * block;
                 row += block;
+                Flush();
             }
             return true;
         }
@@ -213,7 +247,7 @@ namespace Simd
         bool ImagePgmBinSaver::ToStream(const uint8_t* src, size_t stride)
         {
             size_t grayStride = _param.format == SimdPixelFormatGray8 ? stride : _size;
-            _stream.Reserve(32 + _param.height * _size);
+            Reserve(32 + _param.height * _size);
             WriteHeader(5);
             for (size_t row = 0; row < _param.height;)
             {
@@ -231,6 +265,7 @@ namespace Simd
                 }
                 src += stride * block;
                 row += block;
+                Flush();
             }
             return true;
         }
@@ -253,7 +288,7 @@ namespace Simd
         bool ImagePpmTxtSaver::ToStream(const uint8_t* src, size_t stride)
         {
             size_t rgbStride = _param.format == SimdPixelFormatRgb24 ? stride : _size;
-            _stream.Reserve(32 + _param.height * (_param.width * 13 + DivHi(_param.width, 5)));
+            Reserve(32 + _param.height * (_param.width * 13 + DivHi(_param.width, 5)));
             WriteHeader(3);
             for (size_t row = 0; row < _param.height;)
             {
@@ -289,6 +324,7 @@ namespace Simd
                 }
                 src += stride * block;
                 row += block;
+                Flush();
             }
             return true;
         }
@@ -311,7 +347,7 @@ namespace Simd
         bool ImagePpmBinSaver::ToStream(const uint8_t* src, size_t stride)
         {
             size_t rgbStride = _param.format == SimdPixelFormatRgb24 ? stride : _size;
-            _stream.Reserve(32 + _param.height * _size);
+            Reserve(32 + _param.height * _size);
             WriteHeader(6);
             for (size_t row = 0; row < _param.height;)
             {
@@ -329,6 +365,7 @@ namespace Simd
                 }
                 src += stride * block;
                 row += block;
+                Flush();
             }
             return true;
         }
@@ -345,6 +382,7 @@ namespace Simd
             case SimdImageFilePpmBin: return new ImagePpmBinSaver(param);
             case SimdImageFilePng:    return new ImagePngSaver(param);
             case SimdImageFileJpeg:   return new ImageJpegSaver(param);
+            case SimdImageFileQoi:    return new ImageQoiSaver(param);
             default:
                 return NULL;
             }
@@ -364,6 +402,25 @@ namespace Simd
             }
             return NULL;
         }
+
+        SimdBool ImageSaveToFile(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, const char* path)
+        {
+            return Simd::ImageSaveToFile(CreateImageSaver, src, stride, width, height, format, file, quality, path);
+        }
+
+        void* ImageSaveBandInit(size_t width, size_t height, SimdPixelFormatType format, int quality, const char* path)
+        {
+            ImageSaverParam param(width, height, format, SimdImageFileJpeg, quality);
+            if (!param.Validate())
+                return NULL;
+            ImageJpegSaver* saver = new ImageJpegSaver(param);
+            if (!saver->Open(path))
+            {
+                delete saver;
+                return NULL;
+            }
+            return saver;
+        }
     }
 }
 
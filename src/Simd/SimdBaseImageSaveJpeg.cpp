@@ -374,6 +374,9 @@ namespace Simd
             , _writeBlock(NULL)
             , _writeNv12Block(NULL)
             , _writeYuv420pBlock(NULL)
+            , _row(0)
+            , _bandRows(0)
+            , _bandStride(0)
         {
         }
 
@@ -491,43 +494,101 @@ namespace Simd
             _stream.Write(head2, sizeof(head2));
         }
 
+        void ImageJpegSaver::WriteBlock(const uint8_t* src, size_t stride, int block, int dc[3])
+        {
+            uint8_t* r = _buffer.data, * g = r + _width * _block, * b = g + _width * _block;
+            switch (_param.format)
+            {
+            case SimdPixelFormatBgr24:
+                _deintBgr(src, stride, _param.width, block, b, _width, g, _width, r, _width);
+                break;
+            case SimdPixelFormatBgra32:
+                _deintBgra(src, stride, _param.width, block, b, _width, g, _width, r, _width, NULL, 0);
+                break;
+            case SimdPixelFormatRgb24:
+                _deintBgr(src, stride, _param.width, block, r, _width, g, _width, b, _width);
+                break;
+            case SimdPixelFormatRgba32:
+                _deintBgra(src, stride, _param.width, block, r, _width, g, _width, b, _width, NULL, 0);
+                break;
+            default:
+                break;
+            }
+            if(_param.format == SimdPixelFormatGray8)
+                _writeBlock(_stream, (int)_param.width, block, src, src, src, (int)stride, _fY, _fUv, dc);
+            else
+                _writeBlock(_stream, (int)_param.width, block, r, g, b, _width, _fY, _fUv, dc);
+            Flush();
+        }
+
+        void ImageJpegSaver::WriteEnd()
+        {
+            static const uint16_t FILL_BITS[] = { 0x7F, 7 };
+            Base::WriteBits(_stream, FILL_BITS);
+            _stream.Write8u(0xFF);
+            _stream.Write8u(0xD9);
+        }
+
         bool ImageJpegSaver::ToStream(const uint8_t* src, size_t stride)
         {
             Init();
             WriteHeader();
-            uint8_t* r = _buffer.data, * g = r + _width * _block,* b = g + _width * _block;
             int dc[3] = { 0, 0, 0 };
             for (int row = 0; row < (int)_param.height; row += _block)
             {
                 int block = Simd::Min(row + _block, (int)_param.height) - row;
-                switch (_param.format)
+                WriteBlock(src, stride, block, dc);
+                src += block * stride;
+            }
+            WriteEnd();
+            return true;
+        }
+
+        bool ImageJpegSaver::WriteBand(const uint8_t* src, size_t stride, size_t rows)
+        {
+            if (_row + _bandRows >= _param.height)
+                return false;
+            if (_bandStride == 0)
+            {
+                Init();
+                WriteHeader();
+                _dc[0] = 0, _dc[1] = 0, _dc[2] = 0;
+                _bandStride = _param.width * (_param.format == SimdPixelFormatGray8 ? 1 :
+                    (_param.format == SimdPixelFormatBgr24 || _param.format == SimdPixelFormatRgb24) ? 3 : 4);
+                _band.Resize(_bandStride * _block);
+            }
+            rows = Simd::Min(rows, _param.height - _row - _bandRows);
+            while (rows)
+            {
+                size_t block = Simd::Min<size_t>(_block, _param.height - _row);
+                if (_bandRows == 0 && rows >= block)
                 {
-                case SimdPixelFormatBgr24:
-                    _deintBgr(src, stride, _param.width, block, b, _width, g, _width, r, _width);
-                    break;
-                case SimdPixelFormatBgra32:
-                    _deintBgra(src, stride, _param.width, block, b, _width, g, _width, r, _width, NULL, 0);
-                    break;
-                case SimdPixelFormatRgb24:
-                    _deintBgr(src, stride, _param.width, block, r, _width, g, _width, b, _width);
-                    break;
-                case SimdPixelFormatRgba32:
-                    _deintBgra(src, stride, _param.width, block, r, _width, g, _width, b, _width, NULL, 0);
-                    break;
-                default: 
-                    break;
+                    WriteBlock(src, stride, (int)block, _dc);
+                    src += block * stride;
+                    rows -= block;
+                    _row += block;
                 }
-                if(_param.format == SimdPixelFormatGray8)
-                    _writeBlock(_stream, (int)_param.width, block, src, src, src, (int)stride, _fY, _fUv, dc);
                 else
-                    _writeBlock(_stream, (int)_param.width, block, r, g, b, _width, _fY, _fUv, dc);
-                src += block * stride;
+                {
+                    size_t count = Simd::Min(rows, block - _bandRows);
+                    for (size_t i = 0; i < count; ++i, src += stride, _bandRows++)
+                        memcpy(_band.data + _bandRows * _bandStride, src, _bandStride);
+                    rows -= count;
+                    if (_bandRows == block)
+                    {
+                        WriteBlock(_band.data, _bandStride, (int)block, _dc);
+                        _row += block;
+                        _bandRows = 0;
+                    }
+                }
             }
-            static const uint16_t FILL_BITS[] = { 0x7F, 7 };
-            Base::WriteBits(_stream, FILL_BITS);
-            _stream.Write8u(0xFF);
-            _stream.Write8u(0xD9);
-            return true;
+            if (_row == _param.height)
+            {
+                WriteEnd();
+                if (_file)
+                    return Close();
+            }
+            return !_error;
         }
 
         bool ImageJpegSaver::ToStream(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride)
@@ -541,6 +602,7 @@ namespace Simd
                 _writeNv12Block(_stream, (int)_param.width, block, y, (int)yStride, uv, (int)uvStride, _fY, _fUv, dc);
                 y += block * yStride;
                 uv += (block / 2) * uvStride;
+                Flush();
             }
             static const uint16_t FILL_BITS[] = { 0x7F, 7 };
             Base::WriteBits(_stream, FILL_BITS);
@@ -561,6 +623,7 @@ namespace Simd
                 y += block * yStride;
                 u += (block / 2) * uStride;
                 v += (block / 2) * vStride;
+                Flush();
             }
             static const uint16_t FILL_BITS[] = { 0x7F, 7 };
             Base::WriteBits(_stream, FILL_BITS);
@@ -74,7 +74,7 @@ namespace Simd
             return (hi << 16) | lo;
         }
 
-        void ZlibCompress(uint8_t* data, int size, int quality, OutputMemoryStream& stream)
+        void ZlibCompress(uint8_t* data, int size, int quality, OutputMemoryStream& stream, Base::ImagePngSaver* saver)
         {
             const int ZHASH = 16384;
             if (quality < 5)
@@ -91,6 +91,8 @@ namespace Simd
             int i = 0, j;
             while (i < size - 3)
             {
+                if (saver)
+                    saver->Drain(stream);
                 int h = ZlibHash(data + i) & (ZHASH - 1), best = 3;
                 uint8_t* bestLoc = 0;
                 int* hList = hashTable.data + h * basket;
@@ -340,9 +342,11 @@ namespace Simd
                 _filt[row * (_size + 1)] = (uint8_t)bestFilter;
                 memcpy(_filt.data + row * (_size + 1) + 1, _line.data + _size * bestFilter, _size);
             }
-            OutputMemoryStream zlib(Simd::Min(_param.width * _param.height, Base::AlgCacheL1()));
-            _compress(_filt.data, (int)_filt.size, COMPRESSION, zlib);
-            WriteToStream(zlib.Data(), zlib.Size());
+            WriteHeader();
+            OutputMemoryStream zlib(_file ? _flush * 2 : Simd::Min(_filt.size, Base::AlgCacheL1()));
+            _compress(_filt.data, (int)_filt.size, COMPRESSION, zlib, this);
+            WriteData(zlib);
+            WriteEnd();
             return true;
         }
 
@@ -351,11 +355,11 @@ namespace Simd
             stream.WriteBe32u(Base::Crc32(stream.Current() - size - 4, size + 4));
         }
 
-        void ImagePngSaver::WriteToStream(const uint8_t* zlib, size_t zlen)
+        void ImagePngSaver::WriteHeader()
         {
             const uint8_t SIGNATURE[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
             const int8_t CTYPE[5] = { -1, 0, 4, 2, 6 };
-            _stream.Reserve(8 + 12 + 13 + 12 + zlen + 12);
+            Reserve(8 + 12 + 13);
             _stream.Write(SIGNATURE, 8);
             _stream.WriteBe32u(13);
             _stream.Write("IHDR", 4);
@@ -367,10 +371,23 @@ namespace Simd
             _stream.Write8u(0);
             _stream.Write8u(0);
             WriteCrc32(_stream, 13);
-            _stream.WriteBe32u((uint32_t)zlen);
+        }
+
+        void ImagePngSaver::WriteData(OutputMemoryStream& zlib)
+        {
+            size_t size = zlib.Pos();
+            if (size == 0)
+                return;
+            _stream.WriteBe32u((uint32_t)size);
             _stream.Write("IDAT", 4);
-            _stream.Write(zlib, zlen);
-            WriteCrc32(_stream, zlen);
+            _stream.Write(zlib.Data(), size);
+            WriteCrc32(_stream, size);
+            zlib.Clear();
+            Flush();
+        }
+
+        void ImagePngSaver::WriteEnd()
+        {
             _stream.WriteBe32u(0);
             _stream.Write("IEND", 4);
             WriteCrc32(_stream, 0);
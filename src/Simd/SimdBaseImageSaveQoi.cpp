@@ -0,0 +1,180 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdImageSave.h"
+#include "Simd/SimdImageQoi.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void QoiHashRow(const uint8_t* rgba, size_t size, uint8_t* hash)
+        {
+            for (size_t i = 0; i < size; ++i, rgba += 4)
+                hash[i] = QoiHash(rgba);
+        }
+
+        size_t QoiRunLength(const uint32_t* rgba, size_t size, uint32_t value)
+        {
+            size_t i = 0;
+            while (i < size && rgba[i] == value)
+                i++;
+            return i;
+        }
+
+        void QoiDiffRow(const uint32_t* rgba, size_t size, uint32_t prev, uint16_t* diff)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                diff[i] = QoiDiff(rgba[i], prev);
+                prev = rgba[i];
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ImageQoiSaver::ImageQoiSaver(const ImageSaverParam& param)
+            : ImageSaver(param)
+            , _toRgba(NULL)
+            , _toRgbaAlpha(NULL)
+            , _channels(0)
+        {
+            switch (_param.format)
+            {
+            case SimdPixelFormatGray8:
+                _toRgbaAlpha = Base::GrayToBgra;
+                _channels = 3;
+                break;
+            case SimdPixelFormatBgr24:
+                _toRgbaAlpha = Base::RgbToBgra;
+                _channels = 3;
+                break;
+            case SimdPixelFormatBgra32:
+                _toRgba = Base::BgraToRgba;
+                _channels = 4;
+                break;
+            case SimdPixelFormatRgb24:
+                _toRgbaAlpha = Base::BgrToBgra;
+                _channels = 3;
+                break;
+            case SimdPixelFormatRgba32:
+                _channels = 4;
+                break;
+            default:
+                break;
+            }
+            if (_param.format != SimdPixelFormatRgba32)
+                _rgba.Resize(_param.width * 4);
+            _hash.Resize(_param.width);
+            _diff.Resize(_param.width);
+            _hashRow = Base::QoiHashRow;
+            _runLength = Base::QoiRunLength;
+            _diffRow = Base::QoiDiffRow;
+        }
+
+        void ImageQoiSaver::WriteHeader()
+        {
+            _stream.Write(QOI_MAGIC, 4);
+            _stream.WriteBe32u((uint32_t)_param.width);
+            _stream.WriteBe32u((uint32_t)_param.height);
+            _stream.Write8u((uint8_t)_channels);
+            _stream.Write8u(0);
+        }
+
+        bool ImageQoiSaver::ToStream(const uint8_t* src, size_t stride)
+        {
+            if (_param.width * _param.height > QOI_PIXELS_MAX)
+                return false;
+            Reserve(QOI_HEADER_SIZE + _param.width * _param.height * (_channels + 1) + QOI_PADDING_SIZE);
+            WriteHeader();
+            size_t width = _param.width, run = 0;
+            uint32_t index[64], prev;
+            memset(index, 0, sizeof(index));
+            uint8_t* p = (uint8_t*)&prev;
+            p[0] = 0, p[1] = 0, p[2] = 0, p[3] = 255;
+            for (size_t row = 0; row < _param.height; ++row, src += stride)
+            {
+                const uint32_t* rgba = (const uint32_t*)src;
+                if (_toRgba)
+                    _toRgba(src, width, 1, stride, _rgba.data, width * 4);
+                if (_toRgbaAlpha)
+                    _toRgbaAlpha(src, width, 1, stride, _rgba.data, width * 4, 0xFF);
+                if (_param.format != SimdPixelFormatRgba32)
+                    rgba = (const uint32_t*)_rgba.data;
+                _hashRow((const uint8_t*)rgba, width, _hash.data);
+                _diffRow(rgba, width, prev, _diff.data);
+                _stream.Reserve(_stream.Pos() + width * 5 + 1);
+                uint8_t* beg = _stream.Current(), * dst = beg;
+                for (size_t col = 0; col < width;)
+                {
+                    uint16_t diff = _diff[col];
+                    if (diff == 0)
+                    {
+                        size_t count = _runLength(rgba + col, width - col, prev);
+                        col += count;
+                        run += count;
+                        for (; run >= QOI_RUN_MAX; run -= QOI_RUN_MAX)
+                            *dst++ = QOI_OP_RUN | uint8_t(QOI_RUN_MAX - 1);
+                        continue;
+                    }
+                    if (run)
+                    {
+                        *dst++ = QOI_OP_RUN | uint8_t(run - 1);
+                        run = 0;
+                    }
+                    uint32_t pixel = rgba[col];
+                    uint8_t hash = _hash[col];
+                    if (index[hash] == pixel)
+                        *dst++ = QOI_OP_INDEX | hash;
+                    else
+                    {
+                        index[hash] = pixel;
+                        uint8_t op = uint8_t(diff);
+                        if (op < QOI_OP_RGB)
+                        {
+                            *(uint16_t*)dst = diff;
+                            dst += op >> 6;
+                        }
+                        else
+                        {
+                            *(uint32_t*)dst = op | pixel << 8;
+                            if (op == QOI_OP_RGBA)
+                                dst[4] = uint8_t(pixel >> 24);
+                            dst += op == QOI_OP_RGB ? 4 : 5;
+                        }
+                    }
+                    prev = pixel;
+                    col++;
+                }
+                _stream.Seek(_stream.Pos() + (dst - beg));
+                Flush();
+            }
+            if (run)
+                _stream.Write8u(QOI_OP_RUN | uint8_t(run - 1));
+            _stream.Write(QOI_PADDING, QOI_PADDING_SIZE);
+            return true;
+        }
+    }
+}
@@ -0,0 +1,150 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdLocalBinarization.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    LocalBinarizationParam::LocalBinarizationParam(size_t w, size_t h, SimdLocalBinarizationType t, size_t rad, float k_, float r_, size_t a)
+        : width(w)
+        , height(h)
+        , type(t)
+        , radius(rad)
+        , k(k_)
+        , r(r_)
+        , align(a)
+    {
+    }
+
+    bool LocalBinarizationParam::Valid() const
+    {
+        return
+            height > 0 &&
+            width > 0 &&
+            (type == SimdLocalBinarizationSauvola || type == SimdLocalBinarizationNiblack) &&
+            (type == SimdLocalBinarizationNiblack || r > 0.0f) &&
+            Area() <= size_t(INT32_MAX) / (255 * 255);
+    }
+
+    //---------------------------------------------------------------------
+
+    LocalBinarization::LocalBinarization(const LocalBinarizationParam& param)
+        : _param(param)
+    {
+    }
+
+    //---------------------------------------------------------------------
+
+    namespace Base
+    {
+        static void LocalBinarizationRow(const uint32_t* sum, const uint32_t* sqsum, size_t width, const LocalBinarizationAlg& alg,
+            const uint8_t* src, uint8_t positive, uint8_t negative, uint8_t* dst)
+        {
+            size_t step = alg.step;
+            for (size_t i = 0; i < width; ++i)
+            {
+                float mean = float(sum[i + step] - sum[i]) * alg.norm;
+                float var = Simd::Max(float(sqsum[i + step] - sqsum[i]) * alg.norm - mean * mean, 0.0f);
+                float dev = ::sqrtf(var);
+                float threshold = mean * (alg.alpha + alg.beta * dev) + alg.gamma * dev;
+                dst[i] = float(src[i]) > threshold ? positive : negative;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        LocalBinarizationDefault::LocalBinarizationDefault(const LocalBinarizationParam& param)
+            : Simd::LocalBinarization(param)
+        {
+            const LocalBinarizationParam& p = _param;
+            LocalBinarizationAlg& a = _alg;
+            a.step = 2 * p.radius + 1;
+            a.colBuf = AlignHi(p.width * sizeof(uint32_t), p.align);
+            a.padBuf = AlignHi((p.width + a.step) * sizeof(uint32_t), p.align);
+            a.bufSize = 2 * a.colBuf + 2 * a.padBuf;
+            a.threads = Simd::Max<size_t>(1, Simd::Min(Base::GetThreadNumber(), p.height / Simd::Max<size_t>(a.step * 4, 16)));
+            a.norm = 1.0f / float(p.Area());
+            if (p.type == SimdLocalBinarizationSauvola)
+            {
+                a.alpha = 1.0f - p.k;
+                a.beta = p.k / p.r;
+                a.gamma = 0.0f;
+            }
+            else
+            {
+                a.alpha = 1.0f;
+                a.beta = 0.0f;
+                a.gamma = p.k;
+            }
+            _buffer.Resize(a.bufSize * a.threads);
+
+            _colUpdate = BoxFilterColUpdate8u;
+            _row = LocalBinarizationRow;
+        }
+
+        void LocalBinarizationDefault::Run(const uint8_t* src, size_t srcStride, uint8_t positive, uint8_t negative, uint8_t* dst, size_t dstStride)
+        {
+            Simd::Parallel(0, _param.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                Run(src, srcStride, begin, end, _buffer.data + thread * _alg.bufSize, positive, negative, dst, dstStride);
+            }, _alg.threads, 1);
+        }
+
+        void LocalBinarizationDefault::Run(const uint8_t* src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t* buf, uint8_t positive, uint8_t negative, uint8_t* dst, size_t dstStride)
+        {
+            const LocalBinarizationParam& p = _param;
+            const LocalBinarizationAlg& a = _alg;
+            uint32_t* sum = (uint32_t*)buf, * sqsum = (uint32_t*)(buf + a.colBuf);
+            uint32_t* rowSum = (uint32_t*)(buf + 2 * a.colBuf), * rowSqsum = (uint32_t*)(buf + 2 * a.colBuf + a.padBuf);
+            ptrdiff_t height = p.height, radius = p.radius, beg = yBeg;
+            memset(sum, 0, a.colBuf);
+            memset(sqsum, 0, a.colBuf);
+            for (ptrdiff_t k = -radius; k <= radius; ++k)
+                _colUpdate(src + Simd::RestrictRange<ptrdiff_t>(beg + k, 0, height - 1) * srcStride, NULL, p.width, sum, sqsum);
+            for (ptrdiff_t y = beg, end = yEnd; y < end; ++y)
+            {
+                if (y > beg)
+                {
+                    const uint8_t* add = src + Simd::RestrictRange<ptrdiff_t>(y + radius, 0, height - 1) * srcStride;
+                    const uint8_t* sub = src + Simd::RestrictRange<ptrdiff_t>(y - radius - 1, 0, height - 1) * srcStride;
+                    _colUpdate(add, sub, p.width, sum, sqsum);
+                }
+                BoxFilterPrefix(sum, p.width, 1, p.radius, rowSum);
+                BoxFilterPrefix(sqsum, p.width, 1, p.radius, rowSqsum);
+                _row(rowSum, rowSqsum, p.width, a, src + y * srcStride, positive, negative, dst + y * dstStride);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void* LocalBinarizationInit(size_t width, size_t height, SimdLocalBinarizationType type, size_t radius, float k, float r)
+        {
+            LocalBinarizationParam param(width, height, type, radius, k, r, sizeof(void*));
+            if (!param.Valid())
+                return NULL;
+            return new LocalBinarizationDefault(param);
+        }
+    }
+}
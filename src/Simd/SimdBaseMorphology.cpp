@@ -0,0 +1,214 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMorphology.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    MorphParam::MorphParam(size_t w, size_t h, SimdMorphologyOperationType o, size_t kx, size_t ky)
+        : width(w)
+        , height(h)
+        , operation(o)
+        , kernelX(kx)
+        , kernelY(ky)
+    {
+    }
+
+    bool MorphParam::Valid() const
+    {
+        return
+            height > 0 &&
+            width > 0 &&
+            kernelX > 0 && kernelY > 0 &&
+            (operation >= SimdMorphologyErode && operation <= SimdMorphologyClose);
+    }
+
+    //---------------------------------------------------------------------
+
+    Morphology::Morphology(const MorphParam& param)
+        : _param(param)
+    {
+    }
+
+    //---------------------------------------------------------------------
+
+    namespace Base
+    {
+        template<bool dilate> SIMD_INLINE uint8_t MorphologyOp(uint8_t a, uint8_t b)
+        {
+            return dilate ? Simd::Max(a, b) : Simd::Min(a, b);
+        }
+
+        template<bool dilate> static void MorphologyRowOp(const uint8_t* a, const uint8_t* b, size_t width, uint8_t* dst)
+        {
+            for (size_t x = 0; x < width; ++x)
+                dst[x] = MorphologyOp<dilate>(a[x], b[x]);
+        }
+
+        template<bool dilate> void MorphologyHorizontal(const uint8_t* src, size_t srcStride, size_t width, size_t rows, size_t size, size_t anchor, uint8_t* buf, uint8_t* dst, size_t dstStride)
+        {
+            size_t length = width + size - 1;
+            uint8_t* t = buf, * h = buf + length;
+            for (size_t r = 0; r < rows; ++r, src += srcStride, dst += dstStride)
+            {
+                memset(t, dilate ? 0 : 255, anchor);
+                memcpy(t + anchor, src, width);
+                memset(t + anchor + width, dilate ? 0 : 255, length - anchor - width);
+                for (size_t b = 0; b < length; b += size)
+                {
+                    size_t e = Simd::Min(b + size, length);
+                    h[e - 1] = t[e - 1];
+                    for (size_t p = e - 1; p > b; --p)
+                        h[p - 1] = MorphologyOp<dilate>(h[p], t[p - 1]);
+                    for (size_t p = b + 1; p < e; ++p)
+                        t[p] = MorphologyOp<dilate>(t[p - 1], t[p]);
+                }
+                for (size_t x = 0; x < width; ++x)
+                    dst[x] = MorphologyOp<dilate>(h[x], t[x + size - 1]);
+            }
+        }
+
+        void MorphologyHorizontal(const uint8_t* src, size_t srcStride, size_t width, size_t rows, size_t size, size_t anchor, bool dilate, uint8_t* buf, uint8_t* dst, size_t dstStride)
+        {
+            if (dilate)
+                MorphologyHorizontal<true>(src, srcStride, width, rows, size, anchor, buf, dst, dstStride);
+            else
+                MorphologyHorizontal<false>(src, srcStride, width, rows, size, anchor, buf, dst, dstStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        MorphologyDefault::MorphologyDefault(const MorphParam& param)
+            : Simd::Morphology(param)
+        {
+            if (_param.operation == SimdMorphologyOpen || _param.operation == SimdMorphologyClose)
+                _image.Resize(_param.width * _param.height);
+            _rowOp[0] = MorphologyRowOp<false>;
+            _rowOp[1] = MorphologyRowOp<true>;
+            _horizontal[0] = MorphologyHorizontal<false>;
+            _horizontal[1] = MorphologyHorizontal<true>;
+            Init(1);
+        }
+
+        void MorphologyDefault::Init(size_t rows)
+        {
+            const MorphParam& p = _param;
+            size_t stride = AlignHi(p.width, SIMD_ALIGN);
+            _rows = rows;
+            _chunk = AlignHi(Simd::Max<size_t>(p.kernelY * 2, 32), rows);
+            _threads = Simd::Max<size_t>(1, Simd::Min(Base::GetThreadNumber(), DivHi(p.height, _chunk)));
+            _bufSize = stride * (1 + 2 * (_chunk + p.kernelY - 1) + _chunk) + AlignHi((2 * (p.width + p.kernelX - 1) + 1) * rows, SIMD_ALIGN);
+            _buffer.Resize(_bufSize * _threads);
+        }
+
+        void MorphologyDefault::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            const MorphParam& p = _param;
+            switch (p.operation)
+            {
+            case SimdMorphologyErode:
+                Run(src, srcStride, false, false, dst, dstStride);
+                break;
+            case SimdMorphologyDilate:
+                Run(src, srcStride, true, false, dst, dstStride);
+                break;
+            case SimdMorphologyOpen:
+                Run(src, srcStride, false, false, _image.data, p.width);
+                Run(_image.data, p.width, true, true, dst, dstStride);
+                break;
+            case SimdMorphologyClose:
+                Run(src, srcStride, true, false, _image.data, p.width);
+                Run(_image.data, p.width, false, true, dst, dstStride);
+                break;
+            default:
+                assert(0);
+            }
+        }
+
+        void MorphologyDefault::Run(const uint8_t* src, size_t srcStride, bool dilate, bool reflect, uint8_t* dst, size_t dstStride)
+        {
+            Simd::Parallel(0, _param.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                uint8_t* buf = _buffer.data + thread * _bufSize;
+                for (size_t y = begin; y < end; y += _chunk)
+                    Run(src, srcStride, dilate, reflect, y, Simd::Min(_chunk, end - y), buf, dst, dstStride);
+            }, _threads, _chunk);
+        }
+
+        void MorphologyDefault::Run(const uint8_t* src, size_t srcStride, bool dilate, bool reflect, size_t y, size_t count, uint8_t* buf, uint8_t* dst, size_t dstStride)
+        {
+            const MorphParam& p = _param;
+            size_t width = p.width, kx = p.kernelX, ky = p.kernelY, stride = AlignHi(width, SIMD_ALIGN);
+            size_t ax = reflect ? kx - 1 - kx / 2 : kx / 2, ay = reflect ? ky - 1 - ky / 2 : ky / 2;
+            uint8_t* neutral = buf, * g = neutral + stride, * h = g + (_chunk + ky - 1) * stride;
+            uint8_t* v = h + (_chunk + ky - 1) * stride, * hor = v + _chunk * stride;
+            const uint8_t* rows = src + y * srcStride;
+            size_t rowsStride = srcStride;
+            if (ky > 1)
+            {
+                MorphologyRowOpPtr op = _rowOp[dilate ? 1 : 0];
+                ptrdiff_t top = ptrdiff_t(y) - ptrdiff_t(ay), height = p.height;
+                memset(neutral, dilate ? 0 : 255, width);
+                auto Row = [&](size_t i) -> const uint8_t*
+                {
+                    ptrdiff_t sy = top + ptrdiff_t(i);
+                    return sy < 0 || sy >= height ? neutral : src + sy * srcStride;
+                };
+                size_t total = count + ky - 1;
+                for (size_t b = 0; b < total; b += ky)
+                {
+                    size_t e = Simd::Min(b + ky, total);
+                    memcpy(g + b * stride, Row(b), width);
+                    for (size_t i = b + 1; i < e; ++i)
+                        op(g + (i - 1) * stride, Row(i), width, g + i * stride);
+                    memcpy(h + (e - 1) * stride, Row(e - 1), width);
+                    for (size_t i = e - 1; i > b; --i)
+                        op(h + i * stride, Row(i - 1), width, h + (i - 1) * stride);
+                }
+                for (size_t j = 0; j < count; ++j)
+                    op(h + j * stride, g + (j + ky - 1) * stride, width, v + j * stride);
+                rows = v;
+                rowsStride = stride;
+            }
+            if (kx > 1)
+                _horizontal[dilate ? 1 : 0](rows, rowsStride, width, count, kx, ax, hor, dst + y * dstStride, dstStride);
+            else if (rows != dst + y * dstStride)
+            {
+                for (size_t j = 0; j < count; ++j)
+                    memcpy(dst + (y + j) * dstStride, rows + j * rowsStride, width);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void* MorphologyInit(size_t width, size_t height, SimdMorphologyOperationType operation, size_t kernelX, size_t kernelY)
+        {
+            MorphParam param(width, height, operation, kernelX, kernelY);
+            if (!param.Valid())
+                return NULL;
+            return new MorphologyDefault(param);
+        }
+    }
+}
@@ -0,0 +1,303 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdOpticalFlowLk.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    OpticalFlowLkParam::OpticalFlowLkParam(size_t w, size_t h, size_t l, size_t r, size_t i, float e, float m, size_t a)
+        : width(w)
+        , height(h)
+        , levels(l)
+        , radius(r)
+        , iterations(i)
+        , epsilon(e)
+        , minEigenvalue(m)
+        , align(a)
+    {
+    }
+
+    bool OpticalFlowLkParam::Valid() const
+    {
+        if (width < 2 || height < 2 || levels < 1 || levels > 16 || radius < 1 || radius > 63 || iterations < 1 || !(epsilon >= 0.0f))
+            return false;
+        size_t w = width, h = height;
+        for (size_t l = 1; l < levels; ++l)
+            w = (w + 1) / 2, h = (h + 1) / 2;
+        return w >= 2 && h >= 2;
+    }
+
+    //---------------------------------------------------------------------
+
+    OpticalFlowLk::OpticalFlowLk(const OpticalFlowLkParam& param)
+        : _param(param)
+    {
+    }
+
+    //---------------------------------------------------------------------
+
+    namespace Base
+    {
+        SIMD_INLINE int OpticalFlowLkSample(const uint8_t* s0, const uint8_t* s1, const int32_t* w)
+        {
+            return (s0[0] * w[0] + s0[1] * w[1] + s1[0] * w[2] + s1[1] * w[3] + LK_I_ROUND) >> LK_I_SHIFT;
+        }
+
+        SIMD_INLINE int OpticalFlowLkSample(const int16_t* s0, const int16_t* s1, const int32_t* w)
+        {
+            return (s0[0] * w[0] + s0[1] * w[1] + s1[0] * w[2] + s1[1] * w[3] + LK_W_ROUND) >> LK_W_BITS;
+        }
+
+        static void OpticalFlowLkTemplate(const uint8_t* img, size_t imgStride, const int16_t* dx, const int16_t* dy, size_t dStride,
+            const int32_t* weight, size_t window, int16_t* I, int16_t* Ix, int16_t* Iy, size_t patchStride, int64_t* G)
+        {
+            G[0] = 0, G[1] = 0, G[2] = 0;
+            for (size_t y = 0; y < window; ++y)
+            {
+                int32_t gxx = 0, gxy = 0, gyy = 0;
+                for (size_t x = 0; x < window; ++x)
+                {
+                    int ix = OpticalFlowLkSample(dx + x, dx + dStride + x, weight);
+                    int iy = OpticalFlowLkSample(dy + x, dy + dStride + x, weight);
+                    I[x] = (int16_t)OpticalFlowLkSample(img + x, img + imgStride + x, weight);
+                    Ix[x] = (int16_t)ix;
+                    Iy[x] = (int16_t)iy;
+                    gxx += ix * ix;
+                    gxy += ix * iy;
+                    gyy += iy * iy;
+                }
+                G[0] += gxx, G[1] += gxy, G[2] += gyy;
+                img += imgStride, dx += dStride, dy += dStride;
+                I += patchStride, Ix += patchStride, Iy += patchStride;
+            }
+        }
+
+        static void OpticalFlowLkResidual(const uint8_t* img, size_t imgStride, const int32_t* weight, size_t window,
+            const int16_t* I, const int16_t* Ix, const int16_t* Iy, size_t patchStride, int64_t* b)
+        {
+            b[0] = 0, b[1] = 0;
+            for (size_t y = 0; y < window; ++y)
+            {
+                int32_t bx = 0, by = 0;
+                for (size_t x = 0; x < window; ++x)
+                {
+                    int diff = OpticalFlowLkSample(img + x, img + imgStride + x, weight) - I[x];
+                    bx += diff * Ix[x];
+                    by += diff * Iy[x];
+                }
+                b[0] += bx, b[1] += by;
+                img += imgStride;
+                I += patchStride, Ix += patchStride, Iy += patchStride;
+            }
+        }
+
+        static void OpticalFlowLkReduce(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t* dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
+        {
+            ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, 1);
+        }
+
+        SIMD_INLINE bool OpticalFlowLkWeight(float x, float y, const OpticalFlowLkLevel& level, size_t window, int& ix, int& iy, int32_t* weight)
+        {
+            ix = (int)::floor(x);
+            iy = (int)::floor(y);
+            if (ix < -(int)window || ix >= (int)level.width || iy < -(int)window || iy >= (int)level.height)
+                return false;
+            float a = x - float(ix), b = y - float(iy);
+            weight[0] = Round((1.0f - a) * (1.0f - b) * float(1 << LK_W_BITS));
+            weight[1] = Round(a * (1.0f - b) * float(1 << LK_W_BITS));
+            weight[2] = Round((1.0f - a) * b * float(1 << LK_W_BITS));
+            weight[3] = (1 << LK_W_BITS) - weight[0] - weight[1] - weight[2];
+            return true;
+        }
+
+        //---------------------------------------------------------------------
+
+        OpticalFlowLkDefault::OpticalFlowLkDefault(const OpticalFlowLkParam& param)
+            : Simd::OpticalFlowLk(param)
+            , _frames(0)
+        {
+            const OpticalFlowLkParam& p = _param;
+            OpticalFlowLkAlg& a = _alg;
+            a.window = p.Window();
+            a.patchStride = AlignHi(a.window, 32);
+            a.patchSize = a.window * a.patchStride;
+            a.border = a.patchStride + 16;
+            a.threads = Base::GetThreadNumber();
+            for (size_t i = 0; i < 2; ++i)
+            {
+                _pyramids[i].resize(p.levels);
+                size_t w = p.width, h = p.height;
+                for (size_t l = 0; l < p.levels; ++l)
+                {
+                    OpticalFlowLkLevel& level = _pyramids[i][l];
+                    level.width = w;
+                    level.height = h;
+                    level.stride = AlignHi(w + 2 * a.border, p.align);
+                    level.image.Resize(level.stride * (h + 2 * a.border));
+                    level.dx.Resize(level.stride * (h + 2 * a.border));
+                    level.dy.Resize(level.stride * (h + 2 * a.border));
+                    w = (w + 1) / 2, h = (h + 1) / 2;
+                }
+            }
+            _patches.Resize(3 * a.patchSize * a.threads, true);
+
+            _reduce = OpticalFlowLkReduce;
+            _sobelDx = SobelDx;
+            _sobelDy = SobelDy;
+            _template = OpticalFlowLkTemplate;
+            _residual = OpticalFlowLkResidual;
+        }
+
+        void OpticalFlowLkDefault::SetFrame(const uint8_t* src, size_t srcStride)
+        {
+            const OpticalFlowLkParam& p = _param;
+            size_t border = _alg.border;
+            Pyramid& pyramid = _pyramids[++_frames & 1];
+            OpticalFlowLkLevel& first = pyramid[0];
+            for (size_t y = 0; y < p.height; ++y)
+                memcpy(first.image.data + (y + border) * first.stride + border, src + y * srcStride, p.width);
+            SetLevel(first);
+            for (size_t l = 1; l < p.levels; ++l)
+            {
+                const OpticalFlowLkLevel& prev = pyramid[l - 1];
+                OpticalFlowLkLevel& curr = pyramid[l];
+                _reduce(prev.image.data + border * prev.stride + border, prev.width, prev.height, prev.stride,
+                    curr.image.data + border * curr.stride + border, curr.width, curr.height, curr.stride);
+                SetLevel(curr);
+            }
+        }
+
+        void OpticalFlowLkDefault::SetLevel(OpticalFlowLkLevel& level)
+        {
+            size_t border = _alg.border, width = level.width + 2 * border, height = level.height + 2 * border, stride = level.stride;
+            uint8_t* image = level.image.data;
+            for (size_t y = border, end = border + level.height; y < end; ++y)
+            {
+                uint8_t* row = image + y * stride;
+                memset(row, row[border], border);
+                memset(row + border + level.width, row[border + level.width - 1], border);
+            }
+            for (size_t y = 0; y < border; ++y)
+            {
+                memcpy(image + y * stride, image + border * stride, width);
+                memcpy(image + (height - 1 - y) * stride, image + (height - 1 - border) * stride, width);
+            }
+            _sobelDx(image, stride, width, height, (uint8_t*)level.dx.data, stride * sizeof(int16_t));
+            _sobelDy(image, stride, width, height, (uint8_t*)level.dy.data, stride * sizeof(int16_t));
+        }
+
+        void OpticalFlowLkDefault::Track(const float* prev, float* next, uint8_t* status, size_t count)
+        {
+            if (_frames < 2)
+            {
+                memcpy(next, prev, count * 2 * sizeof(float));
+                memset(status, 0, count);
+                return;
+            }
+            size_t threads = Simd::Max<size_t>(1, Simd::Min(_alg.threads, count / 16));
+            Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+            {
+                int16_t* patch = _patches.data + thread * 3 * _alg.patchSize;
+                for (size_t i = begin; i < end; ++i)
+                    Track(prev + 2 * i, next + 2 * i, status + i, patch);
+            }, threads, 1);
+        }
+
+        void OpticalFlowLkDefault::Track(const float* prev, float* next, uint8_t* status, int16_t* patch)
+        {
+            const OpticalFlowLkParam& p = _param;
+            const OpticalFlowLkAlg& a = _alg;
+            const Pyramid& prevPyramid = _pyramids[(_frames - 1) & 1];
+            const Pyramid& nextPyramid = _pyramids[_frames & 1];
+            int16_t* I = patch, * Ix = I + a.patchSize, * Iy = Ix + a.patchSize;
+            double minEigenvalue = double(p.minEigenvalue) * double(a.window * a.window) * 64.0;
+            float radius = float(p.radius), epsilon = p.epsilon * p.epsilon, gx = 0.0f, gy = 0.0f;
+            uint8_t tracked = 1;
+            for (ptrdiff_t l = p.levels - 1; l >= 0; --l)
+            {
+                const OpticalFlowLkLevel& pl = prevPyramid[l], & nl = nextPyramid[l];
+                size_t offset = a.border * pl.stride + a.border;
+                float scale = 1.0f / float(1 << l);
+                float x = prev[0] * scale - radius, y = prev[1] * scale - radius;
+                if (l < (ptrdiff_t)p.levels - 1)
+                    gx *= 2.0f, gy *= 2.0f;
+                int ix, iy;
+                int32_t weight[4];
+                if (!OpticalFlowLkWeight(x, y, pl, a.window, ix, iy, weight))
+                {
+                    if (l == 0)
+                        tracked = 0;
+                    continue;
+                }
+                ptrdiff_t shift = offset + iy * pl.stride + ix;
+                int64_t G[3];
+                _template(pl.image.data + shift, pl.stride, pl.dx.data + shift, pl.dy.data + shift, pl.stride,
+                    weight, a.window, I, Ix, Iy, a.patchStride, G);
+                double A11 = double(G[0]), A12 = double(G[1]), A22 = double(G[2]);
+                double D = A11 * A22 - A12 * A12;
+                double minEig = (A11 + A22 - ::sqrt((A11 - A22) * (A11 - A22) + 4.0 * A12 * A12)) * 0.5;
+                if (minEig < minEigenvalue || D < 1.0)
+                {
+                    if (l == 0)
+                        tracked = 0;
+                    continue;
+                }
+                D = 0.25 / D;
+                for (size_t i = 0; i < p.iterations; ++i)
+                {
+                    int jx, jy;
+                    if (!OpticalFlowLkWeight(x + gx, y + gy, nl, a.window, jx, jy, weight))
+                    {
+                        if (l == 0)
+                            tracked = 0;
+                        break;
+                    }
+                    int64_t b[2];
+                    _residual(nl.image.data + offset + jy * nl.stride + jx, nl.stride, weight, a.window, I, Ix, Iy, a.patchStride, b);
+                    float deltaX = float((A12 * double(b[1]) - A22 * double(b[0])) * D);
+                    float deltaY = float((A12 * double(b[0]) - A11 * double(b[1])) * D);
+                    gx += deltaX;
+                    gy += deltaY;
+                    if (deltaX * deltaX + deltaY * deltaY <= epsilon)
+                        break;
+                }
+            }
+            next[0] = prev[0] + gx;
+            next[1] = prev[1] + gy;
+            status[0] = tracked;
+        }
+
+        //---------------------------------------------------------------------
+
+        void* OpticalFlowLkInit(size_t width, size_t height, size_t levels, size_t radius, size_t iterations, float epsilon, float minEigenvalue)
+        {
+            OpticalFlowLkParam param(width, height, levels, radius, iterations, epsilon, minEigenvalue, sizeof(void*));
+            if (!param.Valid())
+                return NULL;
+            return new OpticalFlowLkDefault(param);
+        }
+    }
+}
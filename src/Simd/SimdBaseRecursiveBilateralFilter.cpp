@@ -23,6 +23,8 @@
 */
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdRecursiveBilateralFilter.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -64,6 +66,8 @@ namespace Simd
         , _vFilter(NULL)
     {
         _param.Init();
+        _hThreads = Simd::Max<size_t>(1, Simd::Min(Base::GetThreadNumber(), _param.height / 16));
+        _vThreads = Simd::Max<size_t>(1, Simd::Min(Base::GetThreadNumber(), _param.width / 128));
     }
 
     //---------------------------------------------------------------------------------------------
@@ -238,10 +242,9 @@ namespace Simd
             if (_buffer.Empty())
             {
                 const RbfParam& p = _param;
-                size_t size = 0;
-                size += p.height * p.width * (p.channels + 1);
-                size += p.width * (p.channels * 2 + 3);
-                _buffer.Resize(size * sizeof(float));
+                size_t ver = p.height * p.width * (p.channels + 1) + p.width * (p.channels * 2 + 3);
+                size_t hor = p.width * (p.channels * 2 + 3) * _hThreads;
+                _buffer.Resize(Simd::Max(ver, hor) * sizeof(float));
             }
             return (float*)_buffer.data;
         }
@@ -249,8 +252,25 @@ namespace Simd
         void RecursiveBilateralFilterPrecize::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
         {
             float* buf = GetBuffer();
-            _hFilter(_param, buf, src, srcStride, dst, dstStride);
-            _vFilter(_param, buf, src, srcStride, dst, dstStride);
+            const RbfParam& p = _param;
+            Simd::Parallel(0, p.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                RbfParam rows = p;
+                rows.height = end - begin;
+                float* hBuf = buf + thread * p.width * (p.channels * 2 + 3);
+                _hFilter(rows, hBuf, src + begin * srcStride, srcStride, dst + begin * dstStride, dstStride);
+            }, _hThreads, 16);
+            Simd::Parallel(0, _vThreads, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t block = begin; block < end; ++block)
+                {
+                    size_t x0 = VerBlockBeg(block), x1 = VerBlockBeg(block + 1), offset = x0 * p.channels;
+                    RbfParam cols = p;
+                    cols.width = x1 - x0;
+                    float* vBuf = buf + x0 * (p.height * (p.channels + 1) + p.channels * 2 + 3);
+                    _vFilter(cols, vBuf, src + offset, srcStride, dst + offset, dstStride);
+                }
+            }, _vThreads, 1);
         }
 
         //-----------------------------------------------------------------------------------------
@@ -401,11 +421,8 @@ namespace Simd
                 const RbfParam& p = _param;
                 _stride = AlignHi(p.width * p.channels, p.align);
                 _size = _stride * p.height;
-                size_t size = 0;
-                size += _size;
-                size += _stride * 2 * sizeof(float);
-                size += 4 * _stride;
-                _buffer.Resize(size);
+                _part = 16 * _stride;
+                _buffer.Resize(_size + _part * Simd::Max(_hThreads, _vThreads));
             }
             return _buffer.data;
         }
@@ -413,8 +430,25 @@ namespace Simd
         void RecursiveBilateralFilterFast::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
         {
             uint8_t* buf = GetBuffer();
-            _hFilter(_param, (float*)(buf + _size), src, srcStride, buf, _stride);
-            _vFilter(_param, (float*)(buf + _size), buf, _stride, dst, dstStride);
+            const RbfParam& p = _param;
+            Simd::Parallel(0, p.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                RbfParam rows = p;
+                rows.height = end - begin;
+                float* hBuf = (float*)(buf + _size + thread * _part);
+                _hFilter(rows, hBuf, src + begin * srcStride, srcStride, buf + begin * _stride, _stride);
+            }, _hThreads, 16);
+            Simd::Parallel(0, _vThreads, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t block = begin; block < end; ++block)
+                {
+                    size_t x0 = VerBlockBeg(block), x1 = VerBlockBeg(block + 1), offset = x0 * p.channels;
+                    RbfParam cols = p;
+                    cols.width = x1 - x0;
+                    float* vBuf = (float*)(buf + _size + block * _part);
+                    _vFilter(cols, vBuf, buf + offset, _stride, dst + offset, dstStride);
+                }
+            }, _vThreads, 1);
         }
 
         //-----------------------------------------------------------------------------------------
@@ -0,0 +1,335 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2022 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdRemap.h"
+#include "Simd/SimdWarpAffineCommon.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdBase.h"
+
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+    RemapParam::RemapParam(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdRemapFlags flags, const uint8_t* border, size_t align)
+    {
+        this->srcW = srcW;
+        this->srcH = srcH;
+        this->srcS = srcS;
+        this->dstW = dstW;
+        this->dstH = dstH;
+        this->dstS = dstS;
+        this->channels = channels;
+        this->flags = flags;
+        memset(this->border, 0, BorderSizeMax);
+        if (border && (flags & SimdRemapBorderMask) == SimdRemapBorderConstant)
+            memcpy(this->border, border, this->PixelSize());
+        this->align = align;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    Remap::Remap(const RemapParam& param)
+        : _param(param)
+        , _threads(Base::GetThreadNumber())
+    {
+    }
+
+    SIMD_INLINE int RemapPackNearest(float mx, float my, int w, int h, int n, int s, uint32_t& offs)
+    {
+        if (!(mx >= -0.5f && mx < float(w) - 0.5f && my >= -0.5f && my < float(h) - 0.5f))
+            return RemapSpan::Outside;
+        int ix = Simd::RestrictRange(Round(mx), 0, w - 1);
+        int iy = Simd::RestrictRange(Round(my), 0, h - 1);
+        offs = iy * s + ix * n;
+        return RemapSpan::Main;
+    }
+
+    SIMD_INLINE int RemapPackBilinear(float mx, float my, int w, int h, int n, int s, uint32_t& offs, uint8_t* fx, uint16_t* fy)
+    {
+        if (!(mx > -1.0f && mx < float(w) && my > -1.0f && my < float(h)))
+            return RemapSpan::Outside;
+        int ix = (int)floor(mx);
+        int iy = (int)floor(my);
+        int fx1 = Round((mx - ix) * Base::WA_FRACTION_RANGE);
+        int fy1 = Round((my - iy) * Base::WA_FRACTION_RANGE);
+        if (fx1 == Base::WA_FRACTION_RANGE)
+            ix++, fx1 = 0;
+        if (fy1 == Base::WA_FRACTION_RANGE)
+            iy++, fy1 = 0;
+        if (ix >= w || iy >= h)
+            return RemapSpan::Outside;
+        fx[0] = Base::WA_FRACTION_RANGE - fx1;
+        fx[1] = fx1;
+        fy[0] = Base::WA_FRACTION_RANGE - fy1;
+        fy[1] = fy1;
+        if (ix >= 0 && ix < w - 1 && iy >= 0 && iy < h - 1)
+        {
+            offs = iy * s + ix * n;
+            return RemapSpan::Main;
+        }
+        offs = uint32_t(uint16_t(ix)) | (uint32_t(uint16_t(iy)) << 16);
+        return RemapSpan::Edge;
+    }
+
+    void Remap::PackRow(size_t y, const float* mapX, const float* mapY, std::vector<RemapSpan>& spans)
+    {
+        const RemapParam& p = _param;
+        int w = (int)p.srcW, h = (int)p.srcH, n = (int)p.channels, s = (int)p.srcS, width = (int)p.dstW;
+        bool bilinear = p.IsByteBilinear();
+        uint32_t* offs = _offs.data + y * p.dstW;
+        uint8_t* fx = bilinear ? _fx.data + y * p.dstW * 2 : NULL;
+        uint16_t* fy = bilinear ? _fy.data + y * p.dstW * 2 : NULL;
+        _rows[y] = (int32_t)spans.size();
+        for (int x = 0; x < width; ++x)
+        {
+            int type = bilinear ? RemapPackBilinear(mapX[x], mapY[x], w, h, n, s, offs[x], fx + 2 * x, fy + 2 * x) :
+                RemapPackNearest(mapX[x], mapY[x], w, h, n, s, offs[x]);
+            if (spans.size() > (size_t)_rows[y] && spans.back().type == type)
+                spans.back().end = x + 1;
+            else
+            {
+                RemapSpan span = { x, x + 1, type };
+                spans.push_back(span);
+            }
+        }
+    }
+
+    void Remap::SetMap(const float* mapX, const float* mapY, size_t mapStride)
+    {
+        const RemapParam& p = _param;
+        size_t size = p.dstW * p.dstH;
+        _offs.Resize(size + p.align, true);
+        if (p.IsByteBilinear())
+        {
+            _fx.Resize(2 * (size + p.align), true);
+            _fy.Resize(2 * (size + p.align), true);
+        }
+        _rows.Resize(p.dstH + 1);
+        std::vector<RemapSpan> spans;
+        for (size_t y = 0; y < p.dstH; ++y)
+        {
+            PackRow(y, mapX, mapY, spans);
+            mapX = (float*)((uint8_t*)mapX + mapStride);
+            mapY = (float*)((uint8_t*)mapY + mapStride);
+        }
+        _rows[p.dstH] = (int32_t)spans.size();
+        _spans.Assign(spans.data(), spans.size());
+    }
+
+    void Remap::SetUndistortion(const float* camera, const float* distortion)
+    {
+        const RemapParam& p = _param;
+        double fx = camera[0], fy = camera[1], cx = camera[2], cy = camera[3];
+        double ifx = 1.0 / fx, ify = 1.0 / fy;
+        bool fisheye = p.IsFisheye();
+        // Fisheye model: [k1, k2, k3, k4]; pinhole model: [k1, k2, p1, p2, k3] (p1 and p2 are tangential coefficients).
+        double k1 = distortion[0], k2 = distortion[1];
+        double k3 = fisheye ? distortion[2] : distortion[4], k4 = fisheye ? distortion[3] : 0.0;
+        double p1 = fisheye ? 0.0 : distortion[2], p2 = fisheye ? 0.0 : distortion[3];
+        Array32f buf(p.dstW * 2);
+        float* mapX = buf.data, * mapY = mapX + p.dstW;
+        size_t size = p.dstW * p.dstH;
+        _offs.Resize(size + p.align, true);
+        if (p.IsByteBilinear())
+        {
+            _fx.Resize(2 * (size + p.align), true);
+            _fy.Resize(2 * (size + p.align), true);
+        }
+        _rows.Resize(p.dstH + 1);
+        std::vector<RemapSpan> spans;
+        for (size_t y = 0; y < p.dstH; ++y)
+        {
+            double ny = (double(y) - cy) * ify;
+            for (size_t x = 0; x < p.dstW; ++x)
+            {
+                double nx = (double(x) - cx) * ifx, dx, dy;
+                if (fisheye)
+                {
+                    double r = sqrt(nx * nx + ny * ny);
+                    double t = atan(r), t2 = t * t;
+                    double td = t * (1.0 + t2 * (k1 + t2 * (k2 + t2 * (k3 + t2 * k4))));
+                    double scale = r > 0.0 ? td / r : 1.0;
+                    dx = nx * scale;
+                    dy = ny * scale;
+                }
+                else
+                {
+                    double r2 = nx * nx + ny * ny;
+                    double radial = 1.0 + r2 * (k1 + r2 * (k2 + r2 * k3));
+                    dx = nx * radial + 2.0 * p1 * nx * ny + p2 * (r2 + 2.0 * nx * nx);
+                    dy = ny * radial + p1 * (r2 + 2.0 * ny * ny) + 2.0 * p2 * nx * ny;
+                }
+                mapX[x] = float(dx * fx + cx);
+                mapY[x] = float(dy * fy + cy);
+            }
+            PackRow(y, mapX, mapY, spans);
+        }
+        _rows[p.dstH] = (int32_t)spans.size();
+        _spans.Assign(spans.data(), spans.size());
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        template<int N> void RemapNearestRun(const RemapParam& p, int yBeg, int yEnd, const int32_t* rows, const RemapSpan* spans, const uint32_t* offs, const uint8_t* src, uint8_t* dst)
+        {
+            bool fill = p.NeedFill();
+            dst += yBeg * p.dstS;
+            offs += yBeg * p.dstW;
+            for (int y = yBeg; y < yEnd; ++y)
+            {
+                for (int i = rows[y]; i < rows[y + 1]; ++i)
+                {
+                    const RemapSpan& span = spans[i];
+                    if (span.type == RemapSpan::Main)
+                        NearestGather<N>(src, offs + span.beg, span.end - span.beg, dst + span.beg * N);
+                    else if (fill)
+                        FillBorder<N>(dst + span.beg * N, span.end - span.beg, p.border);
+                }
+                dst += p.dstS;
+                offs += p.dstW;
+            }
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        RemapNearest::RemapNearest(const RemapParam& param)
+            : Remap(param)
+        {
+            switch (_param.channels)
+            {
+            case 1: _run = RemapNearestRun<1>; break;
+            case 2: _run = RemapNearestRun<2>; break;
+            case 3: _run = RemapNearestRun<3>; break;
+            case 4: _run = RemapNearestRun<4>; break;
+            }
+        }
+
+        void RemapNearest::Run(const uint8_t* src, uint8_t* dst)
+        {
+            Simd::Parallel(0, _param.dstH, [&](size_t thread, size_t begin, size_t end)
+            {
+                _run(_param, (int)begin, (int)end, _rows.data, _spans.data, _offs.data, src, dst);
+            }, _threads, 1);
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        template<int N> void RemapByteBilinearRun(const RemapParam& p, int yBeg, int yEnd, const int32_t* rows, const RemapSpan* spans,
+            const uint32_t* offs, const uint8_t* fx, const uint16_t* fy, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            constexpr int M = (N == 3 ? 4 : N);
+            bool fill = p.NeedFill();
+            int s = (int)p.srcS, w = (int)p.srcW - 2, h = (int)p.srcH - 2;
+            uint8_t* rb0 = buf;
+            uint8_t* rb1 = rb0 + AlignHi(p.dstW, p.align) * M * 2;
+            dst += yBeg * p.dstS;
+            offs += yBeg * p.dstW;
+            fx += yBeg * p.dstW * 2;
+            fy += yBeg * p.dstW * 2;
+            for (int y = yBeg; y < yEnd; ++y)
+            {
+                for (int i = rows[y]; i < rows[y + 1]; ++i)
+                {
+                    const RemapSpan& span = spans[i];
+                    if (span.type == RemapSpan::Main)
+                    {
+                        ByteBilinearGather<M>(src, src + s, offs + span.beg, span.end - span.beg, rb0, rb1);
+                        for (int x = span.beg, o = 0; x < span.end; ++x, o += 2 * M)
+                            ByteBilinearInterpMain<N>(rb0 + o, rb1 + o, fx + 2 * x, fy + 2 * x, dst + x * N);
+                    }
+                    else if (span.type == RemapSpan::Edge)
+                    {
+                        for (int x = span.beg; x < span.end; ++x)
+                            RemapByteBilinearInterpEdge<N>(offs[x], fx + 2 * x, fy + 2 * x, w, h, s, src, fill ? p.border : dst + x * N, dst + x * N);
+                    }
+                    else if (fill)
+                        FillBorder<N>(dst + span.beg * N, span.end - span.beg, p.border);
+                }
+                dst += p.dstS;
+                offs += p.dstW;
+                fx += p.dstW * 2;
+                fy += p.dstW * 2;
+            }
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        RemapByteBilinear::RemapByteBilinear(const RemapParam& param)
+            : Remap(param)
+        {
+            switch (_param.channels)
+            {
+            case 1: _run = RemapByteBilinearRun<1>; break;
+            case 2: _run = RemapByteBilinearRun<2>; break;
+            case 3: _run = RemapByteBilinearRun<3>; break;
+            case 4: _run = RemapByteBilinearRun<4>; break;
+            }
+            _size = AlignHi(_param.dstW, _param.align) * 4 * 2 * 2 + _param.align;
+            _buf.Resize(_size * _threads);
+        }
+
+        void RemapByteBilinear::Run(const uint8_t* src, uint8_t* dst)
+        {
+            Simd::Parallel(0, _param.dstH, [&](size_t thread, size_t begin, size_t end)
+            {
+                _run(_param, (int)begin, (int)end, _rows.data, _spans.data, _offs.data, _fx.data, _fy.data, src, dst, _buf.data + thread * _size);
+            }, _threads, 1);
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        void* RemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+            const float* mapX, const float* mapY, size_t mapStride, SimdRemapFlags flags, const uint8_t* border)
+        {
+            RemapParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, flags, border, 1);
+            if (!param.Valid())
+                return NULL;
+            Remap* remap = NULL;
+            if (param.IsNearest())
+                remap = new RemapNearest(param);
+            else if (param.IsByteBilinear())
+                remap = new RemapByteBilinear(param);
+            if (remap)
+                remap->SetMap(mapX, mapY, mapStride);
+            return remap;
+        }
+
+        void* RemapInitUndistortion(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+            const float* camera, const float* distortion, SimdRemapFlags flags, const uint8_t* border)
+        {
+            RemapParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, flags, border, 1);
+            if (!param.Valid())
+                return NULL;
+            Remap* remap = NULL;
+            if (param.IsNearest())
+                remap = new RemapNearest(param);
+            else if (param.IsByteBilinear())
+                remap = new RemapByteBilinear(param);
+            if (remap)
+                remap->SetUndistortion(camera, distortion);
+            return remap;
+        }
+    }
+}
@@ -24,8 +24,94 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdResizer.h"
 
+#include <list>
+#include <map>
+#include <mutex>
+
 namespace Simd
 {
+    struct ResCoefsKey
+    {
+        size_t type, variant, srcW, srcH, dstW, dstH, channels, channelType, method, align;
+
+        ResCoefsKey(const ResParam& param, ResCoefsType type, size_t variant)
+        {
+            this->type = type;
+            this->variant = variant;
+            this->srcW = param.srcW;
+            this->srcH = param.srcH;
+            this->dstW = param.dstW;
+            this->dstH = param.dstH;
+            this->channels = param.channels;
+            this->channelType = param.type;
+            this->method = param.method;
+            this->align = param.align;
+        }
+
+        bool operator < (const ResCoefsKey& key) const
+        {
+            return memcmp(this, &key, sizeof(ResCoefsKey)) < 0;
+        }
+    };
+
+    class ResizerCache
+    {
+        typedef std::list<std::pair<ResCoefsKey, ResCoefsPtr>> List;
+        typedef std::map<ResCoefsKey, List::iterator> Map;
+
+        std::mutex _mutex;
+        List _list;
+        Map _map;
+
+    public:
+        ResCoefsPtr Find(const ResCoefsKey& key)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            Map::iterator it = _map.find(key);
+            if (it == _map.end())
+                return ResCoefsPtr();
+            _list.splice(_list.begin(), _list, it->second);
+            return it->second->second;
+        }
+
+        void Insert(const ResCoefsKey& key, const ResCoefsPtr& coefs)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            Map::iterator it = _map.find(key);
+            if (it != _map.end())
+            {
+                it->second->second = coefs;
+                _list.splice(_list.begin(), _list, it->second);
+                return;
+            }
+            _list.push_front(List::value_type(key, coefs));
+            _map[key] = _list.begin();
+            while (_list.size() > RESIZER_CACHE_SIZE)
+            {
+                _map.erase(_list.back().first);
+                _list.pop_back();
+            }
+        }
+
+        static ResizerCache& Instance()
+        {
+            static ResizerCache cache;
+            return cache;
+        }
+    };
+
+    ResCoefsPtr ResizerCacheFind(const ResParam& param, ResCoefsType type, size_t variant)
+    {
+        return ResizerCache::Instance().Find(ResCoefsKey(param, type, variant));
+    }
+
+    void ResizerCacheInsert(const ResParam& param, ResCoefsType type, const ResCoefsPtr& coefs, size_t variant)
+    {
+        ResizerCache::Instance().Insert(ResCoefsKey(param, type, variant), coefs);
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
     namespace Base
     {
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
@@ -45,6 +131,10 @@ namespace Simd
                 return new ResizerByteArea2x2(param);
             else if (param.IsByteArea1x1())
                 return new ResizerByteArea1x1(param);
+            else if (param.IsByteFilter())
+                return new ResizerByteFilter(param);
+            else if (param.IsFloatFilter())
+                return new ResizerFloatFilter(param);
             else
                 return NULL;
         }
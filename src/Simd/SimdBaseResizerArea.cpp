@@ -102,7 +102,8 @@ namespace Simd
             size_t dstW = _param.dstW, rowSize = _param.srcW * N, rowRest = dstStride - dstW * N;
             const int32_t* iy = _iy.data, * ix = _ix.data, * ay = _ay.data, * ax = _ax.data;
             int32_t ay0 = ay[0], ax0 = ax[0];
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += rowRest)
+            src += (iy[_dyBeg] - _syBeg) * srcStride;
+            for (size_t dy = _dyBeg; dy < _dyEnd; dy++, dst += rowRest)
             {
                 int32_t* buf = _by.data;
                 size_t yn = iy[dy + 1] - iy[dy];
@@ -169,7 +170,8 @@ namespace Simd
             size_t dstW = _param.dstW, rowSize = _param.srcW * N, rowRest = dstStride - dstW * N;
             const int32_t* iy = _iy.data, * ix = _ix.data, * ay = _ay.data, * ax = _ax.data;
             int32_t ay0 = ay[0], ax0 = ax[0];
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += rowRest)
+            src += (iy[_dyBeg] * 2 - _syBeg) * srcStride;
+            for (size_t dy = _dyBeg; dy < _dyEnd; dy++, dst += rowRest)
             {
                 int32_t* buf = _by.data;
                 size_t yn = (iy[dy + 1] - iy[dy]) * 2;
@@ -0,0 +1,111 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        ResizerBand::ResizerBand(const ResParam& param, Resizer* resizer)
+            : _param(param)
+            , _resizer(resizer)
+            , _scale(double(param.srcH) / double(param.dstH))
+            , _bufRow(0)
+            , _srcRow(0)
+            , _dstRow(0)
+        {
+            _rowSize = _param.srcW * _param.channels;
+            size_t span = 0;
+            for (size_t dy = 0; dy < _param.dstH; ++dy)
+                span = Max(span, RowEnd(dy) - RowBeg(dy));
+            _capacity = Min(span * 2, _param.srcH);
+            _buf.Resize(_capacity * _rowSize + SIMD_ALIGN, true);
+        }
+
+        // Conservative range of source rows used by output row dy for any supported method: [RowBeg(dy), RowEnd(dy)).
+        size_t ResizerBand::RowBeg(size_t dy) const
+        {
+            return (size_t)Simd::Max<ptrdiff_t>(ptrdiff_t(::floor(dy * _scale)) - 3, 0);
+        }
+
+        size_t ResizerBand::RowEnd(size_t dy) const
+        {
+            return Simd::Min<size_t>(size_t(::ceil((dy + 1) * _scale)) + 3, _param.srcH);
+        }
+
+        size_t ResizerBand::Run(const uint8_t* src, size_t srcStride, size_t srcRows, uint8_t* dst, size_t dstStride)
+        {
+            size_t dstRows = 0;
+            srcRows = Min(srcRows, _param.srcH - _srcRow);
+            while (srcRows)
+            {
+                size_t beg = Max(RowBeg(_dstRow), _bufRow);
+                if (beg > _bufRow)
+                {
+                    memmove(_buf.data, _buf.data + (beg - _bufRow) * _rowSize, (_srcRow - beg) * _rowSize);
+                    _bufRow = beg;
+                }
+                size_t rows = Min(srcRows, _capacity - (_srcRow - _bufRow));
+                for (size_t row = 0; row < rows; ++row, src += srcStride)
+                    memcpy(_buf.data + (_srcRow + row - _bufRow) * _rowSize, src, _rowSize);
+                _srcRow += rows;
+                srcRows -= rows;
+                size_t end = _dstRow;
+                while (end < _param.dstH && RowEnd(end) <= _srcRow)
+                    end++;
+                if (end > _dstRow)
+                {
+                    _resizer->RunRows(_buf.data, _rowSize, _bufRow, _dstRow, end, dst, dstStride);
+                    dst += (end - _dstRow) * dstStride;
+                    dstRows += end - _dstRow;
+                    _dstRow = end;
+                }
+            }
+            return dstRows;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ResizerBandInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+        {
+            return Simd::ResizerBandInit(ResizerInit, srcX, srcY, dstX, dstY, channels, type, method);
+        }
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    void* ResizerBandInit(ResizerInitPtr resizerInit, size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+    {
+        ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(void*));
+        if (method == SimdResizeMethodBilinearCaffe || method == SimdResizeMethodBilinearPytorch || method > SimdResizeMethodAreaFast)
+            return NULL;
+        if (type != SimdResizeChannelByte || channels < 1 || channels > 4 || srcX == 0 || srcY == 0 || dstX == 0 || dstY == 0)
+            return NULL;
+        Resizer* resizer = (Resizer*)resizerInit(srcX, srcY, dstX, dstY, channels, type, method);
+        if (resizer == NULL)
+            return NULL;
+        return new Base::ResizerBand(param, resizer);
+    }
+}
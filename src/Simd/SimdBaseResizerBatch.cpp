@@ -0,0 +1,222 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+    namespace Base
+    {
+        ResizerBatch::ResizerBatch(const ResParam& param, SimdTensorFormatType format)
+            : _param(param)
+            , _format(format)
+            , _threads(Base::GetThreadNumber())
+        {
+            _rowSize = _param.dstW * _param.channels;
+            _roiSize = AlignHi((_param.dstW + _param.dstH) * 2, _param.align);
+            _bufSize = AlignHi(_rowSize, _param.align);
+        }
+
+        void ResizerBatch::EstimateIndexAlpha(float begin, float end, size_t srcSize, size_t dstSize, int32_t* index, int32_t* alpha) const
+        {
+            float scale = (end - begin) / dstSize;
+            bool nearest = _param.method == SimdResizeMethodNearest;
+            for (size_t i = 0; i < dstSize; ++i)
+            {
+                float pos = nearest ? begin + (i + 0.5f) * scale : begin + (i + 0.5f) * scale - 0.5f;
+                ptrdiff_t idx = (ptrdiff_t)::floor(pos);
+                float a = nearest ? 0.0f : pos - idx;
+                if (idx < 0)
+                {
+                    idx = 0;
+                    a = 0.0f;
+                }
+                if (idx > (ptrdiff_t)srcSize - 2)
+                {
+                    idx = srcSize - 2;
+                    a = 1.0f;
+                }
+                index[i] = (int32_t)idx;
+                if (_param.type == SimdResizeChannelByte)
+                    alpha[i] = (int32_t)(a * FRACTION_RANGE + 0.5f);
+                else
+                    ((float*)alpha)[i] = a;
+            }
+        }
+
+        void ResizerBatch::Run(const uint8_t* src, size_t srcStride, const float* rois, size_t count, uint8_t* dst)
+        {
+            const ResParam& p = _param;
+            _arena.Resize(_roiSize * count);
+            _buffer.Resize(_bufSize * 3 * _threads);
+            size_t dstSize = _rowSize * p.dstH * p.ChannelSize();
+            Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+            {
+                int32_t* buf = _buffer.data + thread * _bufSize * 3;
+                for (size_t i = begin; i < end; ++i)
+                {
+                    const float* roi = rois + i * 4;
+                    int32_t* ix = _arena.data + i * _roiSize, * ax = ix + p.dstW, * iy = ax + p.dstW, * ay = iy + p.dstH;
+                    EstimateIndexAlpha(roi[0], roi[2], p.srcW, p.dstW, ix, ax);
+                    EstimateIndexAlpha(roi[1], roi[3], p.srcH, p.dstH, iy, ay);
+                    if (p.type == SimdResizeChannelByte)
+                        RunByte(src, srcStride, ix, ax, iy, ay, buf, dst + i * dstSize);
+                    else
+                        RunFloat((float*)src, srcStride / sizeof(float), ix, (float*)ax, iy, (float*)ay, (float*)buf, (float*)(dst + i * dstSize));
+                }
+            }, _threads, 1);
+        }
+
+        void ResizerBatch::RunByte(const uint8_t* src, size_t srcStride, const int32_t* ix, const int32_t* ax,
+            const int32_t* iy, const int32_t* ay, int32_t* buf, uint8_t* dst)
+        {
+            size_t cn = _param.channels, dstW = _param.dstW, dstH = _param.dstH;
+            bool nchw = _format == SimdTensorFormatNchw && cn > 1;
+            int32_t* pbx[2] = { buf, buf + _bufSize };
+            uint8_t* row = (uint8_t*)(buf + 2 * _bufSize);
+            int32_t prev = -2;
+            for (size_t dy = 0; dy < dstH; dy++)
+            {
+                int32_t sy = iy[dy], k = 0;
+                if (sy == prev)
+                    k = 2;
+                else if (sy == prev + 1)
+                {
+                    Swap(pbx[0], pbx[1]);
+                    k = 1;
+                }
+                prev = sy;
+                for (; k < 2; k++)
+                {
+                    int32_t* pb = pbx[k];
+                    const uint8_t* ps = src + (sy + k) * srcStride;
+                    for (size_t dx = 0; dx < dstW; dx++)
+                    {
+                        const uint8_t* s = ps + ix[dx] * cn;
+                        int32_t fx = ax[dx];
+                        for (size_t c = 0; c < cn; ++c, ++pb)
+                        {
+                            int32_t t = s[c];
+                            pb[0] = (t << LINEAR_SHIFT) + (s[c + cn] - t) * fx;
+                        }
+                    }
+                }
+                if (nchw)
+                {
+                    ByteRowY(pbx[0], pbx[1], _rowSize, ay[dy], row);
+                    for (size_t c = 0; c < cn; ++c)
+                    {
+                        uint8_t* pd = dst + (c * dstH + dy) * dstW;
+                        for (size_t dx = 0; dx < dstW; ++dx)
+                            pd[dx] = row[dx * cn + c];
+                    }
+                }
+                else
+                    ByteRowY(pbx[0], pbx[1], _rowSize, ay[dy], dst + dy * _rowSize);
+            }
+        }
+
+        void ResizerBatch::RunFloat(const float* src, size_t srcStride, const int32_t* ix, const float* ax,
+            const int32_t* iy, const float* ay, float* buf, float* dst)
+        {
+            size_t cn = _param.channels, dstW = _param.dstW, dstH = _param.dstH;
+            bool nchw = _format == SimdTensorFormatNchw && cn > 1;
+            float* pbx[2] = { buf, buf + _bufSize };
+            float* row = buf + 2 * _bufSize;
+            int32_t prev = -2;
+            for (size_t dy = 0; dy < dstH; dy++)
+            {
+                int32_t sy = iy[dy], k = 0;
+                if (sy == prev)
+                    k = 2;
+                else if (sy == prev + 1)
+                {
+                    Swap(pbx[0], pbx[1]);
+                    k = 1;
+                }
+                prev = sy;
+                for (; k < 2; k++)
+                {
+                    float* pb = pbx[k];
+                    const float* ps = src + (sy + k) * srcStride;
+                    for (size_t dx = 0; dx < dstW; dx++)
+                    {
+                        const float* s = ps + ix[dx] * cn;
+                        float fx1 = ax[dx], fx0 = 1.0f - fx1;
+                        for (size_t c = 0; c < cn; ++c, ++pb)
+                            pb[0] = s[c] * fx0 + s[c + cn] * fx1;
+                    }
+                }
+                if (nchw)
+                {
+                    FloatRowY(pbx[0], pbx[1], _rowSize, ay[dy], row);
+                    for (size_t c = 0; c < cn; ++c)
+                    {
+                        float* pd = dst + (c * dstH + dy) * dstW;
+                        for (size_t dx = 0; dx < dstW; ++dx)
+                            pd[dx] = row[dx * cn + c];
+                    }
+                }
+                else
+                    FloatRowY(pbx[0], pbx[1], _rowSize, ay[dy], dst + dy * _rowSize);
+            }
+        }
+
+        void ResizerBatch::ByteRowY(const int32_t* src0, const int32_t* src1, size_t size, int32_t fy, uint8_t* dst)
+        {
+            for (size_t i = 0; i < size; i++)
+            {
+                int32_t t = src0[i];
+                dst[i] = ((t << LINEAR_SHIFT) + (src1[i] - t) * fy + BILINEAR_ROUND_TERM) >> BILINEAR_SHIFT;
+            }
+        }
+
+        void ResizerBatch::FloatRowY(const float* src0, const float* src1, size_t size, float fy, float* dst)
+        {
+            float fy1 = fy, fy0 = 1.0f - fy1;
+            for (size_t i = 0; i < size; i++)
+                dst[i] = src0[i] * fy0 + src1[i] * fy1;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        bool ResizerBatchValid(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method, SimdTensorFormatType format)
+        {
+            return srcX >= 2 && srcY >= 2 && dstX > 0 && dstY > 0 && channels > 0 &&
+                (type == SimdResizeChannelByte || type == SimdResizeChannelFloat) &&
+                (method == SimdResizeMethodNearest || method == SimdResizeMethodBilinear) &&
+                (format == SimdTensorFormatNchw || format == SimdTensorFormatNhwc);
+        }
+
+        void* ResizerBatchInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method, SimdTensorFormatType format)
+        {
+            if (!ResizerBatchValid(srcX, srcY, dstX, dstY, channels, type, method, format))
+                return NULL;
+            ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(void*));
+            return new ResizerBatch(param, format);
+        }
+    }
+}
@@ -66,8 +66,17 @@ namespace Simd
         {
             if (_iy.data)
                 return;
-            EstimateIndexAlpha(_param.srcH, _param.dstH, 1, _iy, _ay);
-            EstimateIndexAlpha(_param.srcW, _param.dstW, _param.channels, _ix, _ax);
+            _coefs = ResizerCacheFind(_param, ResCoefsByteBicubic32i);
+            if (_coefs)
+                _coefs->Share(0, _iy), _coefs->Share(1, _ay), _coefs->Share(2, _ix), _coefs->Share(3, _ax);
+            else
+            {
+                EstimateIndexAlpha(_param.srcH, _param.dstH, 1, _iy, _ay);
+                EstimateIndexAlpha(_param.srcW, _param.dstW, _param.channels, _ix, _ax);
+                _coefs.reset(new ResCoefs());
+                _coefs->Keep(_iy), _coefs->Keep(_ay), _coefs->Keep(_ix), _coefs->Keep(_ax);
+                ResizerCacheInsert(_param, ResCoefsByteBicubic32i, _coefs);
+            }
             if (!sparse)
             {
                 for (int i = 0; i < 4; ++i)
@@ -99,10 +108,10 @@ namespace Simd
 
         template<int N> void ResizerByteBicubic::RunS(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
         {
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            for (size_t dy = _dyBeg; dy < _dyEnd; dy++, dst += dstStride)
             {
                 size_t sy = _iy[dy];
-                const uint8_t* src1 = src + sy * srcStride;
+                const uint8_t* src1 = src + (sy - _syBeg) * srcStride;
                 const uint8_t* src2 = src1 + srcStride;
                 const uint8_t* src0 = sy ? src1 - srcStride : src1;
                 const uint8_t* src3 = sy < _param.srcH - 2 ? src2 + srcStride : src2;
@@ -145,15 +154,15 @@ namespace Simd
 
         template<int N> void ResizerByteBicubic::RunB(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
         {
-            int32_t prev = -1;
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            int32_t prev = _iy[_dyBeg] - 1;
+            for (size_t dy = _dyBeg; dy < _dyEnd; dy++, dst += dstStride)
             {
                 int32_t sy = _iy[dy], next = prev;
                 for (int32_t curr = sy - 1, end = sy + 3; curr < end; ++curr)
                 {
                     if (curr < prev)
                         continue;
-                    const uint8_t* ps = src + RestrictRange(curr, 0, (int)_param.srcH - 1) * srcStride;
+                    const uint8_t* ps = src + (RestrictRange(curr, 0, (int)_param.srcH - 1) - _syBeg) * srcStride;
                     int32_t* pb = _bx[(curr + 1) & 3].data;
                     RowCubicSumX<N>(ps, _xn, _xt, _param.dstW, _ix.data, _ax.data, pb);
                     next++;
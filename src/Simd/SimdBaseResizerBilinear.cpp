@@ -32,9 +32,19 @@ namespace Simd
         ResizerByteBilinear::ResizerByteBilinear(const ResParam & param)
             : Resizer(param)
         {
-            _ay.Resize(_param.dstH);
-            _iy.Resize(_param.dstH);
-            EstimateIndexAlpha(_param.srcH, _param.dstH, 1, _iy.data, _ay.data);
+            ResParam key(0, _param.srcH, 0, _param.dstH, 0, SimdResizeChannelByte, SimdResizeMethodBilinear, 0);
+            _coefsY = ResizerCacheFind(key, ResCoefsByteBilinearY32i);
+            if (_coefsY)
+                _coefsY->Share(0, _iy), _coefsY->Share(1, _ay);
+            else
+            {
+                _ay.Resize(_param.dstH);
+                _iy.Resize(_param.dstH);
+                EstimateIndexAlpha(_param.srcH, _param.dstH, 1, _iy.data, _ay.data);
+                _coefsY.reset(new ResCoefs());
+                _coefsY->Keep(_iy), _coefsY->Keep(_ay);
+                ResizerCacheInsert(key, ResCoefsByteBilinearY32i, _coefsY);
+            }
         }        
         
         void ResizerByteBilinear::EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, int32_t * indices, int32_t * alphas)
@@ -74,15 +84,24 @@ namespace Simd
             size_t rs = _param.dstW * cn;
             if (_ax.data == 0)
             {
-                _ax.Resize(rs);
-                _ix.Resize(rs);
-                EstimateIndexAlpha(_param.srcW, _param.dstW, cn, _ix.data, _ax.data);
+                _coefsX = ResizerCacheFind(_param, ResCoefsByteBilinearX32i);
+                if (_coefsX)
+                    _coefsX->Share(0, _ix), _coefsX->Share(1, _ax);
+                else
+                {
+                    _ax.Resize(rs);
+                    _ix.Resize(rs);
+                    EstimateIndexAlpha(_param.srcW, _param.dstW, cn, _ix.data, _ax.data);
+                    _coefsX.reset(new ResCoefs());
+                    _coefsX->Keep(_ix), _coefsX->Keep(_ax);
+                    ResizerCacheInsert(_param, ResCoefsByteBilinearX32i, _coefsX);
+                }
                 _bx[0].Resize(rs);
                 _bx[1].Resize(rs);
             }
             int32_t * pbx[2] = { _bx[0].data, _bx[1].data };
             int32_t prev = -2;
-            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            for (size_t dy = _dyBeg; dy < _dyEnd; dy++, dst += dstStride)
             {
                 int32_t fy = _ay[dy];
                 int32_t sy = _iy[dy];
@@ -101,7 +120,7 @@ namespace Simd
                 for (; k < 2; k++)
                 {
                     int32_t * pb = pbx[k];
-                    const uint8_t * ps = src + (sy + k)*srcStride;
+                    const uint8_t * ps = src + (sy + k - _syBeg)*srcStride;
                     for (size_t dx = 0; dx < rs; dx++)
                     {
                         int32_t sx = _ix[dx];
@@ -133,13 +152,22 @@ namespace Simd
         ResizerShortBilinear::ResizerShortBilinear(const ResParam& param)
             : Resizer(param)
         {
-            _ay.Resize(_param.dstH, false, _param.align);
-            _iy.Resize(_param.dstH, false, _param.align);
-            EstimateIndexAlpha(_param.srcH, _param.dstH, 1, _iy.data, _ay.data);
             size_t rs = _param.dstW * _param.channels + _param.align;
-            _ax.Resize(rs, false, _param.align);
-            _ix.Resize(rs, false, _param.align);
-            EstimateIndexAlpha(_param.srcW, _param.dstW, _param.channels, _ix.data, _ax.data);
+            _coefs = ResizerCacheFind(_param, ResCoefsShortBilinear32f);
+            if (_coefs)
+                _coefs->Share(0, _iy), _coefs->Share(1, _ay), _coefs->Share(2, _ix), _coefs->Share(3, _ax);
+            else
+            {
+                _ay.Resize(_param.dstH, false, _param.align);
+                _iy.Resize(_param.dstH, false, _param.align);
+                EstimateIndexAlpha(_param.srcH, _param.dstH, 1, _iy.data, _ay.data);
+                _ax.Resize(rs, false, _param.align);
+                _ix.Resize(rs, false, _param.align);
+                EstimateIndexAlpha(_param.srcW, _param.dstW, _param.channels, _ix.data, _ax.data);
+                _coefs.reset(new ResCoefs());
+                _coefs->Keep(_iy), _coefs->Keep(_ay), _coefs->Keep(_ix), _coefs->Keep(_ax);
+                ResizerCacheInsert(_param, ResCoefsShortBilinear32f, _coefs);
+            }
             _bx[0].Resize(rs, false, _param.align);
             _bx[1].Resize(rs, false, _param.align);
         }
@@ -252,13 +280,22 @@ namespace Simd
         ResizerFloatBilinear::ResizerFloatBilinear(const ResParam & param)
             : Resizer(param)
         {
-            _ay.Resize(_param.dstH, false, _param.align);
-            _iy.Resize(_param.dstH, false, _param.align);
-            EstimateIndexAlpha(_param.srcH, _param.dstH, 1, _iy.data, _ay.data);
             size_t rs = _param.dstW * _param.channels;
-            _ax.Resize(rs, false, _param.align);
-            _ix.Resize(rs, false, _param.align);
-            EstimateIndexAlpha(_param.srcW, _param.dstW, _param.channels, _ix.data, _ax.data);
+            _coefs = ResizerCacheFind(_param, ResCoefsFloatBilinear32f);
+            if (_coefs)
+                _coefs->Share(0, _iy), _coefs->Share(1, _ay), _coefs->Share(2, _ix), _coefs->Share(3, _ax);
+            else
+            {
+                _ay.Resize(_param.dstH, false, _param.align);
+                _iy.Resize(_param.dstH, false, _param.align);
+                EstimateIndexAlpha(_param.srcH, _param.dstH, 1, _iy.data, _ay.data);
+                _ax.Resize(rs, false, _param.align);
+                _ix.Resize(rs, false, _param.align);
+                EstimateIndexAlpha(_param.srcW, _param.dstW, _param.channels, _ix.data, _ax.data);
+                _coefs.reset(new ResCoefs());
+                _coefs->Keep(_iy), _coefs->Keep(_ay), _coefs->Keep(_ix), _coefs->Keep(_ax);
+                ResizerCacheInsert(_param, ResCoefsFloatBilinear32f, _coefs);
+            }
             _bx[0].Resize(rs, false, _param.align);
             _bx[1].Resize(rs, false, _param.align);
         }
@@ -0,0 +1,371 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE float Sinc(float x)
+        {
+            if (x == 0.0f)
+                return 1.0f;
+            x *= float(M_PI);
+            return ::sin(x) / x;
+        }
+
+        SIMD_INLINE float Lanczos3(float x)
+        {
+            x = ::fabs(x);
+            return x < 3.0f ? Sinc(x) * Sinc(x / 3.0f) : 0.0f;
+        }
+
+        SIMD_INLINE float Mitchell(float x)
+        {
+            const float B = 1.0f / 3.0f, C = 1.0f / 3.0f;
+            x = ::fabs(x);
+            if (x < 1.0f)
+                return ((12.0f - 9.0f * B - 6.0f * C) * x * x * x + (-18.0f + 12.0f * B + 6.0f * C) * x * x + (6.0f - 2.0f * B)) / 6.0f;
+            if (x < 2.0f)
+                return ((-B - 6.0f * C) * x * x * x + (6.0f * B + 30.0f * C) * x * x + (-12.0f * B - 48.0f * C) * x + (8.0f * B + 24.0f * C)) / 6.0f;
+            return 0.0f;
+        }
+
+        static void EstimateCubicIndexAlpha(size_t sizeS, size_t sizeD, size_t align, size_t& taps, Array32i& index, Array32i& count, Array32f& alpha)
+        {
+            float scale = float(sizeS) / float(sizeD);
+            taps = AlignHi(4, align);
+            index.Resize(sizeD);
+            count.Resize(sizeD);
+            alpha.Resize(sizeD * taps, true);
+            for (size_t i = 0; i < sizeD; ++i)
+            {
+                float pos = (i + 0.5f) * scale - 0.5f;
+                int idx = (int)::floor(pos);
+                float d = pos - idx;
+                if (idx < 0)
+                {
+                    idx = 0;
+                    d = 0.0f;
+                }
+                if (idx > (int)sizeS - 2)
+                {
+                    idx = (int)sizeS - 2;
+                    d = 1.0f;
+                }
+                float w[4];
+                w[0] = -d * (1.0f - d) * (2.0f - d) / 6.0f;
+                w[1] = (1.0f - d) * (1.0f + d) * (2.0f - d) / 2.0f;
+                w[2] = d * (1.0f + d) * (2.0f - d) / 2.0f;
+                w[3] = -d * (1.0f - d) * (1.0f + d) / 6.0f;
+                int beg = Simd::Max(idx - 1, 0), end = Simd::Min(idx + 3, (int)sizeS);
+                float* a = alpha.data + i * taps;
+                for (int k = 0; k < 4; ++k)
+                    a[Simd::RestrictRange(idx - 1 + k, beg, end - 1) - beg] += w[k];
+                index[i] = beg;
+                count[i] = end - beg;
+            }
+        }
+
+        static void EstimateAreaIndexAlpha(size_t sizeS, size_t sizeD, size_t align, size_t& taps, Array32i& index, Array32i& count, Array32f& alpha)
+        {
+            double scale = double(sizeS) / double(sizeD);
+            taps = AlignHi((size_t)::ceil(scale) + 1, align);
+            index.Resize(sizeD);
+            count.Resize(sizeD);
+            alpha.Resize(sizeD * taps, true);
+            for (size_t i = 0; i < sizeD; ++i)
+            {
+                double lo = i * scale, hi = Simd::Min((i + 1) * scale, double(sizeS));
+                int beg = (int)::floor(lo), end = Simd::Min((int)::ceil(hi), (int)sizeS);
+                float* a = alpha.data + i * taps;
+                for (int s = beg; s < end; ++s)
+                    a[s - beg] = float((Simd::Min(double(s + 1), hi) - Simd::Max(double(s), lo)) / scale);
+                index[i] = beg;
+                count[i] = end - beg;
+            }
+        }
+
+        void EstimateFilterIndexAlpha(size_t sizeS, size_t sizeD, SimdResizeMethodType method, size_t align, size_t& taps, Array32i& index, Array32i& count, Array32f& alpha)
+        {
+            if (method == SimdResizeMethodBicubic)
+            {
+                EstimateCubicIndexAlpha(sizeS, sizeD, align, taps, index, count, alpha);
+                return;
+            }
+            if (method == SimdResizeMethodArea || method == SimdResizeMethodAreaFast)
+            {
+                EstimateAreaIndexAlpha(sizeS, sizeD, align, taps, index, count, alpha);
+                return;
+            }
+            float radius = method == SimdResizeMethodLanczos3 ? 3.0f : 2.0f;
+            float scale = float(sizeS) / float(sizeD);
+            float stretch = Simd::Max(scale, 1.0f), support = radius * stretch;
+            taps = AlignHi((size_t)::ceil(support) * 2 + 1, align);
+            index.Resize(sizeD);
+            count.Resize(sizeD);
+            alpha.Resize(sizeD * taps, true);
+            for (size_t i = 0; i < sizeD; ++i)
+            {
+                float center = (i + 0.5f) * scale;
+                int beg = Simd::Max((int)(center - support + 0.5f), 0);
+                int end = Simd::Min((int)(center + support + 0.5f), (int)sizeS);
+                float * a = alpha.data + i * taps, sum = 0.0f;
+                for (int s = beg; s < end; ++s)
+                {
+                    float x = (s - center + 0.5f) / stretch;
+                    a[s - beg] = method == SimdResizeMethodLanczos3 ? Lanczos3(x) : Mitchell(x);
+                    sum += a[s - beg];
+                }
+                if (sum != 0.0f)
+                {
+                    for (int s = beg; s < end; ++s)
+                        a[s - beg] /= sum;
+                }
+                index[i] = beg;
+                count[i] = end - beg;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ResizerByteFilter::ResizerByteFilter(const ResParam& param)
+            : Resizer(param)
+            , _alignX(1)
+        {
+        }
+
+        void ResizerByteFilter::EstimateAlpha(const Array32f& src, size_t taps, Array16i& dst)
+        {
+            dst.Resize(src.size);
+            for (size_t i = 0; i < src.size; i += taps)
+            {
+                int sum = 0;
+                size_t max = i;
+                for (size_t k = i; k < i + taps; ++k)
+                {
+                    dst[k] = (int16_t)Round(src[k] * FILTER_RANGE);
+                    sum += dst[k];
+                    if (::abs(dst[k]) > ::abs(dst[max]))
+                        max = k;
+                }
+                dst[max] += int16_t(FILTER_RANGE - sum);
+            }
+        }
+
+        void ResizerByteFilter::Init()
+        {
+            if (_ix.data)
+                return;
+            size_t N = _param.channels;
+            _coefs = ResizerCacheFind(_param, ResCoefsByteFilter16i, _alignX);
+            if (_coefs)
+            {
+                _coefs->Share(0, _ix), _coefs->Share(1, _iy), _coefs->Share(2, _ny), _coefs->Share(3, _ax), _coefs->Share(4, _ay);
+                _tx = _ax.size / _param.dstW;
+                _ty = _ay.size / _param.dstH;
+            }
+            else
+            {
+                Array32i cx;
+                Array32f ax, ay;
+                EstimateFilterIndexAlpha(_param.srcW, _param.dstW, _param.method, _alignX, _tx, _ix, cx, ax);
+                EstimateFilterIndexAlpha(_param.srcH, _param.dstH, _param.method, 1, _ty, _iy, _ny, ay);
+                EstimateAlpha(ax, _tx, _ax);
+                EstimateAlpha(ay, _ty, _ay);
+                for (size_t i = 0; i < _ix.size; ++i)
+                    _ix[i] *= (int)N;
+                _coefs.reset(new ResCoefs());
+                _coefs->Keep(_ix), _coefs->Keep(_iy), _coefs->Keep(_ny), _coefs->Keep(_ax), _coefs->Keep(_ay);
+                ResizerCacheInsert(_param, ResCoefsByteFilter16i, _coefs, _alignX);
+            }
+            _bs.Resize((_param.srcW + _tx) * N + SIMD_ALIGN, true);
+            _bx.Resize(_param.dstW * N * _ty);
+            _rows.Resize(_ty);
+        }
+
+        void ResizerByteFilter::RunX(const uint8_t* src, int16_t* dst)
+        {
+            size_t N = _param.channels, taps = _tx;
+            for (size_t dx = 0; dx < _param.dstW; dx++, dst += N)
+            {
+                const uint8_t* s = src + _ix[dx];
+                const int16_t* a = _ax.data + dx * taps;
+                for (size_t c = 0; c < N; ++c)
+                {
+                    int32_t sum = 0;
+                    for (size_t k = 0; k < taps; ++k)
+                        sum += s[k * N + c] * a[k];
+                    dst[c] = int16_t((sum + FILTER_X_ROUND) >> FILTER_X_SHIFT);
+                }
+            }
+        }
+
+        void ResizerByteFilter::RunY(const int16_t* const* src, size_t n, const int16_t* ay, uint8_t* dst)
+        {
+            size_t size = _param.dstW * _param.channels;
+            for (size_t i = 0; i < size; ++i)
+            {
+                int32_t sum = 0;
+                for (size_t k = 0; k < n; ++k)
+                    sum += src[k][i] * ay[k];
+                dst[i] = RestrictRange((sum + FILTER_Y_ROUND) >> FILTER_Y_SHIFT, 0, 255);
+            }
+        }
+
+        void ResizerByteFilter::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            Init();
+            size_t rowS = _param.srcW * _param.channels, rowD = _param.dstW * _param.channels;
+            int32_t next = 0;
+            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            {
+                int32_t sy = _iy[dy], ny = _ny[dy];
+                for (int32_t curr = Simd::Max(next, sy); curr < sy + ny; ++curr)
+                {
+                    memcpy(_bs.data, src + curr * srcStride, rowS);
+                    RunX(_bs.data, _bx.data + (curr % _ty) * rowD);
+                }
+                next = Simd::Max(next, sy + ny);
+                for (int32_t k = 0; k < ny; ++k)
+                    _rows[k] = _bx.data + ((sy + k) % _ty) * rowD;
+                RunY(_rows.data, ny, _ay.data + dy * _ty, dst);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ResizerFloatFilter::ResizerFloatFilter(const ResParam& param)
+            : Resizer(param)
+            , _alignX(1)
+        {
+        }
+
+        void ResizerFloatFilter::Init()
+        {
+            if (_ix.data)
+                return;
+            size_t N = _param.channels;
+            _coefs = ResizerCacheFind(_param, ResCoefsFloatFilter32f, _alignX);
+            if (_coefs)
+            {
+                _coefs->Share(0, _ix), _coefs->Share(1, _iy), _coefs->Share(2, _ny), _coefs->Share(3, _ax), _coefs->Share(4, _ay);
+                _tx = _ax.size / _param.dstW;
+                _ty = _ay.size / _param.dstH;
+            }
+            else
+            {
+                Array32i cx;
+                EstimateFilterIndexAlpha(_param.srcW, _param.dstW, _param.method, _alignX, _tx, _ix, cx, _ax);
+                EstimateFilterIndexAlpha(_param.srcH, _param.dstH, _param.method, 1, _ty, _iy, _ny, _ay);
+                for (size_t i = 0; i < _ix.size; ++i)
+                    _ix[i] *= (int)N;
+                _coefs.reset(new ResCoefs());
+                _coefs->Keep(_ix), _coefs->Keep(_iy), _coefs->Keep(_ny), _coefs->Keep(_ax), _coefs->Keep(_ay);
+                ResizerCacheInsert(_param, ResCoefsFloatFilter32f, _coefs, _alignX);
+            }
+            _bs.Resize((_param.srcW + _tx) * N + SIMD_ALIGN, true);
+            _bx.Resize(_param.dstW * N * _ty);
+            _rows.Resize(_ty);
+        }
+
+        void ResizerFloatFilter::LoadRow(const uint8_t* src, float* dst)
+        {
+            size_t size = _param.srcW * _param.channels;
+            if (_param.type == SimdResizeChannelShort)
+            {
+                const uint16_t* s = (const uint16_t*)src;
+                for (size_t i = 0; i < size; ++i)
+                    dst[i] = (float)s[i];
+            }
+            else
+                memcpy(dst, src, size * sizeof(float));
+        }
+
+        void ResizerFloatFilter::RunX(const float* src, float* dst)
+        {
+            size_t N = _param.channels, taps = _tx;
+            for (size_t dx = 0; dx < _param.dstW; dx++, dst += N)
+            {
+                const float* s = src + _ix[dx];
+                const float* a = _ax.data + dx * taps;
+                for (size_t c = 0; c < N; ++c)
+                {
+                    float sum = 0.0f;
+                    for (size_t k = 0; k < taps; ++k)
+                        sum += s[k * N + c] * a[k];
+                    dst[c] = sum;
+                }
+            }
+        }
+
+        void ResizerFloatFilter::RunY(const float* const* src, size_t n, const float* ay, uint8_t* dst)
+        {
+            size_t size = _param.dstW * _param.channels;
+            if (_param.type == SimdResizeChannelShort)
+            {
+                uint16_t* d = (uint16_t*)dst;
+                for (size_t i = 0; i < size; ++i)
+                {
+                    float sum = 0.0f;
+                    for (size_t k = 0; k < n; ++k)
+                        sum += src[k][i] * ay[k];
+                    d[i] = (uint16_t)RestrictRange(Round(sum), 0, 0xFFFF);
+                }
+            }
+            else
+            {
+                float* d = (float*)dst;
+                for (size_t i = 0; i < size; ++i)
+                {
+                    float sum = 0.0f;
+                    for (size_t k = 0; k < n; ++k)
+                        sum += src[k][i] * ay[k];
+                    d[i] = sum;
+                }
+            }
+        }
+
+        void ResizerFloatFilter::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            Init();
+            size_t rowD = _param.dstW * _param.channels;
+            int32_t next = 0;
+            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            {
+                int32_t sy = _iy[dy], ny = _ny[dy];
+                for (int32_t curr = Simd::Max(next, sy); curr < sy + ny; ++curr)
+                {
+                    LoadRow(src + curr * srcStride, _bs.data);
+                    RunX(_bs.data, _bx.data + (curr % _ty) * rowD);
+                }
+                next = Simd::Max(next, sy + ny);
+                for (int32_t k = 0; k < ny; ++k)
+                    _rows[k] = _bx.data + ((sy + k) % _ty) * rowD;
+                RunY(_rows.data, ny, _ay.data + dy * _ty, dst);
+            }
+        }
+    }
+}
@@ -80,9 +80,9 @@ namespace Simd
 
         void ResizerNearest::Resize(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
         {
-            for (size_t dy = 0; dy < _param.dstH; dy++)
+            for (size_t dy = _dyBeg; dy < _dyEnd; dy++)
             {
-                const uint8_t* srcRow = src + _iy[dy] * srcStride;
+                const uint8_t* srcRow = src + (_iy[dy] - _syBeg) * srcStride;
                 for (size_t dx = 0, offset = 0; dx < _param.dstW; dx++, offset += _pixelSize)
                     memcpy(dst + offset, srcRow + _ix[dx], _pixelSize);
                 dst += dstStride;
@@ -91,9 +91,9 @@ namespace Simd
 
         template<size_t N> void ResizerNearest::Resize(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
         {
-            for (size_t dy = 0; dy < _param.dstH; dy++)
+            for (size_t dy = _dyBeg; dy < _dyEnd; dy++)
             {
-                const uint8_t * srcRow = src + _iy[dy] * srcStride;
+                const uint8_t * srcRow = src + (_iy[dy] - _syBeg) * srcStride;
                 for (size_t dx = 0, offset = 0; dx < _param.dstW; dx++, offset += N)
                     CopyPixel<N>(srcRow + _ix[dx], dst + offset);
                 dst += dstStride;
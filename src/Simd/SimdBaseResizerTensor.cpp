@@ -0,0 +1,239 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdBFloat16.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        ResizerTensor::ResizerTensor(const ResParam& param, const ResTensorParam& tensor, const float* scale, const float* shift)
+            : _param(param)
+            , _tensor(tensor)
+        {
+            size_t cn = _param.channels, w = _param.dstW, W = _tensor.dstW;
+            bool nchw = _tensor.format == SimdTensorFormatNchw;
+            _scale.Resize(w * cn, false, _param.align);
+            _shift.Resize(w * cn, false, _param.align);
+            _pad.Resize(W * cn * _tensor.ElemSize(), false, _param.align);
+            for (size_t c = 0; c < cn; ++c)
+            {
+                float k = scale ? scale[c] : 1.0f, b = shift ? shift[c] : 0.0f, f = _tensor.fill * k + b;
+                for (size_t x = 0; x < w; ++x)
+                {
+                    size_t i = nchw ? c * w + x : x * cn + c;
+                    _scale[i] = k / float(FRACTION_RANGE * FRACTION_RANGE);
+                    _shift[i] = b;
+                }
+                for (size_t x = 0; x < W; ++x)
+                {
+                    size_t i = nchw ? c * W + x : x * cn + c;
+                    if (_tensor.type == SimdTensorData32f)
+                        ((float*)_pad.data)[i] = f;
+                    else
+                        ((uint16_t*)_pad.data)[i] = Float32ToBFloat16(f);
+                }
+            }
+            _ix.Resize(w);
+            _ax.Resize(w);
+            _iy.Resize(_param.dstH);
+            _ay.Resize(_param.dstH);
+            EstimateIndexAlpha(_param.srcW, w, _ix.data, _ax.data);
+            EstimateIndexAlpha(_param.srcH, _param.dstH, _iy.data, _ay.data);
+            _bx[0].Resize(w * cn, false, _param.align);
+            _bx[1].Resize(w * cn, false, _param.align);
+        }
+
+        void ResizerTensor::EstimateIndexAlpha(size_t srcSize, size_t dstSize, int32_t* indices, int32_t* alphas)
+        {
+            float scale = (float)srcSize / dstSize;
+            bool nearest = _param.IsNearest();
+            for (size_t i = 0; i < dstSize; ++i)
+            {
+                float pos = nearest ? (i + 0.5f) * scale : (i + 0.5f) * scale - 0.5f;
+                ptrdiff_t index = (ptrdiff_t)::floor(pos);
+                float alpha = nearest ? 0.0f : pos - index;
+                if (index < 0)
+                {
+                    index = 0;
+                    alpha = 0;
+                }
+                if (index > (ptrdiff_t)srcSize - 2)
+                {
+                    index = srcSize - 2;
+                    alpha = 1;
+                }
+                indices[i] = (int32_t)index;
+                alphas[i] = (int32_t)(alpha * FRACTION_RANGE + 0.5f);
+            }
+        }
+
+        void ResizerTensor::RunX(const uint8_t* src, int32_t* dst)
+        {
+            size_t cn = _param.channels, w = _param.dstW;
+            if (_tensor.format == SimdTensorFormatNchw)
+            {
+                for (size_t c = 0; c < cn; ++c)
+                {
+                    for (size_t dx = 0; dx < w; dx++)
+                    {
+                        const uint8_t* s = src + _ix[dx] * cn + c;
+                        int32_t t = s[0];
+                        dst[dx] = (t << LINEAR_SHIFT) + (s[cn] - t) * _ax[dx];
+                    }
+                    dst += w;
+                }
+            }
+            else
+            {
+                for (size_t dx = 0; dx < w; dx++)
+                {
+                    const uint8_t* s = src + _ix[dx] * cn;
+                    int32_t fx = _ax[dx];
+                    for (size_t c = 0; c < cn; ++c, ++dst)
+                    {
+                        int32_t t = s[c];
+                        dst[0] = (t << LINEAR_SHIFT) + (s[c + cn] - t) * fx;
+                    }
+                }
+            }
+        }
+
+        void ResizerTensor::RunY(const int32_t* src0, const int32_t* src1, size_t size, int32_t fy, const float* scale, const float* shift, uint8_t* dst)
+        {
+            if (_tensor.type == SimdTensorData32f)
+                RowY32f(src0, src1, size, fy, scale, shift, (float*)dst);
+            else
+                RowY16b(src0, src1, size, fy, scale, shift, (uint16_t*)dst);
+        }
+
+        void ResizerTensor::Run(const uint8_t* src, size_t srcStride, uint8_t* dst)
+        {
+            size_t cn = _param.channels, w = _param.dstW, h = _param.dstH, W = _tensor.dstW, H = _tensor.dstH;
+            size_t es = _tensor.ElemSize(), left = _tensor.left, right = W - w - left, top = _tensor.top;
+            bool nchw = _tensor.format == SimdTensorFormatNchw;
+            if (nchw)
+            {
+                for (size_t c = 0; c < cn; ++c)
+                {
+                    const uint8_t* pad = _pad.data + c * W * es;
+                    uint8_t* plane = dst + c * H * W * es;
+                    for (size_t y = 0; y < H; ++y)
+                    {
+                        uint8_t* row = plane + y * W * es;
+                        if (y < top || y >= top + h)
+                            memcpy(row, pad, W * es);
+                        else
+                        {
+                            memcpy(row, pad, left * es);
+                            memcpy(row + (left + w) * es, pad, right * es);
+                        }
+                    }
+                }
+            }
+            else
+            {
+                size_t rowSize = W * cn * es;
+                for (size_t y = 0; y < H; ++y)
+                {
+                    uint8_t* row = dst + y * rowSize;
+                    if (y < top || y >= top + h)
+                        memcpy(row, _pad.data, rowSize);
+                    else
+                    {
+                        memcpy(row, _pad.data, left * cn * es);
+                        memcpy(row + (left + w) * cn * es, _pad.data, right * cn * es);
+                    }
+                }
+            }
+
+            int32_t* pbx[2] = { _bx[0].data, _bx[1].data };
+            int32_t prev = -2;
+            for (size_t dy = 0; dy < h; dy++)
+            {
+                int32_t sy = _iy[dy], k = 0;
+                if (sy == prev)
+                    k = 2;
+                else if (sy == prev + 1)
+                {
+                    Swap(pbx[0], pbx[1]);
+                    k = 1;
+                }
+                prev = sy;
+                for (; k < 2; k++)
+                    RunX(src + (sy + k) * srcStride, pbx[k]);
+                if (nchw)
+                {
+                    for (size_t c = 0; c < cn; ++c)
+                    {
+                        size_t o = c * w;
+                        uint8_t* pd = dst + ((c * H + top + dy) * W + left) * es;
+                        RunY(pbx[0] + o, pbx[1] + o, w, _ay[dy], _scale.data + o, _shift.data + o, pd);
+                    }
+                }
+                else
+                    RunY(pbx[0], pbx[1], w * cn, _ay[dy], _scale.data, _shift.data, dst + ((top + dy) * W + left) * cn * es);
+            }
+        }
+
+        void ResizerTensor::RowY32f(const int32_t* src0, const int32_t* src1, size_t size, int32_t fy, const float* scale, const float* shift, float* dst)
+        {
+            for (size_t i = 0; i < size; i++)
+            {
+                int32_t t = src0[i];
+                dst[i] = float((t << LINEAR_SHIFT) + (src1[i] - t) * fy) * scale[i] + shift[i];
+            }
+        }
+
+        void ResizerTensor::RowY16b(const int32_t* src0, const int32_t* src1, size_t size, int32_t fy, const float* scale, const float* shift, uint16_t* dst)
+        {
+            for (size_t i = 0; i < size; i++)
+            {
+                int32_t t = src0[i];
+                dst[i] = Float32ToBFloat16(float((t << LINEAR_SHIFT) + (src1[i] - t) * fy) * scale[i] + shift[i]);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        bool ResizerTensorValid(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method, SimdTensorFormatType format, SimdTensorDataType type)
+        {
+            return srcX >= 2 && srcY >= 2 && dstX > 0 && dstY > 0 && channels >= 1 && channels <= 4 &&
+                (method == SimdResizeMethodNearest || method == SimdResizeMethodBilinear) &&
+                (format == SimdTensorFormatNchw || format == SimdTensorFormatNhwc) &&
+                (type == SimdTensorData32f || type == SimdTensorData16b);
+        }
+
+        void* ResizerTensorInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method,
+            SimdTensorFormatType format, SimdTensorDataType type, const float* scale, const float* shift, SimdBool letterbox, float fill)
+        {
+            if (!ResizerTensorValid(srcX, srcY, dstX, dstY, channels, method, format, type))
+                return NULL;
+            ResTensorParam tensor(srcX, srcY, dstX, dstY, format, type, letterbox, fill);
+            ResParam param(srcX, srcY, tensor.imgW, tensor.imgH, channels, SimdResizeChannelByte, method, sizeof(void*));
+            return new ResizerTensor(param, tensor, scale, shift);
+        }
+    }
+}
@@ -0,0 +1,156 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        ResizerYuv420::ResizerYuv420(const ResParam& param, SimdPixelFormatType format, SimdYuvType yuvType)
+            : _param(param)
+            , _format(format)
+            , _yuvType(yuvType)
+        {
+            _convert = format == SimdPixelFormatRgb24 ? Base::Yuv444pToRgbV2 : Base::Yuv444pToBgrV2;
+        }
+
+        void ResizerYuv420::EstimateIndexAlpha(size_t srcSize, size_t dstSize, Array32i& index, Array32i& alpha)
+        {
+            index.Resize(dstSize);
+            alpha.Resize(dstSize);
+            float scale = (float)srcSize / dstSize;
+            for (size_t i = 0; i < dstSize; ++i)
+            {
+                ptrdiff_t idx;
+                float a;
+                if (_param.method == SimdResizeMethodNearest)
+                {
+                    idx = Simd::Min((ptrdiff_t)::floor((i + 0.5f) * scale), (ptrdiff_t)srcSize - 1);
+                    a = 0.0f;
+                }
+                else
+                {
+                    float pos = (float)((i + 0.5f) * scale - 0.5f);
+                    idx = (ptrdiff_t)::floor(pos);
+                    a = pos - idx;
+                    if (idx < 0)
+                    {
+                        idx = 0;
+                        a = 0.0f;
+                    }
+                }
+                if (idx > (ptrdiff_t)srcSize - 2)
+                {
+                    idx = srcSize - 2;
+                    a = 1.0f;
+                }
+                index[i] = (int32_t)idx;
+                alpha[i] = (int32_t)(a * FRACTION_RANGE + 0.5f);
+            }
+        }
+
+        void ResizerYuv420::Init()
+        {
+            if (_planes[0].row.data)
+                return;
+            for (size_t p = 0; p < 3; ++p)
+            {
+                Plane& plane = _planes[p];
+                plane.srcW = p ? DivHi(_param.srcW, 2) : _param.srcW;
+                plane.srcH = p ? DivHi(_param.srcH, 2) : _param.srcH;
+                EstimateIndexAlpha(plane.srcW, _param.dstW, plane.ix, plane.ax);
+                EstimateIndexAlpha(plane.srcH, _param.dstH, plane.iy, plane.ay);
+                plane.bx.Resize(_param.dstW * 2);
+                plane.row.Resize(_param.dstW);
+            }
+        }
+
+        void ResizerYuv420::RunX(const uint8_t* src, size_t step, const Plane& plane, uint16_t* dst)
+        {
+            for (size_t dx = 0; dx < _param.dstW; dx++)
+            {
+                const uint8_t* s = src + plane.ix[dx] * step;
+                int32_t fx = plane.ax[dx];
+                dst[dx] = uint16_t(s[0] * (FRACTION_RANGE - fx) + s[step] * fx);
+            }
+        }
+
+        void ResizerYuv420::RunY(const uint16_t* src0, const uint16_t* src1, int32_t fy, uint8_t* dst)
+        {
+            for (size_t dx = 0; dx < _param.dstW; dx++)
+                dst[dx] = uint8_t((src0[dx] * (FRACTION_RANGE - fy) + src1[dx] * fy + BILINEAR_ROUND_TERM) >> BILINEAR_SHIFT);
+        }
+
+        void ResizerYuv420::RunPlane(const uint8_t* src, size_t stride, size_t step, size_t dy, Plane& plane)
+        {
+            int32_t sy = plane.iy[dy], k = 0;
+            if (sy == plane.prev)
+                k = 2;
+            else if (sy == plane.prev + 1)
+            {
+                Swap(plane.pb[0], plane.pb[1]);
+                k = 1;
+            }
+            plane.prev = sy;
+            for (; k < 2; k++)
+                RunX(src + (sy + k) * stride, step, plane, plane.pb[k]);
+            RunY(plane.pb[0], plane.pb[1], plane.ay[dy], plane.row.data);
+        }
+
+        void ResizerYuv420::Run(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t uvStep, uint8_t* dst, size_t dstStride)
+        {
+            Init();
+            for (size_t p = 0; p < 3; ++p)
+            {
+                _planes[p].prev = -2;
+                _planes[p].pb[0] = _planes[p].bx.data;
+                _planes[p].pb[1] = _planes[p].bx.data + _param.dstW;
+            }
+            for (size_t dy = 0; dy < _param.dstH; ++dy, dst += dstStride)
+            {
+                RunPlane(y, yStride, 1, dy, _planes[0]);
+                RunPlane(u, uStride, uvStep, dy, _planes[1]);
+                RunPlane(v, vStride, uvStep, dy, _planes[2]);
+                _convert(_planes[0].row.data, 0, _planes[1].row.data, 0, _planes[2].row.data, 0, _param.dstW, 1, dst, dstStride, _yuvType);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        bool ResizerYuv420Valid(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType format, SimdYuvType yuvType, SimdResizeMethodType method)
+        {
+            return srcX >= 4 && srcY >= 4 && dstX > 0 && dstY > 0 && (format == SimdPixelFormatBgr24 || format == SimdPixelFormatRgb24) &&
+                (method == SimdResizeMethodNearest || method == SimdResizeMethodBilinear) && yuvType >= SimdYuvBt601 && yuvType <= SimdYuvTrect871;
+        }
+
+        void* ResizerYuv420Init(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType format, SimdYuvType yuvType, SimdResizeMethodType method)
+        {
+            if (!ResizerYuv420Valid(srcX, srcY, dstX, dstY, format, yuvType, method))
+                return NULL;
+            ResParam param(srcX, srcY, dstX, dstY, 3, SimdResizeChannelByte, method, sizeof(void*));
+            return new ResizerYuv420(param, format, yuvType);
+        }
+    }
+}
@@ -0,0 +1,267 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSeparableFilter.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    SepFilterParam::SepFilterParam(size_t w, size_t h, size_t c, SimdSeparableFilterChannelType t, const float* rk, size_t rs, const float* ck, size_t cs, size_t a)
+        : width(w)
+        , height(h)
+        , channels(c)
+        , type(t)
+        , align(a)
+    {
+        if (rk)
+            rowKernel.assign(rk, rk + rs);
+        if (ck)
+            colKernel.assign(ck, ck + cs);
+    }
+
+    bool SepFilterParam::Valid() const
+    {
+        return
+            height > 0 &&
+            width > 0 &&
+            channels > 0 && channels <= 4 &&
+            (type == SimdSeparableFilterChannel8u || type == SimdSeparableFilterChannel16u) &&
+            rowKernel.size() > 0 && colKernel.size() > 0;
+    }
+
+    //---------------------------------------------------------------------
+
+    SeparableFilter::SeparableFilter(const SepFilterParam& param)
+        : _param(param)
+    {
+    }
+
+    //---------------------------------------------------------------------
+
+    namespace Base
+    {
+        static void SepFilterRowInt(const uint8_t* src, size_t size, size_t channels, const int16_t* kernel, size_t kernelSize, int16_t* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                int sum = 0;
+                for (size_t k = 0; k < kernelSize; ++k)
+                    sum += int(src[i + k * channels]) * kernel[k];
+                dst[i] = (int16_t)sum;
+            }
+        }
+
+        static void SepFilterColInt(const int16_t* const* src, size_t size, const int16_t* kernel, size_t kernelSize, int shift, uint8_t* dst)
+        {
+            int round = shift ? 1 << (shift - 1) : 0;
+            for (size_t i = 0; i < size; ++i)
+            {
+                int sum = 0;
+                for (size_t k = 0; k < kernelSize; ++k)
+                    sum += int(src[k][i]) * kernel[k];
+                dst[i] = (uint8_t)RestrictRange((sum + round) >> shift, 0, 255);
+            }
+        }
+
+        template<class T> void SepFilterRowFloat(const uint8_t* src, size_t size, size_t channels, const float* kernel, size_t kernelSize, float* dst)
+        {
+            const T* s = (const T*)src;
+            for (size_t i = 0; i < size; ++i)
+            {
+                float sum = 0.0f;
+                for (size_t k = 0; k < kernelSize; ++k)
+                    sum += float(s[i + k * channels]) * kernel[k];
+                dst[i] = sum;
+            }
+        }
+
+        template<class T> void SepFilterColFloat(const float* const* src, size_t size, const float* kernel, size_t kernelSize, uint8_t* dst)
+        {
+            const int max = std::numeric_limits<T>::max();
+            T* d = (T*)dst;
+            for (size_t i = 0; i < size; ++i)
+            {
+                float sum = 0.0f;
+                for (size_t k = 0; k < kernelSize; ++k)
+                    sum += src[k][i] * kernel[k];
+                d[i] = (T)RestrictRange(Round(sum), 0, max);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        static int ExactShift(const std::vector<float>& kernel, int shiftMax, int sumMax)
+        {
+            for (int shift = 0; shift <= shiftMax; ++shift)
+            {
+                float scale = float(1 << shift), sum = 0.0f;
+                bool exact = true;
+                for (size_t k = 0; k < kernel.size() && exact; ++k)
+                {
+                    float value = kernel[k] * scale;
+                    exact = value == ::floor(value) && ::fabs(value) <= float(INT16_MAX);
+                    sum += ::fabs(value);
+                }
+                if (exact && sum <= float(sumMax))
+                    return shift;
+            }
+            return -1;
+        }
+
+        static int SumAbs(const int16_t* kernel, size_t size)
+        {
+            int sum = 0;
+            for (size_t k = 0; k < size; ++k)
+                sum += Simd::Abs(int(kernel[k]));
+            return sum;
+        }
+
+        SeparableFilterDefault::SeparableFilterDefault(const SepFilterParam& param)
+            : Simd::SeparableFilter(param)
+        {
+            const SepFilterParam& p = _param;
+            SepFilterAlg& a = _alg;
+            a.size = p.width * p.channels;
+            a.rowSize = p.rowKernel.size();
+            a.colSize = p.colKernel.size();
+            a.rowAnchor = a.rowSize / 2;
+            a.colAnchor = a.colSize / 2;
+
+            a.exact = false;
+            if (p.type == SimdSeparableFilterChannel8u)
+            {
+                int rowShift = ExactShift(p.rowKernel, 7, INT16_MAX / 255);
+                if (rowShift >= 0)
+                {
+                    a.rowInt.Resize(a.rowSize);
+                    for (size_t k = 0; k < a.rowSize; ++k)
+                        a.rowInt[k] = (int16_t)(p.rowKernel[k] * float(1 << rowShift));
+                    int rowMax = SumAbs(a.rowInt.data, a.rowSize) * 255;
+                    int colShift = ExactShift(p.colKernel, 16, Simd::Min(INT32_MAX / 2 / Simd::Max(rowMax, 1), 1 << 16));
+                    if (colShift >= 0 && rowShift + colShift <= 24)
+                    {
+                        a.colInt.Resize(a.colSize);
+                        for (size_t k = 0; k < a.colSize; ++k)
+                            a.colInt[k] = (int16_t)(p.colKernel[k] * float(1 << colShift));
+                        a.shift = rowShift + colShift;
+                        a.exact = true;
+                    }
+                }
+            }
+            if (!a.exact)
+            {
+                a.rowFloat.Assign(p.rowKernel.data(), a.rowSize);
+                a.colFloat.Assign(p.colKernel.data(), a.colSize);
+                a.shift = 0;
+            }
+
+            size_t elem = a.exact ? sizeof(int16_t) : sizeof(float);
+            a.stride = AlignHi(a.size * elem, p.align);
+            a.padSize = AlignHi((p.width + a.rowSize) * p.PixelSize(), p.align);
+            a.ringSize = a.stride * a.colSize;
+            a.bufSize = a.padSize + a.ringSize + AlignHi(a.colSize * sizeof(void*), p.align);
+            a.threads = Simd::Max<size_t>(1, Simd::Min(Base::GetThreadNumber(), p.height / Simd::Max<size_t>(a.colSize * 4, 16)));
+            _buffer.Resize(a.bufSize * a.threads);
+
+            _rowInt = SepFilterRowInt;
+            _colInt = SepFilterColInt;
+            if (p.type == SimdSeparableFilterChannel8u)
+            {
+                _rowFloat = SepFilterRowFloat<uint8_t>;
+                _colFloat = SepFilterColFloat<uint8_t>;
+            }
+            else
+            {
+                _rowFloat = SepFilterRowFloat<uint16_t>;
+                _colFloat = SepFilterColFloat<uint16_t>;
+            }
+        }
+
+        void SeparableFilterDefault::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            Simd::Parallel(0, _param.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                Run(src, srcStride, begin, end, _buffer.data + thread * _alg.bufSize, dst, dstStride);
+            }, _alg.threads, 1);
+        }
+
+        void SeparableFilterDefault::SetRow(const uint8_t* src, uint8_t* pad, uint8_t* dst)
+        {
+            const SepFilterParam& p = _param;
+            const SepFilterAlg& a = _alg;
+            size_t pixel = p.PixelSize(), tail = a.rowSize - 1 - a.rowAnchor;
+            for (size_t x = 0; x < a.rowAnchor; ++x, pad += pixel)
+                memcpy(pad, src, pixel);
+            memcpy(pad, src, p.width * pixel);
+            pad += p.width * pixel, src += (p.width - 1) * pixel;
+            for (size_t x = 0; x < tail; ++x, pad += pixel)
+                memcpy(pad, src, pixel);
+            pad -= (p.width + a.rowSize - 1) * pixel;
+            if (a.exact)
+                _rowInt(pad, a.size, p.channels, a.rowInt.data, a.rowSize, (int16_t*)dst);
+            else
+                _rowFloat(pad, a.size, p.channels, a.rowFloat.data, a.rowSize, (float*)dst);
+        }
+
+        void SeparableFilterDefault::Run(const uint8_t* src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t* buf, uint8_t* dst, size_t dstStride)
+        {
+            const SepFilterParam& p = _param;
+            const SepFilterAlg& a = _alg;
+            uint8_t* pad = buf, * ring = buf + a.padSize;
+            const uint8_t** rows = (const uint8_t**)(ring + a.ringSize);
+            ptrdiff_t height = p.height, anchor = a.colAnchor;
+            ptrdiff_t last = Simd::RestrictRange<ptrdiff_t>(ptrdiff_t(yBeg) - anchor, 0, height - 1) - 1;
+            for (size_t y = yBeg; y < yEnd; ++y)
+            {
+                ptrdiff_t top = ptrdiff_t(y) - anchor;
+                for (size_t k = 0; k < a.colSize; ++k)
+                {
+                    ptrdiff_t row = Simd::RestrictRange<ptrdiff_t>(top + k, 0, height - 1);
+                    uint8_t* slot = ring + (row % a.colSize) * a.stride;
+                    while (last < row)
+                    {
+                        last++;
+                        SetRow(src + last * srcStride, pad, ring + (last % a.colSize) * a.stride);
+                    }
+                    rows[k] = slot;
+                }
+                if (a.exact)
+                    _colInt((const int16_t**)rows, a.size, a.colInt.data, a.colSize, a.shift, dst + y * dstStride);
+                else
+                    _colFloat((const float**)rows, a.size, a.colFloat.data, a.colSize, dst + y * dstStride);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void* SeparableFilterInit(size_t width, size_t height, size_t channels, SimdSeparableFilterChannelType type,
+            const float* rowKernel, size_t rowSize, const float* colKernel, size_t colSize)
+        {
+            SepFilterParam param(width, height, channels, type, rowKernel, rowSize, colKernel, colSize, sizeof(void*));
+            if (!param.Valid())
+                return NULL;
+            return new SeparableFilterDefault(param);
+        }
+    }
+}
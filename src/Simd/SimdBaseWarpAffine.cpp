@@ -76,28 +76,20 @@ namespace Simd
     {
     }
 
+    bool WarpAffine::SetMatrix(const float* mat)
+    {
+        if (!WarpAffineInvertible(mat))
+            return false;
+        memcpy(_param.mat, mat, 6 * sizeof(float));
+        SetInv(_param.mat, _param.inv);
+        _first = true;
+        return true;
+    }
+
     //---------------------------------------------------------------------------------------------
 
     namespace Base
     {
-        template<int N> SIMD_INLINE void FillBorder(uint8_t* dst, int count, const uint8_t* bs)
-        {
-            int i = 0, size = count * N;
-            for (int i = 0; i < size; i += N)
-                Base::CopyPixel<N>(bs, dst + i);
-        }
-
-        template<> SIMD_INLINE void FillBorder<3>(uint8_t* dst, int count, const uint8_t* bs)
-        {
-            int i = 0, size = count * 3, size3 = size - 3;
-            for (; i < size3; i += 3)
-                Base::CopyPixel<4>(bs, dst + i);
-            for (; i < size; i += 3)
-                Base::CopyPixel<3>(bs, dst + i);
-        }
-
-        //---------------------------------------------------------------------------------------------
-
         template<int N> void NearestRun(const WarpAffParam& p, int yBeg, int yEnd, const int32_t* beg, const int32_t* end, const uint8_t* src, uint8_t* dst, uint32_t* buf)
         {
             bool fill = p.NeedFill();
@@ -132,12 +124,16 @@ namespace Simd
         WarpAffineNearest::WarpAffineNearest(const WarpAffParam& param)
             : WarpAffine(param)
         {
-            switch (_param.channels)
+            switch (_param.PixelSize())
             {
             case 1: _run = NearestRun<1>; break;
             case 2: _run = NearestRun<2>; break;
             case 3: _run = NearestRun<3>; break;
             case 4: _run = NearestRun<4>; break;
+            case 6: _run = NearestRun<6>; break;
+            case 8: _run = NearestRun<8>; break;
+            case 12: _run = NearestRun<12>; break;
+            case 16: _run = NearestRun<16>; break;
             }
         }
 
@@ -372,6 +368,150 @@ namespace Simd
 
         //-----------------------------------------------------------------------------------------
 
+        template<class T, int N, int K> void InterpRun(const WarpAffParam& p, int yBeg, int yEnd, const int* range, const float* cx, const float* cy, const int32_t* coef, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            const int P = N * sizeof(T);
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW, height = (int)p.dstH, s = (int)p.srcS, w = (int)p.srcW, h = (int)p.srcH, xs = (int)p.CoordStride();
+            const int* ib = range + 0 * height, * ie = range + 1 * height, * ob = range + 2 * height, * oe = range + 3 * height;
+            dst += yBeg * p.dstS;
+            for (int y = yBeg; y < yEnd; ++y)
+            {
+                float yx = cy[2 * y + 0], yy = cy[2 * y + 1];
+                int iB = ib[y], iE = ie[y], oB = ob[y], oE = oe[y];
+                if (fill)
+                    FillBorder<P>(dst, oB, p.border);
+                for (int x = oB; x < iB; ++x)
+                    InterpEdge<T, N, K>(cx[x] + yx, cx[x + xs] + yy, w, h, s, src, coef, fill ? p.border : dst + x * P, dst + x * P);
+                for (int x = iB; x < iE; ++x)
+                    InterpMain<T, N, K>(cx[x] + yx, cx[x + xs] + yy, w, h, s, src, coef, dst + x * P);
+                for (int x = iE; x < oE; ++x)
+                    InterpEdge<T, N, K>(cx[x] + yx, cx[x + xs] + yy, w, h, s, src, coef, fill ? p.border : dst + x * P, dst + x * P);
+                if (fill)
+                    FillBorder<P>(dst + oE * P, width - oE, p.border);
+                dst += p.dstS;
+            }
+        }
+
+        template<class T, int K> WarpAffineInterp::RunPtr GetInterpRun(size_t channels)
+        {
+            switch (channels)
+            {
+            case 1: return InterpRun<T, 1, K>;
+            case 2: return InterpRun<T, 2, K>;
+            case 3: return InterpRun<T, 3, K>;
+            case 4: return InterpRun<T, 4, K>;
+            default: return NULL;
+            }
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        WarpAffineInterp::WarpAffineInterp(const WarpAffParam& param)
+            : WarpAffine(param)
+        {
+            bool cubic = _param.IsBicubic();
+            switch (_param.Channel())
+            {
+            case SimdWarpAffineChannelByte: _run = GetInterpRun<uint8_t, 4>(_param.channels); break;
+            case SimdWarpAffineChannelShort: _run = cubic ? GetInterpRun<uint16_t, 4>(_param.channels) : GetInterpRun<uint16_t, 2>(_param.channels); break;
+            case SimdWarpAffineChannelFloat: _run = cubic ? GetInterpRun<float, 4>(_param.channels) : GetInterpRun<float, 2>(_param.channels); break;
+            default: _run = NULL;
+            }
+        }
+
+        void WarpAffineInterp::Run(const uint8_t* src, uint8_t* dst)
+        {
+            if (_first)
+                Init();
+
+            Simd::Parallel(0, _param.dstH, [&](size_t thread, size_t begin, size_t end)
+            {
+                _run(_param, (int)begin, (int)end, _range.data, _coords.data, _coords.data + _param.CoordStride() * 2, _coef.data, src, dst, _buf.data + thread * _size);
+            }, _threads, 1);
+
+            _first = false;
+        }
+
+        static void SetAffineRange(const WarpAffParam& p, double uMin, double uMax, double vMin, double vMax, int* beg, int* end)
+        {
+            const float* m = p.inv;
+            for (size_t y = 0; y < p.dstH; ++y)
+            {
+                double lo = 0.0, hi = double(p.dstW) - 1.0;
+                double u0 = double(m[1]) * y + m[2], v0 = double(m[4]) * y + m[5];
+                RestrictHalfLine(m[0], u0 - uMin, lo, hi);
+                RestrictHalfLine(-m[0], uMax - u0, lo, hi);
+                RestrictHalfLine(m[3], v0 - vMin, lo, hi);
+                RestrictHalfLine(-m[3], vMax - v0, lo, hi);
+                beg[y] = (int)ceil(lo);
+                end[y] = (int)floor(hi) + 1;
+                if (lo > hi || beg[y] >= end[y])
+                    beg[y] = end[y] = 0;
+            }
+        }
+
+        void WarpAffineInterp::Init()
+        {
+            const WarpAffParam& p = _param;
+            double r = p.IsBicubic() ? 2.0 : 1.0, e = 0.0001;
+            _range.Resize(p.dstH * 4);
+            int* ib = _range.data + 0 * p.dstH;
+            int* ie = _range.data + 1 * p.dstH;
+            int* ob = _range.data + 2 * p.dstH;
+            int* oe = _range.data + 3 * p.dstH;
+            SetAffineRange(p, -r + e, p.srcW + r - 1.0 - e, -r + e, p.srcH + r - 1.0 - e, ob, oe);
+            if (p.srcW >= 2 * r && p.srcH >= 2 * r)
+                SetAffineRange(p, r - 1.0, p.srcW - r, r - 1.0, p.srcH - r, ib, ie);
+            else
+                memset(ib, 0, 2 * p.dstH * sizeof(int));
+            for (size_t y = 0; y < p.dstH; ++y)
+            {
+                if (ib[y] == ie[y])
+                    ib[y] = ie[y] = ob[y];
+                ib[y] = Simd::RestrictRange(ib[y], ob[y], oe[y]);
+                ie[y] = Simd::RestrictRange(ie[y], ib[y], oe[y]);
+            }
+
+            size_t xs = p.CoordStride();
+            _coords.Resize(xs * 2 + p.dstH * 2);
+            float* cx = _coords.data, * cy = cx + xs * 2;
+            for (size_t x = 0; x < xs; ++x)
+            {
+                cx[x + 0 * xs] = float(x) * p.inv[0];
+                cx[x + 1 * xs] = float(x) * p.inv[3];
+            }
+            for (size_t y = 0; y < p.dstH; ++y, cy += 2)
+            {
+                cy[0] = float(y) * p.inv[1] + p.inv[2];
+                cy[1] = float(y) * p.inv[4] + p.inv[5];
+            }
+
+            if (p.Channel() == SimdWarpAffineChannelByte)
+            {
+                _coef.Resize(WA_BICUBIC_COEF_SIZE);
+                int8_t* kx = (int8_t*)_coef.data;
+                int16_t* ky = (int16_t*)(_coef.data + WA_BICUBIC_FRACTION_RANGE + 1);
+                for (int i = 0; i <= WA_BICUBIC_FRACTION_RANGE; ++i, kx += 4, ky += 4)
+                {
+                    float k[4];
+                    CubicWeights(float(i) / float(WA_BICUBIC_FRACTION_RANGE), k);
+                    for (int j = 0; j < 4; ++j)
+                    {
+                        kx[j] = (int8_t)Round(k[j] * (1 << WA_BICUBIC_X_SHIFT));
+                        ky[j] = (int16_t)Round(k[j] * (1 << WA_BICUBIC_Y_SHIFT));
+                    }
+                    kx[1] = (int8_t)((1 << WA_BICUBIC_X_SHIFT) - kx[0] - kx[2] - kx[3]);
+                    ky[1] = (int16_t)((1 << WA_BICUBIC_Y_SHIFT) - ky[0] - ky[2] - ky[3]);
+                }
+            }
+
+            _size = (AlignHi(p.dstW, p.align) + p.align) * 12;
+            _buf.Resize(_size * _threads);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
         void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
         {
             WarpAffParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, mat, flags, border, 1);
@@ -382,7 +522,99 @@ namespace Simd
             else if (param.IsByteBilinear())
                 return new WarpAffineByteBilinear(param);
             else
+                return new WarpAffineInterp(param);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        WarpAffineBatch::WarpAffineBatch(const WarpAffParam& param, SimdTensorDataType type, const float* lower, const float* upper)
+            : _param(param)
+            , _type(type)
+            , _threads(Base::GetThreadNumber())
+        {
+            const WarpAffParam& p = _param;
+            _imageSize = p.dstH * p.dstS;
+            if (_type == SimdTensorData32f)
+            {
+                _format = p.channels == 1 ? SimdPixelFormatGray8 : (p.channels == 3 ? SimdPixelFormatBgr24 : SimdPixelFormatBgra32);
+                _tensorChannels = p.channels == 1 ? 1 : 3;
+                _tensorSize = _tensorChannels * p.dstH * p.dstW * sizeof(float);
+                for (size_t c = 0; c < _tensorChannels; ++c)
+                {
+                    _lower[c] = lower ? lower[c] : 0.0f;
+                    _upper[c] = upper ? upper[c] : 1.0f;
+                }
+            }
+            else
+            {
+                _format = SimdPixelFormatNone;
+                _tensorChannels = 0;
+                _tensorSize = _imageSize;
+            }
+            _warpAffineInit = Base::WarpAffineInit;
+            _synetSetInput = Base::SynetSetInput;
+        }
+
+        WarpAffineBatch::~WarpAffineBatch()
+        {
+            for (size_t i = 0; i < _workers.size(); ++i)
+                delete _workers[i];
+        }
+
+        bool WarpAffineBatch::Run(const uint8_t* src, const float* mats, size_t count, uint8_t* dst)
+        {
+            const WarpAffParam& p = _param;
+            for (size_t i = 0; i < count; ++i)
+                if (!WarpAffineInvertible(mats + i * 6))
+                    return false;
+            size_t threads = Simd::Min(_threads, count);
+            if (_workers.size() < threads)
+            {
+                for (size_t t = _workers.size(); t < threads; ++t)
+                {
+                    WarpAffine* worker = (WarpAffine*)_warpAffineInit(p.srcW, p.srcH, p.srcS, p.dstW, p.dstH, p.dstS, p.channels, p.mat, p.flags, p.border);
+                    worker->SetThreads(1);
+                    _workers.push_back(worker);
+                }
+                if (_type == SimdTensorData32f)
+                    _buffer.Resize(_imageSize * _workers.size());
+            }
+            Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+            {
+                WarpAffine* worker = _workers[thread];
+                for (size_t i = begin; i < end; ++i)
+                {
+                    worker->SetMatrix(mats + i * 6);
+                    if (_type == SimdTensorData32f)
+                    {
+                        uint8_t* buf = _buffer.data + thread * _imageSize;
+                        worker->Run(src, buf);
+                        _synetSetInput(buf, p.dstW, p.dstH, p.dstS, _format, _lower, _upper, (float*)(dst + i * _tensorSize), _tensorChannels, SimdTensorFormatNchw);
+                    }
+                    else
+                        worker->Run(src, dst + i * _tensorSize);
+                }
+            }, threads, 1);
+            return true;
+        }
+
+        bool WarpAffineBatchValid(const WarpAffParam& param, SimdTensorDataType type, const float* lower, const float* upper)
+        {
+            if (!param.Valid())
+                return false;
+            if (type == SimdTensorData32f)
+                return param.Channel() == SimdWarpAffineChannelByte && param.channels != 2 && param.NeedFill();
+            return type == SimdTensorData8u;
+        }
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border, SimdTensorDataType type, const float* lower, const float* upper)
+        {
+            static const float identity[6] = { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+            WarpAffParam param(srcW, srcH, srcS, dstW, dstH, 0, channels, identity, flags, border, 1);
+            param.dstS = dstW * param.PixelSize();
+            if (!WarpAffineBatchValid(param, type, lower, upper))
                 return NULL;
+            return new WarpAffineBatch(param, type, lower, upper);
         }
     }
 }
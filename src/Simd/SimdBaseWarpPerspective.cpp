@@ -0,0 +1,321 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdWarpPerspective.h"
+#include "Simd/SimdWarpAffineCommon.h"
+#include "Simd/SimdCopy.h"
+#include "Simd/SimdBase.h"
+
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+    static SIMD_INLINE void SetPersInv(const float* mat, size_t srcW, size_t srcH, float* inv)
+    {
+        double m[9], a[9];
+        double sign = mat[6] * 0.5 * srcW + mat[7] * 0.5 * srcH + mat[8] < 0.0 ? -1.0 : 1.0;
+        for (int i = 0; i < 9; ++i)
+            m[i] = mat[i] * sign;
+        a[0] = m[4] * m[8] - m[5] * m[7];
+        a[1] = m[2] * m[7] - m[1] * m[8];
+        a[2] = m[1] * m[5] - m[2] * m[4];
+        a[3] = m[5] * m[6] - m[3] * m[8];
+        a[4] = m[0] * m[8] - m[2] * m[6];
+        a[5] = m[2] * m[3] - m[0] * m[5];
+        a[6] = m[3] * m[7] - m[4] * m[6];
+        a[7] = m[1] * m[6] - m[0] * m[7];
+        a[8] = m[0] * m[4] - m[1] * m[3];
+        double D = m[0] * a[0] + m[1] * a[3] + m[2] * a[6];
+        D = D != 0.0 ? 1.0 / D : 0.0;
+        for (int i = 0; i < 9; ++i)
+            inv[i] = (float)(a[i] * D);
+    }
+
+    WarpPersParam::WarpPersParam(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border, size_t align)
+    {
+        this->srcW = srcW;
+        this->srcH = srcH;
+        this->srcS = srcS;
+        this->dstW = dstW;
+        this->dstH = dstH;
+        this->dstS = dstS;
+        this->channels = channels;
+        memcpy(this->mat, mat, 9 * sizeof(float));
+        this->flags = flags;
+        memset(this->border, 0, BorderSizeMax);
+        if (border && (flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderConstant)
+            memcpy(this->border, border, this->PixelSize());
+        this->align = align;
+        SetPersInv(this->mat, srcW, srcH, this->inv);
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    WarpPerspective::WarpPerspective(const WarpPersParam& param)
+        : _param(param)
+        , _first(true)
+        , _threads(Base::GetThreadNumber())
+    {
+    }
+
+    void WarpPerspective::InitCoords()
+    {
+        const WarpPersParam& p = _param;
+        size_t xs = p.CoordStride();
+        _coords.Resize(xs * 3 + p.dstH * 3);
+        float* cx = _coords.data, * cy = cx + xs * 3;
+        for (size_t x = 0; x < xs; ++x)
+        {
+            float sx = (float)x;
+            cx[x + 0 * xs] = sx * p.inv[0];
+            cx[x + 1 * xs] = sx * p.inv[3];
+            cx[x + 2 * xs] = sx * p.inv[6];
+        }
+        for (size_t y = 0; y < p.dstH; ++y, cy += 3)
+        {
+            float sy = (float)y;
+            cy[0] = sy * p.inv[1] + p.inv[2];
+            cy[1] = sy * p.inv[4] + p.inv[5];
+            cy[2] = sy * p.inv[7] + p.inv[8];
+        }
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        static void SetPerspectiveRange(const WarpPersParam& p, double uMin, double uMax, double vMin, double vMax, int* beg, int* end)
+        {
+            const float* m = p.inv;
+            double zMin = 0.0000001 * (::fabs(m[6]) * p.dstW + ::fabs(m[7]) * p.dstH + ::fabs(m[8]));
+            for (size_t y = 0; y < p.dstH; ++y)
+            {
+                double lo = 0.0, hi = double(p.dstW) - 1.0;
+                double zx = m[6], z0 = double(m[7]) * y + m[8];
+                double ux = m[0], u0 = double(m[1]) * y + m[2];
+                double vx = m[3], v0 = double(m[4]) * y + m[5];
+                RestrictHalfLine(zx, z0 - zMin, lo, hi);
+                RestrictHalfLine(ux - uMin * zx, u0 - uMin * z0, lo, hi);
+                RestrictHalfLine(uMax * zx - ux, uMax * z0 - u0, lo, hi);
+                RestrictHalfLine(vx - vMin * zx, v0 - vMin * z0, lo, hi);
+                RestrictHalfLine(vMax * zx - vx, vMax * z0 - v0, lo, hi);
+                beg[y] = (int)ceil(lo);
+                end[y] = (int)floor(hi) + 1;
+                if (lo > hi || beg[y] >= end[y])
+                    beg[y] = end[y] = 0;
+            }
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        template<int N> void PerspNearestRun(const WarpPersParam& p, int yBeg, int yEnd, const float* cx, const float* cy, const int32_t* beg, const int32_t* end, const uint8_t* src, uint8_t* dst, uint32_t* buf)
+        {
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW, s = (int)p.srcS, w = (int)p.srcW - 1, h = (int)p.srcH - 1;
+            size_t xs = p.CoordStride();
+            dst += yBeg * p.dstS;
+            for (int y = yBeg; y < yEnd; ++y)
+            {
+                const float* cr = cy + 3 * y;
+                int nose = beg[y], tail = end[y];
+                if (fill)
+                    FillBorder<N>(dst, nose, p.border);
+                if (N == 3)
+                {
+                    int x = nose, tail1 = tail - 1;
+                    for (; x < tail1; ++x)
+                        Base::CopyPixel<4>(src + PerspNearestOffset<3>(x, cx, xs, cr, w, h, s), dst + x * 3);
+                    for (; x < tail; ++x)
+                        Base::CopyPixel<3>(src + PerspNearestOffset<3>(x, cx, xs, cr, w, h, s), dst + x * 3);
+                }
+                else
+                {
+                    for (int x = nose; x < tail; ++x)
+                        CopyPixel<N>(src + PerspNearestOffset<N>(x, cx, xs, cr, w, h, s), dst + x * N);
+                }
+                if (fill)
+                    FillBorder<N>(dst + tail * N, width - tail, p.border);
+                dst += p.dstS;
+            }
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        WarpPerspectiveNearest::WarpPerspectiveNearest(const WarpPersParam& param)
+            : WarpPerspective(param)
+        {
+            switch (_param.channels)
+            {
+            case 1: _run = PerspNearestRun<1>; break;
+            case 2: _run = PerspNearestRun<2>; break;
+            case 3: _run = PerspNearestRun<3>; break;
+            case 4: _run = PerspNearestRun<4>; break;
+            }
+        }
+
+        void WarpPerspectiveNearest::Run(const uint8_t* src, uint8_t* dst)
+        {
+            if (_first)
+                Init();
+
+            Simd::Parallel(0, _param.dstH, [&](size_t thread, size_t begin, size_t end)
+            {
+                _run(_param, (int)begin, (int)end, _coords.data, _coords.data + _param.CoordStride() * 3, _beg.data, _end.data, src, dst, (uint32_t*)(_buf.data + thread * _size));
+            }, _threads, 1);
+
+            _first = false;
+        }
+
+        void WarpPerspectiveNearest::Init()
+        {
+            const WarpPersParam& p = _param;
+            _beg.Resize(p.dstH);
+            _end.Resize(p.dstH);
+            _size = (AlignHi(p.dstW, p.align) + p.align) * 4;
+            _buf.Resize(_size * _threads);
+            SetPerspectiveRange(p, -0.5, p.srcW - 0.5, -0.5, p.srcH - 0.5, _beg.data, _end.data);
+            InitCoords();
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        template<int N> void PerspByteBilinearRun(const WarpPersParam& p, int yBeg, int yEnd, const float* cx, const float* cy, const int* ib, const int* ie, const int* ob, const int* oe, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            constexpr int M = (N == 3 ? 4 : N);
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW, s = (int)p.srcS, w = (int)p.srcW - 1, h = (int)p.srcH - 1;
+            float fw = (float)w, fh = (float)h;
+            size_t wa = AlignHi(p.dstW, p.align) + p.align, xs = p.CoordStride();
+            uint32_t* offs = (uint32_t*)buf;
+            uint8_t* fx = (uint8_t*)(offs + wa);
+            uint16_t* fy = (uint16_t*)(fx + wa * 2);
+            uint8_t* rb0 = (uint8_t*)(fy + wa * 2);
+            uint8_t* rb1 = (uint8_t*)(rb0 + wa * M * 2);
+            dst += yBeg * p.dstS;
+            for (int y = yBeg; y < yEnd; ++y)
+            {
+                const float* cr = cy + 3 * y;
+                int iB = ib[y], iE = ie[y], oB = ob[y], oE = oe[y];
+                if (fill)
+                {
+                    FillBorder<N>(dst, oB, p.border);
+                    for (int x = oB; x < iB; ++x)
+                        PerspByteBilinearInterpEdge<N>(x, cx, xs, cr, w, h, s, src, p.border, dst + x * N);
+                }
+                else
+                {
+                    for (int x = oB; x < iB; ++x)
+                        PerspByteBilinearInterpEdge<N>(x, cx, xs, cr, w, h, s, src, dst + x * N, dst + x * N);
+                }
+                {
+                    for (int x = iB; x < iE; ++x)
+                        PerspByteBilinearPrepMain(x, cx, xs, cr, N, s, fw, fh, offs + x, fx + 2 * x, fy + 2 * x);
+                    ByteBilinearGather<M>(src, src + s, offs + iB, iE - iB, rb0 + 2 * M * iB, rb1 + 2 * M * iB);
+                    for (int x = iB; x < iE; ++x)
+                        Base::ByteBilinearInterpMain<N>(rb0 + x * M * 2, rb1 + x * M * 2, fx + 2 * x, fy + 2 * x, dst + x * N);
+                }
+                if (fill)
+                {
+                    for (int x = iE; x < oE; ++x)
+                        PerspByteBilinearInterpEdge<N>(x, cx, xs, cr, w, h, s, src, p.border, dst + x * N);
+                    FillBorder<N>(dst + oE * N, width - oE, p.border);
+                }
+                else
+                {
+                    for (int x = iE; x < oE; ++x)
+                        PerspByteBilinearInterpEdge<N>(x, cx, xs, cr, w, h, s, src, dst + x * N, dst + x * N);
+                }
+                dst += p.dstS;
+            }
+        }
+
+        //---------------------------------------------------------------------------------------------
+
+        WarpPerspectiveByteBilinear::WarpPerspectiveByteBilinear(const WarpPersParam& param)
+            : WarpPerspective(param)
+        {
+            switch (_param.channels)
+            {
+            case 1: _run = PerspByteBilinearRun<1>; break;
+            case 2: _run = PerspByteBilinearRun<2>; break;
+            case 3: _run = PerspByteBilinearRun<3>; break;
+            case 4: _run = PerspByteBilinearRun<4>; break;
+            }
+        }
+
+        void WarpPerspectiveByteBilinear::Run(const uint8_t* src, uint8_t* dst)
+        {
+            if (_first)
+                Init();
+
+            Simd::Parallel(0, _param.dstH, [&](size_t thread, size_t begin, size_t end)
+            {
+                _run(_param, (int)begin, (int)end, _coords.data, _coords.data + _param.CoordStride() * 3, _ib, _ie, _ob, _oe, src, dst, _buf.data + thread * _size);
+            }, _threads, 1);
+
+            _first = false;
+        }
+
+        void WarpPerspectiveByteBilinear::Init()
+        {
+            const WarpPersParam& p = _param;
+            _range.Resize(p.dstH * 4);
+            _ib = _range.data + 0 * p.dstH;
+            _ie = _range.data + 1 * p.dstH;
+            _ob = _range.data + 2 * p.dstH;
+            _oe = _range.data + 3 * p.dstH;
+            size_t na = (p.channels == 3 ? 4 : p.channels), wa = AlignHi(p.dstW, p.align) + p.align;
+            _size = wa * 10 + wa * na * 4;
+            _buf.Resize(_size * _threads);
+            double e = 0.0001;
+            SetPerspectiveRange(p, -1.0 + e, p.srcW - e, -1.0 + e, p.srcH - e, _ob, _oe);
+            if (p.srcW > 1 && p.srcH > 1)
+                SetPerspectiveRange(p, 0.0, p.srcW - 1.0, 0.0, p.srcH - 1.0, _ib, _ie);
+            else
+                memset(_ib, 0, 2 * p.dstH * sizeof(int));
+            for (size_t y = 0; y < p.dstH; ++y)
+            {
+                if (_ib[y] == _ie[y])
+                    _ib[y] = _ie[y] = _ob[y];
+                _ib[y] = Simd::RestrictRange(_ib[y], _ob[y], _oe[y]);
+                _ie[y] = Simd::RestrictRange(_ie[y], _ib[y], _oe[y]);
+            }
+            InitCoords();
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
+        {
+            WarpPersParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, mat, flags, border, 1);
+            if (!param.Valid())
+                return NULL;
+            if (param.IsNearest())
+                return new WarpPerspectiveNearest(param);
+            else if (param.IsByteBilinear())
+                return new WarpPerspectiveByteBilinear(param);
+            else
+                return NULL;
+        }
+    }
+}
@@ -0,0 +1,166 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdBoxFilter_h__
+#define __SimdBoxFilter_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    struct BoxFilterParam
+    {
+        size_t width;
+        size_t height;
+        size_t channels;
+        SimdBoxFilterChannelType type;
+        size_t radiusX;
+        size_t radiusY;
+        size_t align;
+
+        BoxFilterParam(size_t w, size_t h, size_t c, SimdBoxFilterChannelType t, size_t rx, size_t ry, size_t a);
+        bool Valid() const;
+
+        size_t ChannelSize() const
+        {
+            return type == SimdBoxFilterChannel32f ? 4 : 1;
+        }
+
+        size_t Area() const
+        {
+            return (2 * radiusX + 1) * (2 * radiusY + 1);
+        }
+    };
+
+    class BoxFilter : Deletable
+    {
+    public:
+        BoxFilter(const BoxFilterParam& param);
+
+        virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* mean, size_t meanStride, float* var, size_t varStride) = 0;
+
+    protected:
+        BoxFilterParam _param;
+    };
+
+    namespace Base
+    {
+        struct BoxFilterAlg
+        {
+            size_t size, step, padSize, colBuf, padBuf, bufSize, threads;
+            float norm32f;
+            double norm64f;
+        };
+
+        typedef void (*BoxFilterColUpdate8uPtr)(const uint8_t* add, const uint8_t* sub, size_t size, uint32_t* sum, uint32_t* sqsum);
+        typedef void (*BoxFilterColUpdate32fPtr)(const float* add, const float* sub, size_t size, double* sum, double* sqsum);
+        typedef void (*BoxFilterRow8uPtr)(const uint32_t* sum, const uint32_t* sqsum, size_t size, size_t step, float norm, uint8_t* mean, float* var);
+        typedef void (*BoxFilterRow32fPtr)(const double* sum, const double* sqsum, size_t size, size_t step, double norm, float* mean, float* var);
+
+        class BoxFilterDefault : public Simd::BoxFilter
+        {
+        public:
+            BoxFilterDefault(const BoxFilterParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* mean, size_t meanStride, float* var, size_t varStride);
+
+        protected:
+            template<class S, class T> void Run(const uint8_t* src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t* buf, uint8_t* mean, size_t meanStride, float* var, size_t varStride);
+
+            BoxFilterAlg _alg;
+            Array8u _buffer;
+            BoxFilterColUpdate8uPtr _colUpdate8u;
+            BoxFilterColUpdate32fPtr _colUpdate32f;
+            BoxFilterRow8uPtr _row8u;
+            BoxFilterRow32fPtr _row32f;
+        };
+
+        void* BoxFilterInit(size_t width, size_t height, size_t channels, SimdBoxFilterChannelType type, size_t radiusX, size_t radiusY);
+
+        void BoxFilterColUpdate8u(const uint8_t* add, const uint8_t* sub, size_t size, uint32_t* sum, uint32_t* sqsum);
+
+        template<class S> void BoxFilterPrefix(const S* col, size_t width, size_t channels, size_t radius, S* dst)
+        {
+            for (size_t c = 0; c < channels; ++c)
+                dst[c] = 0;
+            dst += channels;
+            for (size_t x = 0; x < radius; ++x, dst += channels)
+                for (size_t c = 0; c < channels; ++c)
+                    dst[c] = dst[c - channels] + col[c];
+            for (size_t x = 0; x < width; ++x, col += channels, dst += channels)
+                for (size_t c = 0; c < channels; ++c)
+                    dst[c] = dst[c - channels] + col[c];
+            col -= channels;
+            for (size_t x = 0; x < radius; ++x, dst += channels)
+                for (size_t c = 0; c < channels; ++c)
+                    dst[c] = dst[c - channels] + col[c];
+        }
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class BoxFilterDefault : public Base::BoxFilterDefault
+        {
+        public:
+            BoxFilterDefault(const BoxFilterParam& param);
+        };
+
+        void* BoxFilterInit(size_t width, size_t height, size_t channels, SimdBoxFilterChannelType type, size_t radiusX, size_t radiusY);
+
+        void BoxFilterColUpdate8u(const uint8_t* add, const uint8_t* sub, size_t size, uint32_t* sum, uint32_t* sqsum);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class BoxFilterDefault : public Sse41::BoxFilterDefault
+        {
+        public:
+            BoxFilterDefault(const BoxFilterParam& param);
+        };
+
+        void* BoxFilterInit(size_t width, size_t height, size_t channels, SimdBoxFilterChannelType type, size_t radiusX, size_t radiusY);
+
+        void BoxFilterColUpdate8u(const uint8_t* add, const uint8_t* sub, size_t size, uint32_t* sum, uint32_t* sqsum);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class BoxFilterDefault : public Avx2::BoxFilterDefault
+        {
+        public:
+            BoxFilterDefault(const BoxFilterParam& param);
+        };
+
+        void* BoxFilterInit(size_t width, size_t height, size_t channels, SimdBoxFilterChannelType type, size_t radiusX, size_t radiusY);
+
+        void BoxFilterColUpdate8u(const uint8_t* add, const uint8_t* sub, size_t size, uint32_t* sum, uint32_t* sqsum);
+    }
+#endif
+}
+#endif//__SimdBoxFilter_h__
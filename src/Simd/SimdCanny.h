@@ -0,0 +1,138 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdCanny_h__
+#define __SimdCanny_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+#include <vector>
+
+namespace Simd
+{
+    struct CannyParam
+    {
+        size_t width;
+        size_t height;
+        float lowThreshold;
+        float highThreshold;
+
+        CannyParam(size_t w, size_t h, float lt, float ht);
+        bool Valid() const;
+    };
+
+    class Canny : Deletable
+    {
+    public:
+        Canny(const CannyParam& param);
+
+        virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride) = 0;
+
+    protected:
+        CannyParam _param;
+    };
+
+    namespace Base
+    {
+        const int CANNY_MAGNITUDE_MAX = 8 * 255;
+        const int CANNY_TAN_22_5 = 27146;
+
+        enum CannyMapValue
+        {
+            CannyMapNone = 0,
+            CannyMapWeak = 1,
+            CannyMapStrong = 2,
+            CannyMapEdge = 3,
+        };
+
+        typedef void (*CannySobelPtr)(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride);
+        typedef void (*CannyMagnitudePtr)(const int16_t* dx, const int16_t* dy, size_t width, int16_t* mag);
+        typedef void (*CannyNmsPtr)(const int16_t* dx, const int16_t* dy, const int16_t* mag0, const int16_t* mag1, const int16_t* mag2, size_t width, int16_t low, int16_t high, uint8_t* map);
+        typedef void (*CannyOutputPtr)(const uint8_t* map, size_t width, uint8_t* dst);
+
+        class CannyDefault : public Simd::Canny
+        {
+        public:
+            CannyDefault(const CannyParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        protected:
+            void Band(const uint8_t* src, size_t srcStride, size_t yBeg, size_t yEnd, int16_t* buf);
+            void Hysteresis();
+
+            size_t _band, _threads, _gradStride, _magStride, _mapStride, _bufSize;
+            int16_t _low, _high;
+            Array8u _map;
+            Array16i _buffer;
+            std::vector<uint8_t*> _stack;
+            CannySobelPtr _sobelDx, _sobelDy;
+            CannyMagnitudePtr _magnitude;
+            CannyNmsPtr _nms;
+            CannyOutputPtr _output;
+        };
+
+        void* CannyInit(size_t width, size_t height, float lowThreshold, float highThreshold);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class CannyDefault : public Base::CannyDefault
+        {
+        public:
+            CannyDefault(const CannyParam& param);
+        };
+
+        void* CannyInit(size_t width, size_t height, float lowThreshold, float highThreshold);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class CannyDefault : public Sse41::CannyDefault
+        {
+        public:
+            CannyDefault(const CannyParam& param);
+        };
+
+        void* CannyInit(size_t width, size_t height, float lowThreshold, float highThreshold);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class CannyDefault : public Avx2::CannyDefault
+        {
+        public:
+            CannyDefault(const CannyParam& param);
+        };
+
+        void* CannyInit(size_t width, size_t height, float lowThreshold, float highThreshold);
+    }
+#endif
+}
+#endif//__SimdCanny_h__
@@ -0,0 +1,132 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdClahe_h__
+#define __SimdClahe_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    struct ClaheParam
+    {
+        size_t width;
+        size_t height;
+        size_t tilesX;
+        size_t tilesY;
+        float clipLimit;
+
+        ClaheParam(size_t w, size_t h, size_t tx, size_t ty, float cl);
+        bool Valid() const;
+    };
+
+    class Clahe : Deletable
+    {
+    public:
+        Clahe(const ClaheParam& param);
+
+        virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride) = 0;
+
+    protected:
+        ClaheParam _param;
+    };
+
+    namespace Base
+    {
+        const int CLAHE_SHIFT = 8;
+        const int CLAHE_RANGE = 1 << CLAHE_SHIFT;
+        const int CLAHE_ROUND = 1 << (2 * CLAHE_SHIFT - 1);
+
+        typedef void (*ClaheInterpolatePtr)(const uint8_t* src, size_t width, const int32_t* ix0, const int32_t* ix1, const int32_t* wx,
+            const int32_t* lut0, const int32_t* lut1, int32_t wy, uint8_t* dst);
+
+        SIMD_INLINE uint8_t ClaheInterpolate(int v, int32_t ix0, int32_t ix1, int32_t wx, const int32_t* lut0, const int32_t* lut1, int32_t wy)
+        {
+            int32_t a = lut0[ix0 + v], b = lut0[ix1 + v];
+            int32_t c = lut1[ix0 + v], d = lut1[ix1 + v];
+            int32_t top = (a << CLAHE_SHIFT) + (b - a) * wx;
+            int32_t bot = (c << CLAHE_SHIFT) + (d - c) * wx;
+            return uint8_t(((top << CLAHE_SHIFT) + (bot - top) * wy + CLAHE_ROUND) >> (2 * CLAHE_SHIFT));
+        }
+
+        class ClaheDefault : public Simd::Clahe
+        {
+        public:
+            ClaheDefault(const ClaheParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        protected:
+            void BuildLut(const uint8_t* src, size_t srcStride, size_t tx, size_t ty);
+
+            size_t _lutThreads, _runThreads;
+
+            Array32i _lut, _ix0, _ix1, _wx, _iy0, _iy1, _wy;
+            Array32u _bx, _by;
+            ClaheInterpolatePtr _interpolate;
+        };
+
+        void* ClaheInit(size_t width, size_t height, size_t tilesX, size_t tilesY, float clipLimit);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class ClaheDefault : public Base::ClaheDefault
+        {
+        public:
+            ClaheDefault(const ClaheParam& param);
+        };
+
+        void* ClaheInit(size_t width, size_t height, size_t tilesX, size_t tilesY, float clipLimit);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class ClaheDefault : public Sse41::ClaheDefault
+        {
+        public:
+            ClaheDefault(const ClaheParam& param);
+        };
+
+        void* ClaheInit(size_t width, size_t height, size_t tilesX, size_t tilesY, float clipLimit);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class ClaheDefault : public Avx2::ClaheDefault
+        {
+        public:
+            ClaheDefault(const ClaheParam& param);
+        };
+
+        void* ClaheInit(size_t width, size_t height, size_t tilesX, size_t tilesY, float clipLimit);
+    }
+#endif
+}
+#endif//__SimdClahe_h__
@@ -0,0 +1,171 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdConnectedComponents_h__
+#define __SimdConnectedComponents_h__
+
+#include "Simd/SimdMemory.h"
+
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Simd
+{
+    struct ConnectedComponentsParam
+    {
+        size_t width;
+        size_t height;
+        SimdConnectivityType connectivity;
+        bool moments;
+
+        ConnectedComponentsParam(size_t w, size_t h, SimdConnectivityType c, SimdBool m);
+        bool Valid() const;
+    };
+
+    class ConnectedComponents : Deletable
+    {
+    public:
+        ConnectedComponents(const ConnectedComponentsParam& param);
+
+        virtual size_t Run(const uint8_t* mask, size_t maskStride, uint8_t index, uint32_t* labels, size_t labelsStride, 
+            const SimdConnectedComponent** components) = 0;
+
+    protected:
+        ConnectedComponentsParam _param;
+        std::vector<SimdConnectedComponent> _components;
+    };
+
+    namespace Base
+    {
+        SIMD_INLINE size_t ConnectedComponentsFirstBit(uint32_t bits)
+        {
+#if defined(_MSC_VER)
+            unsigned long index;
+            _BitScanForward(&index, bits);
+            return index;
+#else
+            return __builtin_ctz(bits);
+#endif
+        }
+
+        template<int N> SIMD_INLINE int32_t* ConnectedComponentsEdges(uint32_t bits, int32_t x, uint32_t& inside, int32_t* runs)
+        {
+            uint32_t edges = (bits ^ ((bits << 1) | inside)) & (uint32_t(-1) >> (32 - N));
+            for (; edges; edges &= edges - 1)
+                *runs++ = x + int32_t(ConnectedComponentsFirstBit(edges));
+            inside = (bits >> (N - 1)) & 1;
+            return runs;
+        }
+
+        SIMD_INLINE int32_t* ConnectedComponentsEdges(const uint8_t* mask, size_t beg, size_t end, uint8_t index, uint32_t& inside, int32_t* runs)
+        {
+            for (size_t x = beg; x < end; ++x)
+            {
+                uint32_t bit = mask[x] == index ? 1 : 0;
+                if (bit != inside)
+                {
+                    *runs++ = int32_t(x);
+                    inside = bit;
+                }
+            }
+            return runs;
+        }
+
+        //---------------------------------------------------------------------
+
+        typedef size_t (*ConnectedComponentsRunsPtr)(const uint8_t* mask, size_t width, uint8_t index, int32_t* runs);
+
+        class ConnectedComponentsDefault : public Simd::ConnectedComponents
+        {
+        public:
+            ConnectedComponentsDefault(const ConnectedComponentsParam& param);
+
+            virtual size_t Run(const uint8_t* mask, size_t maskStride, uint8_t index, uint32_t* labels, size_t labelsStride,
+                const SimdConnectedComponent** components);
+
+        protected:
+            struct Strip
+            {
+                size_t yBeg, yEnd, offset;
+                std::vector<int32_t> runs, buf;
+                std::vector<uint32_t> rows, parent;
+            };
+
+            void LabelStrip(const uint8_t* mask, size_t maskStride, uint8_t index, Strip& strip);
+            void MergeRows(const int32_t* a, size_t aN, uint32_t aIdx, const int32_t* b, size_t bN, uint32_t bIdx, uint32_t* parent) const;
+            size_t SetLabels();
+            void Statistic(size_t count);
+            void FillLabels(const Strip& strip, uint32_t* labels, size_t labelsStride) const;
+
+            size_t _threads;
+            std::vector<Strip> _strips;
+            std::vector<uint32_t> _parent, _label;
+            ConnectedComponentsRunsPtr _runs;
+        };
+
+        void* ConnectedComponentsInit(size_t width, size_t height, SimdConnectivityType connectivity, SimdBool moments);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class ConnectedComponentsDefault : public Base::ConnectedComponentsDefault
+        {
+        public:
+            ConnectedComponentsDefault(const ConnectedComponentsParam& param);
+        };
+
+        void* ConnectedComponentsInit(size_t width, size_t height, SimdConnectivityType connectivity, SimdBool moments);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class ConnectedComponentsDefault : public Sse41::ConnectedComponentsDefault
+        {
+        public:
+            ConnectedComponentsDefault(const ConnectedComponentsParam& param);
+        };
+
+        void* ConnectedComponentsInit(size_t width, size_t height, SimdConnectivityType connectivity, SimdBool moments);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class ConnectedComponentsDefault : public Avx2::ConnectedComponentsDefault
+        {
+        public:
+            ConnectedComponentsDefault(const ConnectedComponentsParam& param);
+        };
+
+        void* ConnectedComponentsInit(size_t width, size_t height, SimdConnectivityType connectivity, SimdBool moments);
+    }
+#endif
+}
+#endif//__SimdConnectedComponents_h__
@@ -0,0 +1,185 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdDistanceTransform_h__
+#define __SimdDistanceTransform_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    struct DistanceTransformParam
+    {
+        size_t width;
+        size_t height;
+        SimdDistanceTransformType type;
+        SimdDistanceTransformDataType data;
+
+        DistanceTransformParam(size_t w, size_t h, SimdDistanceTransformType t, SimdDistanceTransformDataType d);
+        bool Valid() const;
+    };
+
+    class DistanceTransform : Deletable
+    {
+    public:
+        DistanceTransform(const DistanceTransformParam& param);
+
+        virtual void Run(const uint8_t* mask, size_t maskStride, uint8_t index, uint8_t* dst, size_t dstStride) = 0;
+
+    protected:
+        DistanceTransformParam _param;
+    };
+
+    namespace Base
+    {
+        const int32_t DISTANCE_CHAMFER_INF = 1 << 29;
+
+        template<bool root> SIMD_INLINE float DistanceValue(int32_t distance, float scale)
+        {
+            float value = float(distance);
+            if (root)
+                value = ::sqrtf(value);
+            return value / scale;
+        }
+
+        template<class T> SIMD_INLINE T DistanceStore(float value);
+
+        template<> SIMD_INLINE float DistanceStore<float>(float value)
+        {
+            return value;
+        }
+
+        template<> SIMD_INLINE uint16_t DistanceStore<uint16_t>(float value)
+        {
+            return uint16_t(Simd::Min(value + 0.5f, 65535.0f));
+        }
+
+        //---------------------------------------------------------------------
+
+        typedef void (*DistanceConvertPtr)(const int32_t* src, size_t width, float scale, uint8_t* dst);
+
+        typedef void (*DistanceEdtColumnsPtr)(const uint8_t* mask, size_t maskStride, size_t width, size_t height, 
+            uint8_t index, int32_t limit, int32_t* dst, size_t dstStride);
+
+        class DistanceTransformEdt : public Simd::DistanceTransform
+        {
+        public:
+            DistanceTransformEdt(const DistanceTransformParam& param);
+
+            virtual void Run(const uint8_t* mask, size_t maskStride, uint8_t index, uint8_t* dst, size_t dstStride);
+
+        protected:
+            void RowPass(const int32_t* g, int32_t* v, int64_t* zn, int32_t* zd, int32_t* d2) const;
+
+            size_t _colThreads, _rowThreads;
+            Array32i _g, _buf;
+            Array<int64_t> _zn;
+            DistanceEdtColumnsPtr _columns;
+            DistanceConvertPtr _convert;
+        };
+
+        //---------------------------------------------------------------------
+
+        typedef void (*DistanceChamferInitPtr)(const uint8_t* mask, size_t width, uint8_t index, int32_t* dst);
+
+        typedef void (*DistanceChamferRowPtr)(const int32_t* row1, const int32_t* row2, size_t width, const int32_t* weights, int32_t* dst);
+
+        class DistanceTransformChamfer : public Simd::DistanceTransform
+        {
+        public:
+            DistanceTransformChamfer(const DistanceTransformParam& param);
+
+            virtual void Run(const uint8_t* mask, size_t maskStride, uint8_t index, uint8_t* dst, size_t dstStride);
+
+        protected:
+            size_t _threads, _tiles, _stride;
+            int32_t _weights[3];
+            float _scale;
+            Array32i _buf;
+            DistanceChamferInitPtr _init;
+            DistanceChamferRowPtr _row;
+            DistanceConvertPtr _convert;
+        };
+
+        void* DistanceTransformInit(size_t width, size_t height, SimdDistanceTransformType type, SimdDistanceTransformDataType data);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class DistanceTransformEdt : public Base::DistanceTransformEdt
+        {
+        public:
+            DistanceTransformEdt(const DistanceTransformParam& param);
+        };
+
+        class DistanceTransformChamfer : public Base::DistanceTransformChamfer
+        {
+        public:
+            DistanceTransformChamfer(const DistanceTransformParam& param);
+        };
+
+        void* DistanceTransformInit(size_t width, size_t height, SimdDistanceTransformType type, SimdDistanceTransformDataType data);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class DistanceTransformEdt : public Sse41::DistanceTransformEdt
+        {
+        public:
+            DistanceTransformEdt(const DistanceTransformParam& param);
+        };
+
+        class DistanceTransformChamfer : public Sse41::DistanceTransformChamfer
+        {
+        public:
+            DistanceTransformChamfer(const DistanceTransformParam& param);
+        };
+
+        void* DistanceTransformInit(size_t width, size_t height, SimdDistanceTransformType type, SimdDistanceTransformDataType data);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class DistanceTransformEdt : public Avx2::DistanceTransformEdt
+        {
+        public:
+            DistanceTransformEdt(const DistanceTransformParam& param);
+        };
+
+        class DistanceTransformChamfer : public Avx2::DistanceTransformChamfer
+        {
+        public:
+            DistanceTransformChamfer(const DistanceTransformParam& param);
+        };
+
+        void* DistanceTransformInit(size_t width, size_t height, SimdDistanceTransformType type, SimdDistanceTransformDataType data);
+    }
+#endif
+}
+#endif//__SimdDistanceTransform_h__
@@ -0,0 +1,144 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdFileMapping_h__
+#define __SimdFileMapping_h__
+
+#include "Simd/SimdDefs.h"
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__GNUC__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#else
+#error Platform is not supported!
+#endif
+
+namespace Simd
+{
+    class InputFileMapping
+    {
+        const uint8_t* _data;
+        size_t _size;
+#if defined(_WIN32)
+        HANDLE _file, _mapping;
+#else
+        int _file;
+#endif
+
+    public:
+        SIMD_INLINE InputFileMapping()
+            : _data(NULL)
+            , _size(0)
+#if defined(_WIN32)
+            , _file(INVALID_HANDLE_VALUE)
+            , _mapping(NULL)
+#else
+            , _file(-1)
+#endif
+        {
+        }
+
+        SIMD_INLINE ~InputFileMapping()
+        {
+            Close();
+        }
+
+        SIMD_INLINE bool Open(const char* path)
+        {
+            Close();
+#if defined(_WIN32)
+            _file = ::CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+            if (_file == INVALID_HANDLE_VALUE)
+                return false;
+            LARGE_INTEGER size;
+            if (!::GetFileSizeEx(_file, &size) || size.QuadPart == 0 || uint64_t(size.QuadPart) > uint64_t(SIZE_MAX))
+                return Close();
+            _size = (size_t)size.QuadPart;
+            _mapping = ::CreateFileMappingA(_file, NULL, PAGE_READONLY, 0, 0, NULL);
+            if (_mapping == NULL)
+                return Close();
+            _data = (const uint8_t*)::MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0);
+            if (_data == NULL)
+                return Close();
+#else
+            _file = ::open(path, O_RDONLY);
+            if (_file == -1)
+                return false;
+            struct stat info;
+            if (::fstat(_file, &info) != 0 || info.st_size <= 0 || uint64_t(info.st_size) > uint64_t(SIZE_MAX))
+                return Close();
+            _size = (size_t)info.st_size;
+            void* data = ::mmap(NULL, _size, PROT_READ, MAP_PRIVATE, _file, 0);
+            if (data == MAP_FAILED)
+                return Close();
+            _data = (const uint8_t*)data;
+#if defined(MADV_SEQUENTIAL)
+            ::madvise(data, _size, MADV_SEQUENTIAL);
+#endif
+#endif
+            return true;
+        }
+
+        SIMD_INLINE bool Close()
+        {
+#if defined(_WIN32)
+            if (_data)
+                ::UnmapViewOfFile(_data);
+            if (_mapping)
+                ::CloseHandle(_mapping);
+            if (_file != INVALID_HANDLE_VALUE)
+                ::CloseHandle(_file);
+            _mapping = NULL;
+            _file = INVALID_HANDLE_VALUE;
+#else
+            if (_data)
+                ::munmap((void*)_data, _size);
+            if (_file != -1)
+                ::close(_file);
+            _file = -1;
+#endif
+            _data = NULL;
+            _size = 0;
+            return false;
+        }
+
+        SIMD_INLINE const uint8_t* Data() const
+        {
+            return _data;
+        }
+
+        SIMD_INLINE size_t Size() const
+        {
+            return _size;
+        }
+    };
+}
+
+#endif//__SimdFileMapping_h__
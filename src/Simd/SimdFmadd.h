@@ -103,6 +103,24 @@ namespace Simd
             return _mm512_add_ps(_mm512_fmadd_ps(a, b, _mm512_setzero_ps()), c);
 #else
             return _mm512_maskz_add_ps(-1, _mm512_mul_ps(a, b), c);
+#endif
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        template<bool nofma> __m512 Fmadd(__m512 a, __m512 b, __m512 c, const __m512& d);
+
+        template <> SIMD_INLINE __m512 Fmadd<false>(__m512 a, __m512 b, __m512 c, const __m512& d)
+        {
+            return _mm512_fmadd_ps(a, b, _mm512_mul_ps(c, d));
+        }
+
+        template <> SIMD_INLINE __m512 Fmadd<true>(__m512 a, __m512 b, __m512 c, const __m512& d)
+        {
+#ifdef _MSC_VER
+            return _mm512_add_ps(_mm512_fmadd_ps(a, b, _mm512_setzero_ps()), _mm512_fmadd_ps(c, d, _mm512_setzero_ps()));
+#else
+            return _mm512_maskz_add_ps(-1, _mm512_mul_ps(a, b), _mm512_mul_ps(c, d));
 #endif
         }
     }
@@ -35,12 +35,35 @@ namespace Simd
         size_t width;
         size_t height;
         size_t channels;
+        SimdGaussianBlurChannelType type;
         float sigma;
         float epsilon;
+        SimdGaussianBlurMethod method;
         size_t align;
 
         BlurParam(size_t w, size_t h, size_t c, const float* s, const float * e, size_t a);
+        BlurParam(size_t w, size_t h, size_t c, SimdGaussianBlurChannelType t, const float* s, const float* e, SimdGaussianBlurMethod m, size_t a);
         bool Valid() const;
+
+        size_t ChannelSize() const
+        {
+            return type == SimdGaussianBlurChannel32f ? 4 : (type == SimdGaussianBlurChannel16u ? 2 : 1);
+        }
+
+        size_t PixelSize() const
+        {
+            return ChannelSize() * channels;
+        }
+
+        size_t Half() const
+        {
+            return (size_t)::floor(::sqrt(-::log(epsilon)) * sigma);
+        }
+
+        bool Iir() const
+        {
+            return sigma >= 0.5f && (method == SimdGaussianBlurIir || (method == SimdGaussianBlurAuto && Half() > 15));
+        }
     };
 
     class GaussianBlur : Deletable
@@ -56,6 +79,25 @@ namespace Simd
 
     namespace Base
     {
+        template<class T> SIMD_INLINE T BlurConvert(float value);
+
+        template<> SIMD_INLINE uint8_t BlurConvert<uint8_t>(float value)
+        {
+            return (uint8_t)Simd::RestrictRange(Round(value), 0, 255);
+        }
+
+        template<> SIMD_INLINE uint16_t BlurConvert<uint16_t>(float value)
+        {
+            return (uint16_t)Simd::RestrictRange(Round(value), 0, 65535);
+        }
+
+        template<> SIMD_INLINE float BlurConvert<float>(float value)
+        {
+            return value;
+        }
+
+        //---------------------------------------------------------------------
+
         template<int channels> SIMD_INLINE void PadCols(const uint8_t* src, size_t half, size_t size, uint8_t* dst)
         {
             for (size_t x = 0; x < half; x += 1, dst += channels)
@@ -69,12 +111,12 @@ namespace Simd
 
         struct AlgDefault
         {
-            size_t half, kernel, edge, start, size, stride, nose, body;
+            size_t half, kernel, edge, start, size, stride, colsSize, rowsSize, threads;
             Array32f weight;
         };
 
-        typedef void (*BlurDefaultPtr)(const BlurParam& p, const AlgDefault& a, const uint8_t* src, 
-            size_t srcStride, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride);
+        typedef void (*BlurDefaultPtr)(const BlurParam& p, const AlgDefault& a, const uint8_t* src, size_t srcStride, 
+            size_t yBeg, size_t yEnd, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride);
 
         class GaussianBlurDefault : public Simd::GaussianBlur
         {
@@ -90,7 +132,40 @@ namespace Simd
             BlurDefaultPtr _blur;
         };
 
+        //---------------------------------------------------------------------
+
+        struct AlgIir
+        {
+            size_t size, stride, hThreads, vThreads;
+            float b, a1, a2, a3, m[9];
+        };
+
+        typedef void (*BlurIirHorPtr)(const AlgIir& a, size_t width, const uint8_t* src, float* buf, float* dst);
+        typedef void (*BlurIirVerPtr)(const AlgIir& a, size_t size, size_t height, float* img, size_t stride, float* buf, uint8_t* dst, size_t dstStride);
+
+        class GaussianBlurIir : public Simd::GaussianBlur
+        {
+        public:
+            GaussianBlurIir(const BlurParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        protected:
+            size_t VerBlockBeg(size_t block) const
+            {
+                return block == _alg.vThreads ? _alg.size : AlignLo(_alg.size * block / _alg.vThreads, 64);
+            }
+
+            AlgIir _alg;
+            Array32f _buffer;
+            BlurIirHorPtr _hor;
+            BlurIirVerPtr _ver;
+        };
+
         void * GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
+
+        void* GaussianBlurInitEx(size_t width, size_t height, size_t channels, SimdGaussianBlurChannelType type, 
+            const float* sigma, const float* epsilon, SimdGaussianBlurMethod method);
     }
 
 #ifdef SIMD_SSE41_ENABLE    
@@ -102,7 +177,16 @@ namespace Simd
             GaussianBlurDefault(const BlurParam& param);
         };
 
+        class GaussianBlurIir : public Base::GaussianBlurIir
+        {
+        public:
+            GaussianBlurIir(const BlurParam& param);
+        };
+
         void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
+
+        void* GaussianBlurInitEx(size_t width, size_t height, size_t channels, SimdGaussianBlurChannelType type,
+            const float* sigma, const float* epsilon, SimdGaussianBlurMethod method);
     }
 #endif //SIMD_SSE41_ENABLE
 
@@ -115,7 +199,16 @@ namespace Simd
             GaussianBlurDefault(const BlurParam& param);
         };
 
+        class GaussianBlurIir : public Sse41::GaussianBlurIir
+        {
+        public:
+            GaussianBlurIir(const BlurParam& param);
+        };
+
         void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
+
+        void* GaussianBlurInitEx(size_t width, size_t height, size_t channels, SimdGaussianBlurChannelType type,
+            const float* sigma, const float* epsilon, SimdGaussianBlurMethod method);
     }
 #endif //SIMD_AVX2_ENABLE
 
@@ -128,7 +221,16 @@ namespace Simd
             GaussianBlurDefault(const BlurParam& param);
         };
 
+        class GaussianBlurIir : public Avx2::GaussianBlurIir
+        {
+        public:
+            GaussianBlurIir(const BlurParam& param);
+        };
+
         void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
+
+        void* GaussianBlurInitEx(size_t width, size_t height, size_t channels, SimdGaussianBlurChannelType type,
+            const float* sigma, const float* epsilon, SimdGaussianBlurMethod method);
     }
 #endif //SIMD_AVX512BW_ENABLE
 
@@ -142,6 +244,9 @@ namespace Simd
         };
 
         void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon);
+
+        void* GaussianBlurInitEx(size_t width, size_t height, size_t channels, SimdGaussianBlurChannelType type,
+            const float* sigma, const float* epsilon, SimdGaussianBlurMethod method);
     }
 #endif //SIMD_NEON_ENABLE
 }
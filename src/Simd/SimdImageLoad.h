@@ -84,6 +84,43 @@ namespace Simd
         }
     };
 
+    //-------------------------------------------------------------------------
+
+    class InputFileMapping;
+
+    class ImageBandLoader : public Deletable
+    {
+    protected:
+        InputFileMapping* _mapping;
+        ImageLoaderParam _param;
+        InputMemoryStream _stream;
+        size_t _width, _height, _row;
+
+    public:
+        ImageBandLoader(InputFileMapping* mapping, const ImageLoaderParam& param);
+
+        virtual ~ImageBandLoader();
+
+        virtual bool ReadHeader() = 0;
+
+        virtual size_t Run(uint8_t* dst, size_t stride, size_t rows) = 0;
+
+        SIMD_INLINE size_t Width() const
+        {
+            return _width;
+        }
+
+        SIMD_INLINE size_t Height() const
+        {
+            return _height;
+        }
+
+        SIMD_INLINE SimdPixelFormatType Format() const
+        {
+            return _param.format;
+        }
+    };
+
     namespace Base
     {
         class ImagePxmLoader : public ImageLoader
@@ -203,9 +240,74 @@ namespace Simd
             virtual bool FromStream();
         };
 
+        class ImageQoiLoader : public ImageLoader
+        {
+        public:
+            ImageQoiLoader(const ImageLoaderParam& param);
+
+            virtual bool FromStream();
+
+        protected:
+            typedef void (*ConverterPtr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* dst, size_t dstStride);
+            ConverterPtr _converter;
+            Array8u _buffer;
+            size_t _channels;
+
+            bool ReadHeader();
+            virtual void SetConverters();
+        };
+
+        class ImagePxmBandLoader : public ImageBandLoader
+        {
+        public:
+            ImagePxmBandLoader(InputFileMapping* mapping, const ImageLoaderParam& param);
+
+            virtual bool ReadHeader();
+
+            virtual size_t Run(uint8_t* dst, size_t stride, size_t rows);
+
+        protected:
+            typedef void (*ToAnyPtr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* dst, size_t dstStride);
+            typedef void (*ToBgraPtr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* bgra, size_t bgraStride, uint8_t alpha);
+            ToAnyPtr _toAny;
+            ToBgraPtr _toBgra;
+            size_t _size;
+        };
+
+        class ImagePngBandLoader : public ImageBandLoader
+        {
+        public:
+            ImagePngBandLoader(InputFileMapping* mapping, const ImageLoaderParam& param);
+
+            virtual bool ReadHeader();
+
+            virtual size_t Run(uint8_t* dst, size_t stride, size_t rows);
+
+        protected:
+            struct Chunk
+            {
+                size_t offs, size;
+            };
+            typedef std::vector<Chunk> Chunks;
+
+            ImagePngLoader::DecodeLinePtr _decodeLine[7];
+            ImagePngLoader::ConverterPtr _converter;
+            size_t _channels, _size, _idat, _idatPos, _lookahead, _zPos;
+            Chunks _idats;
+            Array8u _zSrc, _prev, _curr;
+            InputMemoryStream _zIs;
+            OutputMemoryStream _zDst;
+            bool _final;
+
+            bool AppendData(size_t size);
+            bool DecodeBlock();
+        };
+
         //---------------------------------------------------------------------
 
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        void* ImageLoadBandInit(const char* path, SimdPixelFormatType* format, size_t* width, size_t* height);
     }
 
 #ifdef SIMD_SSE41_ENABLE    
@@ -263,6 +365,15 @@ namespace Simd
             virtual bool FromStream();
         };
 
+        class ImageQoiLoader : public Base::ImageQoiLoader
+        {
+        public:
+            ImageQoiLoader(const ImageLoaderParam& param);
+
+        protected:
+            virtual void SetConverters();
+        };
+
         //---------------------------------------------------------------------
 
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
@@ -308,6 +419,15 @@ namespace Simd
             virtual void SetConverters();
         };
 
+        class ImageQoiLoader : public Sse41::ImageQoiLoader
+        {
+        public:
+            ImageQoiLoader(const ImageLoaderParam& param);
+
+        protected:
+            virtual void SetConverters();
+        };
+
         //---------------------------------------------------------------------
 
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
@@ -0,0 +1,105 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdImageQoi_h__
+#define __SimdImageQoi_h__
+
+#include "Simd/SimdDefs.h"
+
+namespace Simd
+{
+    const size_t QOI_HEADER_SIZE = 14;
+    const size_t QOI_PADDING_SIZE = 8;
+    const size_t QOI_RUN_MAX = 62;
+    const size_t QOI_PIXELS_MAX = 400000000;
+
+    const uint8_t QOI_OP_INDEX = 0x00;
+    const uint8_t QOI_OP_DIFF = 0x40;
+    const uint8_t QOI_OP_LUMA = 0x80;
+    const uint8_t QOI_OP_RUN = 0xC0;
+    const uint8_t QOI_OP_RGB = 0xFE;
+    const uint8_t QOI_OP_RGBA = 0xFF;
+    const uint8_t QOI_MASK_2 = 0xC0;
+
+    const uint8_t QOI_MAGIC[4] = { 'q', 'o', 'i', 'f' };
+    const uint8_t QOI_PADDING[QOI_PADDING_SIZE] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        SIMD_INLINE uint8_t QoiHash(const uint8_t* rgba)
+        {
+            return uint8_t((rgba[0] * 3 + rgba[1] * 5 + rgba[2] * 7 + rgba[3] * 11) & 63);
+        }
+
+        SIMD_INLINE uint16_t QoiDiff(uint32_t pixel, uint32_t prev)
+        {
+            if (pixel == prev)
+                return 0;
+            const uint8_t* c = (uint8_t*)&pixel, * p = (uint8_t*)&prev;
+            if (c[3] != p[3])
+                return QOI_OP_RGBA;
+            int8_t vr = c[0] - p[0];
+            int8_t vg = c[1] - p[1];
+            int8_t vb = c[2] - p[2];
+            int8_t vgr = vr - vg;
+            int8_t vgb = vb - vg;
+            if (vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2)
+                return uint16_t(QOI_OP_DIFF | (vr + 2) << 4 | (vg + 2) << 2 | (vb + 2));
+            if (vgr > -9 && vgr < 8 && vg > -33 && vg < 32 && vgb > -9 && vgb < 8)
+                return uint16_t((QOI_OP_LUMA | (vg + 32)) | ((vgr + 8) << 4 | (vgb + 8)) << 8);
+            return QOI_OP_RGB;
+        }
+
+        void QoiHashRow(const uint8_t* rgba, size_t size, uint8_t* hash);
+
+        size_t QoiRunLength(const uint32_t* rgba, size_t size, uint32_t value);
+
+        void QoiDiffRow(const uint32_t* rgba, size_t size, uint32_t prev, uint16_t* diff);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        void QoiHashRow(const uint8_t* rgba, size_t size, uint8_t* hash);
+
+        size_t QoiRunLength(const uint32_t* rgba, size_t size, uint32_t value);
+
+        void QoiDiffRow(const uint32_t* rgba, size_t size, uint32_t prev, uint16_t* diff);
+    }
+#endif// SIMD_SSE41_ENABLE
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void QoiHashRow(const uint8_t* rgba, size_t size, uint8_t* hash);
+
+        size_t QoiRunLength(const uint32_t* rgba, size_t size, uint32_t value);
+
+        void QoiDiffRow(const uint32_t* rgba, size_t size, uint32_t prev, uint16_t* diff);
+    }
+#endif// SIMD_AVX2_ENABLE
+}
+
+#endif//__SimdImageQoi_h__
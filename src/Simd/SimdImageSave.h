@@ -28,11 +28,13 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdPerformance.h"
 
+#include <stdio.h>
+
 namespace Simd
 {
     typedef uint8_t* (*ImageSaveToMemoryPtr)(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, size_t* size);
 
-    SimdBool ImageSaveToFile(const ImageSaveToMemoryPtr saver, const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, const char* path);
+    typedef SimdBool (*ImageSaveToFilePtr)(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, const char* path);
 
     //---------------------------------------------------------------------
 
@@ -64,6 +66,8 @@ namespace Simd
             this->yuvType = yuvType;
         }
 
+        void SetFileByPath(const char* path);
+
         SIMD_INLINE bool Validate()
         {
             if (file == SimdImageFileUndefined)
@@ -87,25 +91,47 @@ namespace Simd
                 if (width % 2 != 0 || height % 2 != 0)
                     return false;
             }
-            if (file <= SimdImageFileUndefined || file > SimdImageFileJpeg)
+            if (file <= SimdImageFileUndefined || file > SimdImageFileQoi)
                 return false;
             return true;
         }
     };
 
-    class ImageSaver
+    class ImageSaver : public Deletable
     {
     protected:
         ImageSaverParam _param;
         OutputMemoryStream _stream;
+        ::FILE* _file;
+        size_t _flush;
+        bool _error;
+
+        void FlushToFile();
+
+        SIMD_INLINE void Flush()
+        {
+            if (_file && _stream.Pos() >= _flush)
+                FlushToFile();
+        }
+
+        SIMD_INLINE void Reserve(size_t size)
+        {
+            _stream.Reserve(_file ? Simd::Min(size, _flush * 2) : size);
+        }
+
     public:
         ImageSaver(const ImageSaverParam& param)
             : _param(param)
+            , _file(NULL)
+            , _flush(0)
+            , _error(false)
         {
         }
 
         virtual ~ImageSaver()
         {
+            if (_file)
+                ::fclose(_file);
         }
 
         virtual bool ToStream(const uint8_t* src, size_t stride) = 0;
@@ -114,7 +140,15 @@ namespace Simd
         {
             return _stream.Release(size);
         }
+
+        bool Open(const char* path);
+
+        bool Close();
     };
+
+    typedef ImageSaver* (*ImageSaverFactoryPtr)(const ImageSaverParam& param);
+
+    SimdBool ImageSaveToFile(ImageSaverFactoryPtr factory, const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, const char* path);
        
     namespace Base
     {
@@ -176,7 +210,7 @@ namespace Simd
             static const int TYPES = 7;
             typedef void (*ConvertPtr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* dst, size_t dstStride);
             typedef uint32_t (*EncodePtr)(const uint8_t* src, size_t stride, size_t n, size_t size, int8_t* dst);
-            typedef void (*CompressPtr)(uint8_t* data, int size, int quality, OutputMemoryStream& stream);
+            typedef void (*CompressPtr)(uint8_t* data, int size, int quality, OutputMemoryStream& stream, ImagePngSaver* saver);
             ConvertPtr _convert;
             EncodePtr _encode[TYPES];
             CompressPtr _compress;
@@ -184,7 +218,16 @@ namespace Simd
             Array8u _filt, _buff;
             Array8i _line;
 
-            void WriteToStream(const uint8_t* zlib, size_t zlen);
+            void WriteHeader();
+            void WriteData(OutputMemoryStream& zlib);
+            void WriteEnd();
+
+        public:
+            SIMD_INLINE void Drain(OutputMemoryStream& zlib)
+            {
+                if (_file && zlib.Pos() >= _flush)
+                    WriteData(zlib);
+            }
         };
 
         class ImageJpegSaver : public ImageSaver
@@ -197,6 +240,8 @@ namespace Simd
             virtual bool ToStream(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride);
 
             virtual bool ToStream(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride);
+
+            bool WriteBand(const uint8_t* src, size_t stride, size_t rows);
         protected:
             typedef void (*DeintBgrPtr)(const uint8_t* bgr, size_t bgrStride, size_t width, size_t height,
                 uint8_t* b, size_t bStride, uint8_t* g, size_t gStride, uint8_t* r, size_t rStride);
@@ -219,17 +264,50 @@ namespace Simd
             int _quality, _block, _width;
             float _fY[64], _fUv[64];
             uint8_t _uY[64], _uUv[64];
+            Array8u _band;
+            size_t _row, _bandRows, _bandStride;
+            int _dc[3];
 
             virtual void Init();
 
             void InitParams(bool trans);
             void WriteHeader();
+            void WriteBlock(const uint8_t* src, size_t stride, int block, int dc[3]);
+            void WriteEnd();
+        };
+
+        class ImageQoiSaver : public ImageSaver
+        {
+        public:
+            ImageQoiSaver(const ImageSaverParam& param);
+
+            virtual bool ToStream(const uint8_t* src, size_t stride);
+        protected:
+            typedef void (*ToRgbaPtr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* rgba, size_t rgbaStride);
+            typedef void (*ToRgbaAlphaPtr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* rgba, size_t rgbaStride, uint8_t alpha);
+            typedef void (*HashRowPtr)(const uint8_t* rgba, size_t size, uint8_t* hash);
+            typedef size_t (*RunLengthPtr)(const uint32_t* rgba, size_t size, uint32_t value);
+            typedef void (*DiffRowPtr)(const uint32_t* rgba, size_t size, uint32_t prev, uint16_t* diff);
+            ToRgbaPtr _toRgba;
+            ToRgbaAlphaPtr _toRgbaAlpha;
+            HashRowPtr _hashRow;
+            RunLengthPtr _runLength;
+            DiffRowPtr _diffRow;
+            size_t _channels;
+            Array8u _rgba, _hash;
+            Array16u _diff;
+
+            void WriteHeader();
         };
 
         //---------------------------------------------------------------------
 
         uint8_t* ImageSaveToMemory(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, size_t* size);
 
+        SimdBool ImageSaveToFile(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, const char* path);
+
+        void* ImageSaveBandInit(size_t width, size_t height, SimdPixelFormatType format, int quality, const char* path);
+
         uint8_t* Nv12SaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
 
         uint8_t* Yuv420pSaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
@@ -277,10 +355,20 @@ namespace Simd
             virtual void Init();
         };
 
+        class ImageQoiSaver : public Base::ImageQoiSaver
+        {
+        public:
+            ImageQoiSaver(const ImageSaverParam& param);
+        };
+
         //---------------------------------------------------------------------
 
         uint8_t* ImageSaveToMemory(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, size_t* size);
 
+        SimdBool ImageSaveToFile(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, const char* path);
+
+        void* ImageSaveBandInit(size_t width, size_t height, SimdPixelFormatType format, int quality, const char* path);
+
         uint8_t* Nv12SaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
 
         uint8_t* Yuv420pSaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
@@ -329,10 +417,20 @@ namespace Simd
             virtual void Init();
         };
 
+        class ImageQoiSaver : public Sse41::ImageQoiSaver
+        {
+        public:
+            ImageQoiSaver(const ImageSaverParam& param);
+        };
+
         //---------------------------------------------------------------------
 
         uint8_t* ImageSaveToMemory(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, size_t* size);
 
+        SimdBool ImageSaveToFile(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, const char* path);
+
+        void* ImageSaveBandInit(size_t width, size_t height, SimdPixelFormatType format, int quality, const char* path);
+
         uint8_t* Nv12SaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
 
         uint8_t* Yuv420pSaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
@@ -385,6 +483,10 @@ namespace Simd
 
         uint8_t* ImageSaveToMemory(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, size_t* size);
 
+        SimdBool ImageSaveToFile(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, const char* path);
+
+        void* ImageSaveBandInit(size_t width, size_t height, SimdPixelFormatType format, int quality, const char* path);
+
         uint8_t* Nv12SaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
 
         uint8_t* Yuv420pSaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
@@ -437,6 +539,10 @@ namespace Simd
 
         uint8_t* ImageSaveToMemory(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, size_t* size);
 
+        SimdBool ImageSaveToFile(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, const char* path);
+
+        void* ImageSaveBandInit(size_t width, size_t height, SimdPixelFormatType format, int quality, const char* path);
+
         uint8_t* Nv12SaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
 
         uint8_t* Yuv420pSaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
@@ -63,12 +63,22 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdPerformance.h"
 #include "Simd/SimdEmpty.h"
 
+#include "Simd/SimdBoxFilter.h"
+#include "Simd/SimdCanny.h"
+#include "Simd/SimdClahe.h"
+#include "Simd/SimdConnectedComponents.h"
+#include "Simd/SimdDistanceTransform.h"
+#include "Simd/SimdMorphology.h"
+#include "Simd/SimdOpticalFlowLk.h"
 #include "Simd/SimdDescrInt.h"
 #include "Simd/SimdGaussianBlur.h"
 #include "Simd/SimdImageLoad.h"
 #include "Simd/SimdImageSave.h"
+#include "Simd/SimdLocalBinarization.h"
 #include "Simd/SimdRecursiveBilateralFilter.h"
+#include "Simd/SimdRemap.h"
 #include "Simd/SimdResizer.h"
+#include "Simd/SimdSeparableFilter.h"
 #include "Simd/SimdSynetConvolution8i.h"
 #include "Simd/SimdSynetConvolution16b.h"
 #include "Simd/SimdSynetConvolution32f.h"
@@ -80,6 +90,7 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdSynetPermute.h"
 #include "Simd/SimdSynetScale8i.h"
 #include "Simd/SimdWarpAffine.h"
+#include "Simd/SimdWarpPerspective.h"
 
 #include "Simd/SimdBase.h"
 #include "Simd/SimdSse41.h"
@@ -1462,6 +1473,33 @@ SIMD_API void SimdAveragingBinarizationV2(const uint8_t* src, size_t srcStride,
     Base::AveragingBinarizationV2(src, srcStride, width, height, neighborhood, shift, positive, negative, dst, dstStride);
 }
 
+SIMD_API void * SimdLocalBinarizationInit(size_t width, size_t height, SimdLocalBinarizationType type, size_t radius, float k, float r)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdLocalBinarizationInitPtr) (size_t width, size_t height, SimdLocalBinarizationType type, size_t radius, float k, float r);
+    const static SimdLocalBinarizationInitPtr simdLocalBinarizationInit = SIMD_FUNC3(LocalBinarizationInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdLocalBinarizationInit(width, height, type, radius, k, r);
+}
+
+SIMD_API void SimdLocalBinarizationRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    ((LocalBinarization*)context)->Run(src, srcStride, positive, negative, dst, dstStride);
+}
+
+SIMD_API uint8_t SimdOtsuBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+    uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    uint32_t histogram[HISTOGRAM_SIZE];
+    SimdHistogram(src, width, height, srcStride, histogram);
+    uint8_t threshold = Base::OtsuThreshold(histogram);
+    if (dst)
+        SimdBinarization(src, srcStride, width, height, threshold, positive, negative, dst, dstStride, SimdCompareGreater);
+    return threshold;
+}
+
 SIMD_API void SimdConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height,
                                    uint8_t value, SimdCompareType compareType, uint32_t * count)
 {
@@ -2378,12 +2416,85 @@ SIMD_API void* SimdGaussianBlurInit(size_t width, size_t height, size_t channels
     return simdGaussianBlurInit(width, height, channels, sigma, epsilon);
 }
 
+SIMD_API void* SimdGaussianBlurInitEx(size_t width, size_t height, size_t channels, SimdGaussianBlurChannelType type,
+    const float* sigma, const float* epsilon, SimdGaussianBlurMethod method)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdGaussianBlurInitExPtr) (size_t width, size_t height, size_t channels, SimdGaussianBlurChannelType type,
+        const float* sigma, const float* epsilon, SimdGaussianBlurMethod method);
+    const static SimdGaussianBlurInitExPtr simdGaussianBlurInitEx = SIMD_FUNC4(GaussianBlurInitEx, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdGaussianBlurInitEx(width, height, channels, type, sigma, epsilon, method);
+}
+
 SIMD_API void SimdGaussianBlurRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
 {
     SIMD_EMPTY();
     ((GaussianBlur*)filter)->Run(src, srcStride, dst, dstStride);
 }
 
+SIMD_API void* SimdSeparableFilterInit(size_t width, size_t height, size_t channels, SimdSeparableFilterChannelType type,
+    const float* rowKernel, size_t rowSize, const float* colKernel, size_t colSize)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdSeparableFilterInitPtr) (size_t width, size_t height, size_t channels, SimdSeparableFilterChannelType type,
+        const float* rowKernel, size_t rowSize, const float* colKernel, size_t colSize);
+    const static SimdSeparableFilterInitPtr simdSeparableFilterInit = SIMD_FUNC3(SeparableFilterInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdSeparableFilterInit(width, height, channels, type, rowKernel, rowSize, colKernel, colSize);
+}
+
+SIMD_API void SimdSeparableFilterRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    ((SeparableFilter*)filter)->Run(src, srcStride, dst, dstStride);
+}
+
+SIMD_API void* SimdBoxFilterInit(size_t width, size_t height, size_t channels, SimdBoxFilterChannelType type, size_t radiusX, size_t radiusY)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdBoxFilterInitPtr) (size_t width, size_t height, size_t channels, SimdBoxFilterChannelType type, size_t radiusX, size_t radiusY);
+    const static SimdBoxFilterInitPtr simdBoxFilterInit = SIMD_FUNC3(BoxFilterInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdBoxFilterInit(width, height, channels, type, radiusX, radiusY);
+}
+
+SIMD_API void SimdBoxFilterRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* mean, size_t meanStride, float* var, size_t varStride)
+{
+    SIMD_EMPTY();
+    ((BoxFilter*)filter)->Run(src, srcStride, mean, meanStride, var, varStride);
+}
+
+SIMD_API void* SimdMorphologyInit(size_t width, size_t height, SimdMorphologyOperationType operation, size_t kernelX, size_t kernelY)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdMorphologyInitPtr) (size_t width, size_t height, SimdMorphologyOperationType operation, size_t kernelX, size_t kernelY);
+    const static SimdMorphologyInitPtr simdMorphologyInit = SIMD_FUNC3(MorphologyInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdMorphologyInit(width, height, operation, kernelX, kernelY);
+}
+
+SIMD_API void SimdMorphologyRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    ((Morphology*)filter)->Run(src, srcStride, dst, dstStride);
+}
+
+SIMD_API void* SimdDistanceTransformInit(size_t width, size_t height, SimdDistanceTransformType type, SimdDistanceTransformDataType data)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdDistanceTransformInitPtr) (size_t width, size_t height, SimdDistanceTransformType type, SimdDistanceTransformDataType data);
+    const static SimdDistanceTransformInitPtr simdDistanceTransformInit = SIMD_FUNC3(DistanceTransformInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdDistanceTransformInit(width, height, type, data);
+}
+
+SIMD_API void SimdDistanceTransformRun(void* context, const uint8_t* mask, size_t maskStride, uint8_t index, uint8_t* dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    ((DistanceTransform*)context)->Run(mask, maskStride, index, dst, dstStride);
+}
+
 typedef void(*SimdGemm32fPtr) (size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
 
 SIMD_API void SimdGemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc)
@@ -2604,6 +2715,21 @@ SIMD_API void SimdNormalizeHistogram(const uint8_t * src, size_t srcStride, size
         Base::NormalizeHistogram(src, srcStride, width, height, dst, dstStride);
 }
 
+SIMD_API void* SimdClaheInit(size_t width, size_t height, size_t tilesX, size_t tilesY, float clipLimit)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdClaheInitPtr) (size_t width, size_t height, size_t tilesX, size_t tilesY, float clipLimit);
+    const static SimdClaheInitPtr simdClaheInit = SIMD_FUNC3(ClaheInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdClaheInit(width, height, tilesX, tilesY, clipLimit);
+}
+
+SIMD_API void SimdClaheRun(void* clahe, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    ((Clahe*)clahe)->Run(src, srcStride, dst, dstStride);
+}
+
 SIMD_API void SimdHogDirectionHistograms(const uint8_t * src, size_t stride, size_t width, size_t height, 
                                          size_t cellX, size_t cellY, size_t quantization, float * histograms)
 {
@@ -2721,9 +2847,9 @@ SIMD_API uint8_t* SimdImageSaveToMemory(const uint8_t* src, size_t stride, size_
 SIMD_API SimdBool SimdImageSaveToFile(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, const char* path)
 {
     SIMD_EMPTY();
-    const static Simd::ImageSaveToMemoryPtr imageSaveToMemory = SIMD_FUNC4(ImageSaveToMemory, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    const static Simd::ImageSaveToFilePtr imageSaveToFile = SIMD_FUNC4(ImageSaveToFile, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
 
-    return ImageSaveToFile(imageSaveToMemory, src, stride, width, height, format, file, quality, path);
+    return imageSaveToFile(src, stride, width, height, format, file, quality, path);
 }
 
 SIMD_API uint8_t* SimdNv12SaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size)
@@ -2762,6 +2888,33 @@ SIMD_API uint8_t* SimdImageLoadFromFile(const char* path, size_t* stride, size_t
     return ImageLoadFromFile(imageLoadFromMemory, path, stride, width, height, format);
 }
 
+SIMD_API void* SimdImageLoadBandInit(const char* path, SimdPixelFormatType* format, size_t* width, size_t* height)
+{
+    SIMD_EMPTY();
+    return Base::ImageLoadBandInit(path, format, width, height);
+}
+
+SIMD_API size_t SimdImageLoadBandRun(void* loader, uint8_t* dst, size_t stride, size_t rows)
+{
+    SIMD_EMPTY();
+    return ((ImageBandLoader*)loader)->Run(dst, stride, rows);
+}
+
+SIMD_API void* SimdImageSaveBandInit(size_t width, size_t height, SimdPixelFormatType format, int quality, const char* path)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdImageSaveBandInitPtr) (size_t width, size_t height, SimdPixelFormatType format, int quality, const char* path);
+    const static SimdImageSaveBandInitPtr simdImageSaveBandInit = SIMD_FUNC4(ImageSaveBandInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdImageSaveBandInit(width, height, format, quality, path);
+}
+
+SIMD_API SimdBool SimdImageSaveBandRun(void* saver, const uint8_t* src, size_t stride, size_t rows)
+{
+    SIMD_EMPTY();
+    return ((Base::ImageJpegSaver*)saver)->WriteBand(src, stride, rows) ? SimdTrue : SimdFalse;
+}
+
 SIMD_API void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride)
 {
     SIMD_EMPTY();
@@ -3120,6 +3273,22 @@ SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, s
         Base::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
+SIMD_API void SimdMedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::MedianFilterSquare(src, srcStride, width, height, channelCount, radius, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable)
+        Sse41::MedianFilterSquare(src, srcStride, width, height, channelCount, radius, dst, dstStride);
+    else
+#endif
+        Base::MedianFilterSquare(src, srcStride, width, height, channelCount, radius, dst, dstStride);
+}
+
 SIMD_API void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion)
 {
     SIMD_EMPTY();
@@ -3656,7 +3825,7 @@ SIMD_API void* SimdRecursiveBilateralFilterInit(size_t width, size_t height, siz
 {
     SIMD_EMPTY();
     typedef void* (*SimdRecursiveBilateralFilterInitPtr) (size_t width, size_t height, size_t channels, const float* sigmaSpatial, const float* sigmaRange, SimdRecursiveBilateralFilterFlags flags);
-    const static SimdRecursiveBilateralFilterInitPtr simdRecursiveBilateralFilterInit = SIMD_FUNC2(RecursiveBilateralFilterInit, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);// , SIMD_AVX512BW_FUNC, SIMD_NEON_FUNC);
+    const static SimdRecursiveBilateralFilterInitPtr simdRecursiveBilateralFilterInit = SIMD_FUNC3(RecursiveBilateralFilterInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);// , SIMD_NEON_FUNC);
     return simdRecursiveBilateralFilterInit(width, height, channels, sigmaSpatial, sigmaRange, flags);
 }
 
@@ -3894,6 +4063,74 @@ SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t s
     ((Resizer*)resizer)->Run(src, srcStride, dst, dstStride);
 }
 
+SIMD_API void * SimdResizerBandInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+{
+    SIMD_EMPTY();
+    typedef void*(*SimdResizerBandInitPtr) (size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+    const static SimdResizerBandInitPtr simdResizerBandInit = SIMD_FUNC4(ResizerBandInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdResizerBandInit(srcX, srcY, dstX, dstY, channels, type, method);
+}
+
+SIMD_API size_t SimdResizerBandRun(void * resizer, const uint8_t * src, size_t srcStride, size_t srcRows, uint8_t * dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    return ((Base::ResizerBand*)resizer)->Run(src, srcStride, srcRows, dst, dstStride);
+}
+
+SIMD_API void * SimdResizerYuv420Init(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType dstFormat, SimdYuvType yuvType, SimdResizeMethodType method)
+{
+    SIMD_EMPTY();
+    typedef void*(*SimdResizerYuv420InitPtr) (size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType dstFormat, SimdYuvType yuvType, SimdResizeMethodType method);
+    const static SimdResizerYuv420InitPtr simdResizerYuv420Init = SIMD_FUNC3(ResizerYuv420Init, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdResizerYuv420Init(srcX, srcY, dstX, dstY, dstFormat, yuvType, method);
+}
+
+SIMD_API void SimdResizerYuv420pRun(const void * resizer, const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, uint8_t * dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    ((Base::ResizerYuv420*)resizer)->Run(y, yStride, u, uStride, v, vStride, 1, dst, dstStride);
+}
+
+SIMD_API void SimdResizerNv12Run(const void * resizer, const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, uint8_t * dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    ((Base::ResizerYuv420*)resizer)->Run(y, yStride, uv, uvStride, uv + 1, uvStride, 2, dst, dstStride);
+}
+
+SIMD_API void * SimdResizerBatchInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method, SimdTensorFormatType format)
+{
+    SIMD_EMPTY();
+    typedef void*(*SimdResizerBatchInitPtr) (size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method, SimdTensorFormatType format);
+    const static SimdResizerBatchInitPtr simdResizerBatchInit = SIMD_FUNC3(ResizerBatchInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdResizerBatchInit(srcX, srcY, dstX, dstY, channels, type, method, format);
+}
+
+SIMD_API void SimdResizerBatchRun(const void * resizer, const uint8_t * src, size_t srcStride, const float * rois, size_t count, uint8_t * dst)
+{
+    SIMD_EMPTY();
+    ((Base::ResizerBatch*)resizer)->Run(src, srcStride, rois, count, dst);
+}
+
+SIMD_API void * SimdResizerTensorInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method,
+    SimdTensorFormatType format, SimdTensorDataType type, const float * scale, const float * shift, SimdBool letterbox, float fill)
+{
+    SIMD_EMPTY();
+    typedef void*(*SimdResizerTensorInitPtr) (size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method,
+        SimdTensorFormatType format, SimdTensorDataType type, const float * scale, const float * shift, SimdBool letterbox, float fill);
+    const static SimdResizerTensorInitPtr simdResizerTensorInit = SIMD_FUNC3(ResizerTensorInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdResizerTensorInit(srcX, srcY, dstX, dstY, channels, method, format, type, scale, shift, letterbox, fill);
+}
+
+SIMD_API void SimdResizerTensorRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst)
+{
+    SIMD_EMPTY();
+    ((Base::ResizerTensor*)resizer)->Run(src, srcStride, dst);
+}
+
 SIMD_API void SimdRgbToBgra(const uint8_t* rgb, size_t width, size_t height, size_t rgbStride, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
 {
     SIMD_EMPTY();
@@ -4084,6 +4321,43 @@ SIMD_API void SimdSegmentationShrinkRegion(const uint8_t * mask, size_t stride,
         Base::SegmentationShrinkRegion(mask, stride, width, height, index, left, top, right, bottom);
 }
 
+SIMD_API void* SimdConnectedComponentsInit(size_t width, size_t height, SimdConnectivityType connectivity, SimdBool moments)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdConnectedComponentsInitPtr) (size_t width, size_t height, SimdConnectivityType connectivity, SimdBool moments);
+    const static SimdConnectedComponentsInitPtr simdConnectedComponentsInit = SIMD_FUNC3(ConnectedComponentsInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdConnectedComponentsInit(width, height, connectivity, moments);
+}
+
+SIMD_API size_t SimdConnectedComponentsRun(void* context, const uint8_t* mask, size_t maskStride, uint8_t index, 
+    uint32_t* labels, size_t labelsStride, const SimdConnectedComponent** components)
+{
+    SIMD_EMPTY();
+    return ((ConnectedComponents*)context)->Run(mask, maskStride, index, labels, labelsStride, components);
+}
+
+SIMD_API void * SimdOpticalFlowLkInit(size_t width, size_t height, size_t levels, size_t radius, size_t iterations, float epsilon, float minEigenvalue)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdOpticalFlowLkInitPtr) (size_t width, size_t height, size_t levels, size_t radius, size_t iterations, float epsilon, float minEigenvalue);
+    const static SimdOpticalFlowLkInitPtr simdOpticalFlowLkInit = SIMD_FUNC3(OpticalFlowLkInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdOpticalFlowLkInit(width, height, levels, radius, iterations, epsilon, minEigenvalue);
+}
+
+SIMD_API void SimdOpticalFlowLkSetFrame(void * context, const uint8_t * src, size_t srcStride)
+{
+    SIMD_EMPTY();
+    ((OpticalFlowLk*)context)->SetFrame(src, srcStride);
+}
+
+SIMD_API void SimdOpticalFlowLkTrack(void * context, const float * prev, float * next, uint8_t * status, size_t count)
+{
+    SIMD_EMPTY();
+    ((OpticalFlowLk*)context)->Track(prev, next, status, count);
+}
+
 SIMD_API void SimdShiftBilinear(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
     const uint8_t * bkg, size_t bkgStride, const double * shiftX, const double * shiftY,
     size_t cropLeft, size_t cropTop, size_t cropRight, size_t cropBottom, uint8_t * dst, size_t dstStride)
@@ -4352,6 +4626,21 @@ SIMD_API void SimdContourAnchors(const uint8_t * src, size_t srcStride, size_t w
         Base::ContourAnchors(src, srcStride, width, height, step, threshold, dst, dstStride);
 }
 
+SIMD_API void* SimdCannyInit(size_t width, size_t height, float lowThreshold, float highThreshold)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdCannyInitPtr) (size_t width, size_t height, float lowThreshold, float highThreshold);
+    const static SimdCannyInitPtr simdCannyInit = SIMD_FUNC3(CannyInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdCannyInit(width, height, lowThreshold, highThreshold);
+}
+
+SIMD_API void SimdCannyRun(void* canny, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    ((Canny*)canny)->Run(src, srcStride, dst, dstStride);
+}
+
 SIMD_API void SimdSquaredDifferenceSum(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
                           size_t width, size_t height, uint64_t * sum)
 {
@@ -5997,6 +6286,65 @@ SIMD_API void SimdWarpAffineRun(const void* context, const uint8_t* src, uint8_t
     ((WarpAffine*)context)->Run(src, dst);
 }
 
+SIMD_API void* SimdWarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t channels,
+    SimdWarpAffineFlags flags, const uint8_t* border, SimdTensorDataType type, const float* lower, const float* upper)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdWarpAffineBatchInitPtr) (size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t channels,
+        SimdWarpAffineFlags flags, const uint8_t* border, SimdTensorDataType type, const float* lower, const float* upper);
+    const static SimdWarpAffineBatchInitPtr simdWarpAffineBatchInit = SIMD_FUNC3(WarpAffineBatchInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+    return simdWarpAffineBatchInit(srcW, srcH, srcS, dstW, dstH, channels, flags, border, type, lower, upper);
+}
+
+SIMD_API SimdBool SimdWarpAffineBatchRun(const void* context, const uint8_t* src, const float* mats, size_t count, uint8_t* dst)
+{
+    SIMD_EMPTY();
+    return ((Base::WarpAffineBatch*)context)->Run(src, mats, count, dst) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API void* SimdWarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdWarpPerspectiveInitPtr) (size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+    const static SimdWarpPerspectiveInitPtr simdWarpPerspectiveInit = SIMD_FUNC3(WarpPerspectiveInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdWarpPerspectiveInit(srcW, srcH, srcS, dstW, dstH, dstS, channels, mat, flags, border);
+}
+
+SIMD_API void SimdWarpPerspectiveRun(const void* context, const uint8_t* src, uint8_t* dst)
+{
+    SIMD_EMPTY();
+    ((WarpPerspective*)context)->Run(src, dst);
+}
+
+SIMD_API void* SimdRemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+    const float* mapX, const float* mapY, size_t mapStride, SimdRemapFlags flags, const uint8_t* border)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdRemapInitPtr) (size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+        const float* mapX, const float* mapY, size_t mapStride, SimdRemapFlags flags, const uint8_t* border);
+    const static SimdRemapInitPtr simdRemapInit = SIMD_FUNC3(RemapInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdRemapInit(srcW, srcH, srcS, dstW, dstH, dstS, channels, mapX, mapY, mapStride, flags, border);
+}
+
+SIMD_API void* SimdRemapInitUndistortion(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+    const float* camera, const float* distortion, SimdRemapFlags flags, const uint8_t* border)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdRemapInitUndistortionPtr) (size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+        const float* camera, const float* distortion, SimdRemapFlags flags, const uint8_t* border);
+    const static SimdRemapInitUndistortionPtr simdRemapInitUndistortion = SIMD_FUNC3(RemapInitUndistortion, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdRemapInitUndistortion(srcW, srcH, srcS, dstW, dstH, dstS, channels, camera, distortion, flags, border);
+}
+
+SIMD_API void SimdRemapRun(const void* context, const uint8_t* src, uint8_t* dst)
+{
+    SIMD_EMPTY();
+    ((Remap*)context)->Run(src, dst);
+}
+
 typedef void(*SimdWinogradSetFilterPtr) (const float * src, size_t size, float * dst, SimdBool trans);
 typedef void(*SimdWinogradSetInputPtr) (const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth, size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans);
 typedef void(*SimdWinogradSetOutputPtr) (const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
@@ -123,6 +123,56 @@ typedef enum
     SimdTrue = 1, /*!< True value. */
 } SimdBool;
 
+/*! @ingroup other_filter
+    Describes channel type of image processed by box filter (see function ::SimdBoxFilterInit).
+*/
+typedef enum
+{
+    /*! 8-bit unsigned integer channel type. */
+    SimdBoxFilterChannel8u = 0,
+    /*! 32-bit float channel type. */
+    SimdBoxFilterChannel32f = 1,
+} SimdBoxFilterChannelType;
+
+/*! @ingroup other_filter
+    Describes type of morphological operation (see function ::SimdMorphologyInit).
+*/
+typedef enum
+{
+    /*! Erosion: minimum over rectangular window. */
+    SimdMorphologyErode = 0,
+    /*! Dilation: maximum over rectangular window. */
+    SimdMorphologyDilate = 1,
+    /*! Opening: erosion followed by dilation. */
+    SimdMorphologyOpen = 2,
+    /*! Closing: dilation followed by erosion. */
+    SimdMorphologyClose = 3,
+} SimdMorphologyOperationType;
+
+/*! @ingroup other_filter
+    Describes type of distance transform (see function ::SimdDistanceTransformInit).
+*/
+typedef enum
+{
+    /*! Exact Euclidean distance transform (Felzenszwalb - Huttenlocher). */
+    SimdDistanceTransformEuclidean = 0,
+    /*! Chamfer distance transform with 3x3 mask (weights 3 and 4, divided by 3). */
+    SimdDistanceTransformChamfer3x3 = 1,
+    /*! Chamfer distance transform with 5x5 mask (weights 5, 7 and 11, divided by 5). */
+    SimdDistanceTransformChamfer5x5 = 2,
+} SimdDistanceTransformType;
+
+/*! @ingroup other_filter
+    Describes output data type of distance transform (see function ::SimdDistanceTransformInit).
+*/
+typedef enum
+{
+    /*! 32-bit float output. */
+    SimdDistanceTransform32f = 0,
+    /*! 16-bit unsigned integer output (rounded and saturated distance). */
+    SimdDistanceTransform16u = 1,
+} SimdDistanceTransformDataType;
+
 /*! @ingroup c_types
     Describes types of compare operation.
     Operation compare(a, b) is
@@ -280,6 +330,75 @@ typedef enum
     SimdDetectionInfoCanInt16 = 8,
 } SimdDetectionInfoFlags;
 
+/*! @ingroup gaussian_filter
+    Describes channel type of image processed by Gaussian blur filter (see function ::SimdGaussianBlurInitEx).
+*/
+typedef enum
+{
+    /*! 8-bit unsigned integer channel type. */
+    SimdGaussianBlurChannel8u = 0,
+    /*! 16-bit unsigned integer channel type. */
+    SimdGaussianBlurChannel16u = 1,
+    /*! 32-bit float channel type. */
+    SimdGaussianBlurChannel32f = 2,
+} SimdGaussianBlurChannelType;
+
+/*! @ingroup gaussian_filter
+    Describes algorithm of Gaussian blur filter (see function ::SimdGaussianBlurInitEx).
+*/
+typedef enum
+{
+    /*! Automatic choice: FIR filter for small sigma, IIR filter if the FIR kernel size exceeds 31. */
+    SimdGaussianBlurAuto = 0,
+    /*! Direct convolution with separable FIR kernel (see function ::SimdGaussianBlurInit). Its cost grows linearly with sigma. */
+    SimdGaussianBlurFir = 1,
+    /*! Recursive 3rd order IIR filter (Young - van Vliet) with exact replicated borders (Triggs - Sdika). Its cost does not depend on sigma.
+        It is used for sigma >= 0.5 only (FIR filter is used for smaller sigma). */
+    SimdGaussianBlurIir = 2,
+} SimdGaussianBlurMethod;
+
+/*! @ingroup segmentation
+    Describes connectivity of pixels of connected components (see function ::SimdConnectedComponentsInit).
+*/
+typedef enum
+{
+    /*! A pixel is connected with its horizontal and vertical neighbors. */
+    SimdConnectivity4 = 4,
+    /*! A pixel is connected with its horizontal, vertical and diagonal neighbors. */
+    SimdConnectivity8 = 8,
+} SimdConnectivityType;
+
+/*! @ingroup segmentation
+    Describes statistics of connected component (see function ::SimdConnectedComponentsRun).
+*/
+typedef struct SimdConnectedComponent
+{
+    /*! A number of pixels of the component. */
+    uint64_t area;
+    /*! A sum of X coordinates of pixels of the component (first-order moment x). */
+    uint64_t x;
+    /*! A sum of Y coordinates of pixels of the component (first-order moment y). */
+    uint64_t y;
+    /*! A sum of X*X of pixels of the component (second-order moment xx). It is calculated only if moments are enabled. */
+    uint64_t xx;
+    /*! A sum of X*Y of pixels of the component (second-order moment xy). It is calculated only if moments are enabled. */
+    uint64_t xy;
+    /*! A sum of Y*Y of pixels of the component (second-order moment yy). It is calculated only if moments are enabled. */
+    uint64_t yy;
+    /*! A left boundary of the component bounding box. */
+    int32_t left;
+    /*! A top boundary of the component bounding box. */
+    int32_t top;
+    /*! A right boundary (exclusive) of the component bounding box. */
+    int32_t right;
+    /*! A bottom boundary (exclusive) of the component bounding box. */
+    int32_t bottom;
+    /*! X coordinate of the component centroid. */
+    float centerX;
+    /*! Y coordinate of the component centroid. */
+    float centerY;
+} SimdConnectedComponent;
+
 /*! @ingroup synet_grid_sample
     Describes grid sample interpolation type. It is used in function ::SimdSynetGridSample2dInit.
 */
@@ -325,8 +444,21 @@ typedef enum
     SimdImageFilePng,
     /*! A JPEG (Joint Photographic Experts Group) image file format. */
     SimdImageFileJpeg,
+    /*! A QOI (Quite OK Image) lossless image file format. */
+    SimdImageFileQoi,
 } SimdImageFileType;
 
+/*! @ingroup binarization
+    Describes methods of local threshold estimation used by function ::SimdLocalBinarizationInit.
+*/
+typedef enum
+{
+    /*! Sauvola method: threshold = mean*(1 + k*(stddev/r - 1)). */
+    SimdLocalBinarizationSauvola,
+    /*! Niblack method: threshold = mean + k*stddev. */
+    SimdLocalBinarizationNiblack,
+} SimdLocalBinarizationType;
+
 /*! @ingroup c_types
     Describes types of binary operation between two images performed by function ::SimdOperationBinary8u.
     Images must have the same format (unsigned 8-bit integer for every channel).
@@ -435,6 +567,25 @@ enum SimdReduceType
     SimdReduce5x5, /*!< Using of function ::SimdReduceGray5x5 for image reducing. */
 };
 
+/*! @ingroup warp_affine
+    Describes Remap flags. This type used in functions ::SimdRemapInit and ::SimdRemapInitUndistortion.
+*/
+typedef enum
+{
+    SimdRemapDefault = 0, /*!< Default Remap flags. */
+    SimdRemapChannelByte = 0, /*!<  8-bit integer channel type. */
+    SimdRemapChannelMask = 1, /*!< Bit mask of channel type. */
+    SimdRemapInterpNearest = 0, /*!< Nearest pixel interpolation method. */
+    SimdRemapInterpBilinear = 2, /*!< Bilinear pixel interpolation method. */
+    SimdRemapInterpMask = 2, /*!< Bit mask of pixel interpolation options. */
+    SimdRemapBorderConstant = 0, /*!< Output pixels mapped outside of input image are filled by constant border value. */
+    SimdRemapBorderTransparent = 4, /*!< Output pixels mapped outside of input image are left unchanged. */
+    SimdRemapBorderMask = 4, /*!< Bit mask of border type options. */
+    SimdRemapModelPinhole = 0, /*!< Pinhole camera distortion model (k1, k2, p1, p2, k3). It is used in function ::SimdRemapInitUndistortion. */
+    SimdRemapModelFisheye = 8, /*!< Fisheye camera distortion model (k1, k2, k3, k4). It is used in function ::SimdRemapInitUndistortion. */
+    SimdRemapModelMask = 8, /*!< Bit mask of camera distortion model. */
+} SimdRemapFlags;
+
 /*! @ingroup resizing
     Describes resized image channel types.
 */
@@ -469,8 +620,23 @@ typedef enum
     SimdResizeMethodArea,
     /*! Area method for previously reduced in 2 times image. */
     SimdResizeMethodAreaFast,
+    /*! Lanczos method with 3 lobes (a windowed sinc filter). At downscaling the filter support is stretched in order to avoid aliasing. */
+    SimdResizeMethodLanczos3,
+    /*! Mitchell-Netravali bicubic filter (B = C = 1/3). At downscaling the filter support is stretched in order to avoid aliasing. */
+    SimdResizeMethodMitchell,
 } SimdResizeMethodType;
 
+/*! @ingroup other_filter
+    Describes channel type of image processed by separable filter (see function ::SimdSeparableFilterInit).
+*/
+typedef enum
+{
+    /*! 8-bit unsigned integer channel type. */
+    SimdSeparableFilterChannel8u = 0,
+    /*! 16-bit unsigned integer channel type. */
+    SimdSeparableFilterChannel16u = 1,
+} SimdSeparableFilterChannelType;
+
 /*! @ingroup synet_types
     Describes Synet calculation compatibility flags. This type used in functions ::SimdSynetAdd8i, ::SimdSynetScaleLayerForward, 
     ::SimdSynetConvert32fTo8u, ::SimdSynetConvert8uTo32f, ::SimdSynetInnerProduct8i, ::SimdSynetScale8iInit,
@@ -594,13 +760,16 @@ typedef enum
 {
     SimdWarpAffineDefault = 0, /*!< Default Warp Affine flags. */
     SimdWarpAffineChannelByte = 0, /*!<  8-bit integer channel type. */
-    SimdWarpAffineChannelMask = 1, /*!< Bit mask of channel type. */
+    SimdWarpAffineChannelShort = 8, /*!<  16-bit unsigned integer channel type. */
+    SimdWarpAffineChannelFloat = 16, /*!<  32-bit float channel type. */
+    SimdWarpAffineChannelMask = 24, /*!< Bit mask of channel type. */
     SimdWarpAffineInterpNearest = 0, /*!< Nearest pixel interpolation method. */
     SimdWarpAffineInterpBilinear = 2, /*!< Bilinear pixel interpolation method. */
-    SimdWarpAffineInterpMask = 2, /*!< Bit mask of pixel interpolation options. */
-    SimdWarpAffineBorderConstant = 0, /*!< Nearest pixel interpolation method. */
-    SimdWarpAffineBorderTransparent = 4, /*!< Bilinear pixel interpolation method. */
-    SimdWarpAffineBorderMask = 4, /*!< Bit mask of pixel interpolation options. */
+    SimdWarpAffineInterpBicubic = 32, /*!< Bicubic pixel interpolation method (4x4 neighborhood). */
+    SimdWarpAffineInterpMask = 34, /*!< Bit mask of pixel interpolation options. */
+    SimdWarpAffineBorderConstant = 0, /*!< Constant border: pixels outside of source image are filled with border value. */
+    SimdWarpAffineBorderTransparent = 4, /*!< Transparent border: output pixels outside of source image are not changed. */
+    SimdWarpAffineBorderMask = 4, /*!< Bit mask of border type. */
 } SimdWarpAffineFlags;
 
 /*! @ingroup yuv_conversion
@@ -2234,6 +2403,83 @@ extern "C"
     SIMD_API void SimdAveragingBinarizationV2(const uint8_t* src, size_t srcStride, size_t width, size_t height,
         size_t neighborhood, int32_t shift, uint8_t positive, uint8_t negative, uint8_t* dst, size_t dstStride);
 
+    /*! @ingroup binarization
+
+        \fn void * SimdLocalBinarizationInit(size_t width, size_t height, SimdLocalBinarizationType type, size_t radius, float k, float r);
+
+        \short Creates context of local adaptive binarization (Sauvola or Niblack) of 8-bit gray image.
+
+        Local mean and standard deviation are estimated in square window (2*radius + 1)x(2*radius + 1) with replicated image borders.
+        They are taken from running column sums and sums of squares (the same kernel as in ::SimdBoxFilterInit),
+        so the image is processed in single streaming pass and its cost per pixel does not depend on window size.
+        For every point:
+        \verbatim
+        mean = sum / area;
+        stddev = sqrt(max(sqsum / area - mean*mean, 0));
+        if(type == SimdLocalBinarizationSauvola)
+            threshold = mean*(1 + k*(stddev/r - 1));
+        else
+            threshold = mean + k*stddev;
+        dst[x, y] = src[x, y] > threshold ? positive : negative;
+        \endverbatim
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] type - a method of threshold estimation.
+        \param [in] radius - a radius of window. Window area (2*radius + 1)^2 must not exceed 33025.
+        \param [in] k - a sensitivity parameter (usually 0.2 - 0.5 for Sauvola method and -0.2 for Niblack method).
+        \param [in] r - a dynamic range of standard deviation (usually 128). It is used only by Sauvola method and must be positive.
+        \return a pointer to binarization context. On error it returns NULL.
+                This pointer is used in functions ::SimdLocalBinarizationRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdLocalBinarizationInit(size_t width, size_t height, SimdLocalBinarizationType type, size_t radius, float k, float r);
+
+    /*! @ingroup binarization
+
+        \fn void SimdLocalBinarizationRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride);
+
+        \short Performs local adaptive binarization of 8-bit gray image.
+
+        \note Input and output images must not overlap.
+
+        \param [in] context - a binarization context. It must be created by function ::SimdLocalBinarizationInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] srcStride - a row size of the src image.
+        \param [in] positive - a destination value for points which are greater than local threshold.
+        \param [in] negative - a destination value for other points.
+        \param [out] dst - a pointer to pixels data of output 8-bit gray binarized image.
+        \param [in] dstStride - a row size of the dst image.
+    */
+    SIMD_API void SimdLocalBinarizationRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup binarization
+
+        \fn uint8_t SimdOtsuBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride);
+
+        \short Performs binarization of 8-bit gray image with global threshold estimated by Otsu method.
+
+        The threshold maximizes between-class variance of image histogram (see function ::SimdHistogram).
+        For every point:
+        \verbatim
+        dst[x, y] = src[x, y] > threshold ? positive : negative;
+        \endverbatim
+
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] srcStride - a row size of the src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] positive - a destination value for points which are greater than threshold.
+        \param [in] negative - a destination value for other points.
+        \param [out] dst - a pointer to pixels data of output 8-bit gray binarized image. Can be NULL (then only threshold is estimated).
+        \param [in] dstStride - a row size of the dst image.
+        \return estimated threshold.
+    */
+    SIMD_API uint8_t SimdOtsuBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup conditional
 
         \fn void SimdConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height, uint8_t value, SimdCompareType compareType, uint32_t * count);
@@ -3331,7 +3577,9 @@ extern "C"
         dst[dx, dy] = sum;
         \endverbatim
 
-        \param [in] filter - a filter context. It must be created by function ::SimdGaussianBlurInit and released by function ::SimdRelease.
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] filter - a filter context. It must be created by function ::SimdGaussianBlurInit (or ::SimdGaussianBlurInitEx) and released by function ::SimdRelease.
         \param [in] src - a pointer to pixels data of the original input image.
         \param [in] srcStride - a row size (in bytes) of the input image.
         \param [out] dst - a pointer to pixels data of the filtered output image.
@@ -3339,6 +3587,234 @@ extern "C"
     */
     SIMD_API void SimdGaussianBlurRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
 
+    /*! @ingroup gaussian_filter
+
+        \fn void* SimdGaussianBlurInitEx(size_t width, size_t height, size_t channels, SimdGaussianBlurChannelType type, const float* sigma, const float* epsilon, SimdGaussianBlurMethod method);
+
+        \short Creates Gaussian blur filter context for image with 8-bit, 16-bit or 32-bit float channels.
+
+        FIR method uses the same kernel as function ::SimdGaussianBlurInit.
+        IIR method approximates Gaussian with recursive filter which is applied forward and backward along rows and then along columns.
+        Its computational cost per pixel does not depend on sigma, so it is preferable for large blur radius.
+        Integer output values are rounded to nearest and saturated.
+
+        \param [in] width - a width of input and output image.
+        \param [in] height - a height of input and output image.
+        \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
+        \param [in] type - a channel type of input and output image.
+        \param [in] sigma - a pointer to sigma parameter (blur radius). Its value must be greater than 0.000001.
+        \param [in] epsilon - a pointer to epsilon parameter (permissible relative error of FIR kernel).
+                              Its value must be greater than 0.000001. Pointer can be NULL and by default value 0.001 is used.
+        \param [in] method - a method of Gaussian blur.
+        \return a pointer to filter context. On error it returns NULL.
+                This pointer is used in functions ::SimdGaussianBlurRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdGaussianBlurInitEx(size_t width, size_t height, size_t channels, SimdGaussianBlurChannelType type, 
+        const float* sigma, const float* epsilon, SimdGaussianBlurMethod method);
+
+    /*! @ingroup other_filter
+
+        \fn void * SimdSeparableFilterInit(size_t width, size_t height, size_t channels, SimdSeparableFilterChannelType type, const float* rowKernel, size_t rowSize, const float* colKernel, size_t colSize);
+
+        \short Creates context of separable filter with arbitrary row and column kernels.
+
+        The filter performs horizontal pass with row kernel and then vertical pass with column kernel.
+        Image borders are replicated. Anchor of each kernel is its center (size / 2).
+        If both kernels become integer after scaling by power of 2 (for example, binomial kernels {1, 2, 1}/4)
+        and image has 8-bit channels then filter uses exact 16-bit integer arithmetic. Otherwise it uses 32-bit float arithmetic.
+
+        \verbatim
+        sum = 0;
+        for(ky = 0; ky < colSize; ++ky)
+        {
+            sy = min(max(0, dy + ky - colSize/2), height - 1);
+            for(kx = 0; kx < rowSize; ++kx)
+            {
+                sx = min(max(0, dx + kx - rowSize/2), width - 1);
+                sum += src[sx, sy]*rowKernel[kx]*colKernel[ky];
+            }
+        }
+        dst[dx, dy] = min(max(0, round(sum)), max(channel type));
+        \endverbatim
+
+        \param [in] width - a width of input and output image.
+        \param [in] height - a height of input and output image.
+        \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
+        \param [in] type - a channel type of input and output image.
+        \param [in] rowKernel - a pointer to row (horizontal) kernel.
+        \param [in] rowSize - a size of row kernel. It must be greater than 0.
+        \param [in] colKernel - a pointer to column (vertical) kernel.
+        \param [in] colSize - a size of column kernel. It must be greater than 0.
+        \return a pointer to filter context. On error it returns NULL.
+                This pointer is used in functions ::SimdSeparableFilterRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdSeparableFilterInit(size_t width, size_t height, size_t channels, SimdSeparableFilterChannelType type,
+        const float* rowKernel, size_t rowSize, const float* colKernel, size_t colSize);
+
+    /*! @ingroup other_filter
+
+        \fn void SimdSeparableFilterRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        \short Performs image filtering with separable filter.
+
+        \param [in] filter - a filter context. It must be created by function ::SimdSeparableFilterInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the filtered output image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdSeparableFilterRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+    /*! @ingroup other_filter
+
+        \fn void * SimdBoxFilterInit(size_t width, size_t height, size_t channels, SimdBoxFilterChannelType type, size_t radiusX, size_t radiusY);
+
+        \short Creates context of box filter which estimates local mean and variance of image in rectangular window of arbitrary size.
+
+        Computational cost per pixel does not depend on window size: the filter keeps running column sums (and sums of squares),
+        which are updated by one added and one removed row, and takes window sums as differences of prefix sums along the row.
+        Image borders are replicated. For every point and channel:
+        \verbatim
+        sum = 0, sqsum = 0;
+        for(y = -radiusY; y <= radiusY; ++y)
+        {
+            sy = min(max(0, dy + y), height - 1);
+            for(x = -radiusX; x <= radiusX; ++x)
+            {
+                sx = min(max(0, dx + x), width - 1);
+                sum += src[sx, sy];
+                sqsum += src[sx, sy]*src[sx, sy];
+            }
+        }
+        area = (2*radiusX + 1)*(2*radiusY + 1);
+        mean[dx, dy] = sum / area;
+        var[dx, dy] = max(sqsum / area - mean[dx, dy]*mean[dx, dy], 0);
+        \endverbatim
+        For 8-bit image the mean is rounded to nearest integer.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] width - a width of input and output images.
+        \param [in] height - a height of input and output images.
+        \param [in] channels - a channel number of input and output images. Its value must be in range [1..4].
+        \param [in] type - a channel type of input image and output mean image.
+        \param [in] radiusX - a horizontal radius of window.
+        \param [in] radiusY - a vertical radius of window.
+                             For 8-bit image window area (2*radiusX + 1)*(2*radiusY + 1) must not exceed 33025.
+        \return a pointer to filter context. On error it returns NULL.
+                This pointer is used in functions ::SimdBoxFilterRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdBoxFilterInit(size_t width, size_t height, size_t channels, SimdBoxFilterChannelType type, size_t radiusX, size_t radiusY);
+
+    /*! @ingroup other_filter
+
+        \fn void SimdBoxFilterRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* mean, size_t meanStride, float* var, size_t varStride);
+
+        \short Estimates local mean and (optionally) local variance of image.
+
+        \param [in] filter - a filter context. It must be created by function ::SimdBoxFilterInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image (8-bit or 32-bit float channels).
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] mean - a pointer to pixels data of the output local mean image. It has the same channel type as input image.
+        \param [in] meanStride - a row size (in bytes) of the output local mean image.
+        \param [out] var - a pointer to pixels data of the output 32-bit float local variance image. Can be NULL.
+        \param [in] varStride - a row size (in bytes) of the output local variance image.
+    */
+    SIMD_API void SimdBoxFilterRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* mean, size_t meanStride, float* var, size_t varStride);
+
+    /*! @ingroup other_filter
+
+        \fn void * SimdMorphologyInit(size_t width, size_t height, SimdMorphologyOperationType operation, size_t kernelX, size_t kernelY);
+
+        \short Creates context of morphological filter (erosion, dilation, opening or closing) of 8-bit gray image with rectangular structuring element of arbitrary size.
+
+        Rectangular kernel is separable into vertical and horizontal passes. Each pass uses van Herk/Gil-Werman algorithm,
+        so computational cost per pixel does not depend on kernel size (about 3 min/max operations per pass).
+        Pixels outside of the image are ignored (they are treated as 255 for erosion and as 0 for dilation).
+        Erosion is estimated as:
+        \verbatim
+        ax = kernelX / 2;
+        ay = kernelY / 2;
+        dst[x, y] = 255;
+        for(dy = 0; dy < kernelY; ++dy)
+            for(dx = 0; dx < kernelX; ++dx)
+                if(0 <= y + dy - ay < height && 0 <= x + dx - ax < width)
+                    dst[x, y] = min(dst[x, y], src[x + dx - ax, y + dy - ay]);
+        \endverbatim
+        Dilation uses maximum instead of minimum. The second pass of opening and closing uses reflected anchor (kernelX - 1 - ax, kernelY - 1 - ay),
+        so results are exact for even kernel sizes too.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] width - a width of input and output images.
+        \param [in] height - a height of input and output images.
+        \param [in] operation - a type of morphological operation.
+        \param [in] kernelX - a width of structuring element. It must be greater than 0.
+        \param [in] kernelY - a height of structuring element. It must be greater than 0.
+        \return a pointer to filter context. On error it returns NULL.
+                This pointer is used in functions ::SimdMorphologyRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdMorphologyInit(size_t width, size_t height, SimdMorphologyOperationType operation, size_t kernelX, size_t kernelY);
+
+    /*! @ingroup other_filter
+
+        \fn void SimdMorphologyRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        \short Performs morphological filtration of 8-bit gray image.
+
+        \param [in] filter - a filter context. It must be created by function ::SimdMorphologyInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the output image. It must not overlap with input image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdMorphologyRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+    /*! @ingroup other_filter
+
+        \fn void * SimdDistanceTransformInit(size_t width, size_t height, SimdDistanceTransformType type, SimdDistanceTransformDataType data);
+
+        \short Creates context of distance transform of 8-bit mask image.
+
+        For every pixel of the mask it finds a distance to the nearest pixel with given index.
+        Euclidean distance transform is exact: a vertical pass finds distances to the nearest index pixel in every column 
+        (it is vectorized across columns) and a horizontal pass computes a lower envelope of parabolas for every row.
+        Chamfer distance transforms use forward and backward raster scans with 3x3 or 5x5 masks.
+        If the mask does not contain pixels with given index, the output is undefined (very large values).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber). 
+            The raster scans of chamfer distance transforms are pipelined over column tiles of at least 256 pixels, 
+            so they use several threads only for wide images.
+
+        \param [in] width - a width of the mask and output images.
+        \param [in] height - a height of the mask and output images. Sum of width and height must be less than 32768.
+        \param [in] type - a type of distance transform (see ::SimdDistanceTransformType).
+        \param [in] data - a type of output image (see ::SimdDistanceTransformDataType).
+        \return a pointer to distance transform context. On error it returns NULL.
+                This pointer is used in functions ::SimdDistanceTransformRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdDistanceTransformInit(size_t width, size_t height, SimdDistanceTransformType type, SimdDistanceTransformDataType data);
+
+    /*! @ingroup other_filter
+
+        \fn void SimdDistanceTransformRun(void* context, const uint8_t* mask, size_t maskStride, uint8_t index, uint8_t* dst, size_t dstStride);
+
+        \short Performs distance transform of 8-bit mask image.
+
+        \param [in, out] context - a distance transform context. It must be created by function ::SimdDistanceTransformInit and released by function ::SimdRelease.
+        \param [in] mask - a pointer to pixels data of the 8-bit mask image.
+        \param [in] maskStride - a row size (in bytes) of the mask image.
+        \param [in] index - a mask index of pixels which distance is zero (for example 0 to get distance from object pixels to background).
+        \param [out] dst - a pointer to pixels data of the output image (32-bit float or 16-bit unsigned integer).
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdDistanceTransformRun(void* context, const uint8_t* mask, size_t maskStride, uint8_t index, uint8_t* dst, size_t dstStride);
+
     /*! @ingroup matrix
 
         \fn void SimdGemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
@@ -3608,6 +4084,46 @@ extern "C"
     */
     SIMD_API void SimdNormalizeHistogram(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup histogram
+
+        \fn void * SimdClaheInit(size_t width, size_t height, size_t tilesX, size_t tilesY, float clipLimit);
+
+        \short Creates context of contrast limited adaptive histogram equalization (CLAHE).
+
+        The image is divided into tilesX x tilesY tiles. A histogram of every tile is clipped at clipLimit * tileArea / 256 
+        (the excess is uniformly redistributed over all bins) and converted into a tile equalization lookup table.
+        An output pixel is a bilinear interpolation of the lookup tables of the four nearest tile centers. 
+        Unlike ::SimdNormalizeHistogram it adapts to local contrast (for example on backlit scenes).
+        It can be applied to 8-bit gray images or to the Y (luma) plane of YUV images.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] width - a width of input and output images.
+        \param [in] height - a height of input and output images.
+        \param [in] tilesX - a number of tiles in horizontal direction. It must be in range [1, width].
+        \param [in] tilesY - a number of tiles in vertical direction. It must be in range [1, height].
+        \param [in] clipLimit - a relative clip limit of tile histograms (typical value is 2-4). 
+            It must be non-negative. Zero value disables clipping (ordinary adaptive histogram equalization).
+        \return a pointer to CLAHE context. On error it returns NULL.
+                This pointer is used in functions ::SimdClaheRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdClaheInit(size_t width, size_t height, size_t tilesX, size_t tilesY, float clipLimit);
+
+    /*! @ingroup histogram
+
+        \fn void SimdClaheRun(void* clahe, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        \short Performs contrast limited adaptive histogram equalization of 8-bit gray image.
+
+        \param [in, out] clahe - a CLAHE context. It must be created by function ::SimdClaheInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input 8-bit gray image (or Y plane of YUV image).
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the output 8-bit gray image. It can be the same as input image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdClaheRun(void* clahe, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
     /*! @ingroup hog
 
         \fn void SimdHogDirectionHistograms(const uint8_t * src, size_t stride, size_t width, size_t height, size_t cellX, size_t cellY, size_t quantization, float * histograms);
@@ -3724,6 +4240,8 @@ extern "C"
 
         \short Saves an image to file in given image file format.
 
+        Encoded data are written to the file by chunks, so the whole output image file is not stored in memory.
+
         \note This function has a C++ wrapper Simd::View::Save(const std::string & path, ::SimdImageFileType type = ::SimdImageFileUndefined, int quality = 100).
 
         \param [in] src - a pointer to pixels data of input image.
@@ -3809,6 +4327,8 @@ extern "C"
 
         \short Loads an image from file.
 
+        The input file is mapped to memory (if it is possible) and decoded in place without intermediate copying.
+
         \note This function has a C++ wrapper Simd::View::Load(const std::string & path, Simd::View::Format format = Simd::View::None).
 
         \param [in] path - a path to input image file.
@@ -3823,6 +4343,94 @@ extern "C"
     */
     SIMD_API uint8_t* SimdImageLoadFromFile(const char* path, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType * format);
 
+    /*! @ingroup image_io
+
+        \fn void* SimdImageLoadBandInit(const char* path, SimdPixelFormatType* format, size_t* width, size_t* height);
+
+        \short Creates a context of band-wise (row by row) image loading from file.
+
+        The input file is mapped to memory and decoded by horizontal bands, so peak memory consumption is proportional to image width, not to its area.
+        Now binary PGM/PPM and PNG (8-bit, non-interlaced, without palette and transparency chunk) files are supported.
+
+        An using example (resize of large image file and saving of it to JPEG without loading of whole image to memory):
+        \verbatim
+        SimdPixelFormatType format = SimdPixelFormatRgb24;
+        size_t srcW, srcH, band = 64;
+        void * loader = SimdImageLoadBandInit(srcPath, &format, &srcW, &srcH);
+        void * resizer = SimdResizerBandInit(srcW, srcH, dstW, dstH, 3, SimdResizeChannelByte, SimdResizeMethodArea);
+        void * saver = SimdImageSaveBandInit(dstW, dstH, format, 85, dstPath);
+        std::vector<uint8_t> src(srcW * 3 * band), dst(dstW * 3 * ((band + 4) * dstH / srcH + 2));
+        for (size_t row = 0; row < srcH; row += band)
+        {
+            size_t srcRows = SimdImageLoadBandRun(loader, src.data(), srcW * 3, band);
+            size_t dstRows = SimdResizerBandRun(resizer, src.data(), srcW * 3, srcRows, dst.data(), dstW * 3);
+            SimdImageSaveBandRun(saver, dst.data(), dstW * 3, dstRows);
+        }
+        SimdRelease(saver);
+        SimdRelease(resizer);
+        SimdRelease(loader);
+        \endverbatim
+
+        \param [in] path - a path to input image file.
+        \param [in, out] format - a pointer to pixel format of output image.
+            Here you can set desired pixel format (it can be ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32).
+            Or set ::SimdPixelFormatNone and use pixel format of input image file.
+        \param [out] width - a pointer to width of output image.
+        \param [out] height - a pointer to height of output image.
+        \return a pointer to band loader context. On error it returns NULL.
+            This pointer is used in function ::SimdImageLoadBandRun. It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdImageLoadBandInit(const char* path, SimdPixelFormatType* format, size_t* width, size_t* height);
+
+    /*! @ingroup image_io
+
+        \fn size_t SimdImageLoadBandRun(void* loader, uint8_t* dst, size_t stride, size_t rows);
+
+        \short Loads next band of rows of image from file.
+
+        \param [in, out] loader - a band loader context. It must be created by function ::SimdImageLoadBandInit and released by function ::SimdRelease.
+        \param [out] dst - a pointer to pixels data of output band.
+        \param [in] stride - a row size of output band in bytes.
+        \param [in] rows - a maximal number of rows to load.
+        \return a number of actually loaded rows. It is less than rows at the end of image or on error.
+    */
+    SIMD_API size_t SimdImageLoadBandRun(void* loader, uint8_t* dst, size_t stride, size_t rows);
+
+    /*! @ingroup image_io
+
+        \fn void* SimdImageSaveBandInit(size_t width, size_t height, SimdPixelFormatType format, int quality, const char* path);
+
+        \short Creates a context of band-wise (row by row) saving of image to JPEG file.
+
+        Rows are encoded as soon as a full row of JPEG blocks is accumulated and the encoded data are written to the file by chunks,
+        so neither the whole input image nor the whole output file is stored in memory. The file is closed after writing of the last row.
+        See an using example in description of function ::SimdImageLoadBandInit.
+
+        \param [in] width - a width of output image.
+        \param [in] height - a height of output image.
+        \param [in] format - a pixel format of input rows.
+            Supported pixel formats: ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32.
+        \param [in] quality - a parameter of compression quality.
+        \param [in] path - a path to output JPEG file.
+        \return a pointer to band saver context. On error it returns NULL.
+            This pointer is used in function ::SimdImageSaveBandRun. It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdImageSaveBandInit(size_t width, size_t height, SimdPixelFormatType format, int quality, const char* path);
+
+    /*! @ingroup image_io
+
+        \fn SimdBool SimdImageSaveBandRun(void* saver, const uint8_t* src, size_t stride, size_t rows);
+
+        \short Saves next band of rows of image to JPEG file.
+
+        \param [in, out] saver - a band saver context. It must be created by function ::SimdImageSaveBandInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of input band.
+        \param [in] stride - a row size of input band in bytes.
+        \param [in] rows - a number of rows in the band. Rows beyond image height are ignored.
+        \return result of the operation.
+    */
+    SIMD_API SimdBool SimdImageSaveBandRun(void* saver, const uint8_t* src, size_t stride, size_t rows);
+
     /*! @ingroup other_conversion
 
         \fn void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride);
@@ -4161,7 +4769,36 @@ extern "C"
     SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height,
         size_t channelCount, uint8_t * dst, size_t dstStride);
 
-    /*! @ingroup neural
+    /*! @ingroup median_filter
+
+        \fn void SimdMedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride);
+
+        \short Performs median filtration of input image (filter window is a square (2*radius + 1)x(2*radius + 1)).
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+        Image borders are replicated. The filter uses Perreault-Hebert algorithm: it keeps two-level (16 coarse and 256 fine bins) histogram 
+        for every image column and updates window histogram by adding and subtracting column histograms, so computational cost per pixel 
+        does not depend on radius. It is intended for large windows (7x7 and more),
+        for 3x3 and 5x5 windows use functions ::SimdMedianFilterSquare3x3 and ::SimdMedianFilterSquare5x5.
+        SIMD optimizations (SSE4.1, AVX2) accelerate only the window histogram arithmetic, the update of column histograms is scalar.
+
+        \note This function has a C++ wrappers: Simd::MedianFilterSquare(const View<A>& src, size_t radius, View<A>& dst).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] src - a pointer to pixels data of original input image.
+        \param [in] srcStride - a row size of src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channelCount - a channel count.
+        \param [in] radius - a radius of filter window. It must be in range [0..127].
+        \param [out] dst - a pointer to pixels data of filtered output image. It must not overlap with input image.
+        \param [in] dstStride - a row size of dst image.
+    */
+    SIMD_API void SimdMedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup neural
 
         \fn void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion);
 
@@ -4826,6 +5463,9 @@ extern "C"
 
         \short Performs image recursive bilateral filtering.
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+               The horizontal pass is split by rows, the vertical pass is split by column blocks.
+
         \param [in] filter - a filter context. It must be created by function ::SimdRecursiveBilateralFilterInit and released by function ::SimdRelease.
         \param [in] src - a pointer to pixels data of the original input image.
         \param [in] srcStride - a row size (in bytes) of the input image.
@@ -5094,6 +5734,202 @@ extern "C"
     */
     SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup resizing
+
+        \fn void * SimdResizerBandInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        \short Creates context of band-wise (row by row) image resizing.
+
+        The context keeps a window of input rows between calls of ::SimdResizerBandRun and resizes them with the same (SIMD optimized) resizer as ::SimdResizerRun,
+        so an input image can be passed by bands of arbitrary height, the result is identical to full frame resizing and memory consumption is proportional to image width.
+        See an using example in description of function ::SimdImageLoadBandInit.
+
+        \note Now only ::SimdResizeChannelByte with 1-4 channels is supported. Methods ::SimdResizeMethodBilinearCaffe, ::SimdResizeMethodBilinearPytorch,
+            ::SimdResizeMethodLanczos3 and ::SimdResizeMethodMitchell are not supported.
+
+        \param [in] srcX - a width of the input image.
+        \param [in] srcY - a height of the input image.
+        \param [in] dstX - a width of the output image.
+        \param [in] dstY - a height of the output image.
+        \param [in] channels - a channel number of input and output image.
+        \param [in] type - a type of input and output image channel.
+        \param [in] method - a method used in order to resize image.
+        \return a pointer to resize context. On error it returns NULL. 
+                This pointer is used in functions ::SimdResizerBandRun. 
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdResizerBandInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+    /*! @ingroup resizing
+
+        \fn size_t SimdResizerBandRun(void * resizer, const uint8_t * src, size_t srcStride, size_t srcRows, uint8_t * dst, size_t dstStride);
+
+        \short Resizes next band of rows of the input image.
+
+        \param [in, out] resizer - a resize context. It must be created by function ::SimdResizerBandInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the next band of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input band.
+        \param [in] srcRows - a number of rows in the input band.
+        \param [out] dst - a pointer to pixels data of output rows which are ready after processing of the band. 
+            Its size must be enough to store (srcRows + 4) * dstY / srcY + 2 rows.
+        \param [in] dstStride - a row size (in bytes) of the output rows.
+        \return a number of output rows written to dst.
+    */
+    SIMD_API size_t SimdResizerBandRun(void * resizer, const uint8_t * src, size_t srcStride, size_t srcRows, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup resizing
+
+        \fn void * SimdResizerYuv420Init(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType dstFormat, SimdYuvType yuvType, SimdResizeMethodType method);
+
+        \short Creates context of fused resizing of YUV420P (or NV12) image with conversion to 24-bit BGR (or RGB) image.
+
+        Planes of input image are resized row by row to cached rows of output size, which are immediately converted to BGR (RGB),
+        so no intermediate full size image is allocated. Chroma planes are sampled at their own (half) resolution.
+
+        \note Now only ::SimdResizeMethodNearest and ::SimdResizeMethodBilinear are supported. Input image width and height must be at least 4.
+
+        \param [in] srcX - a width of the input image (Y plane).
+        \param [in] srcY - a height of the input image (Y plane).
+        \param [in] dstX - a width of the output image.
+        \param [in] dstY - a height of the output image.
+        \param [in] dstFormat - a pixel format of output image. It can be ::SimdPixelFormatBgr24 or ::SimdPixelFormatRgb24.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+        \param [in] method - a method used in order to resize image.
+        \return a pointer to resize context. On error it returns NULL.
+                This pointer is used in functions ::SimdResizerYuv420pRun and ::SimdResizerNv12Run.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdResizerYuv420Init(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType dstFormat, SimdYuvType yuvType, SimdResizeMethodType method);
+
+    /*! @ingroup resizing
+
+        \fn void SimdResizerYuv420pRun(const void * resizer, const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, uint8_t * dst, size_t dstStride);
+
+        \short Resizes YUV420P image and converts it to 24-bit BGR (or RGB) image.
+
+        \param [in] resizer - a resize context. It must be created by function ::SimdResizerYuv420Init and released by function ::SimdRelease.
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [out] dst - a pointer to pixels data of output 24-bit BGR (or RGB) image.
+        \param [in] dstStride - a row size of the output image.
+    */
+    SIMD_API void SimdResizerYuv420pRun(const void * resizer, const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup resizing
+
+        \fn void SimdResizerNv12Run(const void * resizer, const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, uint8_t * dst, size_t dstStride);
+
+        \short Resizes NV12 image and converts it to 24-bit BGR (or RGB) image.
+
+        \param [in] resizer - a resize context. It must be created by function ::SimdResizerYuv420Init and released by function ::SimdRelease.
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [out] dst - a pointer to pixels data of output 24-bit BGR (or RGB) image.
+        \param [in] dstStride - a row size of the output image.
+    */
+    SIMD_API void SimdResizerNv12Run(const void * resizer, const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup resizing
+
+        \fn void * SimdResizerBatchInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method, SimdTensorFormatType format);
+
+        \short Creates context of batched crop and resize (ROI align) of many regions of one image.
+
+        Every region of interest is resized to the same output size and stored in one contiguous output tensor.
+        Interpolation coefficients of all regions are kept in one buffer of the context, and regions are distributed across threads.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+            Now only ::SimdResizeChannelByte and ::SimdResizeChannelFloat with ::SimdResizeMethodNearest and ::SimdResizeMethodBilinear are supported.
+
+        \param [in] srcX - a width of the input image. It must be at least 2.
+        \param [in] srcY - a height of the input image. It must be at least 2.
+        \param [in] dstX - a width of every output image.
+        \param [in] dstY - a height of every output image.
+        \param [in] channels - a channel number of input and output image.
+        \param [in] type - a type of input and output image channel.
+        \param [in] method - a method used in order to resize regions.
+        \param [in] format - a format of output tensor. It can be ::SimdTensorFormatNhwc or ::SimdTensorFormatNchw.
+        \return a pointer to resize context. On error it returns NULL.
+                This pointer is used in functions ::SimdResizerBatchRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdResizerBatchInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method, SimdTensorFormatType format);
+
+    /*! @ingroup resizing
+
+        \fn void SimdResizerBatchRun(const void * resizer, const uint8_t * src, size_t srcStride, const float * rois, size_t count, uint8_t * dst);
+
+        \short Crops and resizes given regions of the input image.
+
+        \param [in] resizer - a resize context. It must be created by function ::SimdResizerBatchInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [in] rois - a pointer to regions of interest. Every region is given by 4 values (left, top, right, bottom) in pixel coordinates of the input image.
+            Regions may be fractional and may cross image borders (border pixels are replicated).
+        \param [in] count - a number of regions.
+        \param [out] dst - a pointer to output tensor with size count * dstY * dstX * channels (NHWC) or count * channels * dstY * dstX (NCHW).
+    */
+    SIMD_API void SimdResizerBatchRun(const void * resizer, const uint8_t * src, size_t srcStride, const float * rois, size_t count, uint8_t * dst);
+
+    /*! @ingroup resizing
+
+        \fn void * SimdResizerTensorInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method, SimdTensorFormatType format, SimdTensorDataType type, const float * scale, const float * shift, SimdBool letterbox, float fill);
+
+        \short Creates context of resizing of 8-bit image directly to normalized floating point input tensor of neural network.
+
+        Every output value is equal to: 
+        \verbatim
+        dst[c] = resized[c] * scale[c] + shift[c];
+        \endverbatim
+        where resized[c] is not rounded result of interpolation of the input image. Normalization and conversion are fused to the final (vertical) pass of resizing.
+        In letterbox mode the image is resized with preserved aspect ratio to size (imgX, imgY) and is centered in the output canvas:
+        \verbatim
+        k = Min(dstX / srcX, dstY / srcY);
+        imgX = Round(srcX * k), imgY = Round(srcY * k);
+        left = (dstX - imgX) / 2, top = (dstY - imgY) / 2;
+        \endverbatim
+        The rest of canvas is filled by value fill * scale[c] + shift[c].
+
+        \note Now only ::SimdResizeMethodNearest and ::SimdResizeMethodBilinear are supported.
+
+        \param [in] srcX - a width of the input image. It must be at least 2.
+        \param [in] srcY - a height of the input image. It must be at least 2.
+        \param [in] dstX - a width of the output tensor.
+        \param [in] dstY - a height of the output tensor.
+        \param [in] channels - a channel number of input image and output tensor. It must be in range [1..4].
+        \param [in] method - a method used in order to resize image.
+        \param [in] format - a format of output tensor. It can be ::SimdTensorFormatNchw or ::SimdTensorFormatNhwc.
+        \param [in] type - a type of output tensor. It can be ::SimdTensorData32f or ::SimdTensorData16b.
+        \param [in] scale - a pointer to array with per channel scale. Its size must be equal to channels. Can be NULL (scale is 1.0).
+        \param [in] shift - a pointer to array with per channel shift. Its size must be equal to channels. Can be NULL (shift is 0.0).
+        \param [in] letterbox - a flag of letterbox mode (aspect ratio of the input image is preserved).
+        \param [in] fill - a value (in units of the input image) used to fill borders of letterbox canvas.
+        \return a pointer to resize context. On error it returns NULL.
+                This pointer is used in functions ::SimdResizerTensorRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdResizerTensorInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method,
+        SimdTensorFormatType format, SimdTensorDataType type, const float * scale, const float * shift, SimdBool letterbox, float fill);
+
+    /*! @ingroup resizing
+
+        \fn void SimdResizerTensorRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst);
+
+        \short Resizes 8-bit image to normalized floating point tensor.
+
+        \param [in] resizer - a resize context. It must be created by function ::SimdResizerTensorInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to output tensor. Its size must be equal to dstY * dstX * channels elements of given type.
+    */
+    SIMD_API void SimdResizerTensorRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst);
+
     /*! @ingroup rgb_conversion
 
         \fn void SimdRgbToBgra(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
@@ -5247,6 +6083,108 @@ extern "C"
     SIMD_API void SimdSegmentationShrinkRegion(const uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index,
         ptrdiff_t * left, ptrdiff_t * top, ptrdiff_t * right, ptrdiff_t * bottom);
 
+    /*! @ingroup segmentation
+
+        \fn void * SimdConnectedComponentsInit(size_t width, size_t height, SimdConnectivityType connectivity, SimdBool moments);
+
+        \short Creates context of connected components labeling.
+
+        The mask image is split into runs of pixels with given index. Runs of every horizontal strip of the image are merged
+        with runs of the previous row with using of union-find, then the strips are merged along their boundaries.
+        Labels are numbered from 1 in the order of the first pixel of a component (in raster order), 
+        so result does not depend on a number of threads.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] width - a width of the mask image.
+        \param [in] height - a height of the mask image.
+        \param [in] connectivity - a connectivity of pixels (see ::SimdConnectivityType).
+        \param [in] moments - a flag to calculate second-order moments of components.
+        \return a pointer to connected components context. On error it returns NULL.
+                This pointer is used in functions ::SimdConnectedComponentsRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdConnectedComponentsInit(size_t width, size_t height, SimdConnectivityType connectivity, SimdBool moments);
+
+    /*! @ingroup segmentation
+
+        \fn size_t SimdConnectedComponentsRun(void* context, const uint8_t* mask, size_t maskStride, uint8_t index, uint32_t* labels, size_t labelsStride, const SimdConnectedComponent** components);
+
+        \short Labels connected components of pixels with given index and calculates their statistics.
+
+        \param [in, out] context - a connected components context. It must be created by function ::SimdConnectedComponentsInit and released by function ::SimdRelease.
+        \param [in] mask - a pointer to pixels data of the 8-bit mask image.
+        \param [in] maskStride - a row size (in bytes) of the mask image.
+        \param [in] index - a mask index of foreground pixels.
+        \param [out] labels - a pointer to 32-bit label image. Background pixels are set to 0, pixels of components to 1, 2, ... N.
+                    It can be NULL.
+        \param [in] labelsStride - a row size (in bytes) of the label image.
+        \param [out] components - a pointer to returned array of N component statistics (component with label i has index i - 1). 
+                    The array is owned by the context and is valid until next call of the function. It can be NULL.
+        \return a number of found components N.
+    */
+    SIMD_API size_t SimdConnectedComponentsRun(void* context, const uint8_t* mask, size_t maskStride, uint8_t index, 
+        uint32_t* labels, size_t labelsStride, const SimdConnectedComponent** components);
+
+    /*! @ingroup optical_flow
+
+        \fn void * SimdOpticalFlowLkInit(size_t width, size_t height, size_t levels, size_t radius, size_t iterations, float epsilon, float minEigenvalue);
+
+        \short Creates context of pyramidal Lucas-Kanade sparse optical flow tracker.
+
+        The context keeps image pyramids (built with ::SimdReduceGray5x5) and their gradients (::SimdSobelDx and ::SimdSobelDy) for two last frames.
+        They are built once per frame by function ::SimdOpticalFlowLkSetFrame and are shared by all tracked points.
+        Every point is tracked from the coarsest pyramid level to the finest one: the tracker samples bilinear image patch (2*radius + 1)x(2*radius + 1)
+        and its gradients around the point in previous frame and iteratively solves 2x2 normal equations of the patch to find its shift in current frame.
+        Image borders are replicated.
+
+        \param [in] width - a width of input frames.
+        \param [in] height - a height of input frames.
+        \param [in] levels - a number of pyramid levels (1 means tracking without pyramid). Its value must be in range [1..16].
+        \param [in] radius - a radius of tracked patch. Its value must be in range [1..63].
+        \param [in] iterations - a maximal number of iterations at each pyramid level.
+        \param [in] epsilon - iterations at pyramid level are stopped when the point shift is less than this value (in pixels).
+        \param [in] minEigenvalue - a minimal eigenvalue of averaged structure tensor of the patch (squared intensity differences per squared pixel).
+                                    Points with lower value are considered untrackable.
+        \return a pointer to tracker context. On error it returns NULL.
+                This pointer is used in functions ::SimdOpticalFlowLkSetFrame and ::SimdOpticalFlowLkTrack.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdOpticalFlowLkInit(size_t width, size_t height, size_t levels, size_t radius, size_t iterations, float epsilon, float minEigenvalue);
+
+    /*! @ingroup optical_flow
+
+        \fn void SimdOpticalFlowLkSetFrame(void * context, const uint8_t * src, size_t srcStride);
+
+        \short Adds new frame to pyramidal Lucas-Kanade tracker.
+
+        It builds image and gradient pyramids of the frame. The previously added frame becomes the previous frame of the tracker.
+
+        \note This function uses SIMD optimized image pyramid and gradient estimation functions.
+
+        \param [in, out] context - a tracker context. It must be created by function ::SimdOpticalFlowLkInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of 8-bit gray input frame.
+        \param [in] srcStride - a row size of the input frame.
+    */
+    SIMD_API void SimdOpticalFlowLkSetFrame(void * context, const uint8_t * src, size_t srcStride);
+
+    /*! @ingroup optical_flow
+
+        \fn void SimdOpticalFlowLkTrack(void * context, const float * prev, float * next, uint8_t * status, size_t count);
+
+        \short Tracks points from previous frame to current frame of pyramidal Lucas-Kanade tracker.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber). Points are distributed between threads.
+
+        \param [in] context - a tracker context. It must be created by function ::SimdOpticalFlowLkInit and released by function ::SimdRelease.
+        \param [in] prev - a pointer to array of (x, y) coordinates of points in previous frame. Its size is 2*count.
+        \param [out] next - a pointer to array of (x, y) coordinates of tracked points in current frame. Its size is 2*count.
+        \param [out] status - a pointer to array of point status: 1 - point is tracked, 0 - point is lost. Its size is count.
+                               If less than two frames were added to the tracker all points are lost.
+        \param [in] count - a number of points.
+    */
+    SIMD_API void SimdOpticalFlowLkTrack(void * context, const float * prev, float * next, uint8_t * status, size_t count);
+
     /*! @ingroup shifting
 
         \fn void SimdShiftBilinear(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, const uint8_t * bkg, size_t bkgStride, const double * shiftX, const double * shiftY, size_t cropLeft, size_t cropTop, size_t cropRight, size_t cropBottom, uint8_t * dst, size_t dstStride);
@@ -5507,6 +6445,45 @@ extern "C"
     */
     SIMD_API void SimdContourAnchors(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t step, int16_t threshold, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup contour
+
+        \fn void * SimdCannyInit(size_t width, size_t height, float lowThreshold, float highThreshold);
+
+        \short Creates context of Canny edge detector.
+
+        The detector estimates image gradients with using of Sobel's filters (see functions ::SimdSobelDx and ::SimdSobelDy),
+        uses L1 norm |dx| + |dy| as gradient magnitude, performs non-maximum suppression along gradient direction
+        (quantized to horizontal, vertical and two diagonal directions) and hysteresis thresholding:
+        points with magnitude greater than highThreshold are edges, points with magnitude greater than lowThreshold 
+        are edges if they are 8-connected with other edge points. Image borders are replicated.
+        Gradients are processed in horizontal bands which fit in L2 cache.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] width - a width of input and output images. It must be greater than 1.
+        \param [in] height - a height of input and output images.
+        \param [in] lowThreshold - a low threshold of hysteresis. It must be non-negative.
+        \param [in] highThreshold - a high threshold of hysteresis. It must not be less than lowThreshold.
+        \return a pointer to detector context. On error it returns NULL.
+                This pointer is used in functions ::SimdCannyRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdCannyInit(size_t width, size_t height, float lowThreshold, float highThreshold);
+
+    /*! @ingroup contour
+
+        \fn void SimdCannyRun(void* canny, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        \short Detects edges on the image with using of Canny algorithm.
+
+        \param [in, out] canny - a detector context. It must be created by function ::SimdCannyInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input 8-bit gray image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the output 8-bit gray image. Edge points are set to 255, other points are set to 0.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdCannyRun(void* canny, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
     /*! @ingroup correlation
 
         \fn void SimdSquaredDifferenceSum(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, uint64_t * sum);
@@ -7676,8 +8653,9 @@ extern "C"
         \param [in] dstS - a row size (in bytes) of the output image.
         \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
         \param [in] mat - a pointer to 2x3 matrix with coefficients of affine warp.
-        \param [in] flags - a flags of algorithm parameters.
-        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to channels.
+        \param [in] flags - a flags of algorithm parameters. Channel type (::SimdWarpAffineChannelByte, ::SimdWarpAffineChannelShort or ::SimdWarpAffineChannelFloat)
+                             can be combined with any interpolation method (nearest, bilinear or bicubic).
+        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to channels, its elements have the channel type.
                              It parameter is actual for SimdWarpAffineBorderConstant flag. It can be NULL.
         \return a pointer to warp affine context. On error it returns NULL.
                 This pointer is used in functions ::SimdWarpAffineRun.
@@ -7700,6 +8678,213 @@ extern "C"
     */
     SIMD_API void SimdWarpAffineRun(const void* context, const uint8_t* src, uint8_t* dst);
 
+    /*! @ingroup warp_affine
+
+        \fn void* SimdWarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border, SimdTensorDataType type, const float* lower, const float* upper);
+
+        \short Creates batch warp affine context.
+
+        The batch context warps one input image with a set of affine matrices (for example to align several detected faces) into a contiguous batch of output images
+        of the same size. Work is distributed across images of the batch instead of rows of single image, internal buffers are allocated once and reused by subsequent calls.
+        If output type is ::SimdTensorData32f then the aligned images are additionally converted to normalized NCHW float tensor (see ::SimdSynetSetInput):
+        \verbatim
+        dst[((i*C + c)*dstH + y)*dstW + x] = warped[i](x, y)[c]*(upper[c] - lower[c])/255 + lower[c];
+        \endverbatim
+        where C is 1 for gray input image and 3 for 3 and 4-channel input image (alpha channel is ignored).
+
+        \param [in] srcW - a width of input image.
+        \param [in] srcH - a height of input image.
+        \param [in] srcS - a row size (in bytes) of input image.
+        \param [in] dstW - a width of each output image.
+        \param [in] dstH - a height of each output image.
+        \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
+        \param [in] flags - a flags of algorithm parameters (see ::SimdWarpAffineInit).
+        \param [in] border - a pointer to to the array with color of border. It parameter is actual for SimdWarpAffineBorderConstant flag. It can be NULL.
+        \param [in] type - a type of output batch. ::SimdTensorData8u - output images have the same format as input image,
+                            ::SimdTensorData32f - normalized NCHW float tensor (it requires ::SimdWarpAffineChannelByte, ::SimdWarpAffineBorderConstant and 1, 3 or 4 channels).
+        \param [in] lower - a pointer to the array with lower bound of output tensor values. Its size is equal to C. It is used only for ::SimdTensorData32f. It can be NULL (zeros).
+        \param [in] upper - a pointer to the array with upper bound of output tensor values. Its size is equal to C. It is used only for ::SimdTensorData32f. It can be NULL (ones).
+        \return a pointer to batch warp affine context. On error it returns NULL.
+                This pointer is used in functions ::SimdWarpAffineBatchRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdWarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t channels,
+        SimdWarpAffineFlags flags, const uint8_t* border, SimdTensorDataType type, const float* lower, const float* upper);
+
+    /*! @ingroup warp_affine
+
+        \fn SimdBool SimdWarpAffineBatchRun(const void* context, const uint8_t* src, const float* mats, size_t count, uint8_t* dst);
+
+        \short Performs batch warp affine for current image.
+
+        All matrices are checked before processing: if any of them is not invertible then the function returns ::SimdFalse and output batch is not changed.
+
+        \param [in] context - a batch warp affine context. It must be created by function ::SimdWarpAffineBatchInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] mats - a pointer to array of count 2x3 matrices with coefficients of affine warp.
+        \param [in] count - a number of matrices (size of output batch).
+        \param [out] dst - a pointer to output batch. For ::SimdTensorData8u it contains count images with size dstW x dstH and row size dstW * channels * (channel size) tightly packed one by one.
+                            For ::SimdTensorData32f it contains float tensor with shape [count, C, dstH, dstW].
+        \return result of the operation: ::SimdFalse if any of matrices is not invertible.
+    */
+    SIMD_API SimdBool SimdWarpAffineBatchRun(const void* context, const uint8_t* src, const float* mats, size_t count, uint8_t* dst);
+
+    /*! @ingroup warp_affine
+
+        \fn void * SimdWarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t * border);
+
+        \short Creates wrap perspective context.
+
+        Simplified, then warp perspective performs next transformation for every pixel:
+        \verbatim
+        z = x * mat[2][0] + y * mat[2][1] + mat[2][2];
+        dst[(x * mat[0][0] + y * mat[0][1] + mat[0][2]) / z, (x * mat[1][0] + y * mat[1][1] + mat[1][2]) / z] = src[x, y];
+        \endverbatim
+
+        So the matrix maps input image to output image (as for ::SimdWarpAffineInit). The inverse transformation is calculated inside.
+        The output pixels which correspond to points lying behind the horizon of the input plane are treated as points outside of the input image.
+
+        An using example (for BGR image):
+        \verbatim
+        float mat[3][3] = { { 1.0f, 0.1f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0005f, 1.0f } };
+        SimdWarpAffineFlags flags = SimdWarpAffineChannelByte | SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant;
+        void* context = SimdWarpPerspectiveInit(srcW, srcH, srcS, dstW, dstH, dstS, 3, mat, flags, NULL);
+        if (context)
+        {
+             SimdWarpPerspectiveRun(context, src, dst);
+             SimdRelease(context);
+        }
+        \endverbatim
+
+        \note This function has a C++ wrapper Simd::WarpPerspective(const View<A>& src, const float * mat, View<A>& dst, SimdWarpAffineFlags flags = SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant, const uint8_t* border = NULL).
+
+        \param [in] srcW - a width of input image.
+        \param [in] srcH - a height of input image.
+        \param [in] srcS - a row size (in bytes) of the input image.
+        \param [in] dstW - a width of output image.
+        \param [in] dstH - a height of output image.
+        \param [in] dstS - a row size (in bytes) of the output image.
+        \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
+        \param [in] mat - a pointer to 3x3 matrix with coefficients of perspective warp (homography).
+        \param [in] flags - a flags of algorithm parameters.
+        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to channels.
+                             It parameter is actual for SimdWarpAffineBorderConstant flag. It can be NULL.
+        \return a pointer to warp perspective context. On error (for example degenerate matrix) it returns NULL.
+                This pointer is used in functions ::SimdWarpPerspectiveRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdWarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS,
+        size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+    /*! @ingroup warp_affine
+
+        \fn void SimdWarpPerspectiveRun(const void* context, const uint8_t* src, uint8_t* dst);
+
+        \short Performs warp perspective for current image.
+
+        \note This function has a C++ wrapper Simd::WarpPerspective(const View<A>& src, const float * mat, View<A>& dst, SimdWarpAffineFlags flags = SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant, const uint8_t* border = NULL).
+
+        \param [in] context - a warp perspective context. It must be created by function ::SimdWarpPerspectiveInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [out] dst - a pointer to pixels data of the filtered output image.
+    */
+    SIMD_API void SimdWarpPerspectiveRun(const void* context, const uint8_t* src, uint8_t* dst);
+
+    /*! @ingroup warp_affine
+
+        \fn void * SimdRemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mapX, const float* mapY, size_t mapStride, SimdRemapFlags flags, const uint8_t* border);
+
+        \short Creates remap context.
+
+        Remap performs next transformation for every pixel:
+        \verbatim
+        dst[x, y] = src[mapX[x, y], mapY[x, y]];
+        \endverbatim
+
+        Integer map coordinates correspond to centers of input pixels. The maps are converted into compact fixed-point form (pixel offsets 
+        and 5-bit interpolation weights) once at initialization, so repeated calls of ::SimdRemapRun do not touch float maps.
+
+        An using example (for BGR image):
+        \verbatim
+        SimdRemapFlags flags = SimdRemapChannelByte | SimdRemapInterpBilinear | SimdRemapBorderConstant;
+        void* context = SimdRemapInit(srcW, srcH, srcS, dstW, dstH, dstS, 3, mapX, mapY, mapStride, flags, NULL);
+        if (context)
+        {
+             for(size_t i = 0; i < frames; ++i)
+                SimdRemapRun(context, src[i], dst[i]);
+             SimdRelease(context);
+        }
+        \endverbatim
+
+        \param [in] srcW - a width of input image. It must be less then 32768.
+        \param [in] srcH - a height of input image. It must be less then 32768.
+        \param [in] srcS - a row size (in bytes) of the input image.
+        \param [in] dstW - a width of output image.
+        \param [in] dstH - a height of output image.
+        \param [in] dstS - a row size (in bytes) of the output image.
+        \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
+        \param [in] mapX - a pointer to 32-bit float map of input X coordinates. Its size is equal to output image size.
+        \param [in] mapY - a pointer to 32-bit float map of input Y coordinates. Its size is equal to output image size.
+        \param [in] mapStride - a row size (in bytes) of the maps.
+        \param [in] flags - a flags of algorithm parameters.
+        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to channels.
+                             It parameter is actual for SimdRemapBorderConstant flag. It can be NULL.
+        \return a pointer to remap context. On error it returns NULL.
+                This pointer is used in functions ::SimdRemapRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdRemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+        const float* mapX, const float* mapY, size_t mapStride, SimdRemapFlags flags, const uint8_t* border);
+
+    /*! @ingroup warp_affine
+
+        \fn void * SimdRemapInitUndistortion(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* camera, const float* distortion, SimdRemapFlags flags, const uint8_t* border);
+
+        \short Creates remap context which performs lens undistortion.
+
+        The maps are generated from camera intrinsics (output image uses the same intrinsics) and distortion coefficients:
+        \verbatim
+        x = (u - cx) / fx, y = (v - cy) / fy, r2 = x*x + y*y;
+        Pinhole: 
+            xd = x*(1 + k1*r2 + k2*r2^2 + k3*r2^3) + 2*p1*x*y + p2*(r2 + 2*x*x);
+            yd = y*(1 + k1*r2 + k2*r2^2 + k3*r2^3) + p1*(r2 + 2*y*y) + 2*p2*x*y;
+        Fisheye:
+            t = atan(sqrt(r2)), td = t*(1 + k1*t^2 + k2*t^4 + k3*t^6 + k4*t^8);
+            xd = x*td/sqrt(r2), yd = y*td/sqrt(r2);
+        mapX[u, v] = xd * fx + cx, mapY[u, v] = yd * fy + cy;
+        \endverbatim
+
+        \param [in] srcW - a width of input (distorted) image. It must be less then 32768.
+        \param [in] srcH - a height of input (distorted) image. It must be less then 32768.
+        \param [in] srcS - a row size (in bytes) of the input image.
+        \param [in] dstW - a width of output (undistorted) image.
+        \param [in] dstH - a height of output (undistorted) image.
+        \param [in] dstS - a row size (in bytes) of the output image.
+        \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
+        \param [in] camera - a pointer to camera intrinsics: fx, fy, cx, cy.
+        \param [in] distortion - a pointer to distortion coefficients: k1, k2, p1, p2, k3 for ::SimdRemapModelPinhole or k1, k2, k3, k4 for ::SimdRemapModelFisheye.
+        \param [in] flags - a flags of algorithm parameters (including camera model).
+        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to channels.
+                             It parameter is actual for SimdRemapBorderConstant flag. It can be NULL.
+        \return a pointer to remap context. On error it returns NULL.
+                This pointer is used in functions ::SimdRemapRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdRemapInitUndistortion(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+        const float* camera, const float* distortion, SimdRemapFlags flags, const uint8_t* border);
+
+    /*! @ingroup warp_affine
+
+        \fn void SimdRemapRun(const void* context, const uint8_t* src, uint8_t* dst);
+
+        \short Performs remap for current image.
+
+        \param [in] context - a remap context. It must be created by function ::SimdRemapInit or ::SimdRemapInitUndistortion and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [out] dst - a pointer to pixels data of the output image.
+    */
+    SIMD_API void SimdRemapRun(const void* context, const uint8_t* src, uint8_t* dst);
+
     /*! @ingroup synet_winograd
 
         \fn void SimdWinogradKernel1x3Block1x4SetFilter(const float * src, size_t size, float * dst, SimdBool trans);
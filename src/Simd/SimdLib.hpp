@@ -2629,6 +2629,27 @@ namespace Simd
         SimdMedianFilterSquare5x5(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride);
     }
 
+    /*! @ingroup median_filter
+
+        \fn void MedianFilterSquare(const View<A>& src, size_t radius, View<A>& dst)
+
+        \short Performs median filtration of input image (filter window is a square (2*radius + 1)x(2*radius + 1)).
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function is a C++ wrapper for function ::SimdMedianFilterSquare.
+
+        \param [in] src - an original input image.
+        \param [in] radius - a radius of filter window. It must be in range [0..127].
+        \param [out] dst - a filtered output image.
+    */
+    template<template<class> class A> SIMD_INLINE void MedianFilterSquare(const View<A>& src, size_t radius, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.ChannelSize() == 1);
+
+        SimdMedianFilterSquare(src.data, src.stride, src.width, src.height, src.ChannelCount(), radius, dst.data, dst.stride);
+    }
+
     /*! @ingroup neural
 
         \fn void NeuralConvert(const View<A> & src, float * dst, size_t stride, bool inversion)
@@ -4166,8 +4187,10 @@ namespace Simd
     template<template<class> class A> SIMD_INLINE void WarpAffine(const View<A>& src, const float * mat, View<A>& dst, 
         SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant), const uint8_t* border = NULL)
     {
-        assert(src.format == dst.format && src.ChannelSize() == 1);
-        assert((flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelByte);
+        assert(src.format == dst.format);
+        assert((src.ChannelSize() == 1 && (flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelByte) ||
+            (src.format == View<A>::Int16 && (flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelShort) ||
+            (src.format == View<A>::Float && (flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelFloat));
 
         void* context = SimdWarpAffineInit(src.width, src.height, src.stride, dst.width, dst.height, dst.stride, src.ChannelCount(), mat, flags, border);
         if (context)
@@ -4177,6 +4200,35 @@ namespace Simd
         }
     }
 
+    /*! @ingroup warp_affine
+
+        \fn void WarpPerspective(const View<A>& src, const float * mat, View<A>& dst, SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant), const uint8_t* border = NULL)
+
+        \short Performs warp perspective for current image.
+
+        \note This function is a C++ wrapper for functions ::SimdWarpPerspectiveInit and ::SimdWarpPerspectiveRun.
+
+        \param [in] src - an input image.
+        \param [in] mat - a pointer to 3x3 matrix with coefficients of perspective warp.
+        \param [in, out] dst - an output image.
+        \param [in] flags - a flags of algorithm parameters. By default is equal to ::SimdWarpAffineChannelByte | ::SimdWarpAffineInterpBilinear | ::SimdWarpAffineBorderConstant.
+        \param [in] border - a pointer to to the array with color of border. The size of the array must be equal to channels.
+                             It parameter is actual for SimdWarpAffineBorderConstant flag. By default is equal to NULL.
+    */
+    template<template<class> class A> SIMD_INLINE void WarpPerspective(const View<A>& src, const float* mat, View<A>& dst,
+        SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant), const uint8_t* border = NULL)
+    {
+        assert(src.format == dst.format && src.ChannelSize() == 1);
+        assert((flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelByte);
+
+        void* context = SimdWarpPerspectiveInit(src.width, src.height, src.stride, dst.width, dst.height, dst.stride, src.ChannelCount(), mat, flags, border);
+        if (context)
+        {
+            SimdWarpPerspectiveRun(context, src.data, dst.data);
+            SimdRelease(context);
+        }
+    }
+
     /*! @ingroup warp_affine
 
         \fn bool InvertAffineTransform(const float* src, float* dst)
@@ -0,0 +1,130 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdLocalBinarization_h__
+#define __SimdLocalBinarization_h__
+
+#include "Simd/SimdBoxFilter.h"
+
+namespace Simd
+{
+    struct LocalBinarizationParam
+    {
+        size_t width;
+        size_t height;
+        SimdLocalBinarizationType type;
+        size_t radius;
+        float k;
+        float r;
+        size_t align;
+
+        LocalBinarizationParam(size_t w, size_t h, SimdLocalBinarizationType t, size_t rad, float k, float r, size_t a);
+        bool Valid() const;
+
+        size_t Area() const
+        {
+            return (2 * radius + 1) * (2 * radius + 1);
+        }
+    };
+
+    class LocalBinarization : Deletable
+    {
+    public:
+        LocalBinarization(const LocalBinarizationParam& param);
+
+        virtual void Run(const uint8_t* src, size_t srcStride, uint8_t positive, uint8_t negative, uint8_t* dst, size_t dstStride) = 0;
+
+    protected:
+        LocalBinarizationParam _param;
+    };
+
+    namespace Base
+    {
+        struct LocalBinarizationAlg
+        {
+            size_t step, colBuf, padBuf, bufSize, threads;
+            float norm, alpha, beta, gamma;
+        };
+
+        typedef void (*LocalBinarizationRowPtr)(const uint32_t* sum, const uint32_t* sqsum, size_t width, const LocalBinarizationAlg& alg,
+            const uint8_t* src, uint8_t positive, uint8_t negative, uint8_t* dst);
+
+        class LocalBinarizationDefault : public Simd::LocalBinarization
+        {
+        public:
+            LocalBinarizationDefault(const LocalBinarizationParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t positive, uint8_t negative, uint8_t* dst, size_t dstStride);
+
+        protected:
+            void Run(const uint8_t* src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t* buf, uint8_t positive, uint8_t negative, uint8_t* dst, size_t dstStride);
+
+            LocalBinarizationAlg _alg;
+            Array8u _buffer;
+            BoxFilterColUpdate8uPtr _colUpdate;
+            LocalBinarizationRowPtr _row;
+        };
+
+        void* LocalBinarizationInit(size_t width, size_t height, SimdLocalBinarizationType type, size_t radius, float k, float r);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class LocalBinarizationDefault : public Base::LocalBinarizationDefault
+        {
+        public:
+            LocalBinarizationDefault(const LocalBinarizationParam& param);
+        };
+
+        void* LocalBinarizationInit(size_t width, size_t height, SimdLocalBinarizationType type, size_t radius, float k, float r);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class LocalBinarizationDefault : public Sse41::LocalBinarizationDefault
+        {
+        public:
+            LocalBinarizationDefault(const LocalBinarizationParam& param);
+        };
+
+        void* LocalBinarizationInit(size_t width, size_t height, SimdLocalBinarizationType type, size_t radius, float k, float r);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class LocalBinarizationDefault : public Avx2::LocalBinarizationDefault
+        {
+        public:
+            LocalBinarizationDefault(const LocalBinarizationParam& param);
+        };
+
+        void* LocalBinarizationInit(size_t width, size_t height, SimdLocalBinarizationType type, size_t radius, float k, float r);
+    }
+#endif
+}
+#endif//__SimdLocalBinarization_h__
@@ -0,0 +1,144 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdMedianFilter_h__
+#define __SimdMedianFilter_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        const size_t MEDIAN_RADIUS_MAX = 127;
+
+        struct MedianHist16
+        {
+            static SIMD_INLINE void Add(uint16_t * dst, const uint16_t * src)
+            {
+                for (size_t i = 0; i < 16; ++i)
+                    dst[i] += src[i];
+            }
+
+            static SIMD_INLINE void Update(uint16_t * dst, const uint16_t * add, const uint16_t * sub)
+            {
+                for (size_t i = 0; i < 16; ++i)
+                    dst[i] += add[i] - sub[i];
+            }
+        };
+
+        // Column histogram update is a scatter increment of two counters per pixel. It stays scalar and is shared by all ISA:
+        // a vector one-hot compare-and-add of the touched 16-bin segments needs more instructions than the scalar increments.
+        SIMD_INLINE void MedianColumnUpdate(const uint8_t * row, size_t size, int delta, uint16_t * coarse, uint16_t * fine)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                coarse[i * 16 + (row[i] >> 4)] += delta;
+                fine[((row[i] >> 4) * size + i) * 16 + (row[i] & 15)] += delta;
+            }
+        }
+
+        SIMD_INLINE size_t MedianHistFind(const uint16_t * hist, size_t & sum, size_t half)
+        {
+            size_t i = 0;
+            while (sum + hist[i] < half)
+                sum += hist[i++];
+            return i;
+        }
+
+        template<class Hist> void MedianFilterSquareStripe(const uint8_t * src, size_t srcStride, size_t width, size_t height, 
+            size_t channels, size_t radius, size_t yBeg, size_t yEnd, uint8_t * dst, size_t dstStride)
+        {
+            ptrdiff_t r = radius, w = width, h = height, invalid = -2 * r - 2;
+            size_t size = width * channels, half = (2 * radius + 1) * (2 * radius + 1) / 2 + 1;
+            Array16u coarse(size * 16, true), fine(size * 256, true), buf(16 + 256);
+            uint16_t * kCoarse = buf.data, * kFine = buf.data + 16;
+            ptrdiff_t luc[16];
+
+            for (ptrdiff_t dy = -r; dy <= r; ++dy)
+            {
+                const uint8_t * row = src + Simd::RestrictRange<ptrdiff_t>(yBeg + dy, 0, h - 1) * srcStride;
+                MedianColumnUpdate(row, size, 1, coarse.data, fine.data);
+            }
+            for (size_t y = yBeg; y < yEnd; ++y)
+            {
+                uint8_t * out = dst + y * dstStride;
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    const uint16_t * hc = coarse.data + c * 16, * hf = fine.data + c * 16;
+                    size_t step = channels * 16, seg = size * 16;
+                    memset(kCoarse, 0, 16 * sizeof(uint16_t));
+                    for (ptrdiff_t dx = -r; dx <= r; ++dx)
+                        Hist::Add(kCoarse, hc + Simd::RestrictRange<ptrdiff_t>(dx, 0, w - 1) * step);
+                    for (size_t k = 0; k < 16; ++k)
+                        luc[k] = invalid;
+                    for (ptrdiff_t x = 0; x < w; ++x)
+                    {
+                        size_t sum = 0, k = MedianHistFind(kCoarse, sum, half);
+                        uint16_t * kf = kFine + k * 16;
+                        const uint16_t * sf = hf + k * seg;
+                        if (x - luc[k] > 2 * r + 1)
+                        {
+                            memset(kf, 0, 16 * sizeof(uint16_t));
+                            for (ptrdiff_t dx = -r; dx <= r; ++dx)
+                                Hist::Add(kf, sf + Simd::RestrictRange<ptrdiff_t>(x + dx, 0, w - 1) * step);
+                        }
+                        else
+                        {
+                            for (ptrdiff_t j = luc[k] + 1; j <= x; ++j)
+                                Hist::Update(kf, sf + Simd::Min(j + r, w - 1) * step, sf + Simd::Max<ptrdiff_t>(j - r - 1, 0) * step);
+                        }
+                        luc[k] = x;
+                        out[x * channels + c] = uint8_t(k * 16 + MedianHistFind(kf, sum, half));
+                        if (x + 1 < w)
+                            Hist::Update(kCoarse, hc + Simd::Min(x + r + 1, w - 1) * step, hc + Simd::Max<ptrdiff_t>(x - r, 0) * step);
+                    }
+                }
+                if (y + 1 < yEnd)
+                {
+                    const uint8_t * sub = src + Simd::RestrictRange<ptrdiff_t>(y - r, 0, h - 1) * srcStride;
+                    const uint8_t * add = src + Simd::RestrictRange<ptrdiff_t>(y + r + 1, 0, h - 1) * srcStride;
+                    if (sub == add)
+                        continue;
+                    MedianColumnUpdate(sub, size, -1, coarse.data, fine.data);
+                    MedianColumnUpdate(add, size, 1, coarse.data, fine.data);
+                }
+            }
+        }
+
+        template<class Hist> void MedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride)
+        {
+            assert(width && height && channelCount >= 1 && channelCount <= 4 && radius <= MEDIAN_RADIUS_MAX);
+
+            size_t threads = Simd::Max<size_t>(1, Simd::Min(Base::GetThreadNumber(), height / Simd::Max<size_t>(16, 4 * radius)));
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                MedianFilterSquareStripe<Hist>(src, srcStride, width, height, channelCount, radius, begin, end, dst, dstStride);
+            }, threads, 1);
+        }
+    }
+}
+#endif//__SimdMedianFilter_h__
@@ -379,6 +379,12 @@ namespace Simd
             return _size;
         }
 
+        SIMD_INLINE void Clear()
+        {
+            _pos = 0;
+            _size = 0;
+        }
+
         SIMD_INLINE size_t Capacity() const
         {
             return _capacity;
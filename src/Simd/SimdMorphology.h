@@ -0,0 +1,126 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdMorphology_h__
+#define __SimdMorphology_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    struct MorphParam
+    {
+        size_t width;
+        size_t height;
+        SimdMorphologyOperationType operation;
+        size_t kernelX;
+        size_t kernelY;
+
+        MorphParam(size_t w, size_t h, SimdMorphologyOperationType o, size_t kx, size_t ky);
+        bool Valid() const;
+    };
+
+    class Morphology : Deletable
+    {
+    public:
+        Morphology(const MorphParam& param);
+
+        virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride) = 0;
+
+    protected:
+        MorphParam _param;
+    };
+
+    namespace Base
+    {
+        typedef void (*MorphologyRowOpPtr)(const uint8_t* a, const uint8_t* b, size_t width, uint8_t* dst);
+        typedef void (*MorphologyHorizontalPtr)(const uint8_t* src, size_t srcStride, size_t width, size_t rows, size_t size, size_t anchor, uint8_t* buf, uint8_t* dst, size_t dstStride);
+
+        void MorphologyHorizontal(const uint8_t* src, size_t srcStride, size_t width, size_t rows, size_t size, size_t anchor, bool dilate, uint8_t* buf, uint8_t* dst, size_t dstStride);
+
+        class MorphologyDefault : public Simd::Morphology
+        {
+        public:
+            MorphologyDefault(const MorphParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        protected:
+            void Init(size_t rows);
+            void Run(const uint8_t* src, size_t srcStride, bool dilate, bool reflect, uint8_t* dst, size_t dstStride);
+            void Run(const uint8_t* src, size_t srcStride, bool dilate, bool reflect, size_t y, size_t count, uint8_t* buf, uint8_t* dst, size_t dstStride);
+
+            size_t _rows, _chunk, _threads, _bufSize;
+            Array8u _buffer, _image;
+            MorphologyRowOpPtr _rowOp[2];
+            MorphologyHorizontalPtr _horizontal[2];
+        };
+
+        void* MorphologyInit(size_t width, size_t height, SimdMorphologyOperationType operation, size_t kernelX, size_t kernelY);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        void MorphologyHorizontal(const uint8_t* src, size_t srcStride, size_t width, size_t rows, size_t size, size_t anchor, bool dilate, uint8_t* buf, uint8_t* dst, size_t dstStride);
+
+        class MorphologyDefault : public Base::MorphologyDefault
+        {
+        public:
+            MorphologyDefault(const MorphParam& param);
+        };
+
+        void* MorphologyInit(size_t width, size_t height, SimdMorphologyOperationType operation, size_t kernelX, size_t kernelY);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void MorphologyHorizontal(const uint8_t* src, size_t srcStride, size_t width, size_t rows, size_t size, size_t anchor, bool dilate, uint8_t* buf, uint8_t* dst, size_t dstStride);
+
+        class MorphologyDefault : public Sse41::MorphologyDefault
+        {
+        public:
+            MorphologyDefault(const MorphParam& param);
+        };
+
+        void* MorphologyInit(size_t width, size_t height, SimdMorphologyOperationType operation, size_t kernelX, size_t kernelY);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class MorphologyDefault : public Avx2::MorphologyDefault
+        {
+        public:
+            MorphologyDefault(const MorphParam& param);
+        };
+
+        void* MorphologyInit(size_t width, size_t height, SimdMorphologyOperationType operation, size_t kernelX, size_t kernelY);
+    }
+#endif
+}
+#endif//__SimdMorphology_h__
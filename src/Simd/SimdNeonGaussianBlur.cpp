@@ -110,41 +110,23 @@ namespace Simd
             }
         }
 
-        template<int channels> void BlurImageAny(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
+        template<int channels> void BlurImageAny(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, 
+            size_t yBeg, size_t yEnd, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
         {
-            Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-            BlurColsAny(cols, a.size, p.channels, a.weight.data, a.kernel, rows + a.half * a.stride);
-            for (size_t row = 0; row < a.half; ++row)
-                memcpy(rows + row * a.stride, rows + a.half * a.stride, a.size * sizeof(float));
-            for (size_t row = 1; row < a.nose; ++row)
+            ptrdiff_t beg = yBeg - a.half, end = yEnd + a.half, last = p.height - 1;
+            for (ptrdiff_t sy = beg; sy < end; ++sy)
             {
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurColsAny(cols, a.size, p.channels, a.weight.data, a.kernel, rows + (a.half + row) * a.stride);
-            }
-            for (size_t row = a.nose; row <= a.half; ++row)
-                memcpy(rows + (a.half + row) * a.stride, rows + (a.half + a.nose - 1) * a.stride, a.size * sizeof(float));
-            BlurRowsAny(rows, a.size, a.stride, a.weight.data, a.kernel, dst), dst += dstStride;
-
-            for (size_t row = 1, b = row % a.kernel + 2 * a.half, w = a.kernel - row % a.kernel; row < a.body; ++row, ++b, --w)
-            {
-                if (b >= a.kernel)
-                    b -= a.kernel;
-                if (w == 0)
-                    w += a.kernel;
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurColsAny(cols, a.size, p.channels, a.weight.data, a.kernel, rows + b * a.stride);
-                BlurRowsAny(rows, a.size, a.stride, a.weight.data + w, a.kernel, dst), dst += dstStride;
-            }
-
-            size_t last = (a.body + 2 * a.half - 1) % a.kernel;
-            for (size_t row = a.body, b = row % a.kernel + 2 * a.half, w = a.kernel - row % a.kernel; row < p.height; ++row, ++b, --w)
-            {
-                if (b >= a.kernel)
-                    b -= a.kernel;
-                if (w == 0)
-                    w += a.kernel;
-                memcpy(rows + b * a.stride, rows + last * a.stride, a.size * sizeof(float));
-                BlurRowsAny(rows, a.size, a.stride, a.weight.data + w, a.kernel, dst), dst += dstStride;
+                float* row = rows + (sy + a.half) % a.kernel * a.stride;
+                if (sy > beg && (sy <= 0 || sy > last))
+                    memcpy(row, rows + (sy + a.half - 1) % a.kernel * a.stride, a.size * sizeof(float));
+                else
+                {
+                    Base::PadCols<channels>(src + Simd::RestrictRange<ptrdiff_t>(sy, 0, last) * srcStride, a.half, a.size, cols);
+                    BlurColsAny(cols, a.size, p.channels, a.weight.data, a.kernel, row);
+                }
+                ptrdiff_t y = sy - a.half;
+                if (y >= (ptrdiff_t)yBeg)
+                    BlurRowsAny(rows, a.size, a.stride, a.weight.data + a.kernel - y % a.kernel, a.kernel, dst + y * dstStride);
             }
         }
 
@@ -265,41 +247,23 @@ namespace Simd
             }
         }
 
-        template<int channels, int kernel> void BlurImage(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
+        template<int channels, int kernel> void BlurImage(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, 
+            size_t yBeg, size_t yEnd, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
         {
-            Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-            BlurCols<kernel>(cols, a.size, p.channels, a.weight.data, rows + a.half * a.stride);
-            for (size_t row = 0; row < a.half; ++row)
-                memcpy(rows + row * a.stride, rows + a.half * a.stride, a.size * sizeof(float));
-            for (size_t row = 1; row < a.nose; ++row)
-            {
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurCols<kernel>(cols, a.size, p.channels, a.weight.data, rows + (a.half + row) * a.stride);
-            }
-            for (size_t row = a.nose; row <= a.half; ++row)
-                memcpy(rows + (a.half + row) * a.stride, rows + (a.half + a.nose - 1) * a.stride, a.size * sizeof(float));
-            BlurRows<kernel>(rows, a.size, a.stride, a.weight.data, dst), dst += dstStride;
-
-            for (size_t row = 1, b = row % a.kernel + 2 * a.half, w = kernel - row % kernel; row < a.body; ++row, ++b, --w)
+            ptrdiff_t beg = yBeg - a.half, end = yEnd + a.half, last = p.height - 1;
+            for (ptrdiff_t sy = beg; sy < end; ++sy)
             {
-                if (b >= kernel)
-                    b -= kernel;
-                if (w == 0)
-                    w += kernel;
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurCols<kernel>(cols, a.size, p.channels, a.weight.data, rows + b * a.stride);
-                BlurRows<kernel>(rows, a.size, a.stride, a.weight.data + w, dst), dst += dstStride;
-            }
-
-            size_t last = (a.body + 2 * a.half - 1) % kernel;
-            for (size_t row = a.body, b = row % kernel + 2 * a.half, w = kernel - row % kernel; row < p.height; ++row, ++b, --w)
-            {
-                if (b >= kernel)
-                    b -= kernel;
-                if (w == 0)
-                    w += kernel;
-                memcpy(rows + b * a.stride, rows + last * a.stride, a.size * sizeof(float));
-                BlurRows<kernel>(rows, a.size, a.stride, a.weight.data + w, dst), dst += dstStride;
+                float* row = rows + (sy + a.half) % kernel * a.stride;
+                if (sy > beg && (sy <= 0 || sy > last))
+                    memcpy(row, rows + (sy + a.half - 1) % kernel * a.stride, a.size * sizeof(float));
+                else
+                {
+                    Base::PadCols<channels>(src + Simd::RestrictRange<ptrdiff_t>(sy, 0, last) * srcStride, a.half, a.size, cols);
+                    BlurCols<kernel>(cols, a.size, p.channels, a.weight.data, row);
+                }
+                ptrdiff_t y = sy - a.half;
+                if (y >= (ptrdiff_t)yBeg)
+                    BlurRows<kernel>(rows, a.size, a.stride, a.weight.data + kernel - y % kernel, dst + y * dstStride);
             }
         }
 
@@ -322,7 +286,7 @@ namespace Simd
         GaussianBlurDefault::GaussianBlurDefault(const BlurParam& param)
             : Base::GaussianBlurDefault(param)
         {
-            if (_param.width >= F && _alg.kernel > 5)
+            if (_param.width >= F && _alg.kernel > 5 && _param.type == SimdGaussianBlurChannel8u)
             {
                 switch (_param.channels)
                 {
@@ -344,6 +308,17 @@ namespace Simd
             return new GaussianBlurDefault(param);
         }
 
+        void* GaussianBlurInitEx(size_t width, size_t height, size_t channels, SimdGaussianBlurChannelType type,
+            const float* sigma, const float* epsilon, SimdGaussianBlurMethod method)
+        {
+            BlurParam param(width, height, channels, type, sigma, epsilon, method, A);
+            if (!param.Valid())
+                return NULL;
+            if (param.Iir())
+                return new Base::GaussianBlurIir(param);
+            return new GaussianBlurDefault(param);
+        }
+
         //---------------------------------------------------------------------
 
         namespace
@@ -48,6 +48,11 @@ namespace Simd
             else
                 return Base::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
         }
+
+        void* ResizerBandInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
+        {
+            return Simd::ResizerBandInit(ResizerInit, srcX, srcY, dstX, dstY, channels, type, method);
+        }
     }
 #endif
 }
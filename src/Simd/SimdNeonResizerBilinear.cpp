@@ -47,6 +47,27 @@ namespace Simd
         {
             if (_ax.data)
                 return;
+            _coefsX = ResizerCacheFind(_param, ResCoefsByteBilinearX8uTable16);
+            if (_coefsX)
+            {
+                _coefsX->Share(0, _ax), _coefsX->Share(1, _ix), _coefsX->Share(2, _ixg);
+                _blocks = _coefsX->value;
+            }
+            else
+            {
+                EstimateIndexAlphaX();
+                _coefsX.reset(new ResCoefs());
+                _coefsX->Keep(_ax), _coefsX->Keep(_ix), _coefsX->Keep(_ixg);
+                _coefsX->value = _blocks;
+                ResizerCacheInsert(_param, ResCoefsByteBilinearX8uTable16, _coefsX);
+            }
+            size_t size = AlignHi(_param.dstW, _param.align)*_param.channels * 2;
+            _bx[0].Resize(size, false, _param.align);
+            _bx[1].Resize(size, false, _param.align);
+        }
+
+        void ResizerByteBilinear::EstimateIndexAlphaX()
+        {
             if (_param.channels == 1 && _param.srcW < 4 * _param.dstW)
                 _blocks = BlockCountMax(A);
             float scale = (float)_param.srcW / _param.dstW;
@@ -124,10 +145,7 @@ namespace Simd
                     alphas += 2 * _param.channels;
                 }
             }
-            size_t size = AlignHi(_param.dstW, _param.align)*_param.channels * 2;
-            _bx[0].Resize(size, false, _param.align);
-            _bx[1].Resize(size, false, _param.align);
-}
+        }
 
         template <size_t N> void ResizerByteBilinearInterpolateX(const uint8_t * alpha, uint8_t * buffer);
 
@@ -213,7 +231,7 @@ namespace Simd
             const int32_t * ix = _ix.data;
             size_t dstW = _param.dstW;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            for (size_t yDst = _dyBeg; yDst < _dyEnd; yDst++, dst += dstStride)
             {
                 a[0] = vdupq_n_u16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = vdupq_n_u16(int16_t(_ay[yDst]));
@@ -234,7 +252,7 @@ namespace Simd
                 for (; k < 2; k++)
                 {
                     Two * pb = (Two *)bx[k];
-                    const One * psrc = (const One *)(src + (sy + k)*srcStride);
+                    const One * psrc = (const One *)(src + (sy + k - _syBeg)*srcStride);
                     for (size_t x = 0; x < dstW; x++)
                         pb[x] = *(Two *)(psrc + ix[x]);
 
@@ -293,7 +311,7 @@ namespace Simd
             const uint8_t * ax = _ax.data;
             const Idx * ixg = _ixg.data;
 
-            for (size_t yDst = 0; yDst < _param.dstH; yDst++, dst += dstStride)
+            for (size_t yDst = _dyBeg; yDst < _dyEnd; yDst++, dst += dstStride)
             {
                 a[0] = vdupq_n_u16(int16_t(Base::FRACTION_RANGE - _ay[yDst]));
                 a[1] = vdupq_n_u16(int16_t(_ay[yDst]));
@@ -314,12 +332,12 @@ namespace Simd
                 for (; k < 2; k++)
                 {
 #ifdef MERGE_LOADING_AND_INTERPOLATION
-                    const uint8_t * psrc = src + (sy + k)*srcStride;
+                    const uint8_t * psrc = src + (sy + k - _syBeg)*srcStride;
                     uint8_t * pdst = bx[k];
                     for (size_t i = 0; i < blocks; ++i)
                         ResizerByteBilinearLoadGrayInterpolated(psrc, ixg[i], ax, pdst);
 #else
-                    const uint8_t * psrc = src + (sy + k)*srcStride;
+                    const uint8_t * psrc = src + (sy + k - _syBeg)*srcStride;
                     uint8_t * pdst = bx[k];
                     for (size_t i = 0; i < blocks; ++i)
                         ResizerByteBilinearLoadGray(psrc, ixg[i], pdst);
@@ -0,0 +1,162 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdOpticalFlowLk_h__
+#define __SimdOpticalFlowLk_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+#include <vector>
+
+namespace Simd
+{
+    struct OpticalFlowLkParam
+    {
+        size_t width;
+        size_t height;
+        size_t levels;
+        size_t radius;
+        size_t iterations;
+        float epsilon;
+        float minEigenvalue;
+        size_t align;
+
+        OpticalFlowLkParam(size_t w, size_t h, size_t l, size_t r, size_t i, float e, float m, size_t a);
+        bool Valid() const;
+
+        size_t Window() const
+        {
+            return 2 * radius + 1;
+        }
+    };
+
+    class OpticalFlowLk : Deletable
+    {
+    public:
+        OpticalFlowLk(const OpticalFlowLkParam& param);
+
+        virtual void SetFrame(const uint8_t* src, size_t srcStride) = 0;
+
+        virtual void Track(const float* prev, float* next, uint8_t* status, size_t count) = 0;
+
+    protected:
+        OpticalFlowLkParam _param;
+    };
+
+    namespace Base
+    {
+        const int LK_W_BITS = 14;
+        const int LK_I_BITS = 5;
+        const int LK_W_ROUND = 1 << (LK_W_BITS - 1);
+        const int LK_I_SHIFT = LK_W_BITS - LK_I_BITS;
+        const int LK_I_ROUND = 1 << (LK_I_SHIFT - 1);
+
+        struct OpticalFlowLkLevel
+        {
+            size_t width, height, stride;
+            Array8u image;
+            Array16i dx, dy;
+        };
+
+        struct OpticalFlowLkAlg
+        {
+            size_t border, window, patchStride, patchSize, threads;
+        };
+
+        typedef void (*OpticalFlowLkReducePtr)(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t* dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
+        typedef void (*OpticalFlowLkSobelPtr)(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride);
+        typedef void (*OpticalFlowLkTemplatePtr)(const uint8_t* img, size_t imgStride, const int16_t* dx, const int16_t* dy, size_t dStride,
+            const int32_t* weight, size_t window, int16_t* I, int16_t* Ix, int16_t* Iy, size_t patchStride, int64_t* G);
+        typedef void (*OpticalFlowLkResidualPtr)(const uint8_t* img, size_t imgStride, const int32_t* weight, size_t window,
+            const int16_t* I, const int16_t* Ix, const int16_t* Iy, size_t patchStride, int64_t* b);
+
+        class OpticalFlowLkDefault : public Simd::OpticalFlowLk
+        {
+        public:
+            OpticalFlowLkDefault(const OpticalFlowLkParam& param);
+
+            virtual void SetFrame(const uint8_t* src, size_t srcStride);
+
+            virtual void Track(const float* prev, float* next, uint8_t* status, size_t count);
+
+        protected:
+            typedef std::vector<OpticalFlowLkLevel> Pyramid;
+
+            void SetLevel(OpticalFlowLkLevel& level);
+            void Track(const float* prev, float* next, uint8_t* status, int16_t* patch);
+
+            OpticalFlowLkAlg _alg;
+            Pyramid _pyramids[2];
+            size_t _frames;
+            Array16i _patches;
+            OpticalFlowLkReducePtr _reduce;
+            OpticalFlowLkSobelPtr _sobelDx, _sobelDy;
+            OpticalFlowLkTemplatePtr _template;
+            OpticalFlowLkResidualPtr _residual;
+        };
+
+        void* OpticalFlowLkInit(size_t width, size_t height, size_t levels, size_t radius, size_t iterations, float epsilon, float minEigenvalue);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class OpticalFlowLkDefault : public Base::OpticalFlowLkDefault
+        {
+        public:
+            OpticalFlowLkDefault(const OpticalFlowLkParam& param);
+        };
+
+        void* OpticalFlowLkInit(size_t width, size_t height, size_t levels, size_t radius, size_t iterations, float epsilon, float minEigenvalue);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class OpticalFlowLkDefault : public Sse41::OpticalFlowLkDefault
+        {
+        public:
+            OpticalFlowLkDefault(const OpticalFlowLkParam& param);
+        };
+
+        void* OpticalFlowLkInit(size_t width, size_t height, size_t levels, size_t radius, size_t iterations, float epsilon, float minEigenvalue);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class OpticalFlowLkDefault : public Avx2::OpticalFlowLkDefault
+        {
+        public:
+            OpticalFlowLkDefault(const OpticalFlowLkParam& param);
+        };
+
+        void* OpticalFlowLkInit(size_t width, size_t height, size_t levels, size_t radius, size_t iterations, float epsilon, float minEigenvalue);
+    }
+#endif
+}
+#endif//__SimdOpticalFlowLk_h__
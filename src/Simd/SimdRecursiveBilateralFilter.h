@@ -93,6 +93,12 @@ namespace Simd
         RbfParam _param;
         Array8u _buffer;
         FilterPtr _hFilter, _vFilter;
+        size_t _hThreads, _vThreads;
+
+        size_t VerBlockBeg(size_t block) const
+        {
+            return block == _vThreads ? _param.width : AlignLo(_param.width * block / _vThreads, 64);
+        }
     };
 
     //-----------------------------------------------------------------------------------------
@@ -159,7 +165,7 @@ namespace Simd
         protected:
             uint8_t* GetBuffer();
         private:
-            size_t _size, _stride;
+            size_t _size, _stride, _part;
         };
 
         void * RecursiveBilateralFilterInit(size_t width, size_t height, size_t channels, const float* sigmaSpatial, const float* sigmaRange, SimdRecursiveBilateralFilterFlags flags);
@@ -200,6 +206,19 @@ namespace Simd
 #ifdef SIMD_AVX512BW_ENABLE    
     namespace Avx512bw
     {
+        class RecursiveBilateralFilterPrecize : public Sse41::RecursiveBilateralFilterPrecize
+        {
+        public:
+            RecursiveBilateralFilterPrecize(const RbfParam& param);
+        };
+
+        class RecursiveBilateralFilterFast : public Avx2::RecursiveBilateralFilterFast
+        {
+        public:
+            RecursiveBilateralFilterFast(const RbfParam& param);
+        };
+
+        void* RecursiveBilateralFilterInit(size_t width, size_t height, size_t channels, const float* sigmaSpatial, const float* sigmaRange, SimdRecursiveBilateralFilterFlags flags);
     }
 #endif
 
@@ -0,0 +1,248 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2022 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdRemap_h__
+#define __SimdRemap_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+#include <vector>
+
+namespace Simd
+{
+    struct RemapParam
+    {
+        static const int BorderSizeMax = 4 * 1;
+
+        SimdRemapFlags flags;
+        uint8_t border[BorderSizeMax];
+        size_t srcW, srcH, srcS, dstW, dstH, dstS, channels, align;
+
+        RemapParam(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, SimdRemapFlags flags, const uint8_t* border, size_t align);
+
+        bool Valid() const
+        {
+            return channels >= 1 && channels <= 4 && srcW > 0 && srcH > 0 && srcW <= 0x7FFF && srcH <= 0x7FFF && srcH * srcS <= 0x100000000;
+        }
+
+        bool IsNearest() const
+        {
+            return (flags & SimdRemapInterpMask) == SimdRemapInterpNearest;
+        }
+
+        bool IsByteBilinear() const
+        {
+            return (flags & SimdRemapInterpMask) == SimdRemapInterpBilinear && (SimdRemapChannelMask & flags) == SimdRemapChannelByte;
+        }
+
+        bool NeedFill() const
+        {
+            return (flags & SimdRemapBorderMask) == SimdRemapBorderConstant;
+        }
+
+        bool IsFisheye() const
+        {
+            return (flags & SimdRemapModelMask) == SimdRemapModelFisheye;
+        }
+
+        size_t ChannelSize() const
+        {
+            switch (SimdRemapChannelMask & flags)
+            {
+            case SimdRemapChannelByte: return 1;
+            default:
+                assert(0); return 0;
+            }
+        }
+
+        size_t PixelSize() const
+        {
+            return ChannelSize() * channels;
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    struct RemapSpan
+    {
+        enum Type
+        {
+            Outside,
+            Edge,
+            Main,
+        };
+        int32_t beg, end, type;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class Remap : Deletable
+    {
+    public:
+        Remap(const RemapParam& param);
+
+        void SetMap(const float* mapX, const float* mapY, size_t mapStride);
+
+        void SetUndistortion(const float* camera, const float* distortion);
+
+        virtual void Run(const uint8_t* src, uint8_t* dst) = 0;
+
+    protected:
+        void PackRow(size_t y, const float* mapX, const float* mapY, std::vector<RemapSpan> & spans);
+
+        RemapParam _param;
+        size_t _threads;
+        Array32u _offs;
+        Array8u _fx;
+        Array16u _fy;
+        Array32i _rows;
+        Array<RemapSpan> _spans;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        class RemapNearest : public Remap
+        {
+        public:
+            typedef void(*RunPtr)(const RemapParam& p, int yBeg, int yEnd, const int32_t* rows, const RemapSpan* spans, const uint32_t* offs, const uint8_t* src, uint8_t* dst);
+
+            RemapNearest(const RemapParam& param);
+
+            virtual void Run(const uint8_t* src, uint8_t* dst);
+
+        protected:
+            RunPtr _run;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class RemapByteBilinear : public Remap
+        {
+        public:
+            typedef void(*RunPtr)(const RemapParam& p, int yBeg, int yEnd, const int32_t* rows, const RemapSpan* spans, 
+                const uint32_t* offs, const uint8_t* fx, const uint16_t* fy, const uint8_t* src, uint8_t* dst, uint8_t* buf);
+
+            RemapByteBilinear(const RemapParam& param);
+
+            virtual void Run(const uint8_t* src, uint8_t* dst);
+
+        protected:
+            size_t _size;
+            Array8u _buf;
+            RunPtr _run;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* RemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+            const float* mapX, const float* mapY, size_t mapStride, SimdRemapFlags flags, const uint8_t* border);
+
+        void* RemapInitUndistortion(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+            const float* camera, const float* distortion, SimdRemapFlags flags, const uint8_t* border);
+    }
+
+#ifdef SIMD_SSE41_ENABLE
+    namespace Sse41
+    {
+        class RemapNearest : public Base::RemapNearest
+        {
+        public:
+            RemapNearest(const RemapParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class RemapByteBilinear : public Base::RemapByteBilinear
+        {
+        public:
+            RemapByteBilinear(const RemapParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* RemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+            const float* mapX, const float* mapY, size_t mapStride, SimdRemapFlags flags, const uint8_t* border);
+
+        void* RemapInitUndistortion(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+            const float* camera, const float* distortion, SimdRemapFlags flags, const uint8_t* border);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        class RemapNearest : public Sse41::RemapNearest
+        {
+        public:
+            RemapNearest(const RemapParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class RemapByteBilinear : public Sse41::RemapByteBilinear
+        {
+        public:
+            RemapByteBilinear(const RemapParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* RemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+            const float* mapX, const float* mapY, size_t mapStride, SimdRemapFlags flags, const uint8_t* border);
+
+        void* RemapInitUndistortion(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+            const float* camera, const float* distortion, SimdRemapFlags flags, const uint8_t* border);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        class RemapNearest : public Avx2::RemapNearest
+        {
+        public:
+            RemapNearest(const RemapParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class RemapByteBilinear : public Avx2::RemapByteBilinear
+        {
+        public:
+            RemapByteBilinear(const RemapParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* RemapInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+            const float* mapX, const float* mapY, size_t mapStride, SimdRemapFlags flags, const uint8_t* border);
+
+        void* RemapInitUndistortion(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+            const float* camera, const float* distortion, SimdRemapFlags flags, const uint8_t* border);
+    }
+#endif
+}
+#endif//__SimdRemap_h__
@@ -76,6 +76,17 @@ namespace Simd
             return type == SimdResizeChannelByte && method == SimdResizeMethodBicubic;
         }
 
+        bool IsByteFilter() const
+        {
+            return type == SimdResizeChannelByte && (method == SimdResizeMethodLanczos3 || method == SimdResizeMethodMitchell);
+        }
+
+        bool IsFloatFilter() const
+        {
+            return (type == SimdResizeChannelShort || type == SimdResizeChannelFloat) && (method == SimdResizeMethodBicubic || 
+                method == SimdResizeMethodArea || method == SimdResizeMethodAreaFast || method == SimdResizeMethodLanczos3 || method == SimdResizeMethodMitchell);
+        }
+
         bool IsByteArea1x1() const
         {
             return type == SimdResizeChannelByte && (method == SimdResizeMethodArea || (method == SimdResizeMethodAreaFast && 
@@ -102,20 +113,141 @@ namespace Simd
 
     //-------------------------------------------------------------------------------------------------
 
+    struct ResTensorParam
+    {
+        SimdTensorFormatType format;
+        SimdTensorDataType type;
+        size_t dstW, dstH, imgW, imgH, left, top;
+        float fill;
+
+        ResTensorParam(size_t srcW, size_t srcH, size_t dstW, size_t dstH, SimdTensorFormatType format, SimdTensorDataType type, SimdBool letterbox, float fill)
+        {
+            this->format = format;
+            this->type = type;
+            this->dstW = dstW;
+            this->dstH = dstH;
+            this->fill = fill;
+            if (letterbox)
+            {
+                double k = Simd::Min(double(dstW) / double(srcW), double(dstH) / double(srcH));
+                this->imgW = Simd::RestrictRange<size_t>(Round(srcW * k), 1, dstW);
+                this->imgH = Simd::RestrictRange<size_t>(Round(srcH * k), 1, dstH);
+            }
+            else
+            {
+                this->imgW = dstW;
+                this->imgH = dstH;
+            }
+            this->left = (dstW - imgW) / 2;
+            this->top = (dstH - imgH) / 2;
+        }
+
+        size_t ElemSize() const
+        {
+            return type == SimdTensorData32f ? 4 : 2;
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class ResCoefs : public Deletable
+    {
+    public:
+        size_t value;
+
+        ResCoefs()
+            : value(0)
+            , _count(0)
+        {
+        }
+
+        virtual ~ResCoefs()
+        {
+            for (size_t i = 0; i < _count; ++i)
+                Simd::Free(_data[i]);
+        }
+
+        template<class T> void Keep(Array<T>& array)
+        {
+            assert(_count < CAPACITY);
+            _size[_count] = array.size;
+            _data[_count] = array.Release();
+            array.Share((T*)_data[_count], _size[_count]);
+            _count++;
+        }
+
+        template<class T> void Share(size_t index, Array<T>& array) const
+        {
+            assert(index < _count);
+            array.Share((T*)_data[index], _size[index]);
+        }
+
+    private:
+        static const size_t CAPACITY = 6;
+        void* _data[CAPACITY];
+        size_t _size[CAPACITY], _count;
+    };
+    typedef std::shared_ptr<ResCoefs> ResCoefsPtr;
+
+    // Cache keys name a layout of coefficients: resizers of different ISA which use the same layout share cache entries.
+    enum ResCoefsType
+    {
+        ResCoefsByteBilinearX32i,
+        ResCoefsByteBilinearY32i,
+        ResCoefsByteBilinearX8uShuffle16,
+        ResCoefsByteBilinearX8uShuffle32,
+        ResCoefsByteBilinearX8uTable16,
+        ResCoefsShortBilinear32f,
+        ResCoefsFloatBilinear32f,
+        ResCoefsByteBicubic32i,
+        ResCoefsByteBicubic8i,
+        ResCoefsByteFilter16i,
+        ResCoefsFloatFilter32f,
+    };
+
+    const size_t RESIZER_CACHE_SIZE = 64;
+
+    ResCoefsPtr ResizerCacheFind(const ResParam& param, ResCoefsType type, size_t variant = 0);
+
+    void ResizerCacheInsert(const ResParam& param, ResCoefsType type, const ResCoefsPtr& coefs, size_t variant = 0);
+
+    //-------------------------------------------------------------------------------------------------
+
     class Resizer : Deletable
     {
     public:
         Resizer(const ResParam & param)
             : _param(param)
+            , _syBeg(0)
+            , _dyBeg(0)
+            , _dyEnd(param.dstH)
         {
         }
 
         virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride) = 0;
 
+        // Computes output rows [dyBeg, dyEnd) only: src points to source row syBeg, dst points to output row dyBeg.
+        // Output rows must not use source rows before syBeg. It is supported by byte nearest, bilinear, bicubic and area resizers.
+        void RunRows(const uint8_t* src, size_t srcStride, size_t syBeg, size_t dyBeg, size_t dyEnd, uint8_t* dst, size_t dstStride)
+        {
+            _syBeg = syBeg;
+            _dyBeg = dyBeg;
+            _dyEnd = dyEnd;
+            Run(src, srcStride, dst, dstStride);
+            _syBeg = 0;
+            _dyBeg = 0;
+            _dyEnd = _param.dstH;
+        }
+
     protected:
         ResParam _param;
+        size_t _syBeg, _dyBeg, _dyEnd;
     };
 
+    typedef void* (*ResizerInitPtr)(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+    void* ResizerBandInit(ResizerInitPtr resizerInit, size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
     //-------------------------------------------------------------------------------------------------
 
     namespace Base
@@ -143,6 +275,7 @@ namespace Simd
         {
         protected:
             Array32i _ax, _ix, _ay, _iy, _bx[2];
+            ResCoefsPtr _coefsX, _coefsY;
 
             void EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, int32_t * indices, int32_t * alphas);
         public:
@@ -158,6 +291,7 @@ namespace Simd
         protected:
             Array32i _ix, _iy;
             Array32f _ax, _ay, _bx[2];
+            ResCoefsPtr _coefs;
 
             void EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, int32_t* indices, float* alphas);
 
@@ -179,6 +313,7 @@ namespace Simd
         protected:
             Array32i _ix, _iy;
             Array32f _ax, _ay, _bx[2];
+            ResCoefsPtr _coefs;
 
             void EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t channels, int32_t * indices, float * alphas);
 
@@ -201,6 +336,7 @@ namespace Simd
         protected:
             Array32i _ix, _iy, _ax, _ay, _bx[4];
             size_t _xn, _xt, _sxl;
+            ResCoefsPtr _coefs;
 
             void EstimateIndexAlpha(size_t sizeS, size_t sizeD, size_t N, Array32i& index, Array32i& alpha);
 
@@ -256,6 +392,181 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        const int32_t FILTER_SHIFT = 14;
+        const int32_t FILTER_RANGE = 1 << FILTER_SHIFT;
+        const int32_t FILTER_ROUND = 1 << (FILTER_SHIFT - 1);
+        const int32_t FILTER_X_BITS = 6;
+        const int32_t FILTER_X_SHIFT = FILTER_SHIFT - FILTER_X_BITS;
+        const int32_t FILTER_X_ROUND = 1 << (FILTER_X_SHIFT - 1);
+        const int32_t FILTER_Y_SHIFT = FILTER_SHIFT + FILTER_X_BITS;
+        const int32_t FILTER_Y_ROUND = 1 << (FILTER_Y_SHIFT - 1);
+
+        void EstimateFilterIndexAlpha(size_t sizeS, size_t sizeD, SimdResizeMethodType method, size_t align, size_t& taps, Array32i& index, Array32i& count, Array32f& alpha);
+
+        class ResizerByteFilter : public Resizer
+        {
+        protected:
+            size_t _alignX, _tx, _ty;
+            Array32i _ix, _iy, _ny;
+            Array16i _ax, _ay, _bx;
+            Array8u _bs;
+            Array16icp _rows;
+            ResCoefsPtr _coefs;
+
+            void EstimateAlpha(const Array32f& src, size_t taps, Array16i& dst);
+            void Init();
+
+            virtual void RunX(const uint8_t* src, int16_t* dst);
+            virtual void RunY(const int16_t* const* src, size_t n, const int16_t* ay, uint8_t* dst);
+        public:
+            ResizerByteFilter(const ResParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class ResizerFloatFilter : public Resizer
+        {
+        protected:
+            size_t _alignX, _tx, _ty;
+            Array32i _ix, _iy, _ny;
+            Array32f _ax, _ay, _bs, _bx;
+            Array32fcp _rows;
+            ResCoefsPtr _coefs;
+
+            void Init();
+
+            virtual void LoadRow(const uint8_t* src, float* dst);
+            virtual void RunX(const float* src, float* dst);
+            virtual void RunY(const float* const* src, size_t n, const float* ay, uint8_t* dst);
+        public:
+            ResizerFloatFilter(const ResParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class ResizerBand : public Deletable
+        {
+        public:
+            ResizerBand(const ResParam& param, Resizer* resizer);
+
+            size_t Run(const uint8_t* src, size_t srcStride, size_t srcRows, uint8_t* dst, size_t dstStride);
+
+        protected:
+            ResParam _param;
+            Holder<Resizer> _resizer;
+            double _scale;
+            size_t _rowSize, _capacity, _bufRow, _srcRow, _dstRow;
+            Array8u _buf;
+
+            size_t RowBeg(size_t dy) const;
+            size_t RowEnd(size_t dy) const;
+        };
+
+        void* ResizerBandInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        //-------------------------------------------------------------------------------------------------
+
+        class ResizerYuv420 : public Deletable
+        {
+        public:
+            ResizerYuv420(const ResParam& param, SimdPixelFormatType format, SimdYuvType yuvType);
+
+            void Run(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t uvStep, uint8_t* dst, size_t dstStride);
+
+        protected:
+            typedef void(*ConvertPtr)(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+                size_t width, size_t height, uint8_t* dst, size_t dstStride, SimdYuvType yuvType);
+
+            struct Plane
+            {
+                size_t srcW, srcH;
+                int32_t prev;
+                uint16_t* pb[2];
+                Array32i ix, ax, iy, ay;
+                Array16u bx;
+                Array8u row;
+            };
+
+            ResParam _param;
+            SimdPixelFormatType _format;
+            SimdYuvType _yuvType;
+            ConvertPtr _convert;
+            Plane _planes[3];
+
+            void EstimateIndexAlpha(size_t srcSize, size_t dstSize, Array32i& index, Array32i& alpha);
+            void Init();
+            void RunPlane(const uint8_t* src, size_t stride, size_t step, size_t dy, Plane& plane);
+
+            virtual void RunX(const uint8_t* src, size_t step, const Plane& plane, uint16_t* dst);
+            virtual void RunY(const uint16_t* src0, const uint16_t* src1, int32_t fy, uint8_t* dst);
+        };
+
+        bool ResizerYuv420Valid(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType format, SimdYuvType yuvType, SimdResizeMethodType method);
+
+        void* ResizerYuv420Init(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType format, SimdYuvType yuvType, SimdResizeMethodType method);
+
+        //-------------------------------------------------------------------------------------------------
+
+        class ResizerBatch : public Deletable
+        {
+        public:
+            ResizerBatch(const ResParam& param, SimdTensorFormatType format);
+
+            void Run(const uint8_t* src, size_t srcStride, const float* rois, size_t count, uint8_t* dst);
+
+        protected:
+            ResParam _param;
+            SimdTensorFormatType _format;
+            size_t _threads, _rowSize, _roiSize, _bufSize;
+            Array32i _arena, _buffer;
+
+            void EstimateIndexAlpha(float begin, float end, size_t srcSize, size_t dstSize, int32_t* index, int32_t* alpha) const;
+            void RunByte(const uint8_t* src, size_t srcStride, const int32_t* ix, const int32_t* ax, const int32_t* iy, const int32_t* ay, int32_t* buf, uint8_t* dst);
+            void RunFloat(const float* src, size_t srcStride, const int32_t* ix, const float* ax, const int32_t* iy, const float* ay, float* buf, float* dst);
+
+            virtual void ByteRowY(const int32_t* src0, const int32_t* src1, size_t size, int32_t fy, uint8_t* dst);
+            virtual void FloatRowY(const float* src0, const float* src1, size_t size, float fy, float* dst);
+        };
+
+        bool ResizerBatchValid(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method, SimdTensorFormatType format);
+
+        void* ResizerBatchInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method, SimdTensorFormatType format);
+
+        //-------------------------------------------------------------------------------------------------
+
+        class ResizerTensor : public Deletable
+        {
+        public:
+            ResizerTensor(const ResParam& param, const ResTensorParam& tensor, const float* scale, const float* shift);
+
+            void Run(const uint8_t* src, size_t srcStride, uint8_t* dst);
+
+        protected:
+            ResParam _param;
+            ResTensorParam _tensor;
+            Array32i _ix, _ax, _iy, _ay, _bx[2];
+            Array32f _scale, _shift;
+            Array8u _pad;
+
+            void EstimateIndexAlpha(size_t srcSize, size_t dstSize, int32_t* indices, int32_t* alphas);
+            void RunX(const uint8_t* src, int32_t* dst);
+            void RunY(const int32_t* src0, const int32_t* src1, size_t size, int32_t fy, const float* scale, const float* shift, uint8_t* dst);
+
+            virtual void RowY32f(const int32_t* src0, const int32_t* src1, size_t size, int32_t fy, const float* scale, const float* shift, float* dst);
+            virtual void RowY16b(const int32_t* src0, const int32_t* src1, size_t size, int32_t fy, const float* scale, const float* shift, uint16_t* dst);
+        };
+
+        bool ResizerTensorValid(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method, SimdTensorFormatType format, SimdTensorDataType type);
+
+        void* ResizerTensorInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method,
+            SimdTensorFormatType format, SimdTensorDataType type, const float* scale, const float* shift, SimdBool letterbox, float fill);
+
+        //-------------------------------------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 
@@ -301,6 +612,7 @@ namespace Simd
 
             size_t BlockCountMax(size_t align);
             void EstimateParams();
+            void EstimateIndexAlphaX();
             template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
             void RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
         public:
@@ -377,7 +689,72 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class ResizerByteFilter : public Base::ResizerByteFilter
+        {
+        protected:
+            virtual void RunX(const uint8_t* src, int16_t* dst);
+            virtual void RunY(const int16_t* const* src, size_t n, const int16_t* ay, uint8_t* dst);
+        public:
+            ResizerByteFilter(const ResParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class ResizerFloatFilter : public Base::ResizerFloatFilter
+        {
+        protected:
+            virtual void LoadRow(const uint8_t* src, float* dst);
+            virtual void RunX(const float* src, float* dst);
+            virtual void RunY(const float* const* src, size_t n, const float* ay, uint8_t* dst);
+        public:
+            ResizerFloatFilter(const ResParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class ResizerYuv420 : public Base::ResizerYuv420
+        {
+        protected:
+            virtual void RunX(const uint8_t* src, size_t step, const Plane& plane, uint16_t* dst);
+            virtual void RunY(const uint16_t* src0, const uint16_t* src1, int32_t fy, uint8_t* dst);
+        public:
+            ResizerYuv420(const ResParam& param, SimdPixelFormatType format, SimdYuvType yuvType);
+        };
+
+        void* ResizerYuv420Init(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType format, SimdYuvType yuvType, SimdResizeMethodType method);
+
+        //-------------------------------------------------------------------------------------------------
+
+        class ResizerBatch : public Base::ResizerBatch
+        {
+        protected:
+            virtual void ByteRowY(const int32_t* src0, const int32_t* src1, size_t size, int32_t fy, uint8_t* dst);
+            virtual void FloatRowY(const float* src0, const float* src1, size_t size, float fy, float* dst);
+        public:
+            ResizerBatch(const ResParam& param, SimdTensorFormatType format);
+        };
+
+        void* ResizerBatchInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method, SimdTensorFormatType format);
+
+        //-------------------------------------------------------------------------------------------------
+
+        class ResizerTensor : public Base::ResizerTensor
+        {
+        protected:
+            virtual void RowY32f(const int32_t* src0, const int32_t* src1, size_t size, int32_t fy, const float* scale, const float* shift, float* dst);
+            virtual void RowY16b(const int32_t* src0, const int32_t* src1, size_t size, int32_t fy, const float* scale, const float* shift, uint16_t* dst);
+        public:
+            ResizerTensor(const ResParam& param, const ResTensorParam& tensor, const float* scale, const float* shift);
+        };
+
+        void* ResizerTensorInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method,
+            SimdTensorFormatType format, SimdTensorDataType type, const float* scale, const float* shift, SimdBool letterbox, float fill);
+
+        //-------------------------------------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        void* ResizerBandInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 #endif //SIMD_SSE41_ENABLE
 
@@ -411,6 +788,7 @@ namespace Simd
             Array<Idx> _ixg;
 
             void EstimateParams();
+            void EstimateIndexAlphaX();
             template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
             void RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
         public:
@@ -476,7 +854,70 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class ResizerByteFilter : public Sse41::ResizerByteFilter
+        {
+        protected:
+            virtual void RunX(const uint8_t* src, int16_t* dst);
+            virtual void RunY(const int16_t* const* src, size_t n, const int16_t* ay, uint8_t* dst);
+        public:
+            ResizerByteFilter(const ResParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class ResizerFloatFilter : public Sse41::ResizerFloatFilter
+        {
+        protected:
+            virtual void RunX(const float* src, float* dst);
+            virtual void RunY(const float* const* src, size_t n, const float* ay, uint8_t* dst);
+        public:
+            ResizerFloatFilter(const ResParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class ResizerYuv420 : public Sse41::ResizerYuv420
+        {
+        protected:
+            virtual void RunY(const uint16_t* src0, const uint16_t* src1, int32_t fy, uint8_t* dst);
+        public:
+            ResizerYuv420(const ResParam& param, SimdPixelFormatType format, SimdYuvType yuvType);
+        };
+
+        void* ResizerYuv420Init(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType format, SimdYuvType yuvType, SimdResizeMethodType method);
+
+        //-------------------------------------------------------------------------------------------------
+
+        class ResizerBatch : public Sse41::ResizerBatch
+        {
+        protected:
+            virtual void ByteRowY(const int32_t* src0, const int32_t* src1, size_t size, int32_t fy, uint8_t* dst);
+            virtual void FloatRowY(const float* src0, const float* src1, size_t size, float fy, float* dst);
+        public:
+            ResizerBatch(const ResParam& param, SimdTensorFormatType format);
+        };
+
+        void* ResizerBatchInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method, SimdTensorFormatType format);
+
+        //-------------------------------------------------------------------------------------------------
+
+        class ResizerTensor : public Sse41::ResizerTensor
+        {
+        protected:
+            virtual void RowY32f(const int32_t* src0, const int32_t* src1, size_t size, int32_t fy, const float* scale, const float* shift, float* dst);
+            virtual void RowY16b(const int32_t* src0, const int32_t* src1, size_t size, int32_t fy, const float* scale, const float* shift, uint16_t* dst);
+        public:
+            ResizerTensor(const ResParam& param, const ResTensorParam& tensor, const float* scale, const float* shift);
+        };
+
+        void* ResizerTensorInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method,
+            SimdTensorFormatType format, SimdTensorDataType type, const float* scale, const float* shift, SimdBool letterbox, float fill);
+
+        //-------------------------------------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        void* ResizerBandInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 #endif //SIMD_AVX2_ENABLE 
 
@@ -576,7 +1017,69 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class ResizerByteFilter : public Avx2::ResizerByteFilter
+        {
+        protected:
+            virtual void RunY(const int16_t* const* src, size_t n, const int16_t* ay, uint8_t* dst);
+        public:
+            ResizerByteFilter(const ResParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class ResizerFloatFilter : public Avx2::ResizerFloatFilter
+        {
+        protected:
+            virtual void RunX(const float* src, float* dst);
+            virtual void RunY(const float* const* src, size_t n, const float* ay, uint8_t* dst);
+        public:
+            ResizerFloatFilter(const ResParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class ResizerYuv420 : public Avx2::ResizerYuv420
+        {
+        protected:
+            virtual void RunY(const uint16_t* src0, const uint16_t* src1, int32_t fy, uint8_t* dst);
+        public:
+            ResizerYuv420(const ResParam& param, SimdPixelFormatType format, SimdYuvType yuvType);
+        };
+
+        void* ResizerYuv420Init(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType format, SimdYuvType yuvType, SimdResizeMethodType method);
+
+        //-------------------------------------------------------------------------------------------------
+
+        class ResizerBatch : public Base::ResizerBatch
+        {
+        protected:
+            virtual void ByteRowY(const int32_t* src0, const int32_t* src1, size_t size, int32_t fy, uint8_t* dst);
+            virtual void FloatRowY(const float* src0, const float* src1, size_t size, float fy, float* dst);
+        public:
+            ResizerBatch(const ResParam& param, SimdTensorFormatType format);
+        };
+
+        void* ResizerBatchInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method, SimdTensorFormatType format);
+
+        //-------------------------------------------------------------------------------------------------
+
+        class ResizerTensor : public Base::ResizerTensor
+        {
+        protected:
+            virtual void RowY32f(const int32_t* src0, const int32_t* src1, size_t size, int32_t fy, const float* scale, const float* shift, float* dst);
+            virtual void RowY16b(const int32_t* src0, const int32_t* src1, size_t size, int32_t fy, const float* scale, const float* shift, uint16_t* dst);
+        public:
+            ResizerTensor(const ResParam& param, const ResTensorParam& tensor, const float* scale, const float* shift);
+        };
+
+        void* ResizerTensorInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method,
+            SimdTensorFormatType format, SimdTensorDataType type, const float* scale, const float* shift, SimdBool letterbox, float fill);
+
+        //-------------------------------------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        void* ResizerBandInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 #endif //SIMD_AVX512BW_ENABLE 
 
@@ -597,6 +1100,7 @@ namespace Simd
 
             size_t BlockCountMax(size_t align);
             void EstimateParams();
+            void EstimateIndexAlphaX();
             template<size_t N> void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
             void RunG(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
         public:
@@ -638,6 +1142,8 @@ namespace Simd
         //-------------------------------------------------------------------------------------------------
 
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        void* ResizerBandInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 #endif //SIMD_NEON_ENABLE 
 }
@@ -0,0 +1,150 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSeparableFilter_h__
+#define __SimdSeparableFilter_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+#include <vector>
+
+namespace Simd
+{
+    struct SepFilterParam
+    {
+        size_t width;
+        size_t height;
+        size_t channels;
+        SimdSeparableFilterChannelType type;
+        std::vector<float> rowKernel;
+        std::vector<float> colKernel;
+        size_t align;
+
+        SepFilterParam(size_t w, size_t h, size_t c, SimdSeparableFilterChannelType t, const float* rk, size_t rs, const float* ck, size_t cs, size_t a);
+        bool Valid() const;
+
+        size_t ChannelSize() const
+        {
+            return type == SimdSeparableFilterChannel16u ? 2 : 1;
+        }
+
+        size_t PixelSize() const
+        {
+            return ChannelSize() * channels;
+        }
+    };
+
+    class SeparableFilter : Deletable
+    {
+    public:
+        SeparableFilter(const SepFilterParam& param);
+
+        virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride) = 0;
+
+    protected:
+        SepFilterParam _param;
+    };
+
+    namespace Base
+    {
+        struct SepFilterAlg
+        {
+            size_t size, rowSize, colSize, rowAnchor, colAnchor, stride, padSize, ringSize, bufSize, threads;
+            int shift;
+            bool exact;
+            Array16i rowInt, colInt;
+            Array32f rowFloat, colFloat;
+        };
+
+        typedef void (*SepFilterRowIntPtr)(const uint8_t* src, size_t size, size_t channels, const int16_t* kernel, size_t kernelSize, int16_t* dst);
+        typedef void (*SepFilterColIntPtr)(const int16_t* const* src, size_t size, const int16_t* kernel, size_t kernelSize, int shift, uint8_t* dst);
+        typedef void (*SepFilterRowFloatPtr)(const uint8_t* src, size_t size, size_t channels, const float* kernel, size_t kernelSize, float* dst);
+        typedef void (*SepFilterColFloatPtr)(const float* const* src, size_t size, const float* kernel, size_t kernelSize, uint8_t* dst);
+
+        class SeparableFilterDefault : public Simd::SeparableFilter
+        {
+        public:
+            SeparableFilterDefault(const SepFilterParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        protected:
+            void Run(const uint8_t* src, size_t srcStride, size_t yBeg, size_t yEnd, uint8_t* buf, uint8_t* dst, size_t dstStride);
+            void SetRow(const uint8_t* src, uint8_t* pad, uint8_t* dst);
+
+            SepFilterAlg _alg;
+            Array8u _buffer;
+            SepFilterRowIntPtr _rowInt;
+            SepFilterColIntPtr _colInt;
+            SepFilterRowFloatPtr _rowFloat;
+            SepFilterColFloatPtr _colFloat;
+        };
+
+        void* SeparableFilterInit(size_t width, size_t height, size_t channels, SimdSeparableFilterChannelType type, 
+            const float* rowKernel, size_t rowSize, const float* colKernel, size_t colSize);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class SeparableFilterDefault : public Base::SeparableFilterDefault
+        {
+        public:
+            SeparableFilterDefault(const SepFilterParam& param);
+        };
+
+        void* SeparableFilterInit(size_t width, size_t height, size_t channels, SimdSeparableFilterChannelType type,
+            const float* rowKernel, size_t rowSize, const float* colKernel, size_t colSize);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class SeparableFilterDefault : public Sse41::SeparableFilterDefault
+        {
+        public:
+            SeparableFilterDefault(const SepFilterParam& param);
+        };
+
+        void* SeparableFilterInit(size_t width, size_t height, size_t channels, SimdSeparableFilterChannelType type,
+            const float* rowKernel, size_t rowSize, const float* colKernel, size_t colSize);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class SeparableFilterDefault : public Avx2::SeparableFilterDefault
+        {
+        public:
+            SeparableFilterDefault(const SepFilterParam& param);
+        };
+
+        void* SeparableFilterInit(size_t width, size_t height, size_t channels, SimdSeparableFilterChannelType type,
+            const float* rowKernel, size_t rowSize, const float* colKernel, size_t colSize);
+    }
+#endif
+}
+#endif//__SimdSeparableFilter_h__
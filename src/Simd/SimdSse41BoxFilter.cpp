@@ -0,0 +1,182 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdBoxFilter.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        const __m128i K16_0001_FFFF = SIMD_MM_SET2_EPI16(1, -1);
+
+        SIMD_INLINE void BoxFilterColUpdate8u(__m128i add, __m128i sub, uint32_t* sum, uint32_t* sqsum)
+        {
+            __m128i lo = _mm_unpacklo_epi16(add, sub), hi = _mm_unpackhi_epi16(add, sub);
+            _mm_storeu_si128((__m128i*)sum + 0, _mm_add_epi32(_mm_loadu_si128((__m128i*)sum + 0), _mm_madd_epi16(lo, K16_0001_FFFF)));
+            _mm_storeu_si128((__m128i*)sum + 1, _mm_add_epi32(_mm_loadu_si128((__m128i*)sum + 1), _mm_madd_epi16(hi, K16_0001_FFFF)));
+            if (sqsum)
+            {
+                __m128i neg = _mm_sub_epi16(K_ZERO, sub);
+                _mm_storeu_si128((__m128i*)sqsum + 0, _mm_add_epi32(_mm_loadu_si128((__m128i*)sqsum + 0), _mm_madd_epi16(lo, _mm_unpacklo_epi16(add, neg))));
+                _mm_storeu_si128((__m128i*)sqsum + 1, _mm_add_epi32(_mm_loadu_si128((__m128i*)sqsum + 1), _mm_madd_epi16(hi, _mm_unpackhi_epi16(add, neg))));
+            }
+        }
+
+        void BoxFilterColUpdate8u(const uint8_t* add, const uint8_t* sub, size_t size, uint32_t* sum, uint32_t* sqsum)
+        {
+            size_t sizeA = AlignLo(size, A), i = 0;
+            for (; i < sizeA; i += A)
+            {
+                __m128i _add = _mm_loadu_si128((__m128i*)(add + i));
+                __m128i _sub = sub ? _mm_loadu_si128((__m128i*)(sub + i)) : K_ZERO;
+                BoxFilterColUpdate8u(_mm_unpacklo_epi8(_add, K_ZERO), _mm_unpacklo_epi8(_sub, K_ZERO), sum + i + 0, sqsum ? sqsum + i + 0 : NULL);
+                BoxFilterColUpdate8u(_mm_unpackhi_epi8(_add, K_ZERO), _mm_unpackhi_epi8(_sub, K_ZERO), sum + i + HA, sqsum ? sqsum + i + HA : NULL);
+            }
+            for (; i < size; ++i)
+            {
+                int a = add[i], s = sub ? sub[i] : 0;
+                sum[i] += a - s;
+                if (sqsum)
+                    sqsum[i] += a * a - s * s;
+            }
+        }
+
+        SIMD_INLINE void BoxFilterColUpdate32f(__m128d add, __m128d sub, double* sum, double* sqsum)
+        {
+            _mm_storeu_pd(sum, _mm_add_pd(_mm_loadu_pd(sum), _mm_sub_pd(add, sub)));
+            if (sqsum)
+                _mm_storeu_pd(sqsum, _mm_add_pd(_mm_loadu_pd(sqsum), _mm_sub_pd(_mm_mul_pd(add, add), _mm_mul_pd(sub, sub))));
+        }
+
+        static void BoxFilterColUpdate32f(const float* add, const float* sub, size_t size, double* sum, double* sqsum)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+            {
+                __m128 _add = _mm_loadu_ps(add + i);
+                __m128 _sub = sub ? _mm_loadu_ps(sub + i) : _mm_setzero_ps();
+                BoxFilterColUpdate32f(_mm_cvtps_pd(_add), _mm_cvtps_pd(_sub), sum + i + 0, sqsum ? sqsum + i + 0 : NULL);
+                BoxFilterColUpdate32f(_mm_cvtps_pd(_mm_movehl_ps(_add, _add)), _mm_cvtps_pd(_mm_movehl_ps(_sub, _sub)), sum + i + 2, sqsum ? sqsum + i + 2 : NULL);
+            }
+            for (; i < size; ++i)
+            {
+                double a = add[i], s = sub ? sub[i] : 0.0;
+                sum[i] += a - s;
+                if (sqsum)
+                    sqsum[i] += a * a - s * s;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE __m128 BoxFilterRow8u(const uint32_t* sum, const uint32_t* sqsum, size_t step, __m128 norm, float* var)
+        {
+            __m128i s = _mm_sub_epi32(_mm_loadu_si128((__m128i*)(sum + step)), _mm_loadu_si128((__m128i*)sum));
+            __m128 m = _mm_mul_ps(_mm_cvtepi32_ps(s), norm);
+            if (var)
+            {
+                __m128i q = _mm_sub_epi32(_mm_loadu_si128((__m128i*)(sqsum + step)), _mm_loadu_si128((__m128i*)sqsum));
+                _mm_storeu_ps(var, _mm_max_ps(_mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(q), norm), _mm_mul_ps(m, m)), _mm_setzero_ps()));
+            }
+            return m;
+        }
+
+        SIMD_INLINE void BoxFilterRow8u(const uint32_t* sum, const uint32_t* sqsum, size_t step, __m128 norm, uint8_t* mean, float* var)
+        {
+            __m128 half = _mm_set1_ps(0.5f);
+            __m128i m0 = _mm_cvttps_epi32(_mm_add_ps(BoxFilterRow8u(sum + 0 * F, sqsum ? sqsum + 0 * F : NULL, step, norm, var ? var + 0 * F : NULL), half));
+            __m128i m1 = _mm_cvttps_epi32(_mm_add_ps(BoxFilterRow8u(sum + 1 * F, sqsum ? sqsum + 1 * F : NULL, step, norm, var ? var + 1 * F : NULL), half));
+            __m128i m2 = _mm_cvttps_epi32(_mm_add_ps(BoxFilterRow8u(sum + 2 * F, sqsum ? sqsum + 2 * F : NULL, step, norm, var ? var + 2 * F : NULL), half));
+            __m128i m3 = _mm_cvttps_epi32(_mm_add_ps(BoxFilterRow8u(sum + 3 * F, sqsum ? sqsum + 3 * F : NULL, step, norm, var ? var + 3 * F : NULL), half));
+            _mm_storeu_si128((__m128i*)mean, _mm_packus_epi16(_mm_packs_epi32(m0, m1), _mm_packs_epi32(m2, m3)));
+        }
+
+        static void BoxFilterRow8u(const uint32_t* sum, const uint32_t* sqsum, size_t size, size_t step, float norm, uint8_t* mean, float* var)
+        {
+            __m128 _norm = _mm_set1_ps(norm);
+            size_t sizeA = AlignLo(size, A);
+            for (size_t i = 0; i < sizeA; i += A)
+                BoxFilterRow8u(sum + i, sqsum ? sqsum + i : NULL, step, _norm, mean + i, var ? var + i : NULL);
+            if (sizeA < size)
+            {
+                size_t i = size - A;
+                BoxFilterRow8u(sum + i, sqsum ? sqsum + i : NULL, step, _norm, mean + i, var ? var + i : NULL);
+            }
+        }
+
+        SIMD_INLINE __m128 BoxFilterRow32f(const double* sum, const double* sqsum, size_t step, __m128d norm, float* var)
+        {
+            __m128d m0 = _mm_mul_pd(_mm_sub_pd(_mm_loadu_pd(sum + step + 0), _mm_loadu_pd(sum + 0)), norm);
+            __m128d m1 = _mm_mul_pd(_mm_sub_pd(_mm_loadu_pd(sum + step + 2), _mm_loadu_pd(sum + 2)), norm);
+            if (var)
+            {
+                __m128d v0 = _mm_sub_pd(_mm_mul_pd(_mm_sub_pd(_mm_loadu_pd(sqsum + step + 0), _mm_loadu_pd(sqsum + 0)), norm), _mm_mul_pd(m0, m0));
+                __m128d v1 = _mm_sub_pd(_mm_mul_pd(_mm_sub_pd(_mm_loadu_pd(sqsum + step + 2), _mm_loadu_pd(sqsum + 2)), norm), _mm_mul_pd(m1, m1));
+                v0 = _mm_max_pd(v0, _mm_setzero_pd());
+                v1 = _mm_max_pd(v1, _mm_setzero_pd());
+                _mm_storeu_ps(var, _mm_movelh_ps(_mm_cvtpd_ps(v0), _mm_cvtpd_ps(v1)));
+            }
+            return _mm_movelh_ps(_mm_cvtpd_ps(m0), _mm_cvtpd_ps(m1));
+        }
+
+        static void BoxFilterRow32f(const double* sum, const double* sqsum, size_t size, size_t step, double norm, float* mean, float* var)
+        {
+            __m128d _norm = _mm_set1_pd(norm);
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                _mm_storeu_ps(mean + i, BoxFilterRow32f(sum + i, sqsum ? sqsum + i : NULL, step, _norm, var ? var + i : NULL));
+            if (sizeF < size)
+            {
+                size_t i = size - F;
+                _mm_storeu_ps(mean + i, BoxFilterRow32f(sum + i, sqsum ? sqsum + i : NULL, step, _norm, var ? var + i : NULL));
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        BoxFilterDefault::BoxFilterDefault(const BoxFilterParam& param)
+            : Base::BoxFilterDefault(param)
+        {
+            _colUpdate8u = BoxFilterColUpdate8u;
+            _colUpdate32f = BoxFilterColUpdate32f;
+            if (_alg.size >= A)
+                _row8u = BoxFilterRow8u;
+            if (_alg.size >= F)
+                _row32f = BoxFilterRow32f;
+        }
+
+        //---------------------------------------------------------------------
+
+        void* BoxFilterInit(size_t width, size_t height, size_t channels, SimdBoxFilterChannelType type, size_t radiusX, size_t radiusY)
+        {
+            BoxFilterParam param(width, height, channels, type, radiusX, radiusY, A);
+            if (!param.Valid())
+                return NULL;
+            return new BoxFilterDefault(param);
+        }
+    }
+#endif
+}
@@ -0,0 +1,141 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdCanny.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdSse41.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        const __m128i K16_CANNY_TAN = SIMD_MM_SET1_EPI16(Base::CANNY_TAN_22_5);
+        const __m128i K8_CANNY_EDGE = SIMD_MM_SET1_EPI8(Base::CannyMapEdge);
+
+        SIMD_INLINE void CannyMagnitude(const int16_t* dx, const int16_t* dy, int16_t* mag)
+        {
+            __m128i _dx = _mm_abs_epi16(_mm_loadu_si128((__m128i*)dx));
+            __m128i _dy = _mm_abs_epi16(_mm_loadu_si128((__m128i*)dy));
+            _mm_storeu_si128((__m128i*)mag, _mm_add_epi16(_dx, _dy));
+        }
+
+        static void CannyMagnitude(const int16_t* dx, const int16_t* dy, size_t width, int16_t* mag)
+        {
+            assert(width >= HA);
+            size_t widthHA = AlignLo(width, HA);
+            for (size_t x = 0; x < widthHA; x += HA)
+                CannyMagnitude(dx + x, dy + x, mag + x);
+            if (widthHA < width)
+                CannyMagnitude(dx + width - HA, dy + width - HA, mag + width - HA);
+        }
+
+        SIMD_INLINE __m128i CannyTan(__m128i a)
+        {
+            __m128i hi = _mm_add_epi16(_mm_mulhi_epu16(a, K16_CANNY_TAN), K16_0001);
+            return _mm_add_epi16(hi, _mm_cmpeq_epi16(_mm_mullo_epi16(a, K16_CANNY_TAN), _mm_setzero_si128()));
+        }
+
+        SIMD_INLINE __m128i CannyNms(const int16_t* dx, const int16_t* dy, const int16_t* mag0, const int16_t* mag1, const int16_t* mag2, __m128i low, __m128i high)
+        {
+            __m128i _dx = _mm_loadu_si128((__m128i*)dx);
+            __m128i _dy = _mm_loadu_si128((__m128i*)dy);
+            __m128i ax = _mm_abs_epi16(_dx), ay = _mm_abs_epi16(_dy);
+            __m128i hor = _mm_cmpgt_epi16(CannyTan(ax), ay);
+            __m128i ver = _mm_cmpgt_epi16(CannyTan(ay), ax);
+            __m128i neg = _mm_srai_epi16(_mm_xor_si128(_dx, _dy), 15);
+            __m128i a = _mm_blendv_epi8(_mm_loadu_si128((__m128i*)(mag0 - 1)), _mm_loadu_si128((__m128i*)(mag0 + 1)), neg);
+            __m128i b = _mm_blendv_epi8(_mm_loadu_si128((__m128i*)(mag2 + 1)), _mm_loadu_si128((__m128i*)(mag2 - 1)), neg);
+            a = _mm_blendv_epi8(a, _mm_loadu_si128((__m128i*)(mag1 - 1)), hor);
+            b = _mm_blendv_epi8(b, _mm_sub_epi16(_mm_loadu_si128((__m128i*)(mag1 + 1)), K16_0001), hor);
+            a = _mm_blendv_epi8(a, _mm_loadu_si128((__m128i*)mag0), ver);
+            b = _mm_blendv_epi8(b, _mm_sub_epi16(_mm_loadu_si128((__m128i*)mag2), K16_0001), ver);
+            __m128i m = _mm_loadu_si128((__m128i*)mag1);
+            __m128i max = _mm_and_si128(_mm_cmpgt_epi16(m, low), _mm_and_si128(_mm_cmpgt_epi16(m, a), _mm_cmpgt_epi16(m, b)));
+            return _mm_and_si128(max, _mm_sub_epi16(K16_0001, _mm_cmpgt_epi16(m, high)));
+        }
+
+        SIMD_INLINE void CannyNms(const int16_t* dx, const int16_t* dy, const int16_t* mag0, const int16_t* mag1, const int16_t* mag2, __m128i low, __m128i high, uint8_t* map)
+        {
+            __m128i lo = CannyNms(dx + 0, dy + 0, mag0 + 0, mag1 + 0, mag2 + 0, low, high);
+            __m128i hi = CannyNms(dx + HA, dy + HA, mag0 + HA, mag1 + HA, mag2 + HA, low, high);
+            _mm_storeu_si128((__m128i*)map, _mm_packus_epi16(lo, hi));
+        }
+
+        static void CannyNms(const int16_t* dx, const int16_t* dy, const int16_t* mag0, const int16_t* mag1, const int16_t* mag2, size_t width, int16_t low, int16_t high, uint8_t* map)
+        {
+            assert(width >= A);
+            size_t widthA = AlignLo(width, A);
+            __m128i _low = _mm_set1_epi16(low), _high = _mm_set1_epi16(high);
+            for (size_t x = 0; x < widthA; x += A)
+                CannyNms(dx + x, dy + x, mag0 + x, mag1 + x, mag2 + x, _low, _high, map + x);
+            if (widthA < width)
+            {
+                size_t x = width - A;
+                CannyNms(dx + x, dy + x, mag0 + x, mag1 + x, mag2 + x, _low, _high, map + x);
+            }
+        }
+
+        SIMD_INLINE void CannyOutput(const uint8_t* map, uint8_t* dst)
+        {
+            _mm_storeu_si128((__m128i*)dst, _mm_cmpeq_epi8(_mm_loadu_si128((__m128i*)map), K8_CANNY_EDGE));
+        }
+
+        static void CannyOutput(const uint8_t* map, size_t width, uint8_t* dst)
+        {
+            assert(width >= A);
+            size_t widthA = AlignLo(width, A);
+            for (size_t x = 0; x < widthA; x += A)
+                CannyOutput(map + x, dst + x);
+            if (widthA < width)
+                CannyOutput(map + width - A, dst + width - A);
+        }
+
+        //---------------------------------------------------------------------
+
+        CannyDefault::CannyDefault(const CannyParam& param)
+            : Base::CannyDefault(param)
+        {
+            if (_param.width > A)
+            {
+                _sobelDx = Sse41::SobelDx;
+                _sobelDy = Sse41::SobelDy;
+                _magnitude = CannyMagnitude;
+                _nms = CannyNms;
+                _output = CannyOutput;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void* CannyInit(size_t width, size_t height, float lowThreshold, float highThreshold)
+        {
+            CannyParam param(width, height, lowThreshold, highThreshold);
+            if (!param.Valid())
+                return NULL;
+            return new CannyDefault(param);
+        }
+    }
+#endif
+}
@@ -0,0 +1,86 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdClahe.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdSse41.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        SIMD_INLINE __m128i ClaheLerp(__m128i a, __m128i b, __m128i w)
+        {
+            return _mm_add_epi32(_mm_slli_epi32(a, Base::CLAHE_SHIFT), _mm_mullo_epi32(_mm_sub_epi32(b, a), w));
+        }
+
+        SIMD_INLINE __m128i ClaheInterpolate4(const uint8_t* src, const int32_t* ix0, const int32_t* ix1, __m128i wx,
+            const int32_t* lut0, const int32_t* lut1, __m128i wy)
+        {
+            int v0 = src[0], v1 = src[1], v2 = src[2], v3 = src[3];
+            __m128i a = _mm_setr_epi32(lut0[ix0[0] + v0], lut0[ix0[1] + v1], lut0[ix0[2] + v2], lut0[ix0[3] + v3]);
+            __m128i b = _mm_setr_epi32(lut0[ix1[0] + v0], lut0[ix1[1] + v1], lut0[ix1[2] + v2], lut0[ix1[3] + v3]);
+            __m128i c = _mm_setr_epi32(lut1[ix0[0] + v0], lut1[ix0[1] + v1], lut1[ix0[2] + v2], lut1[ix0[3] + v3]);
+            __m128i d = _mm_setr_epi32(lut1[ix1[0] + v0], lut1[ix1[1] + v1], lut1[ix1[2] + v2], lut1[ix1[3] + v3]);
+            __m128i top = ClaheLerp(a, b, wx);
+            __m128i bot = ClaheLerp(c, d, wx);
+            __m128i sum = _mm_add_epi32(ClaheLerp(top, bot, wy), _mm_set1_epi32(Base::CLAHE_ROUND));
+            return _mm_srli_epi32(sum, 2 * Base::CLAHE_SHIFT);
+        }
+
+        static void ClaheInterpolate(const uint8_t* src, size_t width, const int32_t* ix0, const int32_t* ix1, const int32_t* wx,
+            const int32_t* lut0, const int32_t* lut1, int32_t wy, uint8_t* dst)
+        {
+            size_t width8 = AlignLo(width, 8), x = 0;
+            __m128i _wy = _mm_set1_epi32(wy);
+            for (; x < width8; x += 8)
+            {
+                __m128i lo = ClaheInterpolate4(src + x + 0, ix0 + x + 0, ix1 + x + 0, _mm_loadu_si128((__m128i*)(wx + x + 0)), lut0, lut1, _wy);
+                __m128i hi = ClaheInterpolate4(src + x + 4, ix0 + x + 4, ix1 + x + 4, _mm_loadu_si128((__m128i*)(wx + x + 4)), lut0, lut1, _wy);
+                _mm_storel_epi64((__m128i*)(dst + x), _mm_packus_epi16(_mm_packus_epi32(lo, hi), K_ZERO));
+            }
+            for (; x < width; ++x)
+                dst[x] = Base::ClaheInterpolate(src[x], ix0[x], ix1[x], wx[x], lut0, lut1, wy);
+        }
+
+        //---------------------------------------------------------------------
+
+        ClaheDefault::ClaheDefault(const ClaheParam& param)
+            : Base::ClaheDefault(param)
+        {
+            _interpolate = ClaheInterpolate;
+        }
+
+        //---------------------------------------------------------------------
+
+        void* ClaheInit(size_t width, size_t height, size_t tilesX, size_t tilesY, float clipLimit)
+        {
+            ClaheParam param(width, height, tilesX, tilesY, clipLimit);
+            if (!param.Valid())
+                return NULL;
+            return new ClaheDefault(param);
+        }
+    }
+#endif
+}
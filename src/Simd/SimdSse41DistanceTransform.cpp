@@ -0,0 +1,209 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdDistanceTransform.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdSse41.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        SIMD_INLINE __m128i Load(const int32_t* src)
+        {
+            return _mm_loadu_si128((__m128i*)src);
+        }
+
+        SIMD_INLINE __m128i DistanceMask(const uint8_t* mask, __m128i index)
+        {
+            return _mm_cmpeq_epi32(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(int32_t*)mask)), index);
+        }
+
+        //---------------------------------------------------------------------
+
+        template<bool root> SIMD_INLINE __m128 DistanceValue(const int32_t* src, __m128 scale)
+        {
+            __m128 value = _mm_cvtepi32_ps(Load(src));
+            if (root)
+                value = _mm_sqrt_ps(value);
+            return _mm_div_ps(value, scale);
+        }
+
+        SIMD_INLINE __m128i DistanceTo16u(__m128 value)
+        {
+            return _mm_cvttps_epi32(_mm_min_ps(_mm_add_ps(value, _mm_set1_ps(0.5f)), _mm_set1_ps(65535.0f)));
+        }
+
+        template<bool root> SIMD_INLINE void DistanceStore16u(const int32_t* src, __m128 scale, uint16_t* dst)
+        {
+            __m128i lo = DistanceTo16u(DistanceValue<root>(src + 0, scale));
+            __m128i hi = DistanceTo16u(DistanceValue<root>(src + F, scale));
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi32(lo, hi));
+        }
+
+        template<bool root> void DistanceConvert32f(const int32_t* src, size_t width, float scale, uint8_t* dst)
+        {
+            size_t widthF = AlignLo(width, F);
+            float* _dst = (float*)dst;
+            __m128 _scale = _mm_set1_ps(scale);
+            for (size_t x = 0; x < widthF; x += F)
+                _mm_storeu_ps(_dst + x, DistanceValue<root>(src + x, _scale));
+            if (widthF < width)
+                _mm_storeu_ps(_dst + width - F, DistanceValue<root>(src + width - F, _scale));
+        }
+
+        template<bool root> void DistanceConvert16u(const int32_t* src, size_t width, float scale, uint8_t* dst)
+        {
+            size_t widthDF = AlignLo(width, DF);
+            uint16_t* _dst = (uint16_t*)dst;
+            __m128 _scale = _mm_set1_ps(scale);
+            for (size_t x = 0; x < widthDF; x += DF)
+                DistanceStore16u<root>(src + x, _scale, _dst + x);
+            if (widthDF < width)
+                DistanceStore16u<root>(src + width - DF, _scale, _dst + width - DF);
+        }
+
+        template<bool root> Base::DistanceConvertPtr GetDistanceConvert(SimdDistanceTransformDataType data)
+        {
+            return data == SimdDistanceTransform32f ? DistanceConvert32f<root> : DistanceConvert16u<root>;
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void DistanceEdtFirst(const uint8_t* mask, __m128i index, __m128i limit, int32_t* dst)
+        {
+            _mm_storeu_si128((__m128i*)dst, _mm_andnot_si128(DistanceMask(mask, index), limit));
+        }
+
+        SIMD_INLINE void DistanceEdtDown(const uint8_t* mask, __m128i index, __m128i limit, const int32_t* up, int32_t* dst)
+        {
+            __m128i _up = _mm_min_epi32(_mm_add_epi32(Load(up), K32_00000001), limit);
+            _mm_storeu_si128((__m128i*)dst, _mm_andnot_si128(DistanceMask(mask, index), _up));
+        }
+
+        SIMD_INLINE void DistanceEdtUp(const int32_t* down, int32_t* dst)
+        {
+            _mm_storeu_si128((__m128i*)dst, _mm_min_epi32(Load(dst), _mm_add_epi32(Load(down), K32_00000001)));
+        }
+
+        static void DistanceEdtColumns(const uint8_t* mask, size_t maskStride, size_t width, size_t height,
+            uint8_t index, int32_t limit, int32_t* dst, size_t dstStride)
+        {
+            size_t widthF = AlignLo(width, F), tail = width - F;
+            __m128i _index = _mm_set1_epi32(index), _limit = _mm_set1_epi32(limit);
+            for (size_t x = 0; x < widthF; x += F)
+                DistanceEdtFirst(mask + x, _index, _limit, dst + x);
+            if (widthF < width)
+                DistanceEdtFirst(mask + tail, _index, _limit, dst + tail);
+            for (size_t y = 1; y < height; ++y)
+            {
+                const uint8_t* m = mask + y * maskStride;
+                const int32_t* up = dst + (y - 1) * dstStride;
+                int32_t* g = dst + y * dstStride;
+                for (size_t x = 0; x < widthF; x += F)
+                    DistanceEdtDown(m + x, _index, _limit, up + x, g + x);
+                if (widthF < width)
+                    DistanceEdtDown(m + tail, _index, _limit, up + tail, g + tail);
+            }
+            for (size_t y = height - 1; y > 0; --y)
+            {
+                const int32_t* down = dst + y * dstStride;
+                int32_t* g = dst + (y - 1) * dstStride;
+                for (size_t x = 0; x < widthF; x += F)
+                    DistanceEdtUp(down + x, g + x);
+                if (widthF < width)
+                    DistanceEdtUp(down + tail, g + tail);
+            }
+        }
+
+        DistanceTransformEdt::DistanceTransformEdt(const DistanceTransformParam& param)
+            : Base::DistanceTransformEdt(param)
+        {
+            if (_param.width >= DF)
+            {
+                _columns = DistanceEdtColumns;
+                _convert = GetDistanceConvert<true>(_param.data);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        static void DistanceChamferInit(const uint8_t* mask, size_t width, uint8_t index, int32_t* dst)
+        {
+            size_t widthF = AlignLo(width, F);
+            __m128i _index = _mm_set1_epi32(index), inf = _mm_set1_epi32(Base::DISTANCE_CHAMFER_INF);
+            for (size_t x = 0; x < widthF; x += F)
+                DistanceEdtFirst(mask + x, _index, inf, dst + x);
+            if (widthF < width)
+                DistanceEdtFirst(mask + width - F, _index, inf, dst + width - F);
+        }
+
+        template<int size> SIMD_INLINE void DistanceChamferMin(const int32_t* row1, const int32_t* row2, __m128i a, __m128i b, __m128i c, int32_t* dst)
+        {
+            __m128i d = _mm_min_epi32(Load(dst), _mm_add_epi32(Load(row1), a));
+            d = _mm_min_epi32(d, _mm_add_epi32(_mm_min_epi32(Load(row1 - 1), Load(row1 + 1)), b));
+            if (size == 5)
+            {
+                d = _mm_min_epi32(d, _mm_add_epi32(_mm_min_epi32(Load(row1 - 2), Load(row1 + 2)), c));
+                d = _mm_min_epi32(d, _mm_add_epi32(_mm_min_epi32(Load(row2 - 1), Load(row2 + 1)), c));
+            }
+            _mm_storeu_si128((__m128i*)dst, d);
+        }
+
+        template<int size> void DistanceChamferRow(const int32_t* row1, const int32_t* row2, size_t width, const int32_t* weights, int32_t* dst)
+        {
+            size_t widthF = AlignLo(width, F), tail = width - F;
+            __m128i a = _mm_set1_epi32(weights[0]), b = _mm_set1_epi32(weights[1]), c = _mm_set1_epi32(weights[2]);
+            for (size_t x = 0; x < widthF; x += F)
+                DistanceChamferMin<size>(row1 + x, row2 + x, a, b, c, dst + x);
+            if (widthF < width)
+                DistanceChamferMin<size>(row1 + tail, row2 + tail, a, b, c, dst + tail);
+        }
+
+        DistanceTransformChamfer::DistanceTransformChamfer(const DistanceTransformParam& param)
+            : Base::DistanceTransformChamfer(param)
+        {
+            if (_param.width >= DF)
+            {
+                _init = DistanceChamferInit;
+                _row = _param.type == SimdDistanceTransformChamfer3x3 ? DistanceChamferRow<3> : DistanceChamferRow<5>;
+                _convert = GetDistanceConvert<false>(_param.data);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void* DistanceTransformInit(size_t width, size_t height, SimdDistanceTransformType type, SimdDistanceTransformDataType data)
+        {
+            DistanceTransformParam param(width, height, type, data);
+            if (!param.Valid())
+                return NULL;
+            if (type == SimdDistanceTransformEuclidean)
+                return new DistanceTransformEdt(param);
+            else
+                return new DistanceTransformChamfer(param);
+        }
+    }
+#endif
+}
@@ -36,7 +36,17 @@ namespace Simd
             return _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(int32_t*)src)));
         }
 
-        SIMD_INLINE void BlurColsAny(const uint8_t* src, size_t size, size_t channels, const float* weight, size_t kernel, float* dst)
+        SIMD_INLINE __m128 LoadAs32f(const uint16_t* src)
+        {
+            return _mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_loadl_epi64((__m128i*)src)));
+        }
+
+        SIMD_INLINE __m128 LoadAs32f(const float* src)
+        {
+            return _mm_loadu_ps(src);
+        }
+
+        template<class T> SIMD_INLINE void BlurColsAny(const T* src, size_t size, size_t channels, const float* weight, size_t kernel, float* dst)
         {
             size_t sizeF = AlignLo(size, F);
             size_t i = 0;
@@ -56,13 +66,13 @@ namespace Simd
             }
         }
 
-        SIMD_INLINE void StoreAs8u(uint8_t* dst, const __m128 & f0)
+        SIMD_INLINE void StoreAs(uint8_t* dst, const __m128 & f0)
         {
             __m128i i0 = _mm_cvtps_epi32(f0);
             ((int32_t*)dst)[0] = _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packs_epi32(i0, K_ZERO), K_ZERO));
         }
 
-        SIMD_INLINE void StoreAs8u(uint8_t* dst, const __m128& f0, const __m128& f1, const __m128& f2, const __m128& f3)
+        SIMD_INLINE void StoreAs(uint8_t* dst, const __m128& f0, const __m128& f1, const __m128& f2, const __m128& f3)
         {
             __m128i i0 = _mm_cvtps_epi32(f0);
             __m128i i1 = _mm_cvtps_epi32(f1);
@@ -71,7 +81,32 @@ namespace Simd
             _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(_mm_packs_epi32(i0, i1), _mm_packs_epi32(i2, i3)));
         }
 
-        SIMD_INLINE void BlurRowsAny(const float* src, size_t size, size_t stride, const float* weight, size_t kernel, uint8_t* dst)
+        SIMD_INLINE void StoreAs(uint16_t* dst, const __m128& f0)
+        {
+            __m128i i0 = _mm_cvtps_epi32(f0);
+            _mm_storel_epi64((__m128i*)dst, _mm_packus_epi32(i0, K_ZERO));
+        }
+
+        SIMD_INLINE void StoreAs(uint16_t* dst, const __m128& f0, const __m128& f1, const __m128& f2, const __m128& f3)
+        {
+            _mm_storeu_si128((__m128i*)dst + 0, _mm_packus_epi32(_mm_cvtps_epi32(f0), _mm_cvtps_epi32(f1)));
+            _mm_storeu_si128((__m128i*)dst + 1, _mm_packus_epi32(_mm_cvtps_epi32(f2), _mm_cvtps_epi32(f3)));
+        }
+
+        SIMD_INLINE void StoreAs(float* dst, const __m128& f0)
+        {
+            _mm_storeu_ps(dst, f0);
+        }
+
+        SIMD_INLINE void StoreAs(float* dst, const __m128& f0, const __m128& f1, const __m128& f2, const __m128& f3)
+        {
+            _mm_storeu_ps(dst + 0 * F, f0);
+            _mm_storeu_ps(dst + 1 * F, f1);
+            _mm_storeu_ps(dst + 2 * F, f2);
+            _mm_storeu_ps(dst + 3 * F, f3);
+        }
+
+        template<class T> SIMD_INLINE void BlurRowsAny(const float* src, size_t size, size_t stride, const float* weight, size_t kernel, T* dst)
         {
             size_t sizeA = AlignLo(size, A);
             size_t sizeF = AlignLo(size, F);
@@ -91,59 +126,41 @@ namespace Simd
                     sum2 = _mm_add_ps(_mm_mul_ps(w, _mm_loadu_ps(ps + 2 * F)), sum2);
                     sum3 = _mm_add_ps(_mm_mul_ps(w, _mm_loadu_ps(ps + 3 * F)), sum3);
                 }
-                StoreAs8u(dst + i, sum0, sum1, sum2, sum3);
+                StoreAs(dst + i, sum0, sum1, sum2, sum3);
             }
             for (; i < sizeF; i += F)
             {
                 __m128 sum = _mm_setzero_ps();
                 for (size_t k = 0; k < kernel; ++k)
                     sum = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(weight[k]), _mm_loadu_ps(src + i + k * stride)), sum);
-                StoreAs8u(dst + i, sum);
+                StoreAs(dst + i, sum);
             }
             for (; i < size; ++i)
             {
                 float sum = 0;
                 for (size_t k = 0; k < kernel; ++k)
                     sum += weight[k] * src[i + k * stride];
-                dst[i] = Round(sum);
+                dst[i] = Base::BlurConvert<T>(sum);
             }
         }
 
-        template<int channels> void BlurImageAny(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
+        template<class T, int channels> void BlurImageAny(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, 
+            size_t yBeg, size_t yEnd, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
         {
-            Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-            BlurColsAny(cols, a.size, p.channels, a.weight.data, a.kernel, rows + a.half * a.stride);
-            for (size_t row = 0; row < a.half; ++row)
-                memcpy(rows + row * a.stride, rows + a.half * a.stride, a.size * sizeof(float));
-            for (size_t row = 1; row < a.nose; ++row)
-            {
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurColsAny(cols, a.size, p.channels, a.weight.data, a.kernel, rows + (a.half + row) * a.stride);
-            }
-            for (size_t row = a.nose; row <= a.half; ++row)
-                memcpy(rows + (a.half + row) * a.stride, rows + (a.half + a.nose - 1) * a.stride, a.size * sizeof(float));
-            BlurRowsAny(rows, a.size, a.stride, a.weight.data, a.kernel, dst), dst += dstStride;
-
-            for (size_t row = 1, b = row % a.kernel + 2 * a.half, w = a.kernel - row % a.kernel; row < a.body; ++row, ++b, --w)
-            {
-                if (b >= a.kernel)
-                    b -= a.kernel;
-                if (w == 0)
-                    w += a.kernel;
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurColsAny(cols, a.size, p.channels, a.weight.data, a.kernel, rows + b * a.stride);
-                BlurRowsAny(rows, a.size, a.stride, a.weight.data + w, a.kernel, dst), dst += dstStride;
-            }
-
-            size_t last = (a.body + 2 * a.half - 1) % a.kernel;
-            for (size_t row = a.body, b = row % a.kernel + 2 * a.half, w = a.kernel - row % a.kernel; row < p.height; ++row, ++b, --w)
+            ptrdiff_t beg = yBeg - a.half, end = yEnd + a.half, last = p.height - 1;
+            for (ptrdiff_t sy = beg; sy < end; ++sy)
             {
-                if (b >= a.kernel)
-                    b -= a.kernel;
-                if (w == 0)
-                    w += a.kernel;
-                memcpy(rows + b * a.stride, rows + last * a.stride, a.size * sizeof(float));
-                BlurRowsAny(rows, a.size, a.stride, a.weight.data + w, a.kernel, dst), dst += dstStride;
+                float* row = rows + (sy + a.half) % a.kernel * a.stride;
+                if (sy > beg && (sy <= 0 || sy > last))
+                    memcpy(row, rows + (sy + a.half - 1) % a.kernel * a.stride, a.size * sizeof(float));
+                else
+                {
+                    Base::PadCols<int(channels * sizeof(T))>(src + Simd::RestrictRange<ptrdiff_t>(sy, 0, last) * srcStride, a.half, a.size * sizeof(T), cols);
+                    BlurColsAny((T*)cols, a.size, channels, a.weight.data, a.kernel, row);
+                }
+                ptrdiff_t y = sy - a.half;
+                if (y >= (ptrdiff_t)yBeg)
+                    BlurRowsAny(rows, a.size, a.stride, a.weight.data + a.kernel - y % a.kernel, a.kernel, (T*)(dst + y * dstStride));
             }
         }
 
@@ -246,14 +263,14 @@ namespace Simd
                     sum2 = _mm_add_ps(_mm_mul_ps(w[k], _mm_loadu_ps(ps + 2 * F)), sum2);
                     sum3 = _mm_add_ps(_mm_mul_ps(w[k], _mm_loadu_ps(ps + 3 * F)), sum3);
                 }
-                StoreAs8u(dst + i, sum0, sum1, sum2, sum3);
+                StoreAs(dst + i, sum0, sum1, sum2, sum3);
             }
             for (; i < sizeF; i += F)
             {
                 __m128 sum = _mm_setzero_ps();
                 for (size_t k = 0; k < kernel; ++k)
                     sum = _mm_add_ps(_mm_mul_ps(w[k], _mm_loadu_ps(src + i + k * stride)), sum);
-                StoreAs8u(dst + i, sum);
+                StoreAs(dst + i, sum);
             }
             for (; i < size; ++i)
             {
@@ -264,41 +281,23 @@ namespace Simd
             }
         }
 
-        template<int channels, int kernel> void BlurImage(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
+        template<int channels, int kernel> void BlurImage(const BlurParam& p, const Base::AlgDefault& a, const uint8_t* src, size_t srcStride, 
+            size_t yBeg, size_t yEnd, uint8_t* cols, float* rows, uint8_t* dst, size_t dstStride)
         {
-            Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-            BlurCols<kernel>(cols, a.size, p.channels, a.weight.data, rows + a.half * a.stride);
-            for (size_t row = 0; row < a.half; ++row)
-                memcpy(rows + row * a.stride, rows + a.half * a.stride, a.size * sizeof(float));
-            for (size_t row = 1; row < a.nose; ++row)
+            ptrdiff_t beg = yBeg - a.half, end = yEnd + a.half, last = p.height - 1;
+            for (ptrdiff_t sy = beg; sy < end; ++sy)
             {
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurCols<kernel>(cols, a.size, p.channels, a.weight.data, rows + (a.half + row) * a.stride);
-            }
-            for (size_t row = a.nose; row <= a.half; ++row)
-                memcpy(rows + (a.half + row) * a.stride, rows + (a.half + a.nose - 1) * a.stride, a.size * sizeof(float));
-            BlurRows<kernel>(rows, a.size, a.stride, a.weight.data, dst), dst += dstStride;
-
-            for (size_t row = 1, b = row % a.kernel + 2 * a.half, w = kernel - row % kernel; row < a.body; ++row, ++b, --w)
-            {
-                if (b >= kernel)
-                    b -= kernel;
-                if (w == 0)
-                    w += kernel;
-                Base::PadCols<channels>(src, a.half, a.size, cols), src += srcStride;
-                BlurCols<kernel>(cols, a.size, p.channels, a.weight.data, rows + b * a.stride);
-                BlurRows<kernel>(rows, a.size, a.stride, a.weight.data + w, dst), dst += dstStride;
-            }
-
-            size_t last = (a.body + 2 * a.half - 1) % kernel;
-            for (size_t row = a.body, b = row % kernel + 2 * a.half, w = kernel - row % kernel; row < p.height; ++row, ++b, --w)
-            {
-                if (b >= kernel)
-                    b -= kernel;
-                if (w == 0)
-                    w += kernel;
-                memcpy(rows + b * a.stride, rows + last * a.stride, a.size * sizeof(float));
-                BlurRows<kernel>(rows, a.size, a.stride, a.weight.data + w, dst), dst += dstStride;
+                float* row = rows + (sy + a.half) % kernel * a.stride;
+                if (sy > beg && (sy <= 0 || sy > last))
+                    memcpy(row, rows + (sy + a.half - 1) % kernel * a.stride, a.size * sizeof(float));
+                else
+                {
+                    Base::PadCols<channels>(src + Simd::RestrictRange<ptrdiff_t>(sy, 0, last) * srcStride, a.half, a.size, cols);
+                    BlurCols<kernel>(cols, a.size, p.channels, a.weight.data, row);
+                }
+                ptrdiff_t y = sy - a.half;
+                if (y >= (ptrdiff_t)yBeg)
+                    BlurRows<kernel>(rows, a.size, a.stride, a.weight.data + kernel - y % kernel, dst + y * dstStride);
             }
         }
 
@@ -306,13 +305,19 @@ namespace Simd
 
         template<int channels> Base::BlurDefaultPtr GetBlurDefaultPtr(const BlurParam& p, const Base::AlgDefault& a)
         {
+            switch (p.type)
+            {
+            case SimdGaussianBlurChannel16u: return BlurImageAny<uint16_t, channels>;
+            case SimdGaussianBlurChannel32f: return BlurImageAny<float, channels>;
+            default: break;
+            }
             switch (a.kernel)
             {
             case 3: return BlurImage<channels, 3>;
             case 5: return BlurImage<channels, 5>;
             case 7: return BlurImage<channels, 7>;
             case 9: return BlurImage<channels, 9>;
-            default: return BlurImageAny<channels>;
+            default: return BlurImageAny<uint8_t, channels>;
             }
         }
 
@@ -335,6 +340,105 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        SIMD_INLINE __m128 IirSum(const __m128* k, const __m128& x0, const __m128& y1, const __m128& y2, const __m128& y3)
+        {
+            return _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(k[0], x0), _mm_mul_ps(k[1], y1)), _mm_mul_ps(k[2], y2)), _mm_mul_ps(k[3], y3));
+        }
+
+        SIMD_INLINE __m128 IirInit(const __m128* m, const __m128& e, const __m128& u0, const __m128& u1, const __m128& u2)
+        {
+            return _mm_add_ps(_mm_add_ps(_mm_add_ps(e, _mm_mul_ps(m[0], u0)), _mm_mul_ps(m[1], u1)), _mm_mul_ps(m[2], u2));
+        }
+
+        template<class T> void BlurIirVer(const Base::AlgIir& a, size_t size, size_t height, float* img, size_t stride, float* buf, uint8_t* dst, size_t dstStride)
+        {
+            size_t sizeF = AlignLo(size, F), i;
+            __m128 k[4], m[9];
+            k[0] = _mm_set1_ps(a.b);
+            k[1] = _mm_set1_ps(a.a1);
+            k[2] = _mm_set1_ps(a.a2);
+            k[3] = _mm_set1_ps(a.a3);
+            for (size_t j = 0; j < 9; ++j)
+                m[j] = _mm_set1_ps(a.m[j]);
+            float* first = buf, * last = buf + size, * next1 = buf + 2 * size, * next2 = buf + 3 * size;
+            memcpy(first, img, size * sizeof(float));
+            memcpy(last, img + (height - 1) * stride, size * sizeof(float));
+            for (ptrdiff_t y = 0; y < (ptrdiff_t)height; ++y)
+            {
+                float* w0 = img + y * stride;
+                const float* w1 = y > 0 ? w0 - stride : first;
+                const float* w2 = y > 1 ? w0 - 2 * stride : first;
+                const float* w3 = y > 2 ? w0 - 3 * stride : first;
+                for (i = 0; i < sizeF; i += F)
+                    _mm_storeu_ps(w0 + i, IirSum(k, _mm_loadu_ps(w0 + i), _mm_loadu_ps(w1 + i), _mm_loadu_ps(w2 + i), _mm_loadu_ps(w3 + i)));
+                for (; i < size; ++i)
+                    w0[i] = a.b * w0[i] + a.a1 * w1[i] + a.a2 * w2[i] + a.a3 * w3[i];
+            }
+            {
+                ptrdiff_t y = height - 1;
+                float* y0 = img + y * stride;
+                const float* w1 = y > 0 ? y0 - stride : first;
+                const float* w2 = y > 1 ? y0 - 2 * stride : first;
+                T* d = (T*)(dst + y * dstStride);
+                for (i = 0; i < sizeF; i += F)
+                {
+                    __m128 e = _mm_loadu_ps(last + i);
+                    __m128 u0 = _mm_sub_ps(_mm_loadu_ps(y0 + i), e);
+                    __m128 u1 = _mm_sub_ps(_mm_loadu_ps(w1 + i), e);
+                    __m128 u2 = _mm_sub_ps(_mm_loadu_ps(w2 + i), e);
+                    __m128 v0 = IirInit(m + 0, e, u0, u1, u2);
+                    _mm_storeu_ps(y0 + i, v0);
+                    _mm_storeu_ps(next1 + i, IirInit(m + 3, e, u0, u1, u2));
+                    _mm_storeu_ps(next2 + i, IirInit(m + 6, e, u0, u1, u2));
+                    StoreAs(d + i, v0);
+                }
+                for (; i < size; ++i)
+                {
+                    float e = last[i], u0 = y0[i] - e, u1 = w1[i] - e, u2 = w2[i] - e;
+                    y0[i] = e + a.m[0] * u0 + a.m[1] * u1 + a.m[2] * u2;
+                    next1[i] = e + a.m[3] * u0 + a.m[4] * u1 + a.m[5] * u2;
+                    next2[i] = e + a.m[6] * u0 + a.m[7] * u1 + a.m[8] * u2;
+                    d[i] = Base::BlurConvert<T>(y0[i]);
+                }
+            }
+            for (ptrdiff_t y = height - 2; y >= 0; --y)
+            {
+                float* y0 = img + y * stride;
+                const float* y1 = y0 + stride;
+                const float* y2 = y + 2 < (ptrdiff_t)height ? y0 + 2 * stride : next1;
+                const float* y3 = y + 3 < (ptrdiff_t)height ? y0 + 3 * stride : (y + 3 == (ptrdiff_t)height ? next1 : next2);
+                T* d = (T*)(dst + y * dstStride);
+                for (i = 0; i < sizeF; i += F)
+                {
+                    __m128 v0 = IirSum(k, _mm_loadu_ps(y0 + i), _mm_loadu_ps(y1 + i), _mm_loadu_ps(y2 + i), _mm_loadu_ps(y3 + i));
+                    _mm_storeu_ps(y0 + i, v0);
+                    StoreAs(d + i, v0);
+                }
+                for (; i < size; ++i)
+                {
+                    y0[i] = a.b * y0[i] + a.a1 * y1[i] + a.a2 * y2[i] + a.a3 * y3[i];
+                    d[i] = Base::BlurConvert<T>(y0[i]);
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        GaussianBlurIir::GaussianBlurIir(const BlurParam& param)
+            : Base::GaussianBlurIir(param)
+        {
+            switch (_param.type)
+            {
+            case SimdGaussianBlurChannel8u: _ver = BlurIirVer<uint8_t>; break;
+            case SimdGaussianBlurChannel16u: _ver = BlurIirVer<uint16_t>; break;
+            case SimdGaussianBlurChannel32f: _ver = BlurIirVer<float>; break;
+            default:
+                assert(0);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         void* GaussianBlurInit(size_t width, size_t height, size_t channels, const float* sigma, const float* epsilon)
         {
             BlurParam param(width, height, channels, sigma, epsilon, A);
@@ -342,6 +446,17 @@ namespace Simd
                 return NULL;
             return new GaussianBlurDefault(param);
         }
+
+        void* GaussianBlurInitEx(size_t width, size_t height, size_t channels, SimdGaussianBlurChannelType type,
+            const float* sigma, const float* epsilon, SimdGaussianBlurMethod method)
+        {
+            BlurParam param(width, height, channels, type, sigma, epsilon, method, A);
+            if (!param.Valid())
+                return NULL;
+            if (param.Iir())
+                return new GaussianBlurIir(param);
+            return new GaussianBlurDefault(param);
+        }
     }
 #endif// SIMD_SSE41_ENABLE
 }
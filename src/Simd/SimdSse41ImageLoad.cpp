@@ -125,6 +125,29 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        ImageQoiLoader::ImageQoiLoader(const ImageLoaderParam& param)
+            : Base::ImageQoiLoader(param)
+        {
+        }
+
+        void ImageQoiLoader::SetConverters()
+        {
+            Base::ImageQoiLoader::SetConverters();
+            if (_image.width >= A)
+            {
+                switch (_param.format)
+                {
+                case SimdPixelFormatGray8: _converter = Sse41::RgbaToGray; break;
+                case SimdPixelFormatBgr24: _converter = Sse41::BgraToRgb; break;
+                case SimdPixelFormatBgra32: _converter = Sse41::BgraToRgba; break;
+                case SimdPixelFormatRgb24: _converter = Sse41::BgraToBgr; break;
+                default: break;
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         ImageLoader* CreateImageLoader(const ImageLoaderParam& param)
         {
             switch (param.file)
@@ -135,6 +158,7 @@ namespace Simd
             case SimdImageFilePpmBin: return new ImagePpmBinLoader(param);
             case SimdImageFilePng: return new ImagePngLoader(param);
             case SimdImageFileJpeg: return new ImageJpegLoader(param);
+            case SimdImageFileQoi: return new ImageQoiLoader(param);
             default:
                 return NULL;
             }
@@ -64,7 +64,7 @@ namespace Simd
             return (hi << 16) | lo;
         }
 
-        void ZlibCompress(uint8_t* data, int size, int quality, OutputMemoryStream& stream)
+        void ZlibCompress(uint8_t* data, int size, int quality, OutputMemoryStream& stream, Base::ImagePngSaver* saver)
         {
             const int ZHASH = 16384;
             if (quality < 5)
@@ -81,6 +81,8 @@ namespace Simd
             int i = 0, j;
             while (i < size - 3)
             {
+                if (saver)
+                    saver->Drain(stream);
                 int h = Base::ZlibHash(data + i) & (ZHASH - 1), best = 3;
                 uint8_t* bestLoc = 0;
                 int* hList = hashTable.data + h * basket;
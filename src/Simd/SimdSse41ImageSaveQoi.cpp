@@ -0,0 +1,138 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdImageSave.h"
+#include "Simd/SimdImageQoi.h"
+#include "Simd/SimdSse41.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        const __m128i K8_QOI_HASH = SIMD_MM_SETR_EPI8(3, 5, 7, 11, 3, 5, 7, 11, 3, 5, 7, 11, 3, 5, 7, 11);
+        const __m128i K16_QOI_MASK = SIMD_MM_SET1_EPI16(63);
+
+        SIMD_INLINE __m128i QoiHash4(const uint8_t* rgba)
+        {
+            return _mm_madd_epi16(_mm_maddubs_epi16(_mm_loadu_si128((__m128i*)rgba), K8_QOI_HASH), K16_0001);
+        }
+
+        void QoiHashRow(const uint8_t* rgba, size_t size, uint8_t* hash)
+        {
+            size_t size16 = AlignLo(size, 16), i = 0;
+            for (; i < size16; i += 16, rgba += 64)
+            {
+                __m128i lo = _mm_and_si128(_mm_packs_epi32(QoiHash4(rgba + 0 * A), QoiHash4(rgba + 1 * A)), K16_QOI_MASK);
+                __m128i hi = _mm_and_si128(_mm_packs_epi32(QoiHash4(rgba + 2 * A), QoiHash4(rgba + 3 * A)), K16_QOI_MASK);
+                _mm_storeu_si128((__m128i*)(hash + i), _mm_packus_epi16(lo, hi));
+            }
+            for (; i < size; ++i, rgba += 4)
+                hash[i] = Base::QoiHash(rgba);
+        }
+
+        size_t QoiRunLength(const uint32_t* rgba, size_t size, uint32_t value)
+        {
+            size_t size4 = AlignLo(size, 4), i = 0;
+            __m128i _value = _mm_set1_epi32(value);
+            for (; i < size4; i += 4)
+            {
+                int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128((__m128i*)(rgba + i)), _value)));
+                if (mask != 0xF)
+                {
+                    for (; mask & 1; mask >>= 1, i++);
+                    return i;
+                }
+            }
+            for (; i < size && rgba[i] == value; ++i);
+            return i;
+        }
+
+        SIMD_INLINE __m128i QoiSignedByte(__m128i value, int shift)
+        {
+            return _mm_srai_epi32(_mm_slli_epi32(value, shift), 24);
+        }
+
+        SIMD_INLINE __m128i QoiInRange(__m128i value, int lo, int hi)
+        {
+            return _mm_andnot_si128(_mm_cmpgt_epi32(value, _mm_set1_epi32(hi)), _mm_cmpgt_epi32(value, _mm_set1_epi32(lo - 1)));
+        }
+
+        SIMD_INLINE __m128i QoiDiff4(const uint32_t* rgba)
+        {
+            __m128i cur = _mm_loadu_si128((__m128i*)rgba);
+            __m128i prv = _mm_loadu_si128((__m128i*)(rgba - 1));
+            __m128i d = _mm_sub_epi8(cur, prv);
+            __m128i vr = QoiSignedByte(d, 24);
+            __m128i vg = QoiSignedByte(d, 16);
+            __m128i vb = QoiSignedByte(d, 8);
+            __m128i vgr = QoiSignedByte(_mm_sub_epi32(vr, vg), 24);
+            __m128i vgb = QoiSignedByte(_mm_sub_epi32(vb, vg), 24);
+            __m128i isDiff = _mm_and_si128(_mm_and_si128(QoiInRange(vr, -2, 1), QoiInRange(vg, -2, 1)), QoiInRange(vb, -2, 1));
+            __m128i isLuma = _mm_and_si128(_mm_and_si128(QoiInRange(vgr, -8, 7), QoiInRange(vg, -32, 31)), QoiInRange(vgb, -8, 7));
+            __m128i diff = _mm_or_si128(_mm_set1_epi32(QOI_OP_DIFF), _mm_or_si128(_mm_slli_epi32(_mm_add_epi32(vr, _mm_set1_epi32(2)), 4),
+                _mm_or_si128(_mm_slli_epi32(_mm_add_epi32(vg, _mm_set1_epi32(2)), 2), _mm_add_epi32(vb, _mm_set1_epi32(2)))));
+            __m128i luma = _mm_or_si128(_mm_or_si128(_mm_set1_epi32(QOI_OP_LUMA), _mm_add_epi32(vg, _mm_set1_epi32(32))), _mm_slli_epi32(
+                _mm_or_si128(_mm_slli_epi32(_mm_add_epi32(vgr, _mm_set1_epi32(8)), 4), _mm_add_epi32(vgb, _mm_set1_epi32(8))), 8));
+            __m128i code = _mm_blendv_epi8(_mm_blendv_epi8(_mm_set1_epi32(QOI_OP_RGB), luma, isLuma), diff, isDiff);
+            __m128i sameAlpha = _mm_cmpeq_epi32(_mm_srli_epi32(d, 24), _mm_setzero_si128());
+            code = _mm_blendv_epi8(_mm_set1_epi32(QOI_OP_RGBA), code, sameAlpha);
+            return _mm_andnot_si128(_mm_cmpeq_epi32(cur, prv), code);
+        }
+
+        void QoiDiffRow(const uint32_t* rgba, size_t size, uint32_t prev, uint16_t* diff)
+        {
+            if (size == 0)
+                return;
+            diff[0] = Base::QoiDiff(rgba[0], prev);
+            size_t size8 = AlignLo(size - 1, 8) + 1, i = 1;
+            for (; i < size8; i += 8)
+                _mm_storeu_si128((__m128i*)(diff + i), _mm_packus_epi32(QoiDiff4(rgba + i + 0), QoiDiff4(rgba + i + 4)));
+            for (; i < size; ++i)
+                diff[i] = Base::QoiDiff(rgba[i], rgba[i - 1]);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ImageQoiSaver::ImageQoiSaver(const ImageSaverParam& param)
+            : Base::ImageQoiSaver(param)
+        {
+            if (_param.width >= A)
+            {
+                switch (_param.format)
+                {
+                case SimdPixelFormatGray8: _toRgbaAlpha = Sse41::GrayToBgra; break;
+                case SimdPixelFormatBgr24: _toRgbaAlpha = Sse41::RgbToBgra; break;
+                case SimdPixelFormatBgra32: _toRgba = Sse41::BgraToRgba; break;
+                case SimdPixelFormatRgb24: _toRgbaAlpha = Sse41::BgrToBgra; break;
+                default: break;
+                }
+            }
+            _hashRow = Sse41::QoiHashRow;
+            _runLength = Sse41::QoiRunLength;
+            _diffRow = Sse41::QoiDiffRow;
+        }
+    }
+#endif// SIMD_SSE41_ENABLE
+}
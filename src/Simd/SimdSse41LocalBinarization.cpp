@@ -0,0 +1,92 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdLocalBinarization.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        SIMD_INLINE __m128i LocalBinarization4(const uint32_t* sum, const uint32_t* sqsum, size_t step, const __m128* alg, const uint8_t* src)
+        {
+            __m128i s = _mm_sub_epi32(_mm_loadu_si128((__m128i*)(sum + step)), _mm_loadu_si128((__m128i*)sum));
+            __m128i q = _mm_sub_epi32(_mm_loadu_si128((__m128i*)(sqsum + step)), _mm_loadu_si128((__m128i*)sqsum));
+            __m128 mean = _mm_mul_ps(_mm_cvtepi32_ps(s), alg[0]);
+            __m128 var = _mm_max_ps(_mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(q), alg[0]), _mm_mul_ps(mean, mean)), _mm_setzero_ps());
+            __m128 dev = _mm_sqrt_ps(var);
+            __m128 threshold = _mm_add_ps(_mm_mul_ps(mean, _mm_add_ps(alg[1], _mm_mul_ps(alg[2], dev))), _mm_mul_ps(alg[3], dev));
+            __m128 value = _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(int32_t*)src)));
+            return _mm_castps_si128(_mm_cmpgt_ps(value, threshold));
+        }
+
+        SIMD_INLINE void LocalBinarization16(const uint32_t* sum, const uint32_t* sqsum, size_t step, const __m128* alg,
+            const uint8_t* src, __m128i positive, __m128i negative, uint8_t* dst)
+        {
+            __m128i m0 = LocalBinarization4(sum + 0 * F, sqsum + 0 * F, step, alg, src + 0 * F);
+            __m128i m1 = LocalBinarization4(sum + 1 * F, sqsum + 1 * F, step, alg, src + 1 * F);
+            __m128i m2 = LocalBinarization4(sum + 2 * F, sqsum + 2 * F, step, alg, src + 2 * F);
+            __m128i m3 = LocalBinarization4(sum + 3 * F, sqsum + 3 * F, step, alg, src + 3 * F);
+            __m128i mask = _mm_packs_epi16(_mm_packs_epi32(m0, m1), _mm_packs_epi32(m2, m3));
+            _mm_storeu_si128((__m128i*)dst, _mm_blendv_epi8(negative, positive, mask));
+        }
+
+        static void LocalBinarizationRow(const uint32_t* sum, const uint32_t* sqsum, size_t width, const Base::LocalBinarizationAlg& alg,
+            const uint8_t* src, uint8_t positive, uint8_t negative, uint8_t* dst)
+        {
+            __m128 _alg[4] = { _mm_set1_ps(alg.norm), _mm_set1_ps(alg.alpha), _mm_set1_ps(alg.beta), _mm_set1_ps(alg.gamma) };
+            __m128i _positive = _mm_set1_epi8(positive), _negative = _mm_set1_epi8(negative);
+            size_t widthA = AlignLo(width, A);
+            for (size_t i = 0; i < widthA; i += A)
+                LocalBinarization16(sum + i, sqsum + i, alg.step, _alg, src + i, _positive, _negative, dst + i);
+            if (widthA < width)
+            {
+                size_t i = width - A;
+                LocalBinarization16(sum + i, sqsum + i, alg.step, _alg, src + i, _positive, _negative, dst + i);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        LocalBinarizationDefault::LocalBinarizationDefault(const LocalBinarizationParam& param)
+            : Base::LocalBinarizationDefault(param)
+        {
+            _colUpdate = BoxFilterColUpdate8u;
+            if (_param.width >= A)
+                _row = LocalBinarizationRow;
+        }
+
+        //---------------------------------------------------------------------
+
+        void* LocalBinarizationInit(size_t width, size_t height, SimdLocalBinarizationType type, size_t radius, float k, float r)
+        {
+            LocalBinarizationParam param(width, height, type, radius, k, r, A);
+            if (!param.Valid())
+                return NULL;
+            return new LocalBinarizationDefault(param);
+        }
+    }
+#endif
+}
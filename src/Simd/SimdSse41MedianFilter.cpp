@@ -25,6 +25,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdLoadBlock.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdMedianFilter.h"
 
 namespace Simd
 {
@@ -654,6 +655,32 @@ namespace Simd
             else
                 MedianFilterSquare5x5<false>(src, srcStride, width, height, channelCount, dst, dstStride);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        struct MedianHist16
+        {
+            static SIMD_INLINE void Add(uint16_t* dst, const uint16_t* src)
+            {
+                for (size_t i = 0; i < 16; i += HA)
+                    _mm_storeu_si128((__m128i*)(dst + i), _mm_add_epi16(_mm_loadu_si128((__m128i*)(dst + i)), _mm_loadu_si128((__m128i*)(src + i))));
+            }
+
+            static SIMD_INLINE void Update(uint16_t* dst, const uint16_t* add, const uint16_t* sub)
+            {
+                for (size_t i = 0; i < 16; i += HA)
+                {
+                    __m128i _dst = _mm_add_epi16(_mm_loadu_si128((__m128i*)(dst + i)), _mm_loadu_si128((__m128i*)(add + i)));
+                    _mm_storeu_si128((__m128i*)(dst + i), _mm_sub_epi16(_dst, _mm_loadu_si128((__m128i*)(sub + i))));
+                }
+            }
+        };
+
+        void MedianFilterSquare(const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radius, uint8_t* dst, size_t dstStride)
+        {
+            Base::MedianFilterSquare<MedianHist16>(src, srcStride, width, height, channelCount, radius, dst, dstStride);
+        }
     }
 #endif
 }
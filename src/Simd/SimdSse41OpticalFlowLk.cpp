@@ -0,0 +1,168 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdOpticalFlowLk.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdSse41.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        SIMD_INLINE __m128i OpticalFlowLkSample(__m128i s00, __m128i s01, __m128i s10, __m128i s11, const __m128i* weight, __m128i round, int shift)
+        {
+            __m128i lo = _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(s00, s01), weight[0]), _mm_madd_epi16(_mm_unpacklo_epi16(s10, s11), weight[1]));
+            __m128i hi = _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(s00, s01), weight[0]), _mm_madd_epi16(_mm_unpackhi_epi16(s10, s11), weight[1]));
+            return _mm_packs_epi32(_mm_srai_epi32(_mm_add_epi32(lo, round), shift), _mm_srai_epi32(_mm_add_epi32(hi, round), shift));
+        }
+
+        SIMD_INLINE __m128i OpticalFlowLkSample(const uint8_t* s0, const uint8_t* s1, const __m128i* weight)
+        {
+            return OpticalFlowLkSample(
+                _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i*)s0)), _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i*)(s0 + 1))),
+                _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i*)s1)), _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i*)(s1 + 1))),
+                weight, _mm_set1_epi32(Base::LK_I_ROUND), Base::LK_I_SHIFT);
+        }
+
+        SIMD_INLINE __m128i OpticalFlowLkSample(const int16_t* s0, const int16_t* s1, const __m128i* weight)
+        {
+            return OpticalFlowLkSample(
+                _mm_loadu_si128((__m128i*)s0), _mm_loadu_si128((__m128i*)(s0 + 1)),
+                _mm_loadu_si128((__m128i*)s1), _mm_loadu_si128((__m128i*)(s1 + 1)),
+                weight, _mm_set1_epi32(Base::LK_W_ROUND), Base::LK_W_BITS);
+        }
+
+        SIMD_INLINE void OpticalFlowLkSetWeight(const int32_t* src, __m128i* dst)
+        {
+            dst[0] = _mm_set1_epi32(src[0] | (src[1] << 16));
+            dst[1] = _mm_set1_epi32(src[2] | (src[3] << 16));
+        }
+
+        SIMD_INLINE __m128i OpticalFlowLkWiden(__m128i sum)
+        {
+            return _mm_add_epi64(_mm_cvtepi32_epi64(sum), _mm_cvtepi32_epi64(_mm_srli_si128(sum, 8)));
+        }
+
+        SIMD_INLINE int64_t OpticalFlowLkSum(__m128i sum)
+        {
+            return _mm_cvtsi128_si64(_mm_add_epi64(sum, _mm_srli_si128(sum, 8)));
+        }
+
+        static void OpticalFlowLkTemplate(const uint8_t* img, size_t imgStride, const int16_t* dx, const int16_t* dy, size_t dStride,
+            const int32_t* weight, size_t window, int16_t* I, int16_t* Ix, int16_t* Iy, size_t patchStride, int64_t* G)
+        {
+            size_t windowHA = AlignHi(window, HA);
+            __m128i _weight[2];
+            OpticalFlowLkSetWeight(weight, _weight);
+            __m128i gxx = _mm_setzero_si128(), gxy = _mm_setzero_si128(), gyy = _mm_setzero_si128();
+            for (size_t y = 0; y < window; ++y)
+            {
+                for (size_t x = 0; x < windowHA; x += HA)
+                {
+                    _mm_storeu_si128((__m128i*)(I + x), OpticalFlowLkSample(img + x, img + imgStride + x, _weight));
+                    _mm_storeu_si128((__m128i*)(Ix + x), OpticalFlowLkSample(dx + x, dx + dStride + x, _weight));
+                    _mm_storeu_si128((__m128i*)(Iy + x), OpticalFlowLkSample(dy + x, dy + dStride + x, _weight));
+                }
+                for (size_t x = window; x < windowHA; ++x)
+                    Ix[x] = 0, Iy[x] = 0;
+                __m128i sxx = _mm_setzero_si128(), sxy = _mm_setzero_si128(), syy = _mm_setzero_si128();
+                for (size_t x = 0; x < windowHA; x += HA)
+                {
+                    __m128i _Ix = _mm_loadu_si128((__m128i*)(Ix + x));
+                    __m128i _Iy = _mm_loadu_si128((__m128i*)(Iy + x));
+                    sxx = _mm_add_epi32(sxx, _mm_madd_epi16(_Ix, _Ix));
+                    sxy = _mm_add_epi32(sxy, _mm_madd_epi16(_Ix, _Iy));
+                    syy = _mm_add_epi32(syy, _mm_madd_epi16(_Iy, _Iy));
+                }
+                gxx = _mm_add_epi64(gxx, OpticalFlowLkWiden(sxx));
+                gxy = _mm_add_epi64(gxy, OpticalFlowLkWiden(sxy));
+                gyy = _mm_add_epi64(gyy, OpticalFlowLkWiden(syy));
+                img += imgStride, dx += dStride, dy += dStride;
+                I += patchStride, Ix += patchStride, Iy += patchStride;
+            }
+            G[0] = OpticalFlowLkSum(gxx);
+            G[1] = OpticalFlowLkSum(gxy);
+            G[2] = OpticalFlowLkSum(gyy);
+        }
+
+        static void OpticalFlowLkResidual(const uint8_t* img, size_t imgStride, const int32_t* weight, size_t window,
+            const int16_t* I, const int16_t* Ix, const int16_t* Iy, size_t patchStride, int64_t* b)
+        {
+            size_t windowHA = AlignHi(window, HA);
+            __m128i _weight[2];
+            OpticalFlowLkSetWeight(weight, _weight);
+            __m128i bx = _mm_setzero_si128(), by = _mm_setzero_si128();
+            for (size_t y = 0; y < window; ++y)
+            {
+                __m128i sx = _mm_setzero_si128(), sy = _mm_setzero_si128();
+                for (size_t x = 0; x < windowHA; x += HA)
+                {
+                    __m128i diff = _mm_sub_epi16(OpticalFlowLkSample(img + x, img + imgStride + x, _weight), _mm_loadu_si128((__m128i*)(I + x)));
+                    sx = _mm_add_epi32(sx, _mm_madd_epi16(diff, _mm_loadu_si128((__m128i*)(Ix + x))));
+                    sy = _mm_add_epi32(sy, _mm_madd_epi16(diff, _mm_loadu_si128((__m128i*)(Iy + x))));
+                }
+                bx = _mm_add_epi64(bx, OpticalFlowLkWiden(sx));
+                by = _mm_add_epi64(by, OpticalFlowLkWiden(sy));
+                img += imgStride;
+                I += patchStride, Ix += patchStride, Iy += patchStride;
+            }
+            b[0] = OpticalFlowLkSum(bx);
+            b[1] = OpticalFlowLkSum(by);
+        }
+
+        static void OpticalFlowLkReduce(const uint8_t* src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t* dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
+        {
+            if (srcWidth >= A)
+                ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, 1);
+            else
+                Base::ReduceGray5x5(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, 1);
+        }
+
+        //---------------------------------------------------------------------
+
+        OpticalFlowLkDefault::OpticalFlowLkDefault(const OpticalFlowLkParam& param)
+            : Base::OpticalFlowLkDefault(param)
+        {
+            _reduce = OpticalFlowLkReduce;
+            _sobelDx = SobelDx;
+            _sobelDy = SobelDy;
+            _template = OpticalFlowLkTemplate;
+            _residual = OpticalFlowLkResidual;
+        }
+
+        //---------------------------------------------------------------------
+
+        void* OpticalFlowLkInit(size_t width, size_t height, size_t levels, size_t radius, size_t iterations, float epsilon, float minEigenvalue)
+        {
+            OpticalFlowLkParam param(width, height, levels, radius, iterations, epsilon, minEigenvalue, A);
+            if (!param.Valid())
+                return NULL;
+            return new OpticalFlowLkDefault(param);
+        }
+    }
+#endif
+}
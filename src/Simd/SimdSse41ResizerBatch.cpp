@@ -0,0 +1,80 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE
+    namespace Sse41
+    {
+        ResizerBatch::ResizerBatch(const ResParam& param, SimdTensorFormatType format)
+            : Base::ResizerBatch(param, format)
+        {
+        }
+
+        SIMD_INLINE __m128i ResizerBatchRowY(const int32_t* src0, const int32_t* src1, __m128i fy)
+        {
+            __m128i s0 = _mm_loadu_si128((__m128i*)src0);
+            __m128i s1 = _mm_loadu_si128((__m128i*)src1);
+            __m128i sum = _mm_add_epi32(_mm_slli_epi32(s0, Base::LINEAR_SHIFT), _mm_mullo_epi32(_mm_sub_epi32(s1, s0), fy));
+            return _mm_srai_epi32(_mm_add_epi32(sum, _mm_set1_epi32(Base::BILINEAR_ROUND_TERM)), Base::BILINEAR_SHIFT);
+        }
+
+        void ResizerBatch::ByteRowY(const int32_t* src0, const int32_t* src1, size_t size, int32_t fy, uint8_t* dst)
+        {
+            size_t sizeA = AlignLo(size, A), i = 0;
+            __m128i _fy = _mm_set1_epi32(fy);
+            for (; i < sizeA; i += A)
+            {
+                __m128i lo = _mm_packs_epi32(ResizerBatchRowY(src0 + i + 0, src1 + i + 0, _fy), ResizerBatchRowY(src0 + i + 4, src1 + i + 4, _fy));
+                __m128i hi = _mm_packs_epi32(ResizerBatchRowY(src0 + i + 8, src1 + i + 8, _fy), ResizerBatchRowY(src0 + i + 12, src1 + i + 12, _fy));
+                _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(lo, hi));
+            }
+            if (i < size)
+                Base::ResizerBatch::ByteRowY(src0 + i, src1 + i, size - i, fy, dst + i);
+        }
+
+        void ResizerBatch::FloatRowY(const float* src0, const float* src1, size_t size, float fy, float* dst)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __m128 fy1 = _mm_set1_ps(fy), fy0 = _mm_set1_ps(1.0f - fy);
+            for (; i < sizeF; i += F)
+                _mm_storeu_ps(dst + i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src0 + i), fy0), _mm_mul_ps(_mm_loadu_ps(src1 + i), fy1)));
+            if (i < size)
+                Base::ResizerBatch::FloatRowY(src0 + i, src1 + i, size - i, fy, dst + i);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ResizerBatchInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method, SimdTensorFormatType format)
+        {
+            if (!Base::ResizerBatchValid(srcX, srcY, dstX, dstY, channels, type, method, format))
+                return NULL;
+            ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(__m128i));
+            return new ResizerBatch(param, format);
+        }
+    }
+#endif
+}
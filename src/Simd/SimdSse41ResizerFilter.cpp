@@ -0,0 +1,313 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE
+    namespace Sse41
+    {
+        ResizerByteFilter::ResizerByteFilter(const ResParam& param)
+            : Base::ResizerByteFilter(param)
+        {
+            static const size_t aligns[5] = { 1, 8, 4, 2, 2 };
+            _alignX = _param.channels <= 4 ? aligns[_param.channels] : 1;
+        }
+
+        template<int N> __m128i ByteFilterX(const uint8_t* src, const int16_t* ax, size_t taps);
+
+        template<> SIMD_INLINE __m128i ByteFilterX<1>(const uint8_t* src, const int16_t* ax, size_t taps)
+        {
+            __m128i sum = _mm_setzero_si128();
+            for (size_t k = 0; k < taps; k += 8)
+            {
+                __m128i s = _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i*)(src + k)));
+                sum = _mm_add_epi32(sum, _mm_madd_epi16(s, _mm_loadu_si128((__m128i*)(ax + k))));
+            }
+            return _mm_hadd_epi32(_mm_hadd_epi32(sum, sum), sum);
+        }
+
+        template<> SIMD_INLINE __m128i ByteFilterX<2>(const uint8_t* src, const int16_t* ax, size_t taps)
+        {
+            static const __m128i SHUFFLE = SIMD_MM_SETR_EPI8(0x0, -1, 0x2, -1, 0x4, -1, 0x6, -1, 0x1, -1, 0x3, -1, 0x5, -1, 0x7, -1);
+            __m128i sum = _mm_setzero_si128();
+            for (size_t k = 0; k < taps; k += 4)
+            {
+                __m128i s = _mm_shuffle_epi8(_mm_loadl_epi64((__m128i*)(src + k * 2)), SHUFFLE);
+                __m128i a = _mm_loadl_epi64((__m128i*)(ax + k));
+                sum = _mm_add_epi32(sum, _mm_madd_epi16(s, _mm_unpacklo_epi64(a, a)));
+            }
+            return _mm_hadd_epi32(sum, sum);
+        }
+
+        template<> SIMD_INLINE __m128i ByteFilterX<3>(const uint8_t* src, const int16_t* ax, size_t taps)
+        {
+            static const __m128i SHUFFLE = SIMD_MM_SETR_EPI8(0x0, -1, 0x3, -1, 0x1, -1, 0x4, -1, 0x2, -1, 0x5, -1, -1, -1, -1, -1);
+            __m128i sum = _mm_setzero_si128();
+            for (size_t k = 0; k < taps; k += 2)
+            {
+                __m128i s = _mm_shuffle_epi8(_mm_loadl_epi64((__m128i*)(src + k * 3)), SHUFFLE);
+                sum = _mm_add_epi32(sum, _mm_madd_epi16(s, _mm_set1_epi32(*(int32_t*)(ax + k))));
+            }
+            return sum;
+        }
+
+        template<> SIMD_INLINE __m128i ByteFilterX<4>(const uint8_t* src, const int16_t* ax, size_t taps)
+        {
+            static const __m128i SHUFFLE = SIMD_MM_SETR_EPI8(0x0, -1, 0x4, -1, 0x1, -1, 0x5, -1, 0x2, -1, 0x6, -1, 0x3, -1, 0x7, -1);
+            __m128i sum = _mm_setzero_si128();
+            for (size_t k = 0; k < taps; k += 2)
+            {
+                __m128i s = _mm_shuffle_epi8(_mm_loadl_epi64((__m128i*)(src + k * 4)), SHUFFLE);
+                sum = _mm_add_epi32(sum, _mm_madd_epi16(s, _mm_set1_epi32(*(int32_t*)(ax + k))));
+            }
+            return sum;
+        }
+
+        template<int N> void ByteFilterRowX(const uint8_t* src, size_t width, size_t taps, const int32_t* ix, const int16_t* ax, int16_t* dst)
+        {
+            static const __m128i ROUND = SIMD_MM_SET1_EPI32(Base::FILTER_X_ROUND);
+            int16_t val[4];
+            for (size_t dx = 0; dx < width; dx++, ax += taps, dst += N)
+            {
+                __m128i sum = _mm_srai_epi32(_mm_add_epi32(ByteFilterX<N>(src + ix[dx], ax, taps), ROUND), Base::FILTER_X_SHIFT);
+                _mm_storel_epi64((__m128i*)val, _mm_packs_epi32(sum, K_ZERO));
+                for (size_t c = 0; c < N; ++c)
+                    dst[c] = val[c];
+            }
+        }
+
+        void ResizerByteFilter::RunX(const uint8_t* src, int16_t* dst)
+        {
+            switch (_param.channels)
+            {
+            case 1: ByteFilterRowX<1>(src, _param.dstW, _tx, _ix.data, _ax.data, dst); return;
+            case 2: ByteFilterRowX<2>(src, _param.dstW, _tx, _ix.data, _ax.data, dst); return;
+            case 3: ByteFilterRowX<3>(src, _param.dstW, _tx, _ix.data, _ax.data, dst); return;
+            case 4: ByteFilterRowX<4>(src, _param.dstW, _tx, _ix.data, _ax.data, dst); return;
+            default:
+                Base::ResizerByteFilter::RunX(src, dst);
+            }
+        }
+
+        SIMD_INLINE void ByteFilterY(const int16_t* src0, const int16_t* src1, __m128i alpha, __m128i* sums)
+        {
+            __m128i s00 = _mm_loadu_si128((__m128i*)src0 + 0);
+            __m128i s01 = _mm_loadu_si128((__m128i*)src0 + 1);
+            __m128i s10 = _mm_loadu_si128((__m128i*)src1 + 0);
+            __m128i s11 = _mm_loadu_si128((__m128i*)src1 + 1);
+            sums[0] = _mm_add_epi32(sums[0], _mm_madd_epi16(_mm_unpacklo_epi16(s00, s10), alpha));
+            sums[1] = _mm_add_epi32(sums[1], _mm_madd_epi16(_mm_unpackhi_epi16(s00, s10), alpha));
+            sums[2] = _mm_add_epi32(sums[2], _mm_madd_epi16(_mm_unpacklo_epi16(s01, s11), alpha));
+            sums[3] = _mm_add_epi32(sums[3], _mm_madd_epi16(_mm_unpackhi_epi16(s01, s11), alpha));
+        }
+
+        SIMD_INLINE void ByteFilterY(const int16_t* const* src, size_t n, const int16_t* ay, size_t i, uint8_t* dst)
+        {
+            static const __m128i ROUND = SIMD_MM_SET1_EPI32(Base::FILTER_Y_ROUND);
+            __m128i sums[4] = { _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128() };
+            size_t k = 0;
+            for (; k + 1 < n; k += 2)
+                ByteFilterY(src[k] + i, src[k + 1] + i, _mm_set1_epi32(uint16_t(ay[k]) | (int32_t(ay[k + 1]) << 16)), sums);
+            if (k < n)
+                ByteFilterY(src[k] + i, src[k] + i, _mm_set1_epi32(uint16_t(ay[k])), sums);
+            for (size_t j = 0; j < 4; ++j)
+                sums[j] = _mm_srai_epi32(_mm_add_epi32(sums[j], ROUND), Base::FILTER_Y_SHIFT);
+            _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(_mm_packs_epi32(sums[0], sums[1]), _mm_packs_epi32(sums[2], sums[3])));
+        }
+
+        void ResizerByteFilter::RunY(const int16_t* const* src, size_t n, const int16_t* ay, uint8_t* dst)
+        {
+            size_t size = _param.dstW * _param.channels, sizeA = AlignLo(size, A);
+            if (sizeA == 0)
+            {
+                Base::ResizerByteFilter::RunY(src, n, ay, dst);
+                return;
+            }
+            for (size_t i = 0; i < sizeA; i += A)
+                ByteFilterY(src, n, ay, i, dst);
+            if (sizeA < size)
+                ByteFilterY(src, n, ay, size - A, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ResizerFloatFilter::ResizerFloatFilter(const ResParam& param)
+            : Base::ResizerFloatFilter(param)
+        {
+            static const size_t aligns[5] = { 1, 4, 2, 1, 1 };
+            _alignX = _param.channels <= 4 ? aligns[_param.channels] : 1;
+        }
+
+        void ResizerFloatFilter::LoadRow(const uint8_t* src, float* dst)
+        {
+            size_t size = _param.srcW * _param.channels;
+            if (_param.type == SimdResizeChannelShort)
+            {
+                const uint16_t* s = (const uint16_t*)src;
+                size_t sizeF = AlignLo(size, F), i = 0;
+                for (; i < sizeF; i += F)
+                    _mm_storeu_ps(dst + i, _mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_loadl_epi64((__m128i*)(s + i)))));
+                for (; i < size; ++i)
+                    dst[i] = (float)s[i];
+            }
+            else
+                memcpy(dst, src, size * sizeof(float));
+        }
+
+        template<int N> void FloatFilterRowX(const float* src, size_t width, size_t taps, const int32_t* ix, const float* ax, float* dst);
+
+        SIMD_INLINE __m128 FloatFilterX1x4(const float* src, size_t taps, const int32_t* ix, const float* ax)
+        {
+            const float* s0 = src + ix[0], * s1 = src + ix[1], * s2 = src + ix[2], * s3 = src + ix[3];
+            const float* a0 = ax, * a1 = a0 + taps, * a2 = a1 + taps, * a3 = a2 + taps;
+            __m128 sum = _mm_setzero_ps();
+            for (size_t k = 0; k < taps; k += 4)
+            {
+                __m128 p0 = _mm_mul_ps(_mm_loadu_ps(s0 + k), _mm_loadu_ps(a0 + k));
+                __m128 p1 = _mm_mul_ps(_mm_loadu_ps(s1 + k), _mm_loadu_ps(a1 + k));
+                __m128 p2 = _mm_mul_ps(_mm_loadu_ps(s2 + k), _mm_loadu_ps(a2 + k));
+                __m128 p3 = _mm_mul_ps(_mm_loadu_ps(s3 + k), _mm_loadu_ps(a3 + k));
+                __m128 t0 = _mm_unpacklo_ps(p0, p1), t1 = _mm_unpacklo_ps(p2, p3);
+                __m128 t2 = _mm_unpackhi_ps(p0, p1), t3 = _mm_unpackhi_ps(p2, p3);
+                sum = _mm_add_ps(sum, _mm_movelh_ps(t0, t1));
+                sum = _mm_add_ps(sum, _mm_movehl_ps(t1, t0));
+                sum = _mm_add_ps(sum, _mm_movelh_ps(t2, t3));
+                sum = _mm_add_ps(sum, _mm_movehl_ps(t3, t2));
+            }
+            return sum;
+        }
+
+        template<> void FloatFilterRowX<1>(const float* src, size_t width, size_t taps, const int32_t* ix, const float* ax, float* dst)
+        {
+            size_t width4 = AlignLo(width, 4), dx = 0;
+            for (; dx < width4; dx += 4)
+                _mm_storeu_ps(dst + dx, FloatFilterX1x4(src, taps, ix + dx, ax + dx * taps));
+            for (; dx < width; dx++)
+            {
+                const float* s = src + ix[dx];
+                const float* a = ax + dx * taps;
+                float sum = 0.0f;
+                for (size_t k = 0; k < taps; ++k)
+                    sum += s[k] * a[k];
+                dst[dx] = sum;
+            }
+        }
+
+        template<> void FloatFilterRowX<2>(const float* src, size_t width, size_t taps, const int32_t* ix, const float* ax, float* dst)
+        {
+            for (size_t dx = 0; dx < width; dx++, ax += taps, dst += 2)
+            {
+                const float* s = src + ix[dx];
+                __m128 sum = _mm_setzero_ps();
+                for (size_t k = 0; k < taps; k += 2)
+                {
+                    __m128 a = _mm_castsi128_ps(_mm_loadl_epi64((__m128i*)(ax + k)));
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(s + k * 2), _mm_unpacklo_ps(a, a)));
+                }
+                _mm_storel_pi((__m64*)dst, _mm_add_ps(sum, _mm_movehl_ps(sum, sum)));
+            }
+        }
+
+        template<> void FloatFilterRowX<3>(const float* src, size_t width, size_t taps, const int32_t* ix, const float* ax, float* dst)
+        {
+            for (size_t dx = 0; dx < width; dx++, ax += taps, dst += 3)
+            {
+                const float* s = src + ix[dx];
+                __m128 sum = _mm_setzero_ps();
+                for (size_t k = 0; k < taps; k += 1)
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(s + k * 3), _mm_set1_ps(ax[k])));
+                _mm_storel_pi((__m64*)dst, sum);
+                _mm_store_ss(dst + 2, _mm_movehl_ps(sum, sum));
+            }
+        }
+
+        template<> void FloatFilterRowX<4>(const float* src, size_t width, size_t taps, const int32_t* ix, const float* ax, float* dst)
+        {
+            for (size_t dx = 0; dx < width; dx++, ax += taps, dst += 4)
+            {
+                const float* s = src + ix[dx];
+                __m128 sum = _mm_setzero_ps();
+                for (size_t k = 0; k < taps; k += 1)
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(s + k * 4), _mm_set1_ps(ax[k])));
+                _mm_storeu_ps(dst, sum);
+            }
+        }
+
+        void ResizerFloatFilter::RunX(const float* src, float* dst)
+        {
+            switch (_param.channels)
+            {
+            case 1: FloatFilterRowX<1>(src, _param.dstW, _tx, _ix.data, _ax.data, dst); return;
+            case 2: FloatFilterRowX<2>(src, _param.dstW, _tx, _ix.data, _ax.data, dst); return;
+            case 3: FloatFilterRowX<3>(src, _param.dstW, _tx, _ix.data, _ax.data, dst); return;
+            case 4: FloatFilterRowX<4>(src, _param.dstW, _tx, _ix.data, _ax.data, dst); return;
+            default:
+                Base::ResizerFloatFilter::RunX(src, dst);
+            }
+        }
+
+        SIMD_INLINE __m128 FloatFilterY(const float* const* src, size_t n, const float* ay, size_t i)
+        {
+            __m128 sum = _mm_setzero_ps();
+            for (size_t k = 0; k < n; ++k)
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src[k] + i), _mm_set1_ps(ay[k])));
+            return sum;
+        }
+
+        SIMD_INLINE void FloatFilterY(const float* const* src, size_t n, const float* ay, size_t i, uint16_t* dst)
+        {
+            __m128i val = _mm_cvtps_epi32(FloatFilterY(src, n, ay, i));
+            _mm_storel_epi64((__m128i*)(dst + i), _mm_packus_epi32(val, val));
+        }
+
+        SIMD_INLINE void FloatFilterY(const float* const* src, size_t n, const float* ay, size_t i, float* dst)
+        {
+            _mm_storeu_ps(dst + i, FloatFilterY(src, n, ay, i));
+        }
+
+        template<class T> void FloatFilterRowY(const float* const* src, size_t n, const float* ay, size_t size, T* dst)
+        {
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                FloatFilterY(src, n, ay, i, dst);
+            if (sizeF < size)
+                FloatFilterY(src, n, ay, size - F, dst);
+        }
+
+        void ResizerFloatFilter::RunY(const float* const* src, size_t n, const float* ay, uint8_t* dst)
+        {
+            size_t size = _param.dstW * _param.channels;
+            if (size < F)
+                Base::ResizerFloatFilter::RunY(src, n, ay, dst);
+            else if (_param.type == SimdResizeChannelShort)
+                FloatFilterRowY(src, n, ay, size, (uint16_t*)dst);
+            else
+                FloatFilterRowY(src, n, ay, size, (float*)dst);
+        }
+    }
+#endif
+}
@@ -91,9 +91,9 @@ namespace Simd
         void ResizerNearest::Shuffle16x1(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
         {
             size_t body = _blocks - _tails;
-            for (size_t dy = 0; dy < _param.dstH; dy++)
+            for (size_t dy = _dyBeg; dy < _dyEnd; dy++)
             {
-                const uint8_t* srcRow = src + _iy[dy] * srcStride;
+                const uint8_t* srcRow = src + (_iy[dy] - _syBeg) * srcStride;
                 size_t i = 0, t = 0;
                 for (; i < body; ++i)
                 {
@@ -122,9 +122,9 @@ namespace Simd
         void ResizerNearest::Resize12(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
         {
             size_t body = _param.dstW - 1;
-            for (size_t dy = 0; dy < _param.dstH; dy++)
+            for (size_t dy = _dyBeg; dy < _dyEnd; dy++)
             {
-                const uint8_t* srcRow = src + _iy[dy] * srcStride;
+                const uint8_t* srcRow = src + (_iy[dy] - _syBeg) * srcStride;
                 size_t dx = 0, offset = 0;
                 for (; dx < body; dx++, offset += 12)
                     CopyPixel12(srcRow + _ix[dx], dst + offset);
@@ -0,0 +1,83 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdBFloat16.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE
+    namespace Sse41
+    {
+        ResizerTensor::ResizerTensor(const ResParam& param, const ResTensorParam& tensor, const float* scale, const float* shift)
+            : Base::ResizerTensor(param, tensor, scale, shift)
+        {
+        }
+
+        SIMD_INLINE __m128 ResizerTensorRowY(const int32_t* src0, const int32_t* src1, __m128i fy, const float* scale, const float* shift)
+        {
+            __m128i s0 = _mm_loadu_si128((__m128i*)src0);
+            __m128i s1 = _mm_loadu_si128((__m128i*)src1);
+            __m128i sum = _mm_add_epi32(_mm_slli_epi32(s0, Base::LINEAR_SHIFT), _mm_mullo_epi32(_mm_sub_epi32(s1, s0), fy));
+            return _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(sum), _mm_loadu_ps(scale)), _mm_loadu_ps(shift));
+        }
+
+        void ResizerTensor::RowY32f(const int32_t* src0, const int32_t* src1, size_t size, int32_t fy, const float* scale, const float* shift, float* dst)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __m128i _fy = _mm_set1_epi32(fy);
+            for (; i < sizeF; i += F)
+                _mm_storeu_ps(dst + i, ResizerTensorRowY(src0 + i, src1 + i, _fy, scale + i, shift + i));
+            if (i < size)
+                Base::ResizerTensor::RowY32f(src0 + i, src1 + i, size - i, fy, scale + i, shift + i, dst + i);
+        }
+
+        void ResizerTensor::RowY16b(const int32_t* src0, const int32_t* src1, size_t size, int32_t fy, const float* scale, const float* shift, uint16_t* dst)
+        {
+            size_t sizeDF = AlignLo(size, DF), i = 0;
+            __m128i _fy = _mm_set1_epi32(fy);
+            for (; i < sizeDF; i += DF)
+            {
+                __m128i lo = Float32ToBFloat16(ResizerTensorRowY(src0 + i + 0, src1 + i + 0, _fy, scale + i + 0, shift + i + 0));
+                __m128i hi = Float32ToBFloat16(ResizerTensorRowY(src0 + i + F, src1 + i + F, _fy, scale + i + F, shift + i + F));
+                _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi32(lo, hi));
+            }
+            if (i < size)
+                Base::ResizerTensor::RowY16b(src0 + i, src1 + i, size - i, fy, scale + i, shift + i, dst + i);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ResizerTensorInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method,
+            SimdTensorFormatType format, SimdTensorDataType type, const float* scale, const float* shift, SimdBool letterbox, float fill)
+        {
+            if (!Base::ResizerTensorValid(srcX, srcY, dstX, dstY, channels, method, format, type))
+                return NULL;
+            ResTensorParam tensor(srcX, srcY, dstX, dstY, format, type, letterbox, fill);
+            ResParam param(srcX, srcY, tensor.imgW, tensor.imgH, channels, SimdResizeChannelByte, method, sizeof(__m128i));
+            return new ResizerTensor(param, tensor, scale, shift);
+        }
+    }
+#endif
+}
@@ -0,0 +1,122 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdSse41.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE
+    namespace Sse41
+    {
+        ResizerYuv420::ResizerYuv420(const ResParam& param, SimdPixelFormatType format, SimdYuvType yuvType)
+            : Base::ResizerYuv420(param, format, yuvType)
+        {
+            if (_param.dstW >= A)
+                _convert = format == SimdPixelFormatRgb24 ? Sse41::Yuv444pToRgbV2 : Sse41::Yuv444pToBgrV2;
+        }
+
+        template<size_t step> SIMD_INLINE __m128i LoadPairs(const uint8_t* src, const int32_t* ix)
+        {
+            return _mm_setr_epi16(
+                src[ix[0] * step] | src[ix[0] * step + step] << 8, src[ix[1] * step] | src[ix[1] * step + step] << 8,
+                src[ix[2] * step] | src[ix[2] * step + step] << 8, src[ix[3] * step] | src[ix[3] * step + step] << 8,
+                src[ix[4] * step] | src[ix[4] * step + step] << 8, src[ix[5] * step] | src[ix[5] * step + step] << 8,
+                src[ix[6] * step] | src[ix[6] * step + step] << 8, src[ix[7] * step] | src[ix[7] * step + step] << 8);
+        }
+
+        template<size_t step> SIMD_INLINE void ResizerYuv420RowX(const uint8_t* src, const int32_t* ix, const int32_t* ax, uint16_t* dst)
+        {
+            static const __m128i RANGE = SIMD_MM_SET1_EPI16(Base::FRACTION_RANGE);
+            __m128i a = _mm_packs_epi32(_mm_loadu_si128((__m128i*)ax + 0), _mm_loadu_si128((__m128i*)ax + 1));
+            __m128i alpha = _mm_or_si128(_mm_sub_epi16(RANGE, a), _mm_slli_epi16(a, 8));
+            _mm_storeu_si128((__m128i*)dst, _mm_maddubs_epi16(LoadPairs<step>(src, ix), alpha));
+        }
+
+        template<size_t step> void ResizerYuv420RowX(const uint8_t* src, size_t width, const int32_t* ix, const int32_t* ax, uint16_t* dst)
+        {
+            size_t widthHA = AlignLo(width, HA);
+            for (size_t dx = 0; dx < widthHA; dx += HA)
+                ResizerYuv420RowX<step>(src, ix + dx, ax + dx, dst + dx);
+            if (widthHA < width)
+            {
+                size_t dx = width - HA;
+                ResizerYuv420RowX<step>(src, ix + dx, ax + dx, dst + dx);
+            }
+        }
+
+        void ResizerYuv420::RunX(const uint8_t* src, size_t step, const Plane& plane, uint16_t* dst)
+        {
+            if (_param.dstW < HA)
+                Base::ResizerYuv420::RunX(src, step, plane, dst);
+            else if (step == 1)
+                ResizerYuv420RowX<1>(src, _param.dstW, plane.ix.data, plane.ax.data, dst);
+            else
+                ResizerYuv420RowX<2>(src, _param.dstW, plane.ix.data, plane.ax.data, dst);
+        }
+
+        SIMD_INLINE __m128i ResizerYuv420RowY(const uint16_t* src0, const uint16_t* src1, __m128i fy0, __m128i fy1)
+        {
+            __m128i s0 = _mm_mullo_epi16(_mm_loadu_si128((__m128i*)src0), fy0);
+            __m128i s1 = _mm_mullo_epi16(_mm_loadu_si128((__m128i*)src1), fy1);
+            return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(s0, s1), K16_0080), Base::BILINEAR_SHIFT);
+        }
+
+        SIMD_INLINE void ResizerYuv420RowY(const uint16_t* src0, const uint16_t* src1, __m128i fy0, __m128i fy1, uint8_t* dst)
+        {
+            __m128i lo = ResizerYuv420RowY(src0 + 0, src1 + 0, fy0, fy1);
+            __m128i hi = ResizerYuv420RowY(src0 + HA, src1 + HA, fy0, fy1);
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(lo, hi));
+        }
+
+        void ResizerYuv420::RunY(const uint16_t* src0, const uint16_t* src1, int32_t fy, uint8_t* dst)
+        {
+            size_t width = _param.dstW, widthA = AlignLo(width, A);
+            if (widthA == 0)
+            {
+                Base::ResizerYuv420::RunY(src0, src1, fy, dst);
+                return;
+            }
+            __m128i fy0 = _mm_set1_epi16(Base::FRACTION_RANGE - fy);
+            __m128i fy1 = _mm_set1_epi16(fy);
+            for (size_t dx = 0; dx < widthA; dx += A)
+                ResizerYuv420RowY(src0 + dx, src1 + dx, fy0, fy1, dst + dx);
+            if (widthA < width)
+            {
+                size_t dx = width - A;
+                ResizerYuv420RowY(src0 + dx, src1 + dx, fy0, fy1, dst + dx);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ResizerYuv420Init(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType format, SimdYuvType yuvType, SimdResizeMethodType method)
+        {
+            if (!Base::ResizerYuv420Valid(srcX, srcY, dstX, dstY, format, yuvType, method))
+                return NULL;
+            ResParam param(srcX, srcY, dstX, dstY, 3, SimdResizeChannelByte, method, sizeof(__m128i));
+            return new ResizerYuv420(param, format, yuvType);
+        }
+    }
+#endif
+}
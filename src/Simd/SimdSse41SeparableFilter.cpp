@@ -0,0 +1,203 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSeparableFilter.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        SIMD_INLINE __m128i SepFilterRowInt(const uint8_t* src, size_t channels, const int16_t* kernel, size_t kernelSize)
+        {
+            __m128i sum = _mm_setzero_si128();
+            for (size_t k = 0; k < kernelSize; ++k, src += channels)
+            {
+                __m128i val = _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i*)src));
+                sum = _mm_add_epi16(sum, _mm_mullo_epi16(val, _mm_set1_epi16(kernel[k])));
+            }
+            return sum;
+        }
+
+        static void SepFilterRowInt(const uint8_t* src, size_t size, size_t channels, const int16_t* kernel, size_t kernelSize, int16_t* dst)
+        {
+            size_t sizeHA = AlignLo(size, HA);
+            for (size_t i = 0; i < sizeHA; i += HA)
+                _mm_storeu_si128((__m128i*)(dst + i), SepFilterRowInt(src + i, channels, kernel, kernelSize));
+            if (sizeHA < size)
+            {
+                size_t i = size - HA;
+                _mm_storeu_si128((__m128i*)(dst + i), SepFilterRowInt(src + i, channels, kernel, kernelSize));
+            }
+        }
+
+        SIMD_INLINE __m128i SepFilterColInt(const int16_t* const* src, size_t offset, const int16_t* kernel, size_t kernelSize, __m128i round, int shift)
+        {
+            __m128i lo = _mm_setzero_si128(), hi = _mm_setzero_si128();
+            size_t k = 0;
+            for (; k + 1 < kernelSize; k += 2)
+            {
+                __m128i s0 = _mm_loadu_si128((__m128i*)(src[k + 0] + offset));
+                __m128i s1 = _mm_loadu_si128((__m128i*)(src[k + 1] + offset));
+                __m128i w = _mm_unpacklo_epi16(_mm_set1_epi16(kernel[k + 0]), _mm_set1_epi16(kernel[k + 1]));
+                lo = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(s0, s1), w));
+                hi = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(s0, s1), w));
+            }
+            if (k < kernelSize)
+            {
+                __m128i s0 = _mm_loadu_si128((__m128i*)(src[k] + offset));
+                __m128i w = _mm_unpacklo_epi16(_mm_set1_epi16(kernel[k]), K_ZERO);
+                lo = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(s0, K_ZERO), w));
+                hi = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(s0, K_ZERO), w));
+            }
+            lo = _mm_srai_epi32(_mm_add_epi32(lo, round), shift);
+            hi = _mm_srai_epi32(_mm_add_epi32(hi, round), shift);
+            return _mm_packs_epi32(lo, hi);
+        }
+
+        static void SepFilterColInt(const int16_t* const* src, size_t size, const int16_t* kernel, size_t kernelSize, int shift, uint8_t* dst)
+        {
+            __m128i round = _mm_set1_epi32(shift ? 1 << (shift - 1) : 0);
+            size_t sizeHA = AlignLo(size, HA), i = 0;
+            for (; i < sizeHA; i += HA)
+            {
+                __m128i sum = SepFilterColInt(src, i, kernel, kernelSize, round, shift);
+                _mm_storel_epi64((__m128i*)(dst + i), _mm_packus_epi16(sum, sum));
+            }
+            if (sizeHA < size)
+            {
+                i = size - HA;
+                __m128i sum = SepFilterColInt(src, i, kernel, kernelSize, round, shift);
+                _mm_storel_epi64((__m128i*)(dst + i), _mm_packus_epi16(sum, sum));
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        template<class T> SIMD_INLINE __m128 SepFilterLoad(const T* src);
+
+        template<> SIMD_INLINE __m128 SepFilterLoad(const uint8_t* src)
+        {
+            return _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(*(int32_t*)src)));
+        }
+
+        template<> SIMD_INLINE __m128 SepFilterLoad(const uint16_t* src)
+        {
+            return _mm_cvtepi32_ps(_mm_cvtepu16_epi32(_mm_loadl_epi64((__m128i*)src)));
+        }
+
+        template<class T> SIMD_INLINE __m128 SepFilterRowFloat(const T* src, size_t channels, const float* kernel, size_t kernelSize)
+        {
+            __m128 sum = _mm_setzero_ps();
+            for (size_t k = 0; k < kernelSize; ++k, src += channels)
+                sum = _mm_add_ps(sum, _mm_mul_ps(SepFilterLoad(src), _mm_set1_ps(kernel[k])));
+            return sum;
+        }
+
+        template<class T> void SepFilterRowFloat(const uint8_t* src, size_t size, size_t channels, const float* kernel, size_t kernelSize, float* dst)
+        {
+            const T* s = (const T*)src;
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                _mm_storeu_ps(dst + i, SepFilterRowFloat(s + i, channels, kernel, kernelSize));
+            if (sizeF < size)
+            {
+                size_t i = size - F;
+                _mm_storeu_ps(dst + i, SepFilterRowFloat(s + i, channels, kernel, kernelSize));
+            }
+        }
+
+        SIMD_INLINE __m128i SepFilterColFloat(const float* const* src, size_t offset, const float* kernel, size_t kernelSize)
+        {
+            __m128 sum = _mm_setzero_ps();
+            for (size_t k = 0; k < kernelSize; ++k)
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src[k] + offset), _mm_set1_ps(kernel[k])));
+            return _mm_cvtps_epi32(sum);
+        }
+
+        template<class T> SIMD_INLINE void SepFilterColFloatStore(__m128i value, T* dst);
+
+        template<> SIMD_INLINE void SepFilterColFloatStore(__m128i value, uint8_t* dst)
+        {
+            __m128i u16 = _mm_packs_epi32(value, K_ZERO);
+            *(int32_t*)dst = _mm_cvtsi128_si32(_mm_packus_epi16(u16, K_ZERO));
+        }
+
+        template<> SIMD_INLINE void SepFilterColFloatStore(__m128i value, uint16_t* dst)
+        {
+            _mm_storel_epi64((__m128i*)dst, _mm_packus_epi32(value, K_ZERO));
+        }
+
+        template<class T> void SepFilterColFloat(const float* const* src, size_t size, const float* kernel, size_t kernelSize, uint8_t* dst)
+        {
+            T* d = (T*)dst;
+            size_t sizeF = AlignLo(size, F);
+            for (size_t i = 0; i < sizeF; i += F)
+                SepFilterColFloatStore(SepFilterColFloat(src, i, kernel, kernelSize), d + i);
+            if (sizeF < size)
+            {
+                size_t i = size - F;
+                SepFilterColFloatStore(SepFilterColFloat(src, i, kernel, kernelSize), d + i);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SeparableFilterDefault::SeparableFilterDefault(const SepFilterParam& param)
+            : Base::SeparableFilterDefault(param)
+        {
+            if (_alg.size >= HA)
+            {
+                _rowInt = SepFilterRowInt;
+                _colInt = SepFilterColInt;
+            }
+            if (_alg.size >= F)
+            {
+                if (_param.type == SimdSeparableFilterChannel8u)
+                {
+                    _rowFloat = SepFilterRowFloat<uint8_t>;
+                    _colFloat = SepFilterColFloat<uint8_t>;
+                }
+                else
+                {
+                    _rowFloat = SepFilterRowFloat<uint16_t>;
+                    _colFloat = SepFilterColFloat<uint16_t>;
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void* SeparableFilterInit(size_t width, size_t height, size_t channels, SimdSeparableFilterChannelType type,
+            const float* rowKernel, size_t rowSize, const float* colKernel, size_t colSize)
+        {
+            SepFilterParam param(width, height, channels, type, rowKernel, rowSize, colKernel, colSize, A);
+            if (!param.Valid())
+                return NULL;
+            return new SeparableFilterDefault(param);
+        }
+    }
+#endif
+}
@@ -26,6 +26,7 @@
 #include "Simd/SimdCopy.h"
 #include "Simd/SimdUnpack.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdSse41.h"
 
 #include "Simd/SimdPoint.hpp"
 
@@ -34,38 +35,6 @@ namespace Simd
 #ifdef SIMD_SSE41_ENABLE
     namespace Sse41
     {
-        template<int N> SIMD_INLINE void FillBorder(uint8_t* dst, int count, const __m128i & bv, const uint8_t * bs)
-        {
-            int i = 0, size = count * N, size16 = (int)AlignLo(size, 16);
-            for (; i < size16; i += 16)
-                _mm_storeu_si128((__m128i*)(dst + i), bv);
-            for (; i < size; i += N)
-                Base::CopyPixel<N>(bs, dst + i);
-        }
-
-        template<> SIMD_INLINE void FillBorder<3>(uint8_t* dst, int count, const __m128i& bv, const uint8_t* bs)
-        {
-            int i = 0, size = count * 3, size3 = size - 3;
-            for (; i < size3; i += 3)
-                Base::CopyPixel<4>(bs, dst + i);
-            for (; i < size; i += 3)
-                Base::CopyPixel<3>(bs, dst + i);
-        }
-
-        template<int N> SIMD_INLINE __m128i InitBorder(const uint8_t* border)
-        {
-            switch (N)
-            {
-            case 1: return _mm_set1_epi8(*border);
-            case 2: return _mm_set1_epi16(*(uint16_t*)border);
-            case 3: return _mm_setzero_si128();
-            case 4: return _mm_set1_epi32(*(uint32_t*)border);
-            }
-            return _mm_setzero_si128();
-        }
-
-        //-----------------------------------------------------------------------------------------
-
         SIMD_INLINE __m128i NearestOffset(__m128 x, __m128 y, const __m128* m, __m128i w, const __m128i & h, const __m128i & n, const __m128i & s)
         {
             __m128 dx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m[0]), _mm_mul_ps(y, m[1])), m[2]);
@@ -119,12 +88,16 @@ namespace Simd
         WarpAffineNearest::WarpAffineNearest(const WarpAffParam& param)
             : Base::WarpAffineNearest(param)
         {
-            switch (_param.channels)
+            switch (_param.PixelSize())
             {
             case 1: _run = NearestRun<1>; break;
             case 2: _run = NearestRun<2>; break;
             case 3: _run = NearestRun<3>; break;
             case 4: _run = NearestRun<4>; break;
+            case 6: _run = NearestRun<6>; break;
+            case 8: _run = NearestRun<8>; break;
+            case 12: _run = NearestRun<12>; break;
+            case 16: _run = NearestRun<16>; break;
             }
         }
 
@@ -216,8 +189,6 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
-        const __m128i K32_WA_FRACTION_RANGE = SIMD_MM_SET1_EPI32(Base::WA_FRACTION_RANGE);
-
         SIMD_INLINE void ByteBilinearPrepMain4(__m128 x, __m128 y, const __m128* m, __m128i n, const __m128i & s, uint32_t* offs, uint8_t* fx, uint16_t* fy)
         {
             __m128 dx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m[0]), _mm_mul_ps(y, m[1])), m[2]);
@@ -236,128 +207,6 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
-        const __m128i K32_WA_BILINEAR_ROUND_TERM = SIMD_MM_SET1_EPI32(Base::WA_BILINEAR_ROUND_TERM);
-
-        template<int N> void ByteBilinearInterpMainN(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst);
-
-        template<> SIMD_INLINE void ByteBilinearInterpMainN<1>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
-        {
-            __m128i fx0 = _mm_loadu_si128((__m128i*)fx + 0);
-            __m128i fx1 = _mm_loadu_si128((__m128i*)fx + 1);
-            __m128i r00 = _mm_maddubs_epi16(_mm_loadu_si128((__m128i*)src0 + 0), fx0);
-            __m128i r01 = _mm_maddubs_epi16(_mm_loadu_si128((__m128i*)src0 + 1), fx1);
-            __m128i r10 = _mm_maddubs_epi16(_mm_loadu_si128((__m128i*)src1 + 0), fx0);
-            __m128i r11 = _mm_maddubs_epi16(_mm_loadu_si128((__m128i*)src1 + 1), fx1);
-
-            __m128i s0 = _mm_madd_epi16(UnpackU16<0>(r00, r10), _mm_loadu_si128((__m128i*)fy + 0));
-            __m128i d0 = _mm_srli_epi32(_mm_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m128i s1 = _mm_madd_epi16(UnpackU16<1>(r00, r10), _mm_loadu_si128((__m128i*)fy + 1));
-            __m128i d1 = _mm_srli_epi32(_mm_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m128i s2 = _mm_madd_epi16(UnpackU16<0>(r01, r11), _mm_loadu_si128((__m128i*)fy + 2));
-            __m128i d2 = _mm_srli_epi32(_mm_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m128i s3 = _mm_madd_epi16(UnpackU16<1>(r01, r11), _mm_loadu_si128((__m128i*)fy + 3));
-            __m128i d3 = _mm_srli_epi32(_mm_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(_mm_packus_epi32(d0, d1), _mm_packus_epi32(d2, d3)));
-        }
-
-        template<> SIMD_INLINE void ByteBilinearInterpMainN<2>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
-        {
-            static const __m128i SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF);
-
-            __m128i _fx = _mm_loadu_si128((__m128i*)fx);
-            __m128i fx0 = UnpackU16<0>(_fx, _fx);
-            __m128i fx1 = UnpackU16<1>(_fx, _fx);
-            __m128i r00 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 0), SHUFFLE), fx0);
-            __m128i r01 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 1), SHUFFLE), fx1);
-            __m128i r10 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 0), SHUFFLE), fx0);
-            __m128i r11 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 1), SHUFFLE), fx1);
-
-            __m128i fy0 = _mm_loadu_si128((__m128i*)fy + 0);
-            __m128i s0 = _mm_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
-            __m128i d0 = _mm_srli_epi32(_mm_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m128i s1 = _mm_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
-            __m128i d1 = _mm_srli_epi32(_mm_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m128i fy1 = _mm_loadu_si128((__m128i*)fy + 1);
-            __m128i s2 = _mm_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
-            __m128i d2 = _mm_srli_epi32(_mm_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m128i s3 = _mm_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
-            __m128i d3 = _mm_srli_epi32(_mm_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(_mm_packus_epi32(d0, d1), _mm_packus_epi32(d2, d3)));
-        }
-
-        template<> SIMD_INLINE void ByteBilinearInterpMainN<3>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
-        {
-            static const __m128i SRC_SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1);
-            static const __m128i DST_SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
-
-            __m128i _fx = _mm_loadu_si128((__m128i*)fx);
-            _fx = UnpackU16<0>(_fx, _fx);
-            __m128i fx0 = UnpackU16<0>(_fx, _fx);
-            __m128i fx1 = UnpackU16<1>(_fx, _fx);
-            __m128i r00 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 0), SRC_SHUFFLE), fx0);
-            __m128i r01 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 1), SRC_SHUFFLE), fx1);
-            __m128i r10 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 0), SRC_SHUFFLE), fx0);
-            __m128i r11 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 1), SRC_SHUFFLE), fx1);
-
-            __m128i _fy = _mm_loadu_si128((__m128i*)fy);
-            __m128i fy0 = UnpackU32<0>(_fy, _fy);
-            __m128i s0 = _mm_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
-            __m128i d0 = _mm_srli_epi32(_mm_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m128i s1 = _mm_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
-            __m128i d1 = _mm_srli_epi32(_mm_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m128i fy1 = UnpackU32<1>(_fy, _fy);
-            __m128i s2 = _mm_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
-            __m128i d2 = _mm_srli_epi32(_mm_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m128i s3 = _mm_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
-            __m128i d3 = _mm_srli_epi32(_mm_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            Store12(dst, _mm_shuffle_epi8(_mm_packus_epi16(_mm_packus_epi32(d0, d1), _mm_packus_epi32(d2, d3)), DST_SHUFFLE));
-        }
-
-        template<> SIMD_INLINE void ByteBilinearInterpMainN<4>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
-        {
-            static const __m128i SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF);
-
-            __m128i _fx = _mm_loadu_si128((__m128i*)fx);
-            _fx = UnpackU16<0>(_fx, _fx);
-            __m128i fx0 = UnpackU16<0>(_fx, _fx);
-            __m128i fx1 = UnpackU16<1>(_fx, _fx);
-            __m128i r00 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 0), SHUFFLE), fx0);
-            __m128i r01 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 1), SHUFFLE), fx1);
-            __m128i r10 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 0), SHUFFLE), fx0);
-            __m128i r11 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 1), SHUFFLE), fx1);
-
-            __m128i _fy = _mm_loadu_si128((__m128i*)fy);
-            __m128i fy0 = UnpackU32<0>(_fy, _fy);
-            __m128i s0 = _mm_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
-            __m128i d0 = _mm_srli_epi32(_mm_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m128i s1 = _mm_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
-            __m128i d1 = _mm_srli_epi32(_mm_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m128i fy1 = UnpackU32<1>(_fy, _fy);
-            __m128i s2 = _mm_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
-            __m128i d2 = _mm_srli_epi32(_mm_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            __m128i s3 = _mm_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
-            __m128i d3 = _mm_srli_epi32(_mm_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
-
-            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(_mm_packus_epi32(d0, d1), _mm_packus_epi32(d2, d3)));
-        }
-
-        //-------------------------------------------------------------------------------------------------
-
         template<int N> void ByteBilinearRun(const WarpAffParam& p, int yBeg, int yEnd, const int* ib, const int* ie, const int* ob, const int* oe, const uint8_t* src, uint8_t* dst, uint8_t* buf)
         {
             constexpr int M = (N == 3 ? 4 : N);
@@ -518,6 +367,221 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        template<int N> SIMD_INLINE __m128 InterpLoad(const float* src)
+        {
+            switch (N)
+            {
+            case 1: return _mm_load_ss(src);
+            case 2: return _mm_castpd_ps(_mm_load_sd((double*)src));
+            case 3: return _mm_movelh_ps(_mm_castpd_ps(_mm_load_sd((double*)src)), _mm_load_ss(src + 2));
+            default: return _mm_loadu_ps(src);
+            }
+        }
+
+        template<int N> SIMD_INLINE __m128 InterpLoad(const uint16_t* src)
+        {
+            __m128i value;
+            switch (N)
+            {
+            case 1: value = _mm_cvtsi32_si128(src[0]); break;
+            case 2: value = _mm_cvtsi32_si128(*(int32_t*)src); break;
+            case 3: value = _mm_insert_epi16(_mm_cvtsi32_si128(*(int32_t*)src), src[2], 2); break;
+            default: value = _mm_loadl_epi64((__m128i*)src);
+            }
+            return _mm_cvtepi32_ps(_mm_cvtepu16_epi32(value));
+        }
+
+        template<int N> SIMD_INLINE void InterpStore(__m128 value, float* dst)
+        {
+            switch (N)
+            {
+            case 1: _mm_store_ss(dst, value); break;
+            case 2: _mm_storel_pi((__m64*)dst, value); break;
+            case 3: _mm_storel_pi((__m64*)dst, value); _mm_store_ss(dst + 2, _mm_movehl_ps(value, value)); break;
+            default: _mm_storeu_ps(dst, value);
+            }
+        }
+
+        template<int N> SIMD_INLINE void InterpStore(__m128 value, uint16_t* dst)
+        {
+            __m128i u16 = _mm_packus_epi32(_mm_cvtps_epi32(value), _mm_setzero_si128());
+            switch (N)
+            {
+            case 1: dst[0] = (uint16_t)_mm_extract_epi16(u16, 0); break;
+            case 2: *(int32_t*)dst = _mm_cvtsi128_si32(u16); break;
+            case 3: *(int32_t*)dst = _mm_cvtsi128_si32(u16); dst[2] = (uint16_t)_mm_extract_epi16(u16, 2); break;
+            default: _mm_storel_epi64((__m128i*)dst, u16);
+            }
+        }
+
+        template<class T, int N, int K> struct Interp;
+
+        template<class T, int N> struct Interp<T, N, 2>
+        {
+            static SIMD_INLINE void Pixel(const uint8_t* src, int s, float fx, float fy, const int32_t* coef, uint8_t* dst)
+            {
+                const T* s0 = (const T*)src, * s1 = (const T*)(src + s);
+                __m128 kx1 = _mm_set1_ps(fx), kx0 = _mm_sub_ps(_mm_set1_ps(1.0f), kx1);
+                __m128 ky1 = _mm_set1_ps(fy), ky0 = _mm_sub_ps(_mm_set1_ps(1.0f), ky1);
+                __m128 r0 = _mm_add_ps(_mm_mul_ps(InterpLoad<N>(s0), kx0), _mm_mul_ps(InterpLoad<N>(s0 + N), kx1));
+                __m128 r1 = _mm_add_ps(_mm_mul_ps(InterpLoad<N>(s1), kx0), _mm_mul_ps(InterpLoad<N>(s1 + N), kx1));
+                InterpStore<N>(_mm_add_ps(_mm_mul_ps(r0, ky0), _mm_mul_ps(r1, ky1)), (T*)dst);
+            }
+        };
+
+        template<class T, int N> struct Interp<T, N, 4>
+        {
+            static SIMD_INLINE __m128 Row(const T* src, const __m128* kx)
+            {
+                __m128 sum = _mm_mul_ps(InterpLoad<N>(src + 0 * N), kx[0]);
+                sum = _mm_add_ps(sum, _mm_mul_ps(InterpLoad<N>(src + 1 * N), kx[1]));
+                sum = _mm_add_ps(sum, _mm_mul_ps(InterpLoad<N>(src + 2 * N), kx[2]));
+                return _mm_add_ps(sum, _mm_mul_ps(InterpLoad<N>(src + 3 * N), kx[3]));
+            }
+
+            static SIMD_INLINE void Pixel(const uint8_t* src, int s, float fx, float fy, const int32_t* coef, uint8_t* dst)
+            {
+                float wx[4], wy[4];
+                Base::CubicWeights(fx, wx);
+                Base::CubicWeights(fy, wy);
+                __m128 kx[4];
+                for (int i = 0; i < 4; ++i)
+                    kx[i] = _mm_set1_ps(wx[i]);
+                __m128 sum = _mm_mul_ps(Row((const T*)(src + 0 * s), kx), _mm_set1_ps(wy[0]));
+                sum = _mm_add_ps(sum, _mm_mul_ps(Row((const T*)(src + 1 * s), kx), _mm_set1_ps(wy[1])));
+                sum = _mm_add_ps(sum, _mm_mul_ps(Row((const T*)(src + 2 * s), kx), _mm_set1_ps(wy[2])));
+                sum = _mm_add_ps(sum, _mm_mul_ps(Row((const T*)(src + 3 * s), kx), _mm_set1_ps(wy[3])));
+                InterpStore<N>(sum, (T*)dst);
+            }
+        };
+
+        template<int N> SIMD_INLINE __m128i LoadCubicTaps(const uint8_t* src)
+        {
+            switch (N)
+            {
+            case 1: return _mm_cvtsi32_si128(*(int32_t*)src);
+            case 2: return _mm_loadl_epi64((__m128i*)src);
+            case 3: return _mm_insert_epi32(_mm_loadl_epi64((__m128i*)src), *(int32_t*)(src + 8), 2);
+            default: return _mm_loadu_si128((__m128i*)src);
+            }
+        }
+
+        const __m128i K8_CUBIC_TAPS_1 = SIMD_MM_SETR_EPI8(0x0, 0x1, -1, -1, -1, -1, -1, -1, 0x2, 0x3, -1, -1, -1, -1, -1, -1);
+        const __m128i K8_CUBIC_TAPS_2 = SIMD_MM_SETR_EPI8(0x0, 0x2, 0x1, 0x3, -1, -1, -1, -1, 0x4, 0x6, 0x5, 0x7, -1, -1, -1, -1);
+        const __m128i K8_CUBIC_TAPS_3 = SIMD_MM_SETR_EPI8(0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x6, 0x9, 0x7, 0xA, 0x8, 0xB, -1, -1);
+        const __m128i K8_CUBIC_TAPS_4 = SIMD_MM_SETR_EPI8(0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF);
+
+        template<int N> SIMD_INLINE __m128i CubicTapsShuffle()
+        {
+            switch (N)
+            {
+            case 1: return K8_CUBIC_TAPS_1;
+            case 2: return K8_CUBIC_TAPS_2;
+            case 3: return K8_CUBIC_TAPS_3;
+            default: return K8_CUBIC_TAPS_4;
+            }
+        }
+
+        template<int N> struct Interp<uint8_t, N, 4>
+        {
+            static SIMD_INLINE __m128i Row(const uint8_t* src, const __m128i& kx)
+            {
+                __m128i sum = _mm_maddubs_epi16(_mm_shuffle_epi8(LoadCubicTaps<N>(src), CubicTapsShuffle<N>()), kx);
+                return _mm_add_epi16(sum, _mm_srli_si128(sum, 8));
+            }
+
+            static SIMD_INLINE void Pixel(const uint8_t* src, int s, float fx, float fy, const int32_t* coef, uint8_t* dst)
+            {
+                static const __m128i KX_SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x0, 0x1, 0x2, 0x3, 0x2, 0x3, 0x2, 0x3, 0x2, 0x3);
+                __m128i kx = _mm_shuffle_epi8(_mm_cvtsi32_si128(coef[Base::CubicIndex(fx)]), KX_SHUFFLE);
+                const int32_t* ky = coef + Base::WA_BICUBIC_FRACTION_RANGE + 1 + 2 * Base::CubicIndex(fy);
+                __m128i s01 = _mm_madd_epi16(_mm_unpacklo_epi16(Row(src + 0 * s, kx), Row(src + 1 * s, kx)), _mm_set1_epi32(ky[0]));
+                __m128i s23 = _mm_madd_epi16(_mm_unpacklo_epi16(Row(src + 2 * s, kx), Row(src + 3 * s, kx)), _mm_set1_epi32(ky[1]));
+                __m128i sum = _mm_srai_epi32(_mm_add_epi32(_mm_add_epi32(s01, s23), _mm_set1_epi32(Base::WA_BICUBIC_ROUND_TERM)), Base::WA_BICUBIC_SHIFT);
+                __m128i u8 = _mm_packus_epi16(_mm_packs_epi32(sum, _mm_setzero_si128()), _mm_setzero_si128());
+                switch (N)
+                {
+                case 1: dst[0] = (uint8_t)_mm_cvtsi128_si32(u8); break;
+                case 2: *(uint16_t*)dst = (uint16_t)_mm_cvtsi128_si32(u8); break;
+                case 3: *(uint16_t*)dst = (uint16_t)_mm_cvtsi128_si32(u8); dst[2] = (uint8_t)_mm_extract_epi8(u8, 2); break;
+                default: *(int32_t*)dst = _mm_cvtsi128_si32(u8);
+                }
+            }
+        };
+
+        template<class T, int N, int K> void InterpRun(const WarpAffParam& p, int yBeg, int yEnd, const int* range, const float* cx, const float* cy, const int32_t* coef, const uint8_t* src, uint8_t* dst, uint8_t* buf)
+        {
+            const int P = N * sizeof(T), A = K / 2 - 1;
+            bool fill = p.NeedFill();
+            int width = (int)p.dstW, height = (int)p.dstH, s = (int)p.srcS, w = (int)p.srcW, h = (int)p.srcH, xs = (int)p.CoordStride();
+            const int* ib = range + 0 * height, * ie = range + 1 * height, * ob = range + 2 * height, * oe = range + 3 * height;
+            uint32_t* offs = (uint32_t*)buf;
+            float* fx = (float*)(offs + xs);
+            float* fy = fx + xs;
+            __m128i _border = InitBorder<P>(p.border);
+            __m128i _min = _mm_set1_epi32(A), _maxX = _mm_set1_epi32(w - K + A), _maxY = _mm_set1_epi32(h - K + A);
+            __m128i _p = _mm_set1_epi32(P), _s = _mm_set1_epi32(s), _a = _mm_set1_epi32(A * P + A * s);
+            dst += yBeg * p.dstS;
+            for (int y = yBeg; y < yEnd; ++y)
+            {
+                float yx = cy[2 * y + 0], yy = cy[2 * y + 1];
+                int iB = ib[y], iE = ie[y], oB = ob[y], oE = oe[y];
+                if (fill)
+                    FillBorder<P>(dst, oB, _border, p.border);
+                for (int x = oB; x < iB; ++x)
+                    Base::InterpEdge<T, N, K>(cx[x] + yx, cx[x + xs] + yy, w, h, s, src, coef, fill ? p.border : dst + x * P, dst + x * P);
+                {
+                    __m128 _yx = _mm_set1_ps(yx), _yy = _mm_set1_ps(yy);
+                    for (int x = iB; x < iE; x += 4)
+                    {
+                        __m128 dx = _mm_add_ps(_mm_loadu_ps(cx + x), _yx);
+                        __m128 dy = _mm_add_ps(_mm_loadu_ps(cx + x + xs), _yy);
+                        __m128i ix = _mm_min_epi32(_mm_max_epi32(_mm_cvtps_epi32(_mm_floor_ps(dx)), _min), _maxX);
+                        __m128i iy = _mm_min_epi32(_mm_max_epi32(_mm_cvtps_epi32(_mm_floor_ps(dy)), _min), _maxY);
+                        _mm_storeu_si128((__m128i*)(offs + x), _mm_sub_epi32(_mm_add_epi32(_mm_mullo_epi32(ix, _p), _mm_mullo_epi32(iy, _s)), _a));
+                        _mm_storeu_ps(fx + x, _mm_sub_ps(dx, _mm_cvtepi32_ps(ix)));
+                        _mm_storeu_ps(fy + x, _mm_sub_ps(dy, _mm_cvtepi32_ps(iy)));
+                    }
+                    for (int x = iB; x < iE; ++x)
+                        Interp<T, N, K>::Pixel(src + offs[x], s, fx[x], fy[x], coef, dst + x * P);
+                }
+                for (int x = iE; x < oE; ++x)
+                    Base::InterpEdge<T, N, K>(cx[x] + yx, cx[x + xs] + yy, w, h, s, src, coef, fill ? p.border : dst + x * P, dst + x * P);
+                if (fill)
+                    FillBorder<P>(dst + oE * P, width - oE, _border, p.border);
+                dst += p.dstS;
+            }
+        }
+
+        template<class T, int K> Base::WarpAffineInterp::RunPtr GetInterpRun(size_t channels)
+        {
+            switch (channels)
+            {
+            case 1: return InterpRun<T, 1, K>;
+            case 2: return InterpRun<T, 2, K>;
+            case 3: return InterpRun<T, 3, K>;
+            case 4: return InterpRun<T, 4, K>;
+            default: return NULL;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        WarpAffineInterp::WarpAffineInterp(const WarpAffParam& param)
+            : Base::WarpAffineInterp(param)
+        {
+            bool cubic = _param.IsBicubic();
+            switch (_param.Channel())
+            {
+            case SimdWarpAffineChannelByte: _run = GetInterpRun<uint8_t, 4>(_param.channels); break;
+            case SimdWarpAffineChannelShort: _run = cubic ? GetInterpRun<uint16_t, 4>(_param.channels) : GetInterpRun<uint16_t, 2>(_param.channels); break;
+            case SimdWarpAffineChannelFloat: _run = cubic ? GetInterpRun<float, 4>(_param.channels) : GetInterpRun<float, 2>(_param.channels); break;
+            default: break;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
         void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border)
         {
             WarpAffParam param(srcW, srcH, srcS, dstW, dstH, dstS, channels, mat, flags, border, A);
@@ -528,7 +592,26 @@ namespace Simd
             else if (param.IsByteBilinear())
                 return new WarpAffineByteBilinear(param);
             else
+                return new WarpAffineInterp(param);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        WarpAffineBatch::WarpAffineBatch(const WarpAffParam& param, SimdTensorDataType type, const float* lower, const float* upper)
+            : Base::WarpAffineBatch(param, type, lower, upper)
+        {
+            _warpAffineInit = WarpAffineInit;
+            _synetSetInput = SynetSetInput;
+        }
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border, SimdTensorDataType type, const float* lower, const float* upper)
+        {
+            static const float identity[6] = { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+            WarpAffParam param(srcW, srcH, srcS, dstW, dstH, 0, channels, identity, flags, border, A);
+            param.dstS = dstW * param.PixelSize();
+            if (!Base::WarpAffineBatchValid(param, type, lower, upper))
                 return NULL;
+            return new WarpAffineBatch(param, type, lower, upper);
         }
     }
 #endif
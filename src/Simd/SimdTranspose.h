@@ -93,6 +93,39 @@ namespace Simd
             Store<align>(dst + 2 * F, buf23);
             Store<align>(dst + 3 * F, buf33);
         }
+
+        SIMD_INLINE void Transpose16x16Step(const __m128i * a, __m128i * b)
+        {
+            b[0x0] = _mm_unpacklo_epi8(a[0x0], a[0x8]);
+            b[0x1] = _mm_unpackhi_epi8(a[0x0], a[0x8]);
+            b[0x2] = _mm_unpacklo_epi8(a[0x1], a[0x9]);
+            b[0x3] = _mm_unpackhi_epi8(a[0x1], a[0x9]);
+            b[0x4] = _mm_unpacklo_epi8(a[0x2], a[0xA]);
+            b[0x5] = _mm_unpackhi_epi8(a[0x2], a[0xA]);
+            b[0x6] = _mm_unpacklo_epi8(a[0x3], a[0xB]);
+            b[0x7] = _mm_unpackhi_epi8(a[0x3], a[0xB]);
+            b[0x8] = _mm_unpacklo_epi8(a[0x4], a[0xC]);
+            b[0x9] = _mm_unpackhi_epi8(a[0x4], a[0xC]);
+            b[0xA] = _mm_unpacklo_epi8(a[0x5], a[0xD]);
+            b[0xB] = _mm_unpackhi_epi8(a[0x5], a[0xD]);
+            b[0xC] = _mm_unpacklo_epi8(a[0x6], a[0xE]);
+            b[0xD] = _mm_unpackhi_epi8(a[0x6], a[0xE]);
+            b[0xE] = _mm_unpacklo_epi8(a[0x7], a[0xF]);
+            b[0xF] = _mm_unpackhi_epi8(a[0x7], a[0xF]);
+        }
+
+        SIMD_INLINE void Transpose16x16(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            __m128i a[16], b[16];
+            for (size_t i = 0; i < 16; ++i)
+                a[i] = _mm_loadu_si128((__m128i*)(src + i * srcStride));
+            Transpose16x16Step(a, b);
+            Transpose16x16Step(b, a);
+            Transpose16x16Step(a, b);
+            Transpose16x16Step(b, a);
+            for (size_t i = 0; i < 16; ++i)
+                _mm_storeu_si128((__m128i*)(dst + i * dstStride), a[i]);
+        }
     }
 #endif//SIMD_SSE41_ENABLE
 
@@ -29,11 +29,18 @@
 
 #include "Simd/SimdPoint.hpp"
 
+#include <vector>
+
 namespace Simd
 {
+    SIMD_INLINE bool WarpAffineInvertible(const float* mat)
+    {
+        return mat[0] * mat[4] - mat[1] * mat[3] != 0.0f;
+    }
+
     struct WarpAffParam
     {
-        static const int BorderSizeMax = 4 * 1;
+        static const int BorderSizeMax = 4 * 4;
 
         SimdWarpAffineFlags flags;
         float mat[6], inv[6];
@@ -44,7 +51,8 @@ namespace Simd
 
         bool Valid() const
         {
-            return channels >= 1 && channels <= 4 && srcH * srcS <= 0x100000000 &&
+            return channels >= 1 && channels <= 4 && srcH * srcS <= 0x100000000 && ChannelSize() != 0 &&
+                (flags & SimdWarpAffineInterpMask) != SimdWarpAffineInterpMask &&
                 (inv[0] != 0.0f || inv[1] != 0.0f || inv[3] != 0.0f || inv[4] != 0.0f);
         }
 
@@ -58,18 +66,30 @@ namespace Simd
             return (flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpBilinear && (SimdWarpAffineChannelMask & flags) == SimdWarpAffineChannelByte;
         }
 
+        bool IsBicubic() const
+        {
+            return (flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpBicubic;
+        }
+
         bool NeedFill() const
         {
             return (flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderConstant;
         }
 
+        SimdWarpAffineFlags Channel() const
+        {
+            return (SimdWarpAffineFlags)(SimdWarpAffineChannelMask & flags);
+        }
+
         size_t ChannelSize() const
         {
             switch (SimdWarpAffineChannelMask & flags)
             {
             case SimdWarpAffineChannelByte: return 1;
+            case SimdWarpAffineChannelShort: return 2;
+            case SimdWarpAffineChannelFloat: return 4;
             default:
-                assert(0); return 0;
+                return 0;
             }
         }
 
@@ -77,6 +97,11 @@ namespace Simd
         {
             return ChannelSize() * channels;
         }
+
+        size_t CoordStride() const
+        {
+            return AlignHi(dstW, align) + align;
+        }
     };
 
     //-------------------------------------------------------------------------------------------------
@@ -88,6 +113,13 @@ namespace Simd
 
         virtual void Run(const uint8_t * src, uint8_t * dst) = 0;
 
+        bool SetMatrix(const float* mat);
+
+        void SetThreads(size_t threads)
+        {
+            _threads = threads;
+        }
+
     protected:
         WarpAffParam _param;
         bool _first;
@@ -144,7 +176,55 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class WarpAffineInterp : public WarpAffine
+        {
+        public:
+            typedef void(*RunPtr)(const WarpAffParam& p, int yBeg, int yEnd, const int* range, const float* cx, const float* cy, const int32_t* coef, const uint8_t* src, uint8_t* dst, uint8_t* buf);
+
+            WarpAffineInterp(const WarpAffParam& param);
+
+            virtual void Run(const uint8_t* src, uint8_t* dst);
+
+        protected:
+            void Init();
+
+            Array32i _range, _coef;
+            Array32f _coords;
+            RunPtr _run;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
         void * WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        //-------------------------------------------------------------------------------------------------
+
+        class WarpAffineBatch : public Deletable
+        {
+        public:
+            typedef void* (*WarpAffineInitPtr)(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+            typedef void (*SynetSetInputPtr)(const uint8_t* src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat, const float* lower, const float* upper, float* dst, size_t channels, SimdTensorFormatType dstFormat);
+
+            WarpAffineBatch(const WarpAffParam& param, SimdTensorDataType type, const float* lower, const float* upper);
+            virtual ~WarpAffineBatch();
+
+            bool Run(const uint8_t* src, const float* mats, size_t count, uint8_t* dst);
+
+        protected:
+            WarpAffParam _param;
+            SimdTensorDataType _type;
+            SimdPixelFormatType _format;
+            float _lower[3], _upper[3];
+            size_t _threads, _imageSize, _tensorSize, _tensorChannels;
+            std::vector<class WarpAffine*> _workers;
+            Array8u _buffer;
+            WarpAffineInitPtr _warpAffineInit;
+            SynetSetInputPtr _synetSetInput;
+        };
+
+        bool WarpAffineBatchValid(const WarpAffParam& param, SimdTensorDataType type, const float* lower, const float* upper);
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border, SimdTensorDataType type, const float* lower, const float* upper);
     }
 
 #ifdef SIMD_SSE41_ENABLE
@@ -172,7 +252,25 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class WarpAffineInterp : public Base::WarpAffineInterp
+        {
+        public:
+            WarpAffineInterp(const WarpAffParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
         void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        //-------------------------------------------------------------------------------------------------
+
+        class WarpAffineBatch : public Base::WarpAffineBatch
+        {
+        public:
+            WarpAffineBatch(const WarpAffParam& param, SimdTensorDataType type, const float* lower, const float* upper);
+        };
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border, SimdTensorDataType type, const float* lower, const float* upper);
     }
 #endif
 
@@ -201,7 +299,25 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class WarpAffineInterp : public Sse41::WarpAffineInterp
+        {
+        public:
+            WarpAffineInterp(const WarpAffParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
         void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        //-------------------------------------------------------------------------------------------------
+
+        class WarpAffineBatch : public Base::WarpAffineBatch
+        {
+        public:
+            WarpAffineBatch(const WarpAffParam& param, SimdTensorDataType type, const float* lower, const float* upper);
+        };
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border, SimdTensorDataType type, const float* lower, const float* upper);
     }
 #endif
 
@@ -230,7 +346,25 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class WarpAffineInterp : public Avx2::WarpAffineInterp
+        {
+        public:
+            WarpAffineInterp(const WarpAffParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
         void* WarpAffineInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+        //-------------------------------------------------------------------------------------------------
+
+        class WarpAffineBatch : public Base::WarpAffineBatch
+        {
+        public:
+            WarpAffineBatch(const WarpAffParam& param, SimdTensorDataType type, const float* lower, const float* upper);
+        };
+
+        void* WarpAffineBatchInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t channels, SimdWarpAffineFlags flags, const uint8_t* border, SimdTensorDataType type, const float* lower, const float* upper);
     }
 #endif
 }
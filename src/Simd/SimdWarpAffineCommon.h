@@ -26,11 +26,45 @@
 
 #include "Simd/SimdWarpAffine.h"
 #include "Simd/SimdCopy.h"
+#include "Simd/SimdUnpack.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdEnable.h"
+#include "Simd/SimdSet.h"
 
 namespace Simd
 {
     namespace Base
     {
+        SIMD_INLINE void RestrictHalfLine(double a, double b, double& lo, double& hi)
+        {
+            if (a > 0.0)
+                lo = Simd::Max(lo, -b / a);
+            else if (a < 0.0)
+                hi = Simd::Min(hi, -b / a);
+            else if (b < 0.0)
+                lo = hi + 1.0;
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        template<int N> SIMD_INLINE void FillBorder(uint8_t* dst, int count, const uint8_t* bs)
+        {
+            int size = count * N;
+            for (int i = 0; i < size; i += N)
+                Base::CopyPixel<N>(bs, dst + i);
+        }
+
+        template<> SIMD_INLINE void FillBorder<3>(uint8_t* dst, int count, const uint8_t* bs)
+        {
+            int i = 0, size = count * 3, size3 = size - 3;
+            for (; i < size3; i += 3)
+                Base::CopyPixel<4>(bs, dst + i);
+            for (; i < size; i += 3)
+                Base::CopyPixel<3>(bs, dst + i);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
         template<int N> SIMD_INLINE uint32_t NearestOffset(int x, int y, const float* m, int w, int h, int s)
         {
             float sx = (float)x, sy = (float)y;
@@ -43,14 +77,14 @@ namespace Simd
 
         //-----------------------------------------------------------------------------------------
 
-        template<int N> SIMD_INLINE void NearestGather(const uint8_t* src, uint32_t* offset, int count, uint8_t* dst)
+        template<int N> SIMD_INLINE void NearestGather(const uint8_t* src, const uint32_t* offset, int count, uint8_t* dst)
         {
             int i = 0;
             for (; i < count; i++, dst += N)
                 Base::CopyPixel<N>(src + offset[i], dst);
         }
 
-        template<> SIMD_INLINE void NearestGather<3>(const uint8_t* src, uint32_t* offset, int count, uint8_t* dst)
+        template<> SIMD_INLINE void NearestGather<3>(const uint8_t* src, const uint32_t* offset, int count, uint8_t* dst)
         {
             int i = 0, count1 = count - 1;
             for (; i < count1; i++, dst += 3)
@@ -119,7 +153,7 @@ namespace Simd
         }
         //-------------------------------------------------------------------------------------------------
 
-        template<int N> SIMD_INLINE void ByteBilinearGather(const uint8_t* src0, const uint8_t* src1, uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
+        template<int N> SIMD_INLINE void ByteBilinearGather(const uint8_t* src0, const uint8_t* src1, const uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
         {
             int i = 0;
             for (; i < count; i++, dst0 += 2 * N, dst1 += 2 * N)
@@ -129,11 +163,1101 @@ namespace Simd
                 Base::CopyPixel<N * 2>(src1 + offs, dst1);
             }
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE void PerspectiveCoord(int x, const float* cx, size_t xs, const float* cy, float& dx, float& dy)
+        {
+            float dz = 1.0f / (cx[x + 2 * xs] + cy[2]);
+            dx = (cx[x] + cy[0]) * dz;
+            dy = (cx[x + xs] + cy[1]) * dz;
+        }
+
+        template<int N> SIMD_INLINE uint32_t PerspNearestOffset(int x, const float* cx, size_t xs, const float* cy, int w, int h, int s)
+        {
+            float dx, dy;
+            PerspectiveCoord(x, cx, xs, cy, dx, dy);
+            int ix = Simd::RestrictRange(Round(dx), 0, w);
+            int iy = Simd::RestrictRange(Round(dy), 0, h);
+            return iy * s + ix * N;
+        }
+
+        SIMD_INLINE void PerspByteBilinearPrepMain(int x, const float* cx, size_t xs, const float* cy, int n, int s, float w, float h, uint32_t* offs, uint8_t* fx, uint16_t* fy)
+        {
+            float dx, dy;
+            PerspectiveCoord(x, cx, xs, cy, dx, dy);
+            dx = Simd::Min(Simd::Max(dx, 0.0f), w);
+            dy = Simd::Min(Simd::Max(dy, 0.0f), h);
+            float ix = Simd::Min((float)floor(dx), w - 1.0f);
+            float iy = Simd::Min((float)floor(dy), h - 1.0f);
+            int fx1 = Round((dx - ix) * WA_FRACTION_RANGE);
+            int fy1 = Round((dy - iy) * WA_FRACTION_RANGE);
+            *offs = (int)iy * s + (int)ix * n;
+            fx[0] = WA_FRACTION_RANGE - fx1;
+            fx[1] = fx1;
+            fy[0] = WA_FRACTION_RANGE - fy1;
+            fy[1] = fy1;
+        }
+
+        template<int N> SIMD_INLINE void PerspByteBilinearInterpEdge(int x, const float* cx, size_t xs, const float* cy, int w, int h, int s, const uint8_t* src, const uint8_t* brd, uint8_t* dst)
+        {
+            float dx, dy;
+            PerspectiveCoord(x, cx, xs, cy, dx, dy);
+            dx = Simd::Min(Simd::Max(dx, -2.0f), float(w + 1));
+            dy = Simd::Min(Simd::Max(dy, -2.0f), float(h + 1));
+            int ix = (int)floor(dx);
+            int iy = (int)floor(dy);
+            int fx = Round((dx - ix) * WA_FRACTION_RANGE);
+            int fy = Round((dy - iy) * WA_FRACTION_RANGE);
+            int f00 = (WA_FRACTION_RANGE - fy) * (WA_FRACTION_RANGE - fx);
+            int f01 = (WA_FRACTION_RANGE - fy) * fx;
+            int f10 = fy * (WA_FRACTION_RANGE - fx);
+            int f11 = fy * fx;
+            bool x0 = ix >= 0 && ix <= w, x1 = ix >= -1 && ix < w;
+            bool y0 = iy >= 0 && iy <= h, y1 = iy >= -1 && iy < h;
+            const uint8_t* s00 = y0 && x0 ? src + (iy + 0) * s + (ix + 0) * N : brd;
+            const uint8_t* s01 = y0 && x1 ? src + (iy + 0) * s + (ix + 1) * N : brd;
+            const uint8_t* s10 = y1 && x0 ? src + (iy + 1) * s + (ix + 0) * N : brd;
+            const uint8_t* s11 = y1 && x1 ? src + (iy + 1) * s + (ix + 1) * N : brd;
+            for (int c = 0; c < N; c++)
+                dst[c] = (s00[c] * f00 + s01[c] * f01 + s10[c] * f10 + s11[c] * f11 + WA_BILINEAR_ROUND_TERM) >> WA_BILINEAR_SHIFT;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<int N> SIMD_INLINE void RemapByteBilinearInterpEdge(uint32_t offs, const uint8_t* fx, const uint16_t* fy, int w, int h, int s, const uint8_t* src, const uint8_t* brd, uint8_t* dst)
+        {
+            int ix = (int16_t)(offs & 0xFFFF);
+            int iy = (int16_t)(offs >> 16);
+            int f00 = fy[0] * fx[0];
+            int f01 = fy[0] * fx[1];
+            int f10 = fy[1] * fx[0];
+            int f11 = fy[1] * fx[1];
+            bool x0 = ix < 0, x1 = ix > w;
+            bool y0 = iy < 0, y1 = iy > h;
+            const uint8_t* s00 = y0 || x0 ? brd : src + iy * s + ix * N;
+            const uint8_t* s01 = y0 || x1 ? brd : src + iy * s + ix * N + N;
+            const uint8_t* s10 = y1 || x0 ? brd : src + iy * s + s + ix * N;
+            const uint8_t* s11 = y1 || x1 ? brd : src + iy * s + s + ix * N + N;
+            for (int c = 0; c < N; c++)
+                dst[c] = (s00[c] * f00 + s01[c] * f01 + s10[c] * f10 + s11[c] * f11 + WA_BILINEAR_ROUND_TERM) >> WA_BILINEAR_SHIFT;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        const int WA_BICUBIC_X_SHIFT = 6;
+        const int WA_BICUBIC_Y_SHIFT = 10;
+        const int WA_BICUBIC_SHIFT = WA_BICUBIC_X_SHIFT + WA_BICUBIC_Y_SHIFT;
+        const int WA_BICUBIC_ROUND_TERM = 1 << (WA_BICUBIC_SHIFT - 1);
+        const int WA_BICUBIC_FRACTION_RANGE = 64;
+        const int WA_BICUBIC_COEF_SIZE = (WA_BICUBIC_FRACTION_RANGE + 1) * 3;
+
+        SIMD_INLINE void CubicWeights(float d, float* w)
+        {
+            w[0] = -d * (1.0f - d) * (2.0f - d) / 6.0f;
+            w[1] = (1.0f - d) * (1.0f + d) * (2.0f - d) / 2.0f;
+            w[2] = d * (1.0f + d) * (2.0f - d) / 2.0f;
+            w[3] = -d * (1.0f - d) * (1.0f + d) / 6.0f;
+        }
+
+        SIMD_INLINE int CubicIndex(float f)
+        {
+            return Simd::RestrictRange(Round(f * WA_BICUBIC_FRACTION_RANGE), 0, WA_BICUBIC_FRACTION_RANGE);
+        }
+
+        template<class T> SIMD_INLINE void InterpStore(float value, T* dst);
+
+        template<> SIMD_INLINE void InterpStore(float value, uint16_t* dst)
+        {
+            dst[0] = (uint16_t)Simd::RestrictRange(Round(value), 0, 0xFFFF);
+        }
+
+        template<> SIMD_INLINE void InterpStore(float value, float* dst)
+        {
+            dst[0] = value;
+        }
+
+        template<class T, int N, int K> struct Interp;
+
+        template<class T, int N> struct Interp<T, N, 2>
+        {
+            static SIMD_INLINE void Pixel(const uint8_t* src, int s, float fx, float fy, const int32_t* coef, uint8_t* dst)
+            {
+                const T* s0 = (const T*)src, * s1 = (const T*)(src + s);
+                float kx0 = 1.0f - fx, ky0 = 1.0f - fy;
+                for (int c = 0; c < N; c++)
+                {
+                    float r0 = float(s0[c]) * kx0 + float(s0[c + N]) * fx;
+                    float r1 = float(s1[c]) * kx0 + float(s1[c + N]) * fx;
+                    InterpStore(r0 * ky0 + r1 * fy, (T*)dst + c);
+                }
+            }
+        };
+
+        template<class T, int N> struct Interp<T, N, 4>
+        {
+            static SIMD_INLINE void Pixel(const uint8_t* src, int s, float fx, float fy, const int32_t* coef, uint8_t* dst)
+            {
+                float kx[4], ky[4];
+                CubicWeights(fx, kx);
+                CubicWeights(fy, ky);
+                for (int c = 0; c < N; c++)
+                {
+                    float sum = 0.0f;
+                    for (int r = 0; r < 4; ++r)
+                    {
+                        const T* row = (const T*)(src + r * s) + c;
+                        sum += ky[r] * (float(row[0 * N]) * kx[0] + float(row[1 * N]) * kx[1] + float(row[2 * N]) * kx[2] + float(row[3 * N]) * kx[3]);
+                    }
+                    InterpStore(sum, (T*)dst + c);
+                }
+            }
+        };
+
+        template<int N> struct Interp<uint8_t, N, 4>
+        {
+            static SIMD_INLINE void Pixel(const uint8_t* src, int s, float fx, float fy, const int32_t* coef, uint8_t* dst)
+            {
+                const int8_t* kx = (const int8_t*)(coef + CubicIndex(fx));
+                const int16_t* ky = (const int16_t*)(coef + WA_BICUBIC_FRACTION_RANGE + 1 + 2 * CubicIndex(fy));
+                for (int c = 0; c < N; c++)
+                {
+                    int sum = 0;
+                    for (int r = 0; r < 4; ++r)
+                    {
+                        const uint8_t* row = src + r * s + c;
+                        sum += ky[r] * (kx[0] * row[0 * N] + kx[1] * row[1 * N] + kx[2] * row[2 * N] + kx[3] * row[3 * N]);
+                    }
+                    dst[c] = (uint8_t)Simd::RestrictRange((sum + WA_BICUBIC_ROUND_TERM) >> WA_BICUBIC_SHIFT, 0, 255);
+                }
+            }
+        };
+
+        template<class T, int N, int K> SIMD_INLINE void InterpMain(float dx, float dy, int w, int h, int s, const uint8_t* src, const int32_t* coef, uint8_t* dst)
+        {
+            const int A = K / 2 - 1;
+            int ix = Simd::RestrictRange((int)::floor(dx), A, w - K + A);
+            int iy = Simd::RestrictRange((int)::floor(dy), A, h - K + A);
+            src += (iy - A) * s + (ix - A) * N * sizeof(T);
+            Interp<T, N, K>::Pixel(src, s, dx - (float)ix, dy - (float)iy, coef, dst);
+        }
+
+        template<class T, int N, int K> SIMD_INLINE void InterpEdge(float dx, float dy, int w, int h, int s, const uint8_t* src, const int32_t* coef, const uint8_t* brd, uint8_t* dst)
+        {
+            const int A = K / 2 - 1, P = N * sizeof(T);
+            float fx = ::floor(dx), fy = ::floor(dy);
+            int ix = (int)fx - A, iy = (int)fy - A;
+            T buf[K * K * N];
+            uint8_t* pb = (uint8_t*)buf;
+            for (int r = 0; r < K; ++r)
+            {
+                int sy = iy + r;
+                bool vy = sy >= 0 && sy < h;
+                for (int c = 0; c < K; ++c, pb += P)
+                {
+                    int sx = ix + c;
+                    const uint8_t* ps = vy && sx >= 0 && sx < w ? src + sy * s + sx * P : brd;
+                    memcpy(pb, ps, P);
+                }
+            }
+            Interp<T, N, K>::Pixel((uint8_t*)buf, K * P, dx - fx, dy - fy, coef, dst);
+        }
     }
 
 #ifdef SIMD_SSE41_ENABLE
     namespace Sse41
     {
+        template<int N> SIMD_INLINE void FillBorder(uint8_t* dst, int count, const __m128i & bv, const uint8_t * bs)
+        {
+            int i = 0, size = count * N, size16 = (int)AlignLo(size, 16);
+            for (; i < size16; i += 16)
+                _mm_storeu_si128((__m128i*)(dst + i), bv);
+            for (; i < size; i += N)
+                Base::CopyPixel<N>(bs, dst + i);
+        }
+
+        template<> SIMD_INLINE void FillBorder<3>(uint8_t* dst, int count, const __m128i& bv, const uint8_t* bs)
+        {
+            int i = 0, size = count * 3, size3 = size - 3;
+            for (; i < size3; i += 3)
+                Base::CopyPixel<4>(bs, dst + i);
+            for (; i < size; i += 3)
+                Base::CopyPixel<3>(bs, dst + i);
+        }
+
+        template<> SIMD_INLINE void FillBorder<6>(uint8_t* dst, int count, const __m128i& bv, const uint8_t* bs)
+        {
+            Base::FillBorder<6>(dst, count, bs);
+        }
+
+        template<> SIMD_INLINE void FillBorder<12>(uint8_t* dst, int count, const __m128i& bv, const uint8_t* bs)
+        {
+            Base::FillBorder<12>(dst, count, bs);
+        }
+
+        template<int N> SIMD_INLINE __m128i InitBorder(const uint8_t* border)
+        {
+            switch (N)
+            {
+            case 1: return _mm_set1_epi8(*border);
+            case 2: return _mm_set1_epi16(*(uint16_t*)border);
+            case 3: return _mm_setzero_si128();
+            case 4: return _mm_set1_epi32(*(uint32_t*)border);
+            case 8: return _mm_set1_epi64x(*(int64_t*)border);
+            case 16: return _mm_loadu_si128((__m128i*)border);
+            }
+            return _mm_setzero_si128();
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        const __m128i K32_WA_FRACTION_RANGE = SIMD_MM_SET1_EPI32(Base::WA_FRACTION_RANGE);
+
+        const __m128i K32_WA_BILINEAR_ROUND_TERM = SIMD_MM_SET1_EPI32(Base::WA_BILINEAR_ROUND_TERM);
+
+        template<int N> void ByteBilinearInterpMainN(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst);
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<1>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            __m128i fx0 = _mm_loadu_si128((__m128i*)fx + 0);
+            __m128i fx1 = _mm_loadu_si128((__m128i*)fx + 1);
+            __m128i r00 = _mm_maddubs_epi16(_mm_loadu_si128((__m128i*)src0 + 0), fx0);
+            __m128i r01 = _mm_maddubs_epi16(_mm_loadu_si128((__m128i*)src0 + 1), fx1);
+            __m128i r10 = _mm_maddubs_epi16(_mm_loadu_si128((__m128i*)src1 + 0), fx0);
+            __m128i r11 = _mm_maddubs_epi16(_mm_loadu_si128((__m128i*)src1 + 1), fx1);
+
+            __m128i s0 = _mm_madd_epi16(UnpackU16<0>(r00, r10), _mm_loadu_si128((__m128i*)fy + 0));
+            __m128i d0 = _mm_srli_epi32(_mm_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s1 = _mm_madd_epi16(UnpackU16<1>(r00, r10), _mm_loadu_si128((__m128i*)fy + 1));
+            __m128i d1 = _mm_srli_epi32(_mm_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s2 = _mm_madd_epi16(UnpackU16<0>(r01, r11), _mm_loadu_si128((__m128i*)fy + 2));
+            __m128i d2 = _mm_srli_epi32(_mm_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s3 = _mm_madd_epi16(UnpackU16<1>(r01, r11), _mm_loadu_si128((__m128i*)fy + 3));
+            __m128i d3 = _mm_srli_epi32(_mm_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(_mm_packus_epi32(d0, d1), _mm_packus_epi32(d2, d3)));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<2>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            static const __m128i SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF);
+
+            __m128i _fx = _mm_loadu_si128((__m128i*)fx);
+            __m128i fx0 = UnpackU16<0>(_fx, _fx);
+            __m128i fx1 = UnpackU16<1>(_fx, _fx);
+            __m128i r00 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 0), SHUFFLE), fx0);
+            __m128i r01 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 1), SHUFFLE), fx1);
+            __m128i r10 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 0), SHUFFLE), fx0);
+            __m128i r11 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 1), SHUFFLE), fx1);
+
+            __m128i fy0 = _mm_loadu_si128((__m128i*)fy + 0);
+            __m128i s0 = _mm_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m128i d0 = _mm_srli_epi32(_mm_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s1 = _mm_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m128i d1 = _mm_srli_epi32(_mm_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i fy1 = _mm_loadu_si128((__m128i*)fy + 1);
+            __m128i s2 = _mm_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m128i d2 = _mm_srli_epi32(_mm_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s3 = _mm_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m128i d3 = _mm_srli_epi32(_mm_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(_mm_packus_epi32(d0, d1), _mm_packus_epi32(d2, d3)));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<3>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            static const __m128i SRC_SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1);
+            static const __m128i DST_SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+
+            __m128i _fx = _mm_loadu_si128((__m128i*)fx);
+            _fx = UnpackU16<0>(_fx, _fx);
+            __m128i fx0 = UnpackU16<0>(_fx, _fx);
+            __m128i fx1 = UnpackU16<1>(_fx, _fx);
+            __m128i r00 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 0), SRC_SHUFFLE), fx0);
+            __m128i r01 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 1), SRC_SHUFFLE), fx1);
+            __m128i r10 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 0), SRC_SHUFFLE), fx0);
+            __m128i r11 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 1), SRC_SHUFFLE), fx1);
+
+            __m128i _fy = _mm_loadu_si128((__m128i*)fy);
+            __m128i fy0 = UnpackU32<0>(_fy, _fy);
+            __m128i s0 = _mm_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m128i d0 = _mm_srli_epi32(_mm_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s1 = _mm_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m128i d1 = _mm_srli_epi32(_mm_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i fy1 = UnpackU32<1>(_fy, _fy);
+            __m128i s2 = _mm_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m128i d2 = _mm_srli_epi32(_mm_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s3 = _mm_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m128i d3 = _mm_srli_epi32(_mm_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            Store12(dst, _mm_shuffle_epi8(_mm_packus_epi16(_mm_packus_epi32(d0, d1), _mm_packus_epi32(d2, d3)), DST_SHUFFLE));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<4>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            static const __m128i SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF);
+
+            __m128i _fx = _mm_loadu_si128((__m128i*)fx);
+            _fx = UnpackU16<0>(_fx, _fx);
+            __m128i fx0 = UnpackU16<0>(_fx, _fx);
+            __m128i fx1 = UnpackU16<1>(_fx, _fx);
+            __m128i r00 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 0), SHUFFLE), fx0);
+            __m128i r01 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src0 + 1), SHUFFLE), fx1);
+            __m128i r10 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 0), SHUFFLE), fx0);
+            __m128i r11 = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src1 + 1), SHUFFLE), fx1);
+
+            __m128i _fy = _mm_loadu_si128((__m128i*)fy);
+            __m128i fy0 = UnpackU32<0>(_fy, _fy);
+            __m128i s0 = _mm_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m128i d0 = _mm_srli_epi32(_mm_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s1 = _mm_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m128i d1 = _mm_srli_epi32(_mm_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i fy1 = UnpackU32<1>(_fy, _fy);
+            __m128i s2 = _mm_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m128i d2 = _mm_srli_epi32(_mm_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m128i s3 = _mm_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m128i d3 = _mm_srli_epi32(_mm_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(_mm_packus_epi32(d0, d1), _mm_packus_epi32(d2, d3)));
+        }
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        template<int N> SIMD_INLINE void FillBorder(uint8_t* dst, int count, const __m256i& bv, const uint8_t* bs)
+        {
+            int i = 0, size = count * N, size16 = (int)AlignLo(size, 16), size32 = (int)AlignLo(size, 32);
+            for (; i < size32; i += 32)
+                _mm256_storeu_si256((__m256i*)(dst + i), bv);
+            for (; i < size16; i += 16)
+                _mm_storeu_si128((__m128i*)(dst + i), _mm256_castsi256_si128(bv));
+            for (; i < size; i += N)
+                Base::CopyPixel<N>(bs, dst + i);
+        }
+
+        template<> SIMD_INLINE void FillBorder<3>(uint8_t* dst, int count, const __m256i& bv, const uint8_t* bs)
+        {
+            int i = 0, size = count * 3, size3 = size - 3;
+            for (; i < size3; i += 3)
+                Base::CopyPixel<4>(bs, dst + i);
+            for (; i < size; i += 3)
+                Base::CopyPixel<3>(bs, dst + i);
+        }
+
+        template<> SIMD_INLINE void FillBorder<6>(uint8_t* dst, int count, const __m256i& bv, const uint8_t* bs)
+        {
+            Base::FillBorder<6>(dst, count, bs);
+        }
+
+        template<> SIMD_INLINE void FillBorder<12>(uint8_t* dst, int count, const __m256i& bv, const uint8_t* bs)
+        {
+            Base::FillBorder<12>(dst, count, bs);
+        }
+
+        template<int N> SIMD_INLINE __m256i InitBorder(const uint8_t* border)
+        {
+            switch (N)
+            {
+            case 1: return _mm256_set1_epi8(*border);
+            case 2: return _mm256_set1_epi16(*(uint16_t*)border);
+            case 3: return _mm256_setzero_si256();
+            case 4: return _mm256_set1_epi32(*(uint32_t*)border);
+            case 8: return _mm256_set1_epi64x(*(int64_t*)border);
+            case 16: return _mm256_broadcastsi128_si256(_mm_loadu_si128((__m128i*)border));
+            }
+            return _mm256_setzero_si256();
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<int N, bool soft> SIMD_INLINE void NearestGather(const uint8_t* src, const uint32_t* offset, int count, uint8_t* dst)
+        {
+            int i = 0;
+            for (; i < count; i++, dst += N)
+                Base::CopyPixel<N>(src + offset[i], dst);
+        }
+
+        template<> SIMD_INLINE void NearestGather<3, true>(const uint8_t* src, const uint32_t* offset, int count, uint8_t* dst)
+        {
+            int i = 0, count1 = count - 1;
+            for (; i < count1; i++, dst += 3)
+                Base::CopyPixel<4>(src + offset[i], dst);
+            if (i < count)
+                Base::CopyPixel<3>(src + offset[i], dst);
+        }
+
+        template<> SIMD_INLINE void NearestGather<1, false>(const uint8_t* src, const uint32_t* offset, int count, uint8_t* dst)
+        {
+            static const __m256i SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x0, 0x4, 0x8, 0xC, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                0x0, 0x4, 0x8, 0xC, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+            static const __m256i PERMUTE = SIMD_MM256_SETR_EPI32(0, 4, 0, 0, 0, 0, 0, 0);
+            int i = 0, count8 = (int)AlignLo(count, 8);
+            for (; i < count8; i += 8, dst += 8)
+            {
+                __m256i _offs = _mm256_loadu_si256((__m256i*)(offset + i));
+                __m256i _dst = _mm256_i32gather_epi32((int*)src, _offs, 1);
+                _dst = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(_dst, SHUFFLE), PERMUTE);
+                Sse41::StoreHalf<false>((__m128i*)dst, _mm256_castsi256_si128(_dst));
+            }
+            for (; i < count; i++, dst += 1)
+                Base::CopyPixel<1>(src + offset[i], dst);
+        }
+
+        template<> SIMD_INLINE void NearestGather<2, false>(const uint8_t* src, const uint32_t* offset, int count, uint8_t* dst)
+        {
+            static const __m256i SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1,
+                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1);
+            int i = 0, count8 = (int)AlignLo(count, 8);
+            for (; i < count8; i += 8, dst += 16)
+            {
+                __m256i _offs = _mm256_loadu_si256((__m256i*)(offset + i));
+                __m256i _dst = _mm256_i32gather_epi32((int*)src, _offs, 1);
+                _dst = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(_dst, SHUFFLE), 0x08);
+                Sse41::Store<false>((__m128i*)dst, _mm256_castsi256_si128(_dst));
+            }
+            for (; i < count; i++, dst += 2)
+                Base::CopyPixel<2>(src + offset[i], dst);
+        }
+
+        template<> SIMD_INLINE void NearestGather<3, false>(const uint8_t* src, const uint32_t* offset, int count, uint8_t* dst)
+        {
+            static const __m256i SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+            static const __m256i PERMUTE = SIMD_MM256_SETR_EPI32(0, 1, 2, 4, 5, 6, 0, 0);
+            int i = 0, count8 = (int)AlignLo(count, 8), count1 = count - 1;
+            for (; i < count8; i += 8, dst += 24)
+            {
+                __m256i _offs = _mm256_loadu_si256((__m256i*)(offset + i));
+                __m256i _dst = _mm256_i32gather_epi32((int*)src, _offs, 1);
+                _dst = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(_dst, SHUFFLE), PERMUTE);
+                Store24<false>(dst, _dst);
+            }
+            for (; i < count1; i++, dst += 3)
+                Base::CopyPixel<4>(src + offset[i], dst);
+            if (i < count)
+                Base::CopyPixel<3>(src + offset[i], dst);
+        }
+
+        template<> SIMD_INLINE void NearestGather<4, false>(const uint8_t* src, const uint32_t* offset, int count, uint8_t* dst)
+        {
+            int i = 0, count8 = (int)AlignLo(count, 8);
+            for (; i < count8; i += 8, dst += 32)
+            {
+                __m256i _offs = _mm256_loadu_si256((__m256i*)(offset + i));
+                __m256i _dst = _mm256_i32gather_epi32((int*)src, _offs, 1);
+                _mm256_storeu_si256((__m256i*)dst, _dst);
+            }
+            for (; i < count; i++, dst += 4)
+                Base::CopyPixel<4>(src + offset[i], dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<int N, bool soft> SIMD_INLINE void ByteBilinearGather(const uint8_t* src0, const uint8_t* src1, const uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
+        {
+            int i = 0;
+            for (; i < count; i++, dst0 += 2 * N, dst1 += 2 * N)
+            {
+                int offs = offset[i];
+                Base::CopyPixel<N * 2>(src0 + offs, dst0);
+                Base::CopyPixel<N * 2>(src1 + offs, dst1);
+            }
+        }
+
+        template<> SIMD_INLINE void ByteBilinearGather<1, false>(const uint8_t* src0, const uint8_t* src1, const uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
+        {
+            static const __m256i SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1,
+                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1);
+            int i = 0, count8 = (int)AlignLo(count, 8);
+            for (; i < count8; i += 8, dst0 += 16, dst1 += 16)
+            {
+                __m256i _offs = _mm256_loadu_si256((__m256i*)(offset + i));
+                __m256i _dst0 = _mm256_shuffle_epi8(_mm256_i32gather_epi32((int*)src0, _offs, 1), SHUFFLE);
+                _mm_storeu_si128((__m128i*)dst0, _mm256_castsi256_si128(_mm256_permute4x64_epi64(_dst0, 0x08)));
+                __m256i _dst1 = _mm256_shuffle_epi8(_mm256_i32gather_epi32((int*)src1, _offs, 1), SHUFFLE);
+                _mm_storeu_si128((__m128i*)dst1, _mm256_castsi256_si128(_mm256_permute4x64_epi64(_dst1, 0x08)));
+            }
+            for (; i < count; i++, dst0 += 2, dst1 += 2)
+            {
+                int offs = offset[i];
+                Base::CopyPixel<2>(src0 + offs, dst0);
+                Base::CopyPixel<2>(src1 + offs, dst1);
+            }
+        }
+
+        template<> SIMD_INLINE void ByteBilinearGather<2, false>(const uint8_t* src0, const uint8_t* src1, const uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
+        {
+            int i = 0, count8 = (int)AlignLo(count, 8);
+            for (; i < count8; i += 8, dst0 += 32, dst1 += 32)
+            {
+                __m256i _offs = _mm256_loadu_si256((__m256i*)(offset + i));
+                _mm256_storeu_si256((__m256i*)dst0, _mm256_i32gather_epi32((int*)src0, _offs, 1));
+                _mm256_storeu_si256((__m256i*)dst1, _mm256_i32gather_epi32((int*)src1, _offs, 1));
+            }
+            for (; i < count; i++, dst0 += 4, dst1 += 4)
+            {
+                int offs = offset[i];
+                Base::CopyPixel<4>(src0 + offs, dst0);
+                Base::CopyPixel<4>(src1 + offs, dst1);
+            }
+        }
+
+        template<> SIMD_INLINE void ByteBilinearGather<4, false>(const uint8_t* src0, const uint8_t* src1, const uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
+        {
+            int i = 0, count4 = (int)AlignLo(count, 4);
+            for (; i < count4; i += 4, dst0 += 32, dst1 += 32)
+            {
+                __m128i _offs = _mm_loadu_si128((__m128i*)(offset + i));
+                _mm256_storeu_si256((__m256i*)dst0, _mm256_i32gather_epi64((long long*)src0, _offs, 1));
+                _mm256_storeu_si256((__m256i*)dst1, _mm256_i32gather_epi64((long long*)src1, _offs, 1));
+            }
+            for (; i < count; i++, dst0 += 8, dst1 += 8)
+            {
+                int offs = offset[i];
+                Base::CopyPixel<8>(src0 + offs, dst0);
+                Base::CopyPixel<8>(src1 + offs, dst1);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        const __m256i K32_WA_FRACTION_RANGE = SIMD_MM256_SET1_EPI32(Base::WA_FRACTION_RANGE);
+
+        const __m256i K32_WA_BILINEAR_ROUND_TERM = SIMD_MM256_SET1_EPI32(Base::WA_BILINEAR_ROUND_TERM);
+
+        template<int N> void ByteBilinearInterpMainN(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst);
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<1>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            __m256i fx0 = _mm256_loadu_si256((__m256i*)fx + 0);
+            __m256i fx1 = _mm256_loadu_si256((__m256i*)fx + 1);
+            __m256i r00 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)src0 + 0), fx0);
+            __m256i r01 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)src0 + 1), fx1);
+            __m256i r10 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)src1 + 0), fx0);
+            __m256i r11 = _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)src1 + 1), fx1);
+
+            __m256i s0 = _mm256_madd_epi16(UnpackU16<0>(r00, r10), Load<false>((__m128i*)fy + 0, (__m128i*)fy + 2));
+            __m256i d0 = _mm256_srli_epi32(_mm256_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s1 = _mm256_madd_epi16(UnpackU16<1>(r00, r10), Load<false>((__m128i*)fy + 1, (__m128i*)fy + 3));
+            __m256i d1 = _mm256_srli_epi32(_mm256_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s2 = _mm256_madd_epi16(UnpackU16<0>(r01, r11), Load<false>((__m128i*)fy + 4, (__m128i*)fy + 6));
+            __m256i d2 = _mm256_srli_epi32(_mm256_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s3 = _mm256_madd_epi16(UnpackU16<1>(r01, r11), Load<false>((__m128i*)fy + 5, (__m128i*)fy + 7));
+            __m256i d3 = _mm256_srli_epi32(_mm256_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            _mm256_storeu_si256((__m256i*)dst, PackI16ToU8(_mm256_packus_epi32(d0, d1), _mm256_packus_epi32(d2, d3)));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<2>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            static const __m256i SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF,
+                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF);
+
+            __m256i _fx = LoadPermuted<false>((__m256i*)fx);
+            __m256i fx0 = UnpackU16<0>(_fx, _fx);
+            __m256i fx1 = UnpackU16<1>(_fx, _fx);
+            __m256i r00 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 0), SHUFFLE), fx0);
+            __m256i r01 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 1), SHUFFLE), fx1);
+            __m256i r10 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 0), SHUFFLE), fx0);
+            __m256i r11 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 1), SHUFFLE), fx1);
+
+            __m256i fy0 = _mm256_loadu_si256((__m256i*)fy + 0);
+            __m256i s0 = _mm256_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m256i d0 = _mm256_srli_epi32(_mm256_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s1 = _mm256_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m256i d1 = _mm256_srli_epi32(_mm256_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i fy1 = _mm256_loadu_si256((__m256i*)fy + 1);
+            __m256i s2 = _mm256_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m256i d2 = _mm256_srli_epi32(_mm256_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s3 = _mm256_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m256i d3 = _mm256_srli_epi32(_mm256_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            _mm256_storeu_si256((__m256i*)dst, PackI16ToU8(_mm256_packus_epi32(d0, d1), _mm256_packus_epi32(d2, d3)));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<3>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            static const __m256i SRC_SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1,
+                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1);
+            static const __m256i DST_SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+            static const __m256i DST_PERMUTE = SIMD_MM256_SETR_EPI32(0, 1, 2, 4, 5, 6, 0, 0);
+
+            __m256i _fx = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((__m256i*)fx), K32_TWO_UNPACK_PERMUTE);
+            _fx = UnpackU16<0>(_fx, _fx);
+            __m256i fx0 = UnpackU16<0>(_fx, _fx);
+            __m256i fx1 = UnpackU16<1>(_fx, _fx);
+            __m256i r00 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 0), SRC_SHUFFLE), fx0);
+            __m256i r01 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 1), SRC_SHUFFLE), fx1);
+            __m256i r10 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 0), SRC_SHUFFLE), fx0);
+            __m256i r11 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 1), SRC_SHUFFLE), fx1);
+
+            __m256i _fy = LoadPermuted<false>((__m256i*)fy);
+            __m256i fy0 = UnpackU32<0>(_fy, _fy);
+            __m256i s0 = _mm256_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m256i d0 = _mm256_srli_epi32(_mm256_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s1 = _mm256_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m256i d1 = _mm256_srli_epi32(_mm256_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i fy1 = UnpackU32<1>(_fy, _fy);
+            __m256i s2 = _mm256_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m256i d2 = _mm256_srli_epi32(_mm256_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s3 = _mm256_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m256i d3 = _mm256_srli_epi32(_mm256_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i _dst = PackI16ToU8(_mm256_packus_epi32(d0, d1), _mm256_packus_epi32(d2, d3));
+            Store24<false>(dst, _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(_dst, DST_SHUFFLE), DST_PERMUTE));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<4>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst)
+        {
+            static const __m256i SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF,
+                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF);
+
+            __m256i _fx = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((__m256i*)fx), K32_TWO_UNPACK_PERMUTE);
+            _fx = UnpackU16<0>(_fx, _fx);
+            __m256i fx0 = UnpackU16<0>(_fx, _fx);
+            __m256i fx1 = UnpackU16<1>(_fx, _fx);
+            __m256i r00 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 0), SHUFFLE), fx0);
+            __m256i r01 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src0 + 1), SHUFFLE), fx1);
+            __m256i r10 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 0), SHUFFLE), fx0);
+            __m256i r11 = _mm256_maddubs_epi16(_mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)src1 + 1), SHUFFLE), fx1);
+
+            __m256i _fy = LoadPermuted<false>((__m256i*)fy);
+            __m256i fy0 = UnpackU32<0>(_fy, _fy);
+            __m256i s0 = _mm256_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m256i d0 = _mm256_srli_epi32(_mm256_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s1 = _mm256_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m256i d1 = _mm256_srli_epi32(_mm256_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i fy1 = UnpackU32<1>(_fy, _fy);
+            __m256i s2 = _mm256_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m256i d2 = _mm256_srli_epi32(_mm256_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m256i s3 = _mm256_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m256i d3 = _mm256_srli_epi32(_mm256_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            _mm256_storeu_si256((__m256i*)dst, PackI16ToU8(_mm256_packus_epi32(d0, d1), _mm256_packus_epi32(d2, d3)));
+        }
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        template<int N> SIMD_INLINE void FillBorder(uint8_t* dst, int count, const __m512i& bv, const uint8_t* bs)
+        {
+            int i = 0, size = count * N, size64 = (int)AlignLo(size, 64);
+            for (; i < size64; i += 64)
+                _mm512_storeu_si512((__m512i*)(dst + i), bv);
+            if (i < size)
+            {
+                __mmask64 mask = TailMask64(size - size64);
+                _mm512_mask_storeu_epi8(dst + i, mask, bv);
+            }
+        }
+
+        template<> SIMD_INLINE void FillBorder<3>(uint8_t* dst, int count, const __m512i& bv, const uint8_t* bs)
+        {
+            int i = 0, size = count * 3, size3 = size - 3;
+            for (; i < size3; i += 3)
+                Base::CopyPixel<4>(bs, dst + i);
+            for (; i < size; i += 3)
+                Base::CopyPixel<3>(bs, dst + i);
+        }
+
+        template<> SIMD_INLINE void FillBorder<6>(uint8_t* dst, int count, const __m512i& bv, const uint8_t* bs)
+        {
+            Base::FillBorder<6>(dst, count, bs);
+        }
+
+        template<> SIMD_INLINE void FillBorder<12>(uint8_t* dst, int count, const __m512i& bv, const uint8_t* bs)
+        {
+            Base::FillBorder<12>(dst, count, bs);
+        }
+
+        template<int N> SIMD_INLINE __m512i InitBorder(const uint8_t* border)
+        {
+            switch (N)
+            {
+            case 1: return _mm512_set1_epi8(*border);
+            case 2: return _mm512_set1_epi16(*(uint16_t*)border);
+            case 3: return _mm512_setzero_si512();
+            case 4: return _mm512_set1_epi32(*(uint32_t*)border);
+            case 8: return _mm512_set1_epi64(*(int64_t*)border);
+            case 16: return _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i*)border));
+            }
+            return _mm512_setzero_si512();
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<int N, bool soft> SIMD_INLINE void NearestGather(const uint8_t* src, const uint32_t* offset, int count, uint8_t* dst)
+        {
+            int i = 0;
+            for (; i < count; i++, dst += N)
+                Base::CopyPixel<N>(src + offset[i], dst);
+        }
+
+        template<> SIMD_INLINE void NearestGather<3, true>(const uint8_t* src, const uint32_t* offset, int count, uint8_t* dst)
+        {
+            int i = 0, count1 = count - 1;
+            for (; i < count1; i++, dst += 3)
+                Base::CopyPixel<4>(src + offset[i], dst);
+            if (i < count)
+                Base::CopyPixel<3>(src + offset[i], dst);
+        }
+
+        template<> SIMD_INLINE void NearestGather<1, false>(const uint8_t* src, const uint32_t* offset, int count, uint8_t* dst)
+        {
+            static const __m512i SHUFFLE = SIMD_MM512_SETR_EPI8(
+                0x0, 0x4, 0x8, 0xC, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                0x0, 0x4, 0x8, 0xC, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                0x0, 0x4, 0x8, 0xC, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 
+                0x0, 0x4, 0x8, 0xC, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+            static const __m512i PERMUTE = SIMD_MM512_SETR_EPI32(0x0, 0x4, 0x8, 0xC, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+            int i = 0, count16 = (int)AlignLo(count, 16);
+            for (; i < count16; i += 16, dst += 16)
+            {
+                __m512i _offs = _mm512_loadu_si512((__m512i*)(offset + i));
+                __m512i _dst = _mm512_i32gather_epi32(_offs, src, 1);
+                _dst = _mm512_permutexvar_epi32(PERMUTE, _mm512_shuffle_epi8(_dst, SHUFFLE));
+                _mm_storeu_si128((__m128i*)dst, _mm512_castsi512_si128(_dst));
+            }
+            if(i < count)
+            {
+                __mmask16 mask = TailMask16(count - count16);
+                __m512i _offs = _mm512_maskz_loadu_epi32(mask, offset + i);
+                __m512i _dst = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, _offs, src, 1);
+                _dst = _mm512_permutexvar_epi32(PERMUTE, _mm512_shuffle_epi8(_dst, SHUFFLE));
+                _mm_mask_storeu_epi8(dst, mask, _mm512_castsi512_si128(_dst));
+            }
+        }
+
+        template<> SIMD_INLINE void NearestGather<2, false>(const uint8_t* src, const uint32_t* offset, int count, uint8_t* dst)
+        {
+            static const __m512i SHUFFLE = SIMD_MM512_SETR_EPI8(
+                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1,
+                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1,
+                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1,
+                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1);
+            static const __m512i PERMUTE = SIMD_MM512_SETR_EPI64(0x0, 0x2, 0x4, 0x6, 0, 0, 0, 0);
+            int i = 0, count16 = (int)AlignLo(count, 16);
+            for (; i < count16; i += 16, dst += 32)
+            {
+                __m512i _offs = _mm512_loadu_si512((__m512i*)(offset + i));
+                __m512i _dst = _mm512_i32gather_epi32(_offs, src, 1);
+                _dst = _mm512_permutexvar_epi64(PERMUTE, _mm512_shuffle_epi8(_dst, SHUFFLE));
+                _mm256_storeu_si256((__m256i*)dst, _mm512_castsi512_si256(_dst));
+            }
+            if (i < count)
+            {
+                __mmask16 mask = TailMask16(count - count16);
+                __m512i _offs = _mm512_maskz_loadu_epi32(mask, offset + i);
+                __m512i _dst = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, _offs, src, 1);
+                _dst = _mm512_permutexvar_epi64(PERMUTE, _mm512_shuffle_epi8(_dst, SHUFFLE));
+                _mm256_mask_storeu_epi16(dst, mask, _mm512_castsi512_si256(_dst));
+            }
+        }
+
+        template<> SIMD_INLINE void NearestGather<3, false>(const uint8_t* src, const uint32_t* offset, int count, uint8_t* dst)
+        {
+            static const __m512i SHUFFLE = SIMD_MM512_SETR_EPI8(
+                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+            static const __m512i PERMUTE = SIMD_MM512_SETR_EPI32(0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, 0, 0, 0, 0);
+            int i = 0, count16 = (int)AlignLo(count, 16);
+            for (; i < count16; i += 16, dst += 48)
+            {
+                __m512i _offs = _mm512_loadu_si512((__m512i*)(offset + i));
+                __m512i _dst = _mm512_i32gather_epi32(_offs, src, 1);
+                _dst = _mm512_permutexvar_epi32(PERMUTE, _mm512_shuffle_epi8(_dst, SHUFFLE));
+                _mm512_mask_storeu_epi8(dst, 0x0000FFFFFFFFFFFF, _dst);
+            }
+            if (i < count)
+            {
+                __mmask16 srcMask = TailMask16(count - count16);
+                __mmask64 dstMask = TailMask64((count - count16) * 3);
+                __m512i _offs = _mm512_maskz_loadu_epi32(srcMask, offset + i);
+                __m512i _dst = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), srcMask, _offs, src, 1);
+                _dst = _mm512_permutexvar_epi32(PERMUTE, _mm512_shuffle_epi8(_dst, SHUFFLE));
+                _mm512_mask_storeu_epi8(dst, dstMask, _dst);
+            }
+        }
+
+        template<> SIMD_INLINE void NearestGather<4, false>(const uint8_t* src, const uint32_t* offset, int count, uint8_t* dst)
+        {
+            int i = 0, count16 = (int)AlignLo(count, 16);
+            for (; i < count16; i += 16, dst += 64)
+            {
+                __m512i _offs = _mm512_loadu_si512((__m512i*)(offset + i));
+                __m512i _dst = _mm512_i32gather_epi32(_offs, src, 1);
+                _mm512_storeu_si512((__m512i*)dst, _dst);
+            }
+            if (i < count)
+            {
+                __mmask16 mask = TailMask16(count - count16);
+                __m512i _offs = _mm512_maskz_loadu_epi32(mask, offset + i);
+                __m512i _dst = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, _offs, src, 1);
+                _mm512_mask_storeu_epi32(dst, mask, _dst);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        const __m512i K32_WA_FRACTION_RANGE = SIMD_MM512_SET1_EPI32(Base::WA_FRACTION_RANGE);
+
+        const __m512i K32_WA_BILINEAR_ROUND_TERM = SIMD_MM512_SET1_EPI32(Base::WA_BILINEAR_ROUND_TERM);
+
+        template<int N, bool soft> SIMD_INLINE void ByteBilinearGather(const uint8_t* src0, const uint8_t* src1, const uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
+        {
+            int i = 0;
+            for (; i < count; i++, dst0 += 2 * N, dst1 += 2 * N)
+            {
+                int offs = offset[i];
+                Base::CopyPixel<N * 2>(src0 + offs, dst0);
+                Base::CopyPixel<N * 2>(src1 + offs, dst1);
+            }
+        }
+
+        template<> SIMD_INLINE void ByteBilinearGather<1, false>(const uint8_t* src0, const uint8_t* src1, const uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
+        {
+            static const __m512i SHUFFLE = SIMD_MM512_SETR_EPI8(
+                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1,
+                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1,
+                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1,
+                0x0, 0x1, 0x4, 0x5, 0x8, 0x9, 0xC, 0xD, -1, -1, -1, -1, -1, -1, -1, -1);
+            static const __m512i PERMUTE = SIMD_MM512_SETR_EPI64(0x0, 0x2, 0x4, 0x6, 0, 0, 0, 0);
+            int i = 0, count16 = (int)AlignLo(count, 16);
+            for (; i < count16; i += 16, dst0 += 32, dst1 += 32)
+            {
+                __m512i _offs = _mm512_loadu_si512((__m512i*)(offset + i));
+                __m512i _dst0 = _mm512_shuffle_epi8(_mm512_i32gather_epi32(_offs, src0, 1), SHUFFLE);
+                _mm256_storeu_si256((__m256i*)dst0, _mm512_castsi512_si256(_mm512_permutexvar_epi64(PERMUTE, _dst0)));
+                __m512i _dst1 = _mm512_shuffle_epi8(_mm512_i32gather_epi32(_offs, src1, 1), SHUFFLE);
+                _mm256_storeu_si256((__m256i*)dst1, _mm512_castsi512_si256(_mm512_permutexvar_epi64(PERMUTE, _dst1)));
+            }
+            if (i < count)
+            {
+                __mmask16 mask = __mmask16(-1) >> (16 + count16 - count);
+                __m512i _offs = _mm512_maskz_loadu_epi32(mask, offset + i);
+                __m512i _dst0 = _mm512_shuffle_epi8(_mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, _offs, src0, 1), SHUFFLE);
+                _mm256_mask_storeu_epi16(dst0, mask, _mm512_castsi512_si256(_mm512_permutexvar_epi64(PERMUTE, _dst0)));
+                __m512i _dst1 = _mm512_shuffle_epi8(_mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, _offs, src1, 1), SHUFFLE);
+                _mm256_mask_storeu_epi16(dst1, mask, _mm512_castsi512_si256(_mm512_permutexvar_epi64(PERMUTE, _dst1)));
+            }
+        }
+
+        template<> SIMD_INLINE void ByteBilinearGather<2, false>(const uint8_t* src0, const uint8_t* src1, const uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
+        {
+            int i = 0, count16 = (int)AlignLo(count, 16);
+            for (; i < count16; i += 16, dst0 += 64, dst1 += 64)
+            {
+                __m512i _offs = _mm512_loadu_si512((__m512i*)(offset + i));
+                _mm512_storeu_si512((__m512i*)dst0, _mm512_i32gather_epi32(_offs, src0, 1));
+                _mm512_storeu_si512((__m512i*)dst1, _mm512_i32gather_epi32(_offs, src1, 1));
+            }
+            if(i < count)
+            {
+                __mmask16 mask = __mmask16(-1) >> (16 + count16 - count);
+                __m512i _offs = _mm512_maskz_loadu_epi32(mask, offset + i);
+                _mm512_mask_storeu_epi32(dst0, mask, _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, _offs, src0, 1));
+                _mm512_mask_storeu_epi32(dst1, mask, _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, _offs, src1, 1));
+            }
+        }
+
+        template<> SIMD_INLINE void ByteBilinearGather<4, false>(const uint8_t* src0, const uint8_t* src1, const uint32_t* offset, int count, uint8_t* dst0, uint8_t* dst1)
+        {
+            int i = 0, count8 = (int)AlignLo(count, 8);
+            for (; i < count8; i += 8, dst0 += 64, dst1 += 64)
+            {
+                __m256i _offs = _mm256_loadu_si256((__m256i*)(offset + i));
+                _mm512_storeu_si512((__m512i*)dst0, _mm512_i32gather_epi64(_offs, src0, 1));
+                _mm512_storeu_si512((__m512i*)dst1, _mm512_i32gather_epi64(_offs, src1, 1));
+            }
+            if (i < count)
+            {
+                __mmask8 mask = __mmask8(-1) >> (8 + count8 - count);
+                __m256i _offs = _mm256_maskz_loadu_epi32(mask, offset + i);
+                _mm512_mask_storeu_epi64(dst0, mask, _mm512_mask_i32gather_epi64(_mm512_setzero_si512(), mask, _offs, src0, 1));
+                _mm512_mask_storeu_epi64(dst1, mask, _mm512_mask_i32gather_epi64(_mm512_setzero_si512(), mask, _offs, src1, 1));
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<int N> void ByteBilinearInterpMainN(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst, int count);
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<1>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst, int count)
+        {
+            __m512i fx0 = _mm512_loadu_si512((__m512i*)fx + 0);
+            __m512i fx1 = _mm512_loadu_si512((__m512i*)fx + 1);
+            __m512i r00 = _mm512_maddubs_epi16(_mm512_loadu_si512((__m512i*)src0 + 0), fx0);
+            __m512i r01 = _mm512_maddubs_epi16(_mm512_loadu_si512((__m512i*)src0 + 1), fx1);
+            __m512i r10 = _mm512_maddubs_epi16(_mm512_loadu_si512((__m512i*)src1 + 0), fx0);
+            __m512i r11 = _mm512_maddubs_epi16(_mm512_loadu_si512((__m512i*)src1 + 1), fx1);
+
+            __m512i s0 = _mm512_madd_epi16(UnpackU16<0>(r00, r10), Load<false>((__m128i*)fy + 0x0, (__m128i*)fy + 0x2, (__m128i*)fy + 0x4, (__m128i*)fy + 0x6));
+            __m512i d0 = _mm512_srli_epi32(_mm512_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m512i s1 = _mm512_madd_epi16(UnpackU16<1>(r00, r10), Load<false>((__m128i*)fy + 0x1, (__m128i*)fy + 0x3, (__m128i*)fy + 0x5, (__m128i*)fy + 0x7));
+            __m512i d1 = _mm512_srli_epi32(_mm512_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m512i s2 = _mm512_madd_epi16(UnpackU16<0>(r01, r11), Load<false>((__m128i*)fy + 0x8, (__m128i*)fy + 0xA, (__m128i*)fy + 0xC, (__m128i*)fy + 0xE));
+            __m512i d2 = _mm512_srli_epi32(_mm512_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m512i s3 = _mm512_madd_epi16(UnpackU16<1>(r01, r11), Load<false>((__m128i*)fy + 0x9, (__m128i*)fy + 0xB, (__m128i*)fy + 0xD, (__m128i*)fy + 0xF));
+            __m512i d3 = _mm512_srli_epi32(_mm512_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __mmask64 mask = __mmask64(-1) >> (64 - count * 1);
+            _mm512_mask_storeu_epi8(dst, mask, PackI16ToU8(_mm512_packus_epi32(d0, d1), _mm512_packus_epi32(d2, d3)));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<2>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst, int count)
+        {
+            static const __m512i SHUFFLE = SIMD_MM512_SETR_EPI8(
+                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF,
+                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF,
+                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF,
+                0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF);
+
+            __m512i _fx = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, _mm512_loadu_si512((__m512i*)fx));
+            __m512i fx0 = UnpackU16<0>(_fx, _fx);
+            __m512i fx1 = UnpackU16<1>(_fx, _fx);
+            __m512i r00 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src0 + 0), SHUFFLE), fx0);
+            __m512i r01 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src0 + 1), SHUFFLE), fx1);
+            __m512i r10 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src1 + 0), SHUFFLE), fx0);
+            __m512i r11 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src1 + 1), SHUFFLE), fx1);
+
+            __m512i fy0 = _mm512_loadu_si512((__m512i*)fy + 0);
+            __m512i s0 = _mm512_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m512i d0 = _mm512_srli_epi32(_mm512_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m512i s1 = _mm512_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m512i d1 = _mm512_srli_epi32(_mm512_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m512i fy1 = _mm512_loadu_si512((__m512i*)fy + 1);
+            __m512i s2 = _mm512_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m512i d2 = _mm512_srli_epi32(_mm512_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m512i s3 = _mm512_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m512i d3 = _mm512_srli_epi32(_mm512_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __mmask64 mask = __mmask64(-1) >> (64 - count * 2);
+            _mm512_mask_storeu_epi8(dst, mask, PackI16ToU8(_mm512_packus_epi32(d0, d1), _mm512_packus_epi32(d2, d3)));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<3>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst, int count)
+        {
+            static const __m512i SRC_SHUFFLE = SIMD_MM512_SETR_EPI8(
+                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1,
+                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1,
+                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1,
+                0x0, 0x3, 0x1, 0x4, 0x2, 0x5, -1, -1, 0x8, 0xB, 0x9, 0xC, 0xA, 0xD, -1, -1);
+            static const __m512i DST_SHUFFLE = SIMD_MM512_SETR_EPI8(
+                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+                0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+            static const __m512i DST_PERMUTE = SIMD_MM512_SETR_EPI32(0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, 0x0, 0x0, 0x0, 0x0);
+
+            __m512i _fx = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, _mm512_loadu_si512((__m512i*)fx));
+            _fx = UnpackU16<0>(_fx, _fx);
+            __m512i fx0 = UnpackU16<0>(_fx, _fx);
+            __m512i fx1 = UnpackU16<1>(_fx, _fx);
+            __m512i r00 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src0 + 0), SRC_SHUFFLE), fx0);
+            __m512i r01 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src0 + 1), SRC_SHUFFLE), fx1);
+            __m512i r10 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src1 + 0), SRC_SHUFFLE), fx0);
+            __m512i r11 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src1 + 1), SRC_SHUFFLE), fx1);
+
+            __m512i _fy = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, _mm512_loadu_si512((__m512i*)fy));
+            __m512i fy0 = UnpackU32<0>(_fy, _fy);
+            __m512i s0 = _mm512_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m512i d0 = _mm512_srli_epi32(_mm512_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m512i s1 = _mm512_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m512i d1 = _mm512_srli_epi32(_mm512_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m512i fy1 = UnpackU32<1>(_fy, _fy);
+            __m512i s2 = _mm512_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m512i d2 = _mm512_srli_epi32(_mm512_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m512i s3 = _mm512_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m512i d3 = _mm512_srli_epi32(_mm512_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __mmask64 mask = __mmask64(-1) >> (64 - count * 3);
+            __m512i _dst = PackI16ToU8(_mm512_packus_epi32(d0, d1), _mm512_packus_epi32(d2, d3));
+            _mm512_mask_storeu_epi8(dst, mask, _mm512_permutexvar_epi32(DST_PERMUTE, _mm512_shuffle_epi8(_dst, DST_SHUFFLE)));
+        }
+
+        template<> SIMD_INLINE void ByteBilinearInterpMainN<4>(const uint8_t* src0, const uint8_t* src1, const uint8_t* fx, const uint16_t* fy, uint8_t* dst, int count)
+        {
+            static const __m512i SHUFFLE = SIMD_MM512_SETR_EPI8(
+                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF,
+                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF,
+                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF,
+                0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF);
+
+            __m512i _fx = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, _mm512_loadu_si512((__m512i*)fx));
+            _fx = UnpackU16<0>(_fx, _fx);
+            __m512i fx0 = UnpackU16<0>(_fx, _fx);
+            __m512i fx1 = UnpackU16<1>(_fx, _fx);
+            __m512i r00 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src0 + 0), SHUFFLE), fx0);
+            __m512i r01 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src0 + 1), SHUFFLE), fx1);
+            __m512i r10 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src1 + 0), SHUFFLE), fx0);
+            __m512i r11 = _mm512_maddubs_epi16(_mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src1 + 1), SHUFFLE), fx1);
+
+            __m512i _fy = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, _mm512_loadu_si512((__m512i*)fy));
+            __m512i fy0 = UnpackU32<0>(_fy, _fy);
+            __m512i s0 = _mm512_madd_epi16(UnpackU16<0>(r00, r10), UnpackU32<0>(fy0, fy0));
+            __m512i d0 = _mm512_srli_epi32(_mm512_add_epi32(s0, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m512i s1 = _mm512_madd_epi16(UnpackU16<1>(r00, r10), UnpackU32<1>(fy0, fy0));
+            __m512i d1 = _mm512_srli_epi32(_mm512_add_epi32(s1, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m512i fy1 = UnpackU32<1>(_fy, _fy);
+            __m512i s2 = _mm512_madd_epi16(UnpackU16<0>(r01, r11), UnpackU32<0>(fy1, fy1));
+            __m512i d2 = _mm512_srli_epi32(_mm512_add_epi32(s2, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __m512i s3 = _mm512_madd_epi16(UnpackU16<1>(r01, r11), UnpackU32<1>(fy1, fy1));
+            __m512i d3 = _mm512_srli_epi32(_mm512_add_epi32(s3, K32_WA_BILINEAR_ROUND_TERM), Base::WA_BILINEAR_SHIFT);
+
+            __mmask64 mask = __mmask64(-1) >> (64 - count * 4);
+            _mm512_mask_storeu_epi8(dst, mask, PackI16ToU8(_mm512_packus_epi32(d0, d1), _mm512_packus_epi32(d2, d3)));
+        }
     }
 #endif
 }
@@ -0,0 +1,218 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdWarpPerspective_h__
+#define __SimdWarpPerspective_h__
+
+#include "Simd/SimdWarpAffine.h"
+
+namespace Simd
+{
+    struct WarpPersParam
+    {
+        static const int BorderSizeMax = 4 * 1;
+
+        SimdWarpAffineFlags flags;
+        float mat[9], inv[9];
+        uint8_t border[BorderSizeMax];
+        size_t srcW, srcH, srcS, dstW, dstH, dstS, channels, align;
+
+        WarpPersParam(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border, size_t align);
+
+        bool Valid() const
+        {
+            return channels >= 1 && channels <= 4 && srcH * srcS <= 0x100000000 &&
+                (SimdWarpAffineChannelMask & flags) == SimdWarpAffineChannelByte &&
+                ((flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpNearest || (flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpBilinear) &&
+                (inv[6] != 0.0f || inv[7] != 0.0f || inv[8] != 0.0f);
+        }
+
+        bool IsNearest() const
+        {
+            return (flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpNearest;
+        }
+
+        bool IsByteBilinear() const
+        {
+            return (flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpBilinear && (SimdWarpAffineChannelMask & flags) == SimdWarpAffineChannelByte;
+        }
+
+        bool NeedFill() const
+        {
+            return (flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderConstant;
+        }
+
+        size_t ChannelSize() const
+        {
+            switch (SimdWarpAffineChannelMask & flags)
+            {
+            case SimdWarpAffineChannelByte: return 1;
+            default:
+                return 0;
+            }
+        }
+
+        size_t PixelSize() const
+        {
+            return ChannelSize() * channels;
+        }
+
+        size_t CoordStride() const
+        {
+            return AlignHi(dstW, align) + align;
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class WarpPerspective : Deletable
+    {
+    public:
+        WarpPerspective(const WarpPersParam& param);
+
+        virtual void Run(const uint8_t* src, uint8_t* dst) = 0;
+
+    protected:
+        void InitCoords();
+
+        WarpPersParam _param;
+        bool _first;
+        size_t _size, _threads;
+        Array8u _buf;
+        Array32f _coords;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        class WarpPerspectiveNearest : public WarpPerspective
+        {
+        public:
+            typedef void(*RunPtr)(const WarpPersParam& p, int yBeg, int yEnd, const float* cx, const float* cy, const int32_t* beg, const int32_t* end, const uint8_t* src, uint8_t* dst, uint32_t* offs);
+
+            WarpPerspectiveNearest(const WarpPersParam& param);
+
+            virtual void Run(const uint8_t* src, uint8_t* dst);
+
+        protected:
+            void Init();
+
+            Array32i _beg, _end;
+            RunPtr _run;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class WarpPerspectiveByteBilinear : public WarpPerspective
+        {
+        public:
+            typedef void(*RunPtr)(const WarpPersParam& p, int yBeg, int yEnd, const float* cx, const float* cy, const int* ib, const int* ie, const int* ob, const int* oe, const uint8_t* src, uint8_t* dst, uint8_t* buf);
+
+            WarpPerspectiveByteBilinear(const WarpPersParam& param);
+
+            virtual void Run(const uint8_t* src, uint8_t* dst);
+
+        protected:
+            void Init();
+
+            Array32i _range;
+            int* _ib, * _ie, * _ob, * _oe;
+            RunPtr _run;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+    }
+
+#ifdef SIMD_SSE41_ENABLE
+    namespace Sse41
+    {
+        class WarpPerspectiveNearest : public Base::WarpPerspectiveNearest
+        {
+        public:
+            WarpPerspectiveNearest(const WarpPersParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class WarpPerspectiveByteBilinear : public Base::WarpPerspectiveByteBilinear
+        {
+        public:
+            WarpPerspectiveByteBilinear(const WarpPersParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        class WarpPerspectiveNearest : public Sse41::WarpPerspectiveNearest
+        {
+        public:
+            WarpPerspectiveNearest(const WarpPersParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class WarpPerspectiveByteBilinear : public Sse41::WarpPerspectiveByteBilinear
+        {
+        public:
+            WarpPerspectiveByteBilinear(const WarpPersParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        class WarpPerspectiveNearest : public Avx2::WarpPerspectiveNearest
+        {
+        public:
+            WarpPerspectiveNearest(const WarpPersParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class WarpPerspectiveByteBilinear : public Avx2::WarpPerspectiveByteBilinear
+        {
+        public:
+            WarpPerspectiveByteBilinear(const WarpPersParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* WarpPerspectiveInit(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+    }
+#endif
+}
+#endif
@@ -143,6 +143,8 @@ namespace Test
     TEST_ADD_GROUP_A0(Binarization);
     TEST_ADD_GROUP_A0(AveragingBinarization);
     TEST_ADD_GROUP_A0(AveragingBinarizationV2);
+    TEST_ADD_GROUP_A0(LocalBinarization);
+    TEST_ADD_GROUP_A0(OtsuBinarization);
 
     TEST_ADD_GROUP_A0(ConditionalCount8u);
     TEST_ADD_GROUP_A0(ConditionalCount16i);
@@ -153,6 +155,7 @@ namespace Test
 
     TEST_ADD_GROUP_A0(ContourMetricsMasked);
     TEST_ADD_GROUP_A0(ContourAnchors);
+    TEST_ADD_GROUP_A0(Canny);
     TEST_ADD_GROUP_0S(ContourDetector);
 
     TEST_ADD_GROUP_A0(Copy);
@@ -221,15 +224,19 @@ namespace Test
     TEST_ADD_GROUP_A0(Gemm32fNT);
 
     TEST_ADD_GROUP_A0(ImageSaveToMemory);
+    TEST_ADD_GROUP_A0(ImageSaveToFile);
+    TEST_ADD_GROUP_A0(ImageSaveBand);
     TEST_ADD_GROUP_A0(Nv12SaveAsJpegToMemory);
     TEST_ADD_GROUP_A0(Yuv420pSaveAsJpegToMemory);
     TEST_ADD_GROUP_AS(ImageLoadFromMemory);
+    TEST_ADD_GROUP_A0(ImageLoadBand);
 
     TEST_ADD_GROUP_A0(MeanFilter3x3);
     TEST_ADD_GROUP_A0(MedianFilterRhomb3x3);
     TEST_ADD_GROUP_A0(MedianFilterRhomb5x5);
     TEST_ADD_GROUP_A0(MedianFilterSquare3x3);
     TEST_ADD_GROUP_A0(MedianFilterSquare5x5);
+    TEST_ADD_GROUP_A0(MedianFilterSquare);
     TEST_ADD_GROUP_A0(GaussianBlur3x3);
     TEST_ADD_GROUP_A0(AbsGradientSaturatedSum);
     TEST_ADD_GROUP_A0(LbpEstimate);
@@ -242,12 +249,18 @@ namespace Test
     TEST_ADD_GROUP_A0(Laplace);
     TEST_ADD_GROUP_A0(LaplaceAbs);
     TEST_ADD_GROUP_AS(GaussianBlur);
+    TEST_ADD_GROUP_A0(GaussianBlurEx);
     TEST_ADD_GROUP_A0(RecursiveBilateralFilter);
+    TEST_ADD_GROUP_A0(SeparableFilter);
+    TEST_ADD_GROUP_A0(BoxFilter);
+    TEST_ADD_GROUP_A0(Morphology);
+    TEST_ADD_GROUP_A0(DistanceTransform);
 
     TEST_ADD_GROUP_A0(Histogram);
     TEST_ADD_GROUP_A0(HistogramMasked);
     TEST_ADD_GROUP_A0(HistogramConditional);
     TEST_ADD_GROUP_A0(AbsSecondDerivativeHistogram);
+    TEST_ADD_GROUP_A0(Clahe);
     TEST_ADD_GROUP_A0(ChangeColors);
 
     TEST_ADD_GROUP_A0(HogDirectionHistograms);
@@ -265,6 +278,8 @@ namespace Test
 
     TEST_ADD_GROUP_0S(Motion);
 
+    TEST_ADD_GROUP_A0(OpticalFlowLk);
+
     TEST_ADD_GROUP_A0(NeuralConvert);
     TEST_ADD_GROUP_A0(NeuralProductSum);
     TEST_ADD_GROUP_A0(NeuralAddVectorMultipliedByValue);
@@ -311,12 +326,18 @@ namespace Test
     TEST_ADD_GROUP_A0(Reorder64bit);
 
     TEST_ADD_GROUP_A0(Resizer);
+    TEST_ADD_GROUP_A0(ResizerBand);
+    TEST_ADD_GROUP_A0(ResizerYuv420);
+    TEST_ADD_GROUP_A0(ResizerBatch);
+    TEST_ADD_GROUP_A0(ResizerTensor);
+    TEST_ADD_GROUP_A0(ResizerCache);
     TEST_ADD_GROUP_0S(ResizeYuv420p);
 
     TEST_ADD_GROUP_A0(SegmentationShrinkRegion);
     TEST_ADD_GROUP_A0(SegmentationFillSingleHoles);
     TEST_ADD_GROUP_A0(SegmentationChangeIndex);
     TEST_ADD_GROUP_A0(SegmentationPropagate2x2);
+    TEST_ADD_GROUP_A0(ConnectedComponents);
 
     TEST_ADD_GROUP_A0(ShiftBilinear);
     TEST_ADD_GROUP_0S(ShiftDetectorRand);
@@ -411,6 +432,9 @@ namespace Test
     TEST_ADD_GROUP_A0(Uyvy422ToBgr);
 
     TEST_ADD_GROUP_A0(WarpAffine);
+    TEST_ADD_GROUP_A0(WarpAffineBatch);
+    TEST_ADD_GROUP_A0(WarpPerspective);
+    TEST_ADD_GROUP_A0(Remap);
 #ifdef SIMD_OPENCV_ENABLE
     TEST_ADD_GROUP_0S(WarpAffineOpenCv);
 #endif
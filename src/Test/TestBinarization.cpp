@@ -26,6 +26,8 @@
 #include "Test/TestString.h"
 #include "Test/TestRandom.h"
 
+#include "Simd/SimdLocalBinarization.h"
+
 namespace Test
 {
     namespace
@@ -294,4 +296,180 @@ namespace Test
 
         return result;
     }
+
+    //-----------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncLB
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, SimdLocalBinarizationType type, size_t radius, float k, float r);
+
+            FuncPtr func;
+            String description;
+
+            FuncLB(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(SimdLocalBinarizationType type, size_t radius, float k)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << (type == SimdLocalBinarizationSauvola ? "Sauvola" : "Niblack") << "-" << radius << "-" << k << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, SimdLocalBinarizationType type, size_t radius, float k, float r, uint8_t positive, uint8_t negative, View& dst) const
+            {
+                void* context = func(src.width, src.height, type, radius, k, r);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdLocalBinarizationRun(context, src.data, src.stride, positive, negative, dst.data, dst.stride);
+                }
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_LB(function) \
+    FuncLB(function, std::string(#function))
+
+    bool LocalBinarizationAutoTest(size_t width, size_t height, SimdLocalBinarizationType type, size_t radius, float k, FuncLB f1, FuncLB f2)
+    {
+        bool result = true;
+
+        f1.Update(type, radius, k);
+        f2.Update(type, radius, k);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View noise(width / 8 + 2, height / 8 + 2, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(noise);
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        Simd::Resize(noise, src, SimdResizeMethodBilinear);
+
+        View dst1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, type, radius, k, 128.0f, 255, 0, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, type, radius, k, 128.0f, 255, 0, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool LocalBinarizationAutoTest(const FuncLB& f1, const FuncLB& f2)
+    {
+        bool result = true;
+
+        result = result && LocalBinarizationAutoTest(W, H, SimdLocalBinarizationSauvola, 7, 0.34f, f1, f2);
+        result = result && LocalBinarizationAutoTest(W + O, H - O, SimdLocalBinarizationSauvola, 15, 0.5f, f1, f2);
+        result = result && LocalBinarizationAutoTest(W, H, SimdLocalBinarizationNiblack, 7, -0.2f, f1, f2);
+        result = result && LocalBinarizationAutoTest(W - O, H + O, SimdLocalBinarizationNiblack, 2, 0.0f, f1, f2);
+
+        return result;
+    }
+
+    bool LocalBinarizationAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && LocalBinarizationAutoTest(FUNC_LB(Simd::Base::LocalBinarizationInit), FUNC_LB(SimdLocalBinarizationInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && LocalBinarizationAutoTest(FUNC_LB(Simd::Sse41::LocalBinarizationInit), FUNC_LB(SimdLocalBinarizationInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && LocalBinarizationAutoTest(FUNC_LB(Simd::Avx2::LocalBinarizationInit), FUNC_LB(SimdLocalBinarizationInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && LocalBinarizationAutoTest(FUNC_LB(Simd::Avx512bw::LocalBinarizationInit), FUNC_LB(SimdLocalBinarizationInit));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------------------------------------
+
+    static uint8_t OtsuThreshold(const View& src)
+    {
+        double hist[256] = { 0 }, total = double(src.width * src.height);
+        for (size_t y = 0; y < src.height; ++y)
+            for (size_t x = 0; x < src.width; ++x)
+                hist[src.At<uint8_t>(x, y)] += 1.0;
+        double best = -1.0;
+        int threshold = 0;
+        for (int t = 0; t < 256; ++t)
+        {
+            double n0 = 0, n1 = 0, s0 = 0, s1 = 0;
+            for (int i = 0; i < 256; ++i)
+            {
+                if (i <= t)
+                    n0 += hist[i], s0 += i * hist[i];
+                else
+                    n1 += hist[i], s1 += i * hist[i];
+            }
+            if (n0 == 0 || n1 == 0)
+                continue;
+            double m0 = s0 / n0, m1 = s1 / n1;
+            double between = n0 * n1 * (m0 - m1) * (m0 - m1) / (total * total);
+            if (between > best * (1.0 + 1.0e-12))
+            {
+                best = between;
+                threshold = t;
+            }
+        }
+        return (uint8_t)threshold;
+    }
+
+    bool OtsuBinarizationAutoTest(size_t width, size_t height)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SimdOtsuBinarization [" << width << ", " << height << "].");
+
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        for (size_t y = 0; y < height; ++y)
+            for (size_t x = 0; x < width; ++x)
+                src.At<uint8_t>(x, y) = uint8_t(((x / 32 + y / 16) & 1 ? 160 : 40) + Random(48));
+
+        View dst1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        uint8_t threshold1 = OtsuThreshold(src);
+        Simd::Binarization(src, threshold1, 255, 0, dst1, SimdCompareGreater);
+
+        uint8_t threshold2 = 0;
+        {
+            TEST_PERFORMANCE_TEST("SimdOtsuBinarization");
+            threshold2 = SimdOtsuBinarization(src.data, src.stride, src.width, src.height, 255, 0, dst2.data, dst2.stride);
+        }
+
+        if (threshold1 != threshold2)
+        {
+            TEST_LOG_SS(Error, "Otsu threshold: " << int(threshold1) << " != " << int(threshold2) << " !");
+            result = false;
+        }
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool OtsuBinarizationAutoTest()
+    {
+        bool result = true;
+
+        result = result && OtsuBinarizationAutoTest(W, H);
+        result = result && OtsuBinarizationAutoTest(W + O, H - O);
+
+        return result;
+    }
 }
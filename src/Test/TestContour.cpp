@@ -25,6 +25,8 @@
 #include "Test/TestPerformance.h"
 #include "Test/TestRandom.h"
 
+#include "Simd/SimdCanny.h"
+
 namespace Test
 {
     namespace
@@ -199,6 +201,104 @@ namespace Test
 
         return result;
     }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncC
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, float lowThreshold, float highThreshold);
+
+            FuncPtr func;
+            String description;
+
+            FuncC(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(float low, float high)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << low << "-" << high << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, float low, float high, View& dst) const
+            {
+                void* canny = func(src.width, src.height, low, high);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdCannyRun(canny, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(canny);
+            }
+        };
+    }
+
+#define FUNC_C(function) \
+    FuncC(function, std::string(#function))
+
+    bool CannyAutoTest(size_t width, size_t height, float low, float high, FuncC f1, FuncC f2)
+    {
+        bool result = true;
+
+        f1.Update(low, high);
+        f2.Update(low, high);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View noise(width / 8 + 2, height / 8 + 2, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(noise);
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        Simd::Resize(noise, src, SimdResizeMethodBilinear);
+
+        View dst1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, low, high, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, low, high, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool CannyAutoTest(const FuncC& f1, const FuncC& f2)
+    {
+        bool result = true;
+
+        result = result && CannyAutoTest(W, H, 20.0f, 60.0f, f1, f2);
+        result = result && CannyAutoTest(W + O, H - O, 20.0f, 60.0f, f1, f2);
+        result = result && CannyAutoTest(W, H, 50.5f, 200.0f, f1, f2);
+
+        return result;
+    }
+
+    bool CannyAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && CannyAutoTest(FUNC_C(Simd::Base::CannyInit), FUNC_C(SimdCannyInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && CannyAutoTest(FUNC_C(Simd::Sse41::CannyInit), FUNC_C(SimdCannyInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && CannyAutoTest(FUNC_C(Simd::Avx2::CannyInit), FUNC_C(SimdCannyInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && CannyAutoTest(FUNC_C(Simd::Avx512bw::CannyInit), FUNC_C(SimdCannyInit));
+#endif 
+
+        return result;
+    }
 }
 
 //-----------------------------------------------------------------------------
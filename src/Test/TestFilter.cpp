@@ -27,8 +27,12 @@
 #include "Test/TestFile.h"
 #include "Test/TestRandom.h"
 
+#include "Simd/SimdBoxFilter.h"
+#include "Simd/SimdMorphology.h"
+#include "Simd/SimdDistanceTransform.h"
 #include "Simd/SimdGaussianBlur.h"
 #include "Simd/SimdRecursiveBilateralFilter.h"
+#include "Simd/SimdSeparableFilter.h"
 
 namespace Test
 {
@@ -292,6 +296,92 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncMS
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncMS(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(View::Format format, size_t radius)
+            {
+                std::stringstream ss;
+                ss << description << ColorDescription(format) << "[" << 2 * radius + 1 << "x" << 2 * radius + 1 << "]";
+                description = ss.str();
+            }
+
+            void Call(const View & src, size_t radius, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, src.width, src.height, View::PixelSize(src.format), radius, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_MS(function) \
+    FuncMS(function, std::string(#function))
+
+    bool MedianFilterSquareAutoTest(View::Format format, int width, int height, size_t radius, FuncMS f1, FuncMS f2)
+    {
+        bool result = true;
+
+        f1.Update(format, radius);
+        f2.Update(format, radius);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View s(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+
+        View d1(width, height, format, NULL, TEST_ALIGN(width));
+        View d2(width, height, format, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, radius, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, radius, d2));
+
+        result = result && Compare(d1, d2, 0, true, 64);
+
+        return result;
+    }
+
+    bool MedianFilterSquareAutoTest(const FuncMS & f1, const FuncMS & f2)
+    {
+        bool result = true;
+
+        for (View::Format format = View::Gray8; format <= View::Bgra32; format = View::Format(format + 1))
+        {
+            result = result && MedianFilterSquareAutoTest(format, W, H, 3, f1, f2);
+            result = result && MedianFilterSquareAutoTest(format, W + O, H - O, 10, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool MedianFilterSquareAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && MedianFilterSquareAutoTest(FUNC_MS(Simd::Base::MedianFilterSquare), FUNC_MS(SimdMedianFilterSquare));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && MedianFilterSquareAutoTest(FUNC_MS(Simd::Sse41::MedianFilterSquare), FUNC_MS(SimdMedianFilterSquare));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && MedianFilterSquareAutoTest(FUNC_MS(Simd::Avx2::MedianFilterSquare), FUNC_MS(SimdMedianFilterSquare));
+#endif
+
+        return result;
+    }
+
     bool GaussianBlur3x3AutoTest()
     {
         bool result = true;
@@ -795,6 +885,614 @@ namespace Test
 
     //---------------------------------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncGBE
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, size_t channels, SimdGaussianBlurChannelType type, 
+                const float* sigma, const float* epsilon, SimdGaussianBlurMethod method);
+
+            FuncPtr func;
+            String description;
+
+            FuncGBE(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t c, SimdGaussianBlurChannelType t, float s, SimdGaussianBlurMethod m)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << c << "-" << (t == SimdGaussianBlurChannel8u ? "8u" : (t == SimdGaussianBlurChannel16u ? "16u" : "32f"));
+                ss << "-" << ToString(s, 1, true) << "-" << (m == SimdGaussianBlurFir ? "fir" : "iir") << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, size_t width, size_t channels, SimdGaussianBlurChannelType type, float sigma, SimdGaussianBlurMethod method, View& dst) const
+            {
+                void* filter = NULL;
+                filter = func(width, src.height, channels, type, &sigma, NULL, method);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdGaussianBlurRun(filter, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(filter);
+            }
+        };
+    }
+
+#define FUNC_GBE(function) \
+    FuncGBE(function, std::string(#function))
+
+    bool GaussianBlurExAutoTest(size_t width, size_t height, size_t channels, SimdGaussianBlurChannelType type, float sigma, SimdGaussianBlurMethod method, FuncGBE f1, FuncGBE f2)
+    {
+        bool result = true;
+
+        f1.Update(channels, type, sigma, method);
+        f2.Update(channels, type, sigma, method);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src;
+        if (type == SimdGaussianBlurChannel8u)
+        {
+            if (!GetTestImage(src, width, height, channels, f1.description, f2.description))
+                return false;
+        }
+        else if (type == SimdGaussianBlurChannel16u)
+        {
+            src.Recreate(width * channels, height, View::Int16, NULL, TEST_ALIGN(width));
+            FillRandom16u(src);
+        }
+        else
+        {
+            src.Recreate(width * channels, height, View::Float, NULL, TEST_ALIGN(width));
+            FillRandom32f(src, 0.0f, 255.0f);
+        }
+
+        View dst1(src.width, height, src.format, NULL, TEST_ALIGN(width));
+        View dst2(src.width, height, src.format, NULL, TEST_ALIGN(width));
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, width, channels, type, sigma, method, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, width, channels, type, sigma, method, dst2));
+
+        if (type == SimdGaussianBlurChannel32f)
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(dst1, dst2, 1, true, 64);
+
+        return result;
+    }
+
+    bool GaussianBlurExAutoTest(size_t channels, SimdGaussianBlurChannelType type, float sigma, SimdGaussianBlurMethod method, const FuncGBE& f1, const FuncGBE& f2)
+    {
+        bool result = true;
+
+        result = result && GaussianBlurExAutoTest(W, H, channels, type, sigma, method, f1, f2);
+        result = result && GaussianBlurExAutoTest(W + O, H - O, channels, type, sigma, method, f1, f2);
+
+        return result;
+    }
+
+    bool GaussianBlurExAutoTest(const FuncGBE& f1, const FuncGBE& f2)
+    {
+        bool result = true;
+
+        for (size_t channels = 1; channels <= 4; channels++)
+        {
+            result = result && GaussianBlurExAutoTest(channels, SimdGaussianBlurChannel8u, 3.0f, SimdGaussianBlurIir, f1, f2);
+            result = result && GaussianBlurExAutoTest(channels, SimdGaussianBlurChannel8u, 20.0f, SimdGaussianBlurIir, f1, f2);
+            result = result && GaussianBlurExAutoTest(channels, SimdGaussianBlurChannel16u, 1.0f, SimdGaussianBlurFir, f1, f2);
+            result = result && GaussianBlurExAutoTest(channels, SimdGaussianBlurChannel16u, 20.0f, SimdGaussianBlurIir, f1, f2);
+            result = result && GaussianBlurExAutoTest(channels, SimdGaussianBlurChannel32f, 3.0f, SimdGaussianBlurFir, f1, f2);
+            result = result && GaussianBlurExAutoTest(channels, SimdGaussianBlurChannel32f, 20.0f, SimdGaussianBlurIir, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool GaussianBlurExAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && GaussianBlurExAutoTest(FUNC_GBE(Simd::Base::GaussianBlurInitEx), FUNC_GBE(SimdGaussianBlurInitEx));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && GaussianBlurExAutoTest(FUNC_GBE(Simd::Sse41::GaussianBlurInitEx), FUNC_GBE(SimdGaussianBlurInitEx));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && GaussianBlurExAutoTest(FUNC_GBE(Simd::Avx2::GaussianBlurInitEx), FUNC_GBE(SimdGaussianBlurInitEx));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && GaussianBlurExAutoTest(FUNC_GBE(Simd::Avx512bw::GaussianBlurInitEx), FUNC_GBE(SimdGaussianBlurInitEx));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon())
+            result = result && GaussianBlurExAutoTest(FUNC_GBE(Simd::Neon::GaussianBlurInitEx), FUNC_GBE(SimdGaussianBlurInitEx));
+#endif
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncSF
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, size_t channels, SimdSeparableFilterChannelType type,
+                const float* rowKernel, size_t rowSize, const float* colKernel, size_t colSize);
+
+            FuncPtr func;
+            String description;
+
+            FuncSF(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t c, SimdSeparableFilterChannelType t, size_t rs, size_t cs, const String & kernel)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << c << "-" << (t == SimdSeparableFilterChannel8u ? "8u" : "16u") << "-" << rs << "x" << cs << "-" << kernel << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, size_t channels, SimdSeparableFilterChannelType type, const Buffer32f & row, const Buffer32f & col, View& dst) const
+            {
+                void* filter = NULL;
+                filter = func(src.width / (src.format == View::Int16 ? channels : 1), src.height, channels, type, row.data(), row.size(), col.data(), col.size());
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdSeparableFilterRun(filter, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(filter);
+            }
+        };
+    }
+
+#define FUNC_SF(function) \
+    FuncSF(function, std::string(#function))
+
+    bool SeparableFilterAutoTest(size_t width, size_t height, size_t channels, SimdSeparableFilterChannelType type, 
+        const Buffer32f & row, const Buffer32f & col, const String & kernel, int differenceMax, FuncSF f1, FuncSF f2)
+    {
+        bool result = true;
+
+        f1.Update(channels, type, row.size(), col.size(), kernel);
+        f2.Update(channels, type, row.size(), col.size(), kernel);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src;
+        if (type == SimdSeparableFilterChannel8u)
+        {
+            if (!GetTestImage(src, width, height, channels, f1.description, f2.description))
+                return false;
+        }
+        else
+        {
+            src.Recreate(width * channels, height, View::Int16, NULL, TEST_ALIGN(width));
+            FillRandom16u(src);
+        }
+
+        View dst1(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+        View dst2(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, channels, type, row, col, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, channels, type, row, col, dst2));
+
+        result = result && Compare(dst1, dst2, differenceMax, true, 64);
+
+        return result;
+    }
+
+    bool SeparableFilterAutoTest(size_t channels, SimdSeparableFilterChannelType type, 
+        const Buffer32f& row, const Buffer32f& col, const String& kernel, int differenceMax, const FuncSF& f1, const FuncSF& f2)
+    {
+        bool result = true;
+
+        result = result && SeparableFilterAutoTest(W, H, channels, type, row, col, kernel, differenceMax, f1, f2);
+        result = result && SeparableFilterAutoTest(W + O, H - O, channels, type, row, col, kernel, differenceMax, f1, f2);
+
+        return result;
+    }
+
+    bool SeparableFilterAutoTest(const FuncSF& f1, const FuncSF& f2)
+    {
+        bool result = true;
+
+        Buffer32f binomial3 = { 0.25f, 0.50f, 0.25f }, binomial5 = { 1.0f / 16, 4.0f / 16, 6.0f / 16, 4.0f / 16, 1.0f / 16 };
+        Buffer32f derivative = { -0.5f, 0.0f, 0.5f }, smooth = { 0.1f, 0.2f, 0.4f, 0.2f, 0.1f }, shift = { 0.3f, 0.7f };
+
+        for (size_t channels = 1; channels <= 4; channels++)
+        {
+            result = result && SeparableFilterAutoTest(channels, SimdSeparableFilterChannel8u, binomial3, binomial5, "binomial", 0, f1, f2);
+            result = result && SeparableFilterAutoTest(channels, SimdSeparableFilterChannel8u, derivative, binomial3, "derivative", 0, f1, f2);
+            result = result && SeparableFilterAutoTest(channels, SimdSeparableFilterChannel8u, smooth, shift, "float", 1, f1, f2);
+            result = result && SeparableFilterAutoTest(channels, SimdSeparableFilterChannel16u, binomial5, smooth, "float", 1, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool SeparableFilterAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && SeparableFilterAutoTest(FUNC_SF(Simd::Base::SeparableFilterInit), FUNC_SF(SimdSeparableFilterInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && SeparableFilterAutoTest(FUNC_SF(Simd::Sse41::SeparableFilterInit), FUNC_SF(SimdSeparableFilterInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && SeparableFilterAutoTest(FUNC_SF(Simd::Avx2::SeparableFilterInit), FUNC_SF(SimdSeparableFilterInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && SeparableFilterAutoTest(FUNC_SF(Simd::Avx512bw::SeparableFilterInit), FUNC_SF(SimdSeparableFilterInit));
+#endif 
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncBF
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, size_t channels, SimdBoxFilterChannelType type, size_t radiusX, size_t radiusY);
+
+            FuncPtr func;
+            String description;
+
+            FuncBF(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t c, SimdBoxFilterChannelType t, size_t rx, size_t ry, bool var)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << c << "-" << (t == SimdBoxFilterChannel8u ? "8u" : "32f") << "-" << rx << "x" << ry << (var ? "-v" : "") << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, size_t width, size_t channels, SimdBoxFilterChannelType type, size_t rx, size_t ry, View& mean, View* var) const
+            {
+                void* filter = NULL;
+                filter = func(width, src.height, channels, type, rx, ry);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdBoxFilterRun(filter, src.data, src.stride, mean.data, mean.stride, var ? (float*)var->data : NULL, var ? var->stride : 0);
+                }
+                SimdRelease(filter);
+            }
+        };
+    }
+
+#define FUNC_BF(function) \
+    FuncBF(function, std::string(#function))
+
+    bool BoxFilterAutoTest(size_t width, size_t height, size_t channels, SimdBoxFilterChannelType type, size_t rx, size_t ry, bool var, FuncBF f1, FuncBF f2)
+    {
+        bool result = true;
+
+        f1.Update(channels, type, rx, ry, var);
+        f2.Update(channels, type, rx, ry, var);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src;
+        if (type == SimdBoxFilterChannel8u)
+        {
+            if (!GetTestImage(src, width, height, channels, f1.description, f2.description))
+                return false;
+        }
+        else
+        {
+            src.Recreate(width * channels, height, View::Float, NULL, TEST_ALIGN(width));
+            FillRandom32f(src, 0.0f, 255.0f);
+        }
+
+        View mean1(src.width, height, src.format, NULL, TEST_ALIGN(width));
+        View mean2(src.width, height, src.format, NULL, TEST_ALIGN(width));
+        View var1(width * channels, height, View::Float, NULL, TEST_ALIGN(width));
+        View var2(width * channels, height, View::Float, NULL, TEST_ALIGN(width));
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, width, channels, type, rx, ry, mean1, var ? &var1 : NULL));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, width, channels, type, rx, ry, mean2, var ? &var2 : NULL));
+
+        if (type == SimdBoxFilterChannel8u)
+            result = result && Compare(mean1, mean2, 0, true, 64, 0, "mean");
+        else
+            result = result && Compare(mean1, mean2, EPS, true, 64, DifferenceBoth, "mean");
+        if (var)
+            result = result && Compare(var1, var2, 0.01f, true, 64, DifferenceBoth, "var");
+
+        return result;
+    }
+
+    bool BoxFilterAutoTest(size_t channels, SimdBoxFilterChannelType type, size_t rx, size_t ry, bool var, const FuncBF& f1, const FuncBF& f2)
+    {
+        bool result = true;
+
+        result = result && BoxFilterAutoTest(W, H, channels, type, rx, ry, var, f1, f2);
+        result = result && BoxFilterAutoTest(W + O, H - O, channels, type, rx, ry, var, f1, f2);
+
+        return result;
+    }
+
+    bool BoxFilterAutoTest(const FuncBF& f1, const FuncBF& f2)
+    {
+        bool result = true;
+
+        for (size_t channels = 1; channels <= 4; channels++)
+        {
+            result = result && BoxFilterAutoTest(channels, SimdBoxFilterChannel8u, 1, 1, false, f1, f2);
+            result = result && BoxFilterAutoTest(channels, SimdBoxFilterChannel8u, 7, 3, true, f1, f2);
+            result = result && BoxFilterAutoTest(channels, SimdBoxFilterChannel8u, 30, 30, true, f1, f2);
+            result = result && BoxFilterAutoTest(channels, SimdBoxFilterChannel32f, 2, 5, true, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool BoxFilterAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && BoxFilterAutoTest(FUNC_BF(Simd::Base::BoxFilterInit), FUNC_BF(SimdBoxFilterInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && BoxFilterAutoTest(FUNC_BF(Simd::Sse41::BoxFilterInit), FUNC_BF(SimdBoxFilterInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && BoxFilterAutoTest(FUNC_BF(Simd::Avx2::BoxFilterInit), FUNC_BF(SimdBoxFilterInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && BoxFilterAutoTest(FUNC_BF(Simd::Avx512bw::BoxFilterInit), FUNC_BF(SimdBoxFilterInit));
+#endif 
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncMO
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, SimdMorphologyOperationType operation, size_t kernelX, size_t kernelY);
+
+            FuncPtr func;
+            String description;
+
+            FuncMO(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(SimdMorphologyOperationType operation, size_t kx, size_t ky)
+            {
+                const char* names[] = { "erode", "dilate", "open", "close" };
+                std::stringstream ss;
+                ss << description << "[" << names[operation] << "-" << kx << "x" << ky << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, SimdMorphologyOperationType operation, size_t kx, size_t ky, View& dst) const
+            {
+                void* filter = NULL;
+                filter = func(src.width, src.height, operation, kx, ky);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdMorphologyRun(filter, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(filter);
+            }
+        };
+    }
+
+#define FUNC_MO(function) \
+    FuncMO(function, std::string(#function))
+
+    bool MorphologyAutoTest(size_t width, size_t height, SimdMorphologyOperationType operation, size_t kx, size_t ky, FuncMO f1, FuncMO f2)
+    {
+        bool result = true;
+
+        f1.Update(operation, kx, ky);
+        f2.Update(operation, kx, ky);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src;
+        if (!GetTestImage(src, width, height, 1, f1.description, f2.description))
+            return false;
+
+        View dst1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, operation, kx, ky, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, operation, kx, ky, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool MorphologyAutoTest(SimdMorphologyOperationType operation, size_t kx, size_t ky, const FuncMO& f1, const FuncMO& f2)
+    {
+        bool result = true;
+
+        result = result && MorphologyAutoTest(W, H, operation, kx, ky, f1, f2);
+        result = result && MorphologyAutoTest(W + O, H - O, operation, kx, ky, f1, f2);
+
+        return result;
+    }
+
+    bool MorphologyAutoTest(const FuncMO& f1, const FuncMO& f2)
+    {
+        bool result = true;
+
+        for (int operation = SimdMorphologyErode; operation <= SimdMorphologyClose; operation++)
+        {
+            result = result && MorphologyAutoTest((SimdMorphologyOperationType)operation, 3, 3, f1, f2);
+            result = result && MorphologyAutoTest((SimdMorphologyOperationType)operation, 8, 5, f1, f2);
+            result = result && MorphologyAutoTest((SimdMorphologyOperationType)operation, 31, 31, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool MorphologyAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && MorphologyAutoTest(FUNC_MO(Simd::Base::MorphologyInit), FUNC_MO(SimdMorphologyInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && MorphologyAutoTest(FUNC_MO(Simd::Sse41::MorphologyInit), FUNC_MO(SimdMorphologyInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && MorphologyAutoTest(FUNC_MO(Simd::Avx2::MorphologyInit), FUNC_MO(SimdMorphologyInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && MorphologyAutoTest(FUNC_MO(Simd::Avx512bw::MorphologyInit), FUNC_MO(SimdMorphologyInit));
+#endif 
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncDT
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, SimdDistanceTransformType type, SimdDistanceTransformDataType data);
+
+            FuncPtr func;
+            String description;
+
+            FuncDT(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(SimdDistanceTransformType type, SimdDistanceTransformDataType data)
+            {
+                const char* names[] = { "euclidean", "chamfer3x3", "chamfer5x5" };
+                std::stringstream ss;
+                ss << description << "[" << names[type] << "-" << (data == SimdDistanceTransform32f ? "32f" : "16u") << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& mask, SimdDistanceTransformType type, SimdDistanceTransformDataType data, View& dst) const
+            {
+                void* context = func(mask.width, mask.height, type, data);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdDistanceTransformRun(context, mask.data, mask.stride, 0, dst.data, dst.stride);
+                }
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_DT(function) \
+    FuncDT(function, std::string(#function))
+
+    bool DistanceTransformAutoTest(size_t width, size_t height, SimdDistanceTransformType type, SimdDistanceTransformDataType data, FuncDT f1, FuncDT f2)
+    {
+        bool result = true;
+
+        f1.Update(type, data);
+        f2.Update(type, data);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View mask(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(mask);
+
+        View::Format format = data == SimdDistanceTransform32f ? View::Float : View::Int16;
+        View dst1(width, height, format, NULL, TEST_ALIGN(width));
+        View dst2(width, height, format, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(mask, type, data, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(mask, type, data, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool DistanceTransformAutoTest(const FuncDT& f1, const FuncDT& f2)
+    {
+        bool result = true;
+
+        for (int type = SimdDistanceTransformEuclidean; type <= SimdDistanceTransformChamfer5x5; type++)
+        {
+            result = result && DistanceTransformAutoTest(W, H, (SimdDistanceTransformType)type, SimdDistanceTransform32f, f1, f2);
+            result = result && DistanceTransformAutoTest(W + O, H - O, (SimdDistanceTransformType)type, SimdDistanceTransform16u, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool DistanceTransformAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && DistanceTransformAutoTest(FUNC_DT(Simd::Base::DistanceTransformInit), FUNC_DT(SimdDistanceTransformInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && DistanceTransformAutoTest(FUNC_DT(Simd::Sse41::DistanceTransformInit), FUNC_DT(SimdDistanceTransformInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && DistanceTransformAutoTest(FUNC_DT(Simd::Avx2::DistanceTransformInit), FUNC_DT(SimdDistanceTransformInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && DistanceTransformAutoTest(FUNC_DT(Simd::Avx512bw::DistanceTransformInit), FUNC_DT(SimdDistanceTransformInit));
+#endif 
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
     SIMD_INLINE String ToStr(SimdRecursiveBilateralFilterFlags flags)
     {
         std::stringstream ss;
@@ -944,6 +1642,11 @@ namespace Test
             result = result && RecursiveBilateralFilterAutoTest(FUNC_RBF(Simd::Avx2::RecursiveBilateralFilterInit), FUNC_RBF(SimdRecursiveBilateralFilterInit));
 #endif
 
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && RecursiveBilateralFilterAutoTest(FUNC_RBF(Simd::Avx512bw::RecursiveBilateralFilterInit), FUNC_RBF(SimdRecursiveBilateralFilterInit));
+#endif
+
         return result;
     }
 
@@ -26,6 +26,8 @@
 #include "Test/TestString.h"
 #include "Test/TestRandom.h"
 
+#include "Simd/SimdClahe.h"
+
 namespace Test
 {
     namespace
@@ -430,4 +432,103 @@ namespace Test
 
         return result;
     }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncCl
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, size_t tilesX, size_t tilesY, float clipLimit);
+
+            FuncPtr func;
+            String description;
+
+            FuncCl(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t tilesX, size_t tilesY, float clipLimit)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << tilesX << "x" << tilesY << "-" << clipLimit << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, size_t tilesX, size_t tilesY, float clipLimit, View& dst) const
+            {
+                void* clahe = func(src.width, src.height, tilesX, tilesY, clipLimit);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdClaheRun(clahe, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(clahe);
+            }
+        };
+    }
+
+#define FUNC_CL(function) \
+    FuncCl(function, std::string(#function))
+
+    bool ClaheAutoTest(size_t width, size_t height, size_t tilesX, size_t tilesY, float clipLimit, FuncCl f1, FuncCl f2)
+    {
+        bool result = true;
+
+        f1.Update(tilesX, tilesY, clipLimit);
+        f2.Update(tilesX, tilesY, clipLimit);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View noise(width / 16 + 2, height / 16 + 2, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(noise, 0, 127);
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        Simd::Resize(noise, src, SimdResizeMethodBilinear);
+
+        View dst1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, tilesX, tilesY, clipLimit, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, tilesX, tilesY, clipLimit, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool ClaheAutoTest(const FuncCl& f1, const FuncCl& f2)
+    {
+        bool result = true;
+
+        result = result && ClaheAutoTest(W, H, 8, 8, 2.0f, f1, f2);
+        result = result && ClaheAutoTest(W + O, H - O, 8, 8, 2.0f, f1, f2);
+        result = result && ClaheAutoTest(W, H, 5, 3, 4.0f, f1, f2);
+        result = result && ClaheAutoTest(W - O, H + O, 1, 1, 0.0f, f1, f2);
+
+        return result;
+    }
+
+    bool ClaheAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && ClaheAutoTest(FUNC_CL(Simd::Base::ClaheInit), FUNC_CL(SimdClaheInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && ClaheAutoTest(FUNC_CL(Simd::Sse41::ClaheInit), FUNC_CL(SimdClaheInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && ClaheAutoTest(FUNC_CL(Simd::Avx2::ClaheInit), FUNC_CL(SimdClaheInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && ClaheAutoTest(FUNC_CL(Simd::Avx512bw::ClaheInit), FUNC_CL(SimdClaheInit));
+#endif 
+
+        return result;
+    }
 }
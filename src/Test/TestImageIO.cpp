@@ -108,6 +108,8 @@ namespace Test
             ss << suffix << ".png";
         if (file == SimdImageFileJpeg)
             ss << "_" << ToString(quality) << suffix << ".jpg";
+        else if (file == SimdImageFileQoi)
+            ss << suffix << ".qoi";
         const String dir = "_out";
         String path = MakePath(dir, ss.str());
         return CreatePathIfNotExist(dir, false) && image.Save(path, file, quality);
@@ -213,7 +215,7 @@ namespace Test
         std::vector<View::Format> formats({ View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32});
         for (int format = 0; format < (int)formats.size(); format++)
         {
-            for (int file = (int)SimdImageFileJpeg; file <= (int)SimdImageFileJpeg; file++)
+            for (int file = (int)SimdImageFileJpeg; file <= (int)SimdImageFileQoi; file++)
             {
                 if (file == SimdImageFileJpeg)
                 {
@@ -259,6 +261,352 @@ namespace Test
         return result;
     }
 
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncSF
+        {
+            typedef Simd::ImageSaveToFilePtr FuncPtr;
+
+            FuncPtr func;
+            String desc;
+
+            FuncSF(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(View::Format format, SimdImageFileType file, int quality)
+            {
+                desc = desc + "[" + ToString(format) + "-" + ToString(file) +
+                    (file == SimdImageFileJpeg ? String("-") + ToString(quality) : String("")) + "]";
+            }
+
+            bool Call(const View& src, SimdImageFileType file, int quality, const String& path) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                return func(src.data, src.stride, src.width, src.height, (SimdPixelFormatType)src.format, file, quality, path.c_str()) == SimdTrue;
+            }
+        };
+    }
+
+#define FUNC_SF(func) \
+    FuncSF(func, std::string(#func))
+
+    bool ImageSaveToFileAutoTest(size_t width, size_t height, View::Format format, SimdImageFileType file, int quality, FuncSF f1, FuncSM f2)
+    {
+        bool result = true;
+
+        f1.Update(format, file, quality);
+        f2.Update(format, file, quality);
+
+        View src;
+        if (!GetTestImage(src, width, height, format, f1.desc, f2.desc, file, quality, NULL, NULL))
+            return false;
+
+        const String dir = "_out";
+        const String path = MakePath(dir, "ImageSaveToFile.tmp");
+        if (!CreatePathIfNotExist(dir, false))
+        {
+            TEST_LOG_SS(Error, "Can't create directory '" << dir << "'!");
+            return false;
+        }
+
+        bool saved = false;
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(saved = f1.Call(src, file, quality, path));
+        if (!saved)
+        {
+            TEST_LOG_SS(Error, "Can't save image to file '" << path << "'!");
+            return false;
+        }
+
+        size_t size = 0;
+        uint8_t* data = NULL;
+        f2.Call(src, file, quality, &data, &size);
+
+        View dst1, dst2;
+        if (dst1.Load(path, format) && dst2.Load(data, size, format))
+            result = result && Compare(dst1, dst2, 0, true, 64, 0, "dst1 & dst2");
+        else
+        {
+            TEST_LOG_SS(Error, "Can't load saved images!");
+            result = false;
+        }
+
+        Simd::Free(data);
+        ::remove(path.c_str());
+
+        return result;
+    }
+
+    bool ImageSaveToFileAutoTest(const FuncSF& f1, const FuncSM& f2)
+    {
+        bool result = true;
+
+        std::vector<View::Format> formats({ View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32 });
+        for (int format = 0; format < (int)formats.size(); format++)
+        {
+            for (int file = (int)SimdImageFilePgmBin; file <= (int)SimdImageFileQoi; file++)
+            {
+                if (file == SimdImageFilePpmTxt)
+                    continue;
+                result = result && ImageSaveToFileAutoTest(W, H, formats[format], (SimdImageFileType)file, 65, f1, f2);
+                result = result && ImageSaveToFileAutoTest(W + O, H - O, formats[format], (SimdImageFileType)file, 65, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool ImageSaveToFileAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && ImageSaveToFileAutoTest(FUNC_SF(Simd::Base::ImageSaveToFile), FUNC_SM(Simd::Base::ImageSaveToMemory));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && ImageSaveToFileAutoTest(FUNC_SF(Simd::Sse41::ImageSaveToFile), FUNC_SM(Simd::Sse41::ImageSaveToMemory));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && ImageSaveToFileAutoTest(FUNC_SF(Simd::Avx2::ImageSaveToFile), FUNC_SM(Simd::Avx2::ImageSaveToMemory));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && ImageSaveToFileAutoTest(FUNC_SF(Simd::Avx512bw::ImageSaveToFile), FUNC_SM(Simd::Avx512bw::ImageSaveToMemory));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon())
+            result = result && ImageSaveToFileAutoTest(FUNC_SF(Simd::Neon::ImageSaveToFile), FUNC_SM(Simd::Neon::ImageSaveToMemory));
+#endif 
+
+        result = result && ImageSaveToFileAutoTest(FUNC_SF(SimdImageSaveToFile), FUNC_SM(SimdImageSaveToMemory));
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    static uint32_t PngCrc32(const uint8_t* data, size_t size)
+    {
+        uint32_t crc = 0xFFFFFFFF;
+        for (size_t i = 0; i < size; ++i)
+        {
+            crc ^= data[i];
+            for (int k = 0; k < 8; ++k)
+                crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+        return ~crc;
+    }
+
+    static void PngWriteBe32u(std::vector<uint8_t>& dst, uint32_t value)
+    {
+        for (int i = 3; i >= 0; --i)
+            dst.push_back(uint8_t(value >> (8 * i)));
+    }
+
+    static void PngSplitData(const uint8_t* data, size_t size, size_t chunk, std::vector<uint8_t>& dst)
+    {
+        std::vector<uint8_t> idat;
+        dst.assign(data, data + 8);
+        for (size_t pos = 8; pos + 12 <= size;)
+        {
+            uint32_t length = (uint32_t(data[pos]) << 24) | (uint32_t(data[pos + 1]) << 16) | (uint32_t(data[pos + 2]) << 8) | uint32_t(data[pos + 3]);
+            const uint8_t* type = data + pos + 4;
+            if (memcmp(type, "IDAT", 4) == 0)
+                idat.insert(idat.end(), type + 4, type + 4 + length);
+            else
+            {
+                if (memcmp(type, "IEND", 4) == 0)
+                {
+                    for (size_t offs = 0; offs < idat.size(); offs += chunk)
+                    {
+                        size_t count = std::min(chunk, idat.size() - offs);
+                        size_t start = dst.size() + 4;
+                        PngWriteBe32u(dst, (uint32_t)count);
+                        dst.insert(dst.end(), (const uint8_t*)"IDAT", (const uint8_t*)"IDAT" + 4);
+                        dst.insert(dst.end(), idat.begin() + offs, idat.begin() + offs + count);
+                        PngWriteBe32u(dst, PngCrc32(dst.data() + start, count + 4));
+                    }
+                }
+                dst.insert(dst.end(), data + pos, data + pos + 12 + length);
+            }
+            pos += 12 + length;
+        }
+    }
+
+    bool ImageLoadBandAutoTest(size_t width, size_t height, View::Format srcFormat, SimdImageFileType file, View::Format dstFormat, size_t band, size_t chunk)
+    {
+        bool result = true;
+
+        std::stringstream desc;
+        desc << "ImageLoadBand[" << ToString(srcFormat) << "-" << ToString(file) << "-" << ToString(dstFormat) << "-" << band;
+        if (chunk)
+            desc << "-" << chunk;
+        desc << "]";
+
+        View src;
+        uint8_t* data = NULL;
+        size_t size = 0;
+        if (!GetTestImage(src, width, height, srcFormat, desc.str(), "SimdImageLoadFromMemory", file, 100, &data, &size))
+            return false;
+
+        std::vector<uint8_t> split;
+        if (file == SimdImageFilePng && chunk)
+        {
+            PngSplitData(data, size, chunk, split);
+            Simd::Free(data);
+            data = (uint8_t*)Simd::Allocate(split.size());
+            memcpy(data, split.data(), split.size());
+            size = split.size();
+        }
+
+        const String dir = "_out";
+        const String path = MakePath(dir, "ImageLoadBand.tmp");
+        if (!(CreatePathIfNotExist(dir, false) && FileSave(data, size, path.c_str())))
+        {
+            TEST_LOG_SS(Error, "Can't save image to file '" << path << "'!");
+            Simd::Free(data);
+            return false;
+        }
+
+        View dst1;
+        if (!dst1.Load(data, size, dstFormat))
+        {
+            TEST_LOG_SS(Error, "Can't load image from memory!");
+            Simd::Free(data);
+            return false;
+        }
+        Simd::Free(data);
+
+        SimdPixelFormatType format = (SimdPixelFormatType)dstFormat;
+        size_t bandW = 0, bandH = 0;
+        void* loader = SimdImageLoadBandInit(path.c_str(), &format, &bandW, &bandH);
+        if (loader == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't create band loader for '" << path << "'!");
+            return false;
+        }
+        if (bandW != dst1.width || bandH != dst1.height || format != (SimdPixelFormatType)dst1.format)
+        {
+            TEST_LOG_SS(Error, "Band loader has wrong image parameters!");
+            SimdRelease(loader);
+            return false;
+        }
+
+        View dst2(bandW, bandH, (View::Format)format);
+        for (size_t row = 0; row < bandH; row += band)
+        {
+            size_t rows = Simd::Min(band, bandH - row);
+            if (SimdImageLoadBandRun(loader, dst2.data + row * dst2.stride, dst2.stride, band) != rows)
+            {
+                TEST_LOG_SS(Error, "Can't load band at row " << row << "!");
+                result = false;
+                break;
+            }
+        }
+        SimdRelease(loader);
+        ::remove(path.c_str());
+
+        result = result && Compare(dst1, dst2, 0, true, 64, 0, "dst1 & dst2");
+
+        return result;
+    }
+
+    bool ImageLoadBandAutoTest()
+    {
+        bool result = true;
+
+        std::vector<View::Format> formats({ View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32 });
+        for (size_t f = 0; f < formats.size(); f++)
+        {
+            result = result && ImageLoadBandAutoTest(W, H, View::Gray8, SimdImageFilePgmBin, formats[f], 17, 0);
+            result = result && ImageLoadBandAutoTest(W + O, H - O, View::Rgb24, SimdImageFilePpmBin, formats[f], 17, 0);
+            result = result && ImageLoadBandAutoTest(W, H, View::Gray8, SimdImageFilePng, formats[f], 17, 0);
+            result = result && ImageLoadBandAutoTest(W + O, H - O, View::Bgr24, SimdImageFilePng, formats[f], 1, 0);
+            result = result && ImageLoadBandAutoTest(W, H, View::Bgra32, SimdImageFilePng, formats[f], 64, 8192);
+        }
+        result = result && ImageLoadBandAutoTest(W + O, H - O, View::Rgb24, SimdImageFilePng, View::None, 7, 1000);
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool ImageSaveBandAutoTest(size_t width, size_t height, View::Format format, int quality, size_t band)
+    {
+        bool result = true;
+
+        std::stringstream desc;
+        desc << "SimdImageSaveBand[" << ToString(format) << "-" << quality << "-" << band << "]";
+
+        View src;
+        if (!GetTestImage(src, width, height, format, desc.str(), "SimdImageSaveToMemory", SimdImageFileJpeg, quality, NULL, NULL))
+            return false;
+
+        const String dir = "_out";
+        const String path = MakePath(dir, "ImageSaveBand.jpg");
+        if (!CreatePathIfNotExist(dir, false))
+        {
+            TEST_LOG_SS(Error, "Can't create directory '" << dir << "'!");
+            return false;
+        }
+
+        void* saver = SimdImageSaveBandInit(src.width, src.height, (SimdPixelFormatType)src.format, quality, path.c_str());
+        if (saver == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't create band saver for '" << path << "'!");
+            return false;
+        }
+        for (size_t row = 0; row < src.height; row += band)
+        {
+            if (!SimdImageSaveBandRun(saver, src.data + row * src.stride, src.stride, Simd::Min(band, src.height - row)))
+            {
+                TEST_LOG_SS(Error, "Can't save band at row " << row << "!");
+                result = false;
+                break;
+            }
+        }
+        SimdRelease(saver);
+
+        size_t size1 = 0, size2 = 0;
+        uint8_t* data1 = SimdImageSaveToMemory(src.data, src.stride, src.width, src.height, (SimdPixelFormatType)src.format, SimdImageFileJpeg, quality, &size1);
+        uint8_t* data2 = NULL;
+        if (!FileLoad(path.c_str(), &data2, &size2))
+        {
+            TEST_LOG_SS(Error, "Can't load file '" << path << "'!");
+            result = false;
+        }
+        else if (result && (size1 != size2 || memcmp(data1, data2, size1) != 0))
+        {
+            TEST_LOG_SS(Error, "Band-wise and whole image JPEG outputs are different!");
+            result = false;
+        }
+        Simd::Free(data1);
+        Simd::Free(data2);
+        ::remove(path.c_str());
+
+        return result;
+    }
+
+    bool ImageSaveBandAutoTest()
+    {
+        bool result = true;
+
+        std::vector<View::Format> formats({ View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32 });
+        for (size_t f = 0; f < formats.size(); f++)
+        {
+            result = result && ImageSaveBandAutoTest(W, H, formats[f], 65, 16);
+            result = result && ImageSaveBandAutoTest(W + O, H - O, formats[f], 95, 7);
+            result = result && ImageSaveBandAutoTest(W - O, H + O, formats[f], 65, 33);
+        }
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     namespace
@@ -595,6 +943,8 @@ namespace Test
             return format == View::Gray8;
         if (file == SimdImageFilePpmTxt || file == SimdImageFilePpmBin)
             return format != View::Bgra32 && format != View::Rgba32;
+        if (file == SimdImageFileQoi)
+            return format != View::Gray8;
         return false;
     }
 
@@ -668,7 +1018,7 @@ namespace Test
         std::vector<View::Format> formats = { View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32 };
         for (size_t format = 0; format < formats.size(); format++)
         {
-            for (int file = (int)SimdImageFileJpeg; file <= (int)SimdImageFileJpeg; file++)
+            for (int file = (int)SimdImageFileJpeg; file <= (int)SimdImageFileQoi; file++)
             {
                 if (file == SimdImageFileJpeg)
                 {
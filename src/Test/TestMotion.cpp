@@ -24,6 +24,8 @@
 #include "Test/TestCompare.h"
 #include "Test/TestPerformance.h"
 #include "Test/TestVideo.h"
+#include "Test/TestRandom.h"
+#include "Test/TestString.h"
 
 //-----------------------------------------------------------------------------
 
@@ -35,6 +37,8 @@
 #include "Simd/SimdDrawing.hpp"
 #include "Simd/SimdPixel.hpp"
 
+#include "Simd/SimdOpticalFlowLk.h"
+
 namespace Test
 {
     typedef Video::Frame Frame;
@@ -161,4 +165,122 @@ namespace Test
 
         return true;
     }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncLk
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, size_t levels, size_t radius, size_t iterations, float epsilon, float minEigenvalue);
+
+            FuncPtr func;
+            String description;
+
+            FuncLk(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t levels, size_t radius)
+            {
+                description = description + "[" + ToString(levels) + "-" + ToString(radius) + "]";
+            }
+
+            void Call(const View& prev, const View& next, size_t levels, size_t radius, const Buffer32f& src, Buffer32f& dst, Buffer8u& status) const
+            {
+                void* context = func(prev.width, prev.height, levels, radius, 20, 0.01f, 0.001f);
+                SimdOpticalFlowLkSetFrame(context, prev.data, prev.stride);
+                SimdOpticalFlowLkSetFrame(context, next.data, next.stride);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdOpticalFlowLkTrack(context, src.data(), dst.data(), status.data(), status.size());
+                }
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_LK(function) \
+    FuncLk(function, std::string(#function))
+
+    bool OpticalFlowLkAutoTest(size_t width, size_t height, size_t levels, size_t radius, FuncLk f1, FuncLk f2)
+    {
+        bool result = true;
+
+        f1.Update(levels, radius);
+        f2.Update(levels, radius);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        const ptrdiff_t shiftX = 3, shiftY = -2;
+        View noise(width / 8 + 4, height / 8 + 4, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(noise);
+        View scene(width + 8, height + 8, View::Gray8, NULL, TEST_ALIGN(width));
+        Simd::Resize(noise, scene, SimdResizeMethodBicubic);
+
+        View prev(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View next(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        Simd::Copy(scene.Region(4, 4, 4 + width, 4 + height), prev);
+        Simd::Copy(scene.Region(4 - shiftX, 4 - shiftY, 4 - shiftX + width, 4 - shiftY + height), next);
+
+        const size_t count = 1000;
+        Buffer32f src(count * 2), dst1(count * 2, 0.0f), dst2(count * 2, 0.0f);
+        Buffer8u status1(count, 0), status2(count, 0);
+        for (size_t i = 0; i < count; ++i)
+        {
+            src[i * 2 + 0] = float(Random() * width);
+            src[i * 2 + 1] = float(Random() * height);
+        }
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(prev, next, levels, radius, src, dst1, status1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(prev, next, levels, radius, src, dst2, status2));
+
+        for (size_t i = 0; i < count && result; ++i)
+        {
+            if (status1[i] != status2[i] || dst1[i * 2 + 0] != dst2[i * 2 + 0] || dst1[i * 2 + 1] != dst2[i * 2 + 1])
+            {
+                TEST_LOG_SS(Error, "There is difference at point " << i << " (" << src[i * 2 + 0] << ", " << src[i * 2 + 1] << "): status " 
+                    << int(status1[i]) << " != " << int(status2[i]) << ", position (" << dst1[i * 2 + 0] << ", " << dst1[i * 2 + 1] 
+                    << ") != (" << dst2[i * 2 + 0] << ", " << dst2[i * 2 + 1] << ") !");
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+    bool OpticalFlowLkAutoTest(const FuncLk& f1, const FuncLk& f2)
+    {
+        bool result = true;
+
+        result = result && OpticalFlowLkAutoTest(W, H, 3, 7, f1, f2);
+        result = result && OpticalFlowLkAutoTest(W + O, H - O, 4, 10, f1, f2);
+        result = result && OpticalFlowLkAutoTest(W - O, H + O, 2, 3, f1, f2);
+
+        return result;
+    }
+
+    bool OpticalFlowLkAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && OpticalFlowLkAutoTest(FUNC_LK(Simd::Base::OpticalFlowLkInit), FUNC_LK(SimdOpticalFlowLkInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && OpticalFlowLkAutoTest(FUNC_LK(Simd::Sse41::OpticalFlowLkInit), FUNC_LK(SimdOpticalFlowLkInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && OpticalFlowLkAutoTest(FUNC_LK(Simd::Avx2::OpticalFlowLkInit), FUNC_LK(SimdOpticalFlowLkInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && OpticalFlowLkAutoTest(FUNC_LK(Simd::Avx512bw::OpticalFlowLkInit), FUNC_LK(SimdOpticalFlowLkInit));
+#endif 
+
+        return result;
+    }
 }
@@ -42,6 +42,8 @@ namespace Test
         case SimdResizeMethodBicubic: return "BcO";
         case SimdResizeMethodArea: return "ArO";
         case SimdResizeMethodAreaFast: return "ArF";
+        case SimdResizeMethodLanczos3: return "La3";
+        case SimdResizeMethodMitchell: return "Mit";
         default: assert(0); return "";
         }
     }
@@ -238,15 +240,14 @@ namespace Test
         //result = result && ResizerAutoTest(SimdResizeMethodBicubic, SimdResizeChannelByte, 4, 100, 2, 200, 10, f1, f2);
 
 #if !defined(__aarch64__) || 1  
-        std::vector<SimdResizeMethodType> methods = { SimdResizeMethodNearest, SimdResizeMethodBilinear, SimdResizeMethodBicubic, SimdResizeMethodArea, SimdResizeMethodAreaFast };
+        std::vector<SimdResizeMethodType> methods = { SimdResizeMethodNearest, SimdResizeMethodBilinear, SimdResizeMethodBicubic, SimdResizeMethodArea, SimdResizeMethodAreaFast, 
+            SimdResizeMethodLanczos3, SimdResizeMethodMitchell };
         for (size_t m = 0; m < methods.size(); ++m)
         {
             result = result && ResizerAutoTest(methods[m], SimdResizeChannelByte, 1, f1, f2);
             result = result && ResizerAutoTest(methods[m], SimdResizeChannelByte, 2, f1, f2);
             result = result && ResizerAutoTest(methods[m], SimdResizeChannelByte, 3, f1, f2);
             result = result && ResizerAutoTest(methods[m], SimdResizeChannelByte, 4, f1, f2);
-            if (methods[m] == SimdResizeMethodBicubic || methods[m] == SimdResizeMethodArea || methods[m] == SimdResizeMethodAreaFast)
-                continue;
             result = result && ResizerAutoTest(methods[m], SimdResizeChannelShort, 1, f1, f2);
             result = result && ResizerAutoTest(methods[m], SimdResizeChannelShort, 2, f1, f2);
             result = result && ResizerAutoTest(methods[m], SimdResizeChannelShort, 3, f1, f2);
@@ -291,6 +292,589 @@ namespace Test
 
     //---------------------------------------------------------------------------------------------
 
+    bool ResizerBandAutoTest(SimdResizeMethodType method, size_t channels, size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t band)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test ResizerBand [" << channels << ":" << srcW << "x" << srcH << "->" << dstW << "x" << dstH << ":" << ToString(method) << "] band = " << band << ".");
+
+        View::Format format = channels == 1 ? View::Gray8 : (channels == 2 ? View::Uv16 : (channels == 3 ? View::Bgr24 : View::Bgra32));
+        View src(srcW, srcH, format, NULL, TEST_ALIGN(srcW));
+        FillRandom(src);
+
+        View dst1(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        View dst2(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        Simd::Fill(dst1, 0x01);
+        Simd::Fill(dst2, 0x02);
+
+        void* resizer1 = SimdResizerBandInit(srcW, srcH, dstW, dstH, channels, SimdResizeChannelByte, method);
+        void* resizer2 = SimdResizerBandInit(srcW, srcH, dstW, dstH, channels, SimdResizeChannelByte, method);
+        if (resizer1 == NULL || resizer2 == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't create ResizerBand!");
+            return false;
+        }
+
+        size_t rows1 = SimdResizerBandRun(resizer1, src.data, src.stride, srcH, dst1.data, dst1.stride);
+        size_t rows2 = 0;
+        for (size_t row = 0; row < srcH; row += band)
+        {
+            size_t srcRows = Simd::Min(band, srcH - row), maxRows = (srcRows + 4) * dstH / srcH + 2;
+            size_t dstRows = SimdResizerBandRun(resizer2, src.data + row * src.stride, src.stride, srcRows, dst2.data + rows2 * dst2.stride, dst2.stride);
+            if (dstRows > maxRows)
+            {
+                TEST_LOG_SS(Error, "Band " << row << " gives " << dstRows << " output rows, maximum is " << maxRows << "!");
+                result = false;
+            }
+            rows2 += dstRows;
+        }
+        SimdRelease(resizer1);
+        SimdRelease(resizer2);
+
+        if (rows1 != dstH || rows2 != dstH)
+        {
+            TEST_LOG_SS(Error, "Wrong number of output rows: " << rows1 << " and " << rows2 << " instead of " << dstH << "!");
+            return false;
+        }
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool ResizerBandAutoTest()
+    {
+        bool result = true;
+
+        std::vector<SimdResizeMethodType> methods = { SimdResizeMethodNearest, SimdResizeMethodBilinear, SimdResizeMethodBicubic, SimdResizeMethodArea };
+        for (size_t m = 0; m < methods.size(); ++m)
+        {
+            for (size_t c = 1; c <= 4; ++c)
+            {
+                result = result && ResizerBandAutoTest(methods[m], c, 124, 93, 319, 239, 7);
+                result = result && ResizerBandAutoTest(methods[m], c, 1999, 1499, 319, 239, 64);
+            }
+            result = result && ResizerBandAutoTest(methods[m], 3, 499, 374, 319, 239, 1);
+        }
+
+        std::vector<SimdResizeMethodType> unsupported = { SimdResizeMethodBilinearCaffe, SimdResizeMethodBilinearPytorch, SimdResizeMethodLanczos3, SimdResizeMethodMitchell };
+        for (size_t m = 0; m < unsupported.size() && result; ++m)
+        {
+            void* resizer = SimdResizerBandInit(124, 93, 319, 239, 3, SimdResizeChannelByte, unsupported[m]);
+            if (resizer)
+            {
+                TEST_LOG_SS(Error, "ResizerBand must not support " << ToString(unsupported[m]) << " method!");
+                SimdRelease(resizer);
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncRY
+        {
+            typedef void* (*FuncPtr)(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType dstFormat, SimdYuvType yuvType, SimdResizeMethodType method);
+
+            FuncPtr func;
+            String description;
+
+            FuncRY(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(SimdResizeMethodType method, SimdPixelFormatType format, size_t srcW, size_t srcH, size_t dstW, size_t dstH)
+            {
+                std::stringstream ss;
+                ss << description << "[" << srcW << "x" << srcH << "->" << dstW << "x" << dstH;
+                ss << ":" << ToString(method) << "-" << (format == SimdPixelFormatBgr24 ? "bgr" : "rgb") << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& y, const View& u, const View& v, const View& uv, View& dst1, View& dst2, SimdPixelFormatType format, SimdResizeMethodType method) const
+            {
+                void* resizer = func(y.width, y.height, dst1.width, dst1.height, format, SimdYuvBt601, method);
+                if (resizer)
+                {
+                    {
+                        TEST_PERFORMANCE_TEST(description);
+                        SimdResizerYuv420pRun(resizer, y.data, y.stride, u.data, u.stride, v.data, v.stride, dst1.data, dst1.stride);
+                    }
+                    SimdResizerNv12Run(resizer, y.data, y.stride, uv.data, uv.stride, dst2.data, dst2.stride);
+                    SimdRelease(resizer);
+                }
+            }
+        };
+    }
+
+#define FUNC_RY(function) \
+    FuncRY(function, std::string(#function))
+
+    bool ResizerYuv420AutoTest(SimdResizeMethodType method, SimdPixelFormatType format, size_t srcW, size_t srcH, size_t dstW, size_t dstH, FuncRY f1, FuncRY f2)
+    {
+        bool result = true;
+
+        f1.Update(method, format, srcW, srcH, dstW, dstH);
+        f2.Update(method, format, srcW, srcH, dstW, dstH);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << ".");
+
+        View y(srcW, srcH, View::Gray8, NULL, TEST_ALIGN(srcW));
+        View u(srcW / 2, srcH / 2, View::Gray8, NULL, TEST_ALIGN(srcW));
+        View v(srcW / 2, srcH / 2, View::Gray8, NULL, TEST_ALIGN(srcW));
+        View uv(srcW / 2, srcH / 2, View::Uv16, NULL, TEST_ALIGN(srcW));
+        FillRandom(y);
+        FillRandom(u);
+        FillRandom(v);
+        Simd::InterleaveUv(u, v, uv);
+
+        View dst1(dstW, dstH, View::Bgr24, NULL, TEST_ALIGN(dstW));
+        View dst2(dstW, dstH, View::Bgr24, NULL, TEST_ALIGN(dstW));
+        View dst3(dstW, dstH, View::Bgr24, NULL, TEST_ALIGN(dstW));
+        View dst4(dstW, dstH, View::Bgr24, NULL, TEST_ALIGN(dstW));
+        Simd::Fill(dst1, 0x01);
+        Simd::Fill(dst2, 0x02);
+        Simd::Fill(dst3, 0x03);
+        Simd::Fill(dst4, 0x04);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, u, v, uv, dst1, dst3, format, method));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, u, v, uv, dst2, dst4, format, method));
+
+        result = result && Compare(dst1, dst2, 0, true, 64, 0, "yuv420p");
+
+        result = result && Compare(dst1, dst3, 0, true, 64, 0, "nv12");
+
+        return result;
+    }
+
+    bool ResizerYuv420AutoTest(const FuncRY& f1, const FuncRY& f2)
+    {
+        bool result = true;
+
+        std::vector<SimdResizeMethodType> methods = { SimdResizeMethodNearest, SimdResizeMethodBilinear };
+        for (size_t m = 0; m < methods.size(); ++m)
+        {
+            result = result && ResizerYuv420AutoTest(methods[m], SimdPixelFormatBgr24, 124, 94, 319, 239, f1, f2);
+            result = result && ResizerYuv420AutoTest(methods[m], SimdPixelFormatRgb24, 1920, 1080, 319, 239, f1, f2);
+            result = result && ResizerYuv420AutoTest(methods[m], SimdPixelFormatBgr24, 1920, 1080, 640, 360, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool ResizerYuv420AutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && ResizerYuv420AutoTest(FUNC_RY(Simd::Base::ResizerYuv420Init), FUNC_RY(SimdResizerYuv420Init));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && ResizerYuv420AutoTest(FUNC_RY(Simd::Sse41::ResizerYuv420Init), FUNC_RY(SimdResizerYuv420Init));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && ResizerYuv420AutoTest(FUNC_RY(Simd::Avx2::ResizerYuv420Init), FUNC_RY(SimdResizerYuv420Init));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && ResizerYuv420AutoTest(FUNC_RY(Simd::Avx512bw::ResizerYuv420Init), FUNC_RY(SimdResizerYuv420Init));
+#endif
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncRB
+        {
+            typedef void* (*FuncPtr)(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method, SimdTensorFormatType format);
+
+            FuncPtr func;
+            String description;
+
+            FuncRB(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(SimdResizeMethodType method, SimdResizeChannelType type, size_t channels, SimdTensorFormatType format, size_t count, size_t dstW, size_t dstH)
+            {
+                std::stringstream ss;
+                ss << description << "[" << count << "x" << channels << ":" << dstW << "x" << dstH;
+                ss << ":" << ToString(method) << "-" << ToString(type) << "-" << (format == SimdTensorFormatNchw ? "nchw" : "nhwc") << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, const Buffer32f& rois, size_t count, View& dst, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method,
+                SimdTensorFormatType format, size_t dstW, size_t dstH) const
+            {
+                size_t srcW = src.width / (type == SimdResizeChannelFloat ? channels : 1);
+                void* resizer = func(srcW, src.height, dstW, dstH, channels, type, method, format);
+                if (resizer)
+                {
+                    {
+                        TEST_PERFORMANCE_TEST(description);
+                        SimdResizerBatchRun(resizer, src.data, src.stride, rois.data(), count, dst.data);
+                    }
+                    SimdRelease(resizer);
+                }
+            }
+        };
+    }
+
+#define FUNC_RB(function) \
+    FuncRB(function, std::string(#function))
+
+    bool ResizerBatchAutoTest(SimdResizeMethodType method, SimdResizeChannelType type, size_t channels, SimdTensorFormatType format, 
+        size_t srcW, size_t srcH, size_t count, size_t dstW, size_t dstH, FuncRB f1, FuncRB f2)
+    {
+        bool result = true;
+
+        f1.Update(method, type, channels, format, count, dstW, dstH);
+        f2.Update(method, type, channels, format, count, dstW, dstH);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << srcW << ", " << srcH << "].");
+
+        View src, dst1, dst2;
+        if (type == SimdResizeChannelFloat)
+        {
+            src.Recreate(srcW * channels, srcH, View::Float, NULL, TEST_ALIGN(srcW));
+            FillRandom32f(src);
+            dst1.Recreate(dstW * channels, dstH * count, View::Float, NULL, 1);
+            dst2.Recreate(dstW * channels, dstH * count, View::Float, NULL, 1);
+        }
+        else
+        {
+            src.Recreate(srcW * channels, srcH, View::Gray8, NULL, TEST_ALIGN(srcW));
+            FillRandom(src);
+            dst1.Recreate(dstW * channels, dstH * count, View::Gray8, NULL, 1);
+            dst2.Recreate(dstW * channels, dstH * count, View::Gray8, NULL, 1);
+        }
+        Simd::Fill(dst1, 0x01);
+        Simd::Fill(dst2, 0x02);
+
+        Buffer32f rois(count * 4);
+        for (size_t i = 0; i < count; ++i)
+        {
+            float x = float((Random() * 1.1 - 0.05) * srcW), y = float((Random() * 1.1 - 0.05) * srcH);
+            rois[i * 4 + 0] = x;
+            rois[i * 4 + 1] = y;
+            rois[i * 4 + 2] = x + float((Random() * 0.5 + 0.01) * srcW);
+            rois[i * 4 + 3] = y + float((Random() * 0.5 + 0.01) * srcH);
+        }
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, rois, count, dst1, channels, type, method, format, dstW, dstH));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, rois, count, dst2, channels, type, method, format, dstW, dstH));
+
+        if (type == SimdResizeChannelFloat)
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceAbsolute);
+        else
+            result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool ResizerBatchWholeImageTest(size_t channels, size_t srcW, size_t srcH, size_t dstW, size_t dstH)
+    {
+        View src(srcW * channels, srcH, View::Gray8, NULL, TEST_ALIGN(srcW));
+        FillRandom(src);
+        View dst1(dstW * channels, dstH, View::Gray8, NULL, 1);
+        View dst2(dstW * channels, dstH, View::Gray8, NULL, 1);
+        float roi[4] = { 0.0f, 0.0f, float(srcW), float(srcH) };
+
+        void* batch = SimdResizerBatchInit(srcW, srcH, dstW, dstH, channels, SimdResizeChannelByte, SimdResizeMethodBilinear, SimdTensorFormatNhwc);
+        void* resizer = SimdResizerInit(srcW, srcH, dstW, dstH, channels, SimdResizeChannelByte, SimdResizeMethodBilinear);
+        SimdResizerBatchRun(batch, src.data, src.stride, roi, 1, dst1.data);
+        SimdResizerRun(resizer, src.data, src.stride, dst2.data, dst2.stride);
+        SimdRelease(batch);
+        SimdRelease(resizer);
+
+        return Compare(dst1, dst2, 0, true, 64, 0, "whole image");
+    }
+
+    bool ResizerBatchAutoTest(const FuncRB& f1, const FuncRB& f2)
+    {
+        bool result = true;
+
+        std::vector<SimdResizeMethodType> methods = { SimdResizeMethodNearest, SimdResizeMethodBilinear };
+        std::vector<SimdResizeChannelType> types = { SimdResizeChannelByte, SimdResizeChannelFloat };
+        for (size_t m = 0; m < methods.size(); ++m)
+        {
+            for (size_t t = 0; t < types.size(); ++t)
+            {
+                for (size_t c = 1; c <= 4; ++c)
+                {
+                    result = result && ResizerBatchAutoTest(methods[m], types[t], c, SimdTensorFormatNhwc, 640, 480, 37, 112, 112, f1, f2);
+                    result = result && ResizerBatchAutoTest(methods[m], types[t], c, SimdTensorFormatNchw, 640, 480, 37, 112, 112, f1, f2);
+                }
+                result = result && ResizerBatchAutoTest(methods[m], types[t], 3, SimdTensorFormatNchw, 1920, 1080, 11, 224, 224, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool ResizerBatchAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+        {
+            result = result && ResizerBatchAutoTest(FUNC_RB(Simd::Base::ResizerBatchInit), FUNC_RB(SimdResizerBatchInit));
+            for (size_t c = 1; c <= 4; ++c)
+                result = result && ResizerBatchWholeImageTest(c, 499, 374, 319, 239);
+        }
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && ResizerBatchAutoTest(FUNC_RB(Simd::Sse41::ResizerBatchInit), FUNC_RB(SimdResizerBatchInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && ResizerBatchAutoTest(FUNC_RB(Simd::Avx2::ResizerBatchInit), FUNC_RB(SimdResizerBatchInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && ResizerBatchAutoTest(FUNC_RB(Simd::Avx512bw::ResizerBatchInit), FUNC_RB(SimdResizerBatchInit));
+#endif
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncRT
+        {
+            typedef void* (*FuncPtr)(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeMethodType method,
+                SimdTensorFormatType format, SimdTensorDataType type, const float* scale, const float* shift, SimdBool letterbox, float fill);
+
+            FuncPtr func;
+            String description;
+
+            FuncRT(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(SimdResizeMethodType method, size_t channels, SimdTensorFormatType format, SimdTensorDataType type, SimdBool letterbox, size_t dstW, size_t dstH)
+            {
+                std::stringstream ss;
+                ss << description << "[" << channels << ":" << dstW << "x" << dstH << ":" << ToString(method);
+                ss << "-" << (format == SimdTensorFormatNchw ? "nchw" : "nhwc") << "-" << (type == SimdTensorData32f ? "32f" : "16b") << (letterbox ? "-lb" : "") << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, View& dst, size_t channels, SimdResizeMethodType method, SimdTensorFormatType format, SimdTensorDataType type,
+                const float* scale, const float* shift, SimdBool letterbox, size_t dstW, size_t dstH) const
+            {
+                void* resizer = func(src.width, src.height, dstW, dstH, channels, method, format, type, scale, shift, letterbox, 114.0f);
+                if (resizer)
+                {
+                    {
+                        TEST_PERFORMANCE_TEST(description);
+                        SimdResizerTensorRun(resizer, src.data, src.stride, dst.data);
+                    }
+                    SimdRelease(resizer);
+                }
+            }
+        };
+    }
+
+#define FUNC_RT(function) \
+    FuncRT(function, std::string(#function))
+
+    bool ResizerTensorAutoTest(SimdResizeMethodType method, size_t channels, SimdTensorFormatType format, SimdTensorDataType type, SimdBool letterbox,
+        size_t srcW, size_t srcH, size_t dstW, size_t dstH, FuncRT f1, FuncRT f2)
+    {
+        bool result = true;
+
+        f1.Update(method, channels, format, type, letterbox, dstW, dstH);
+        f2.Update(method, channels, format, type, letterbox, dstW, dstH);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << srcW << ", " << srcH << "].");
+
+        View::Format formats[4] = { View::Gray8, View::Uv16, View::Bgr24, View::Bgra32 };
+        View src(srcW, srcH, formats[channels - 1], NULL, TEST_ALIGN(srcW));
+        FillRandom(src);
+
+        View::Format dstFormat = type == SimdTensorData32f ? View::Float : View::Int16;
+        View dst1(dstW * channels, dstH, dstFormat, NULL, 1);
+        View dst2(dstW * channels, dstH, dstFormat, NULL, 1);
+        Simd::Fill(dst1, 0x01);
+        Simd::Fill(dst2, 0x02);
+
+        const float scale[4] = { 1.0f / 255.0f, 1.0f / 58.4f, 1.0f / 57.1f, 2.0f };
+        const float shift[4] = { 0.0f, -123.7f / 58.4f, -116.3f / 57.1f, -1.0f };
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1, channels, method, format, type, scale, shift, letterbox, dstW, dstH));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, channels, method, format, type, scale, shift, letterbox, dstW, dstH));
+
+        if (type == SimdTensorData32f)
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(dst1, dst2, 1, true, 64);
+
+        return result;
+    }
+
+    bool ResizerTensorAutoTest(const FuncRT& f1, const FuncRT& f2)
+    {
+        bool result = true;
+
+        std::vector<SimdResizeMethodType> methods = { SimdResizeMethodNearest, SimdResizeMethodBilinear };
+        for (size_t m = 0; m < methods.size(); ++m)
+        {
+            for (size_t c = 1; c <= 4; ++c)
+            {
+                result = result && ResizerTensorAutoTest(methods[m], c, SimdTensorFormatNhwc, SimdTensorData32f, SimdFalse, 640, 480, 224, 224, f1, f2);
+                result = result && ResizerTensorAutoTest(methods[m], c, SimdTensorFormatNchw, SimdTensorData32f, SimdTrue, 640, 480, 224, 224, f1, f2);
+            }
+            result = result && ResizerTensorAutoTest(methods[m], 3, SimdTensorFormatNchw, SimdTensorData16b, SimdFalse, 1920, 1080, 319, 239, f1, f2);
+            result = result && ResizerTensorAutoTest(methods[m], 3, SimdTensorFormatNhwc, SimdTensorData16b, SimdTrue, 1920, 1080, 640, 640, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool ResizerTensorAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && ResizerTensorAutoTest(FUNC_RT(Simd::Base::ResizerTensorInit), FUNC_RT(SimdResizerTensorInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && ResizerTensorAutoTest(FUNC_RT(Simd::Sse41::ResizerTensorInit), FUNC_RT(SimdResizerTensorInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && ResizerTensorAutoTest(FUNC_RT(Simd::Avx2::ResizerTensorInit), FUNC_RT(SimdResizerTensorInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && ResizerTensorAutoTest(FUNC_RT(Simd::Avx512bw::ResizerTensorInit), FUNC_RT(SimdResizerTensorInit));
+#endif
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    bool ResizerCacheAutoTest(SimdResizeMethodType method, SimdResizeChannelType type, size_t channels, size_t srcW, size_t srcH, size_t dstW, size_t dstH, FuncRS f)
+    {
+        bool result = true;
+
+        f.Update(method, type, channels, srcW, srcH, dstW, dstH);
+
+        TEST_LOG_SS(Info, "Test " << f.description << " [" << srcW << ", " << srcH << "] -> [" << dstW << ", " << dstH << "].");
+
+        View::Format format;
+        size_t k = 1;
+        if (type == SimdResizeChannelFloat)
+            format = View::Float, k = channels;
+        else if (type == SimdResizeChannelShort)
+            format = View::Int16, k = channels;
+        else
+            format = channels == 1 ? View::Gray8 : (channels == 2 ? View::Uv16 : (channels == 3 ? View::Bgr24 : View::Bgra32));
+        View src(srcW * k, srcH, format, NULL, TEST_ALIGN(srcW));
+        if (type == SimdResizeChannelFloat)
+            FillRandom32f(src);
+        else if (type == SimdResizeChannelShort)
+            FillRandom16u(src);
+        else
+            FillRandom(src);
+
+        View dst1(dstW * k, dstH, format, NULL, TEST_ALIGN(dstW));
+        View dst2(dstW * k, dstH, format, NULL, TEST_ALIGN(dstW));
+        View dst3(dstW * k, dstH, format, NULL, TEST_ALIGN(dstW));
+
+        void* first = f.func(srcW, srcH, dstW, dstH, channels, type, method);
+        SimdResizerRun(first, src.data, src.stride, dst1.data, dst1.stride);
+        void* second = f.func(srcW, srcH, dstW, dstH, channels, type, method);
+        SimdRelease(first);
+        SimdResizerRun(second, src.data, src.stride, dst2.data, dst2.stride);
+
+        for (size_t i = 1; i <= Simd::RESIZER_CACHE_SIZE + 1; ++i)
+        {
+            View dst((dstW + i) * k, dstH + i, format, NULL, TEST_ALIGN(dstW + i));
+            void* other = f.func(srcW, srcH, dstW + i, dstH + i, channels, type, method);
+            SimdResizerRun(other, src.data, src.stride, dst.data, dst.stride);
+            SimdRelease(other);
+        }
+        SimdResizerRun(second, src.data, src.stride, dst3.data, dst3.stride);
+        SimdRelease(second);
+
+        result = result && Compare(dst1, dst2, 0, true, 64, 0, "shared");
+        result = result && Compare(dst1, dst3, 0, true, 64, 0, "evicted");
+
+        return result;
+    }
+
+    bool ResizerCacheAutoTest(const FuncRS& f)
+    {
+        bool result = true;
+
+        std::vector<SimdResizeMethodType> methods = { SimdResizeMethodBilinear, SimdResizeMethodBicubic, SimdResizeMethodLanczos3 };
+        std::vector<SimdResizeChannelType> types = { SimdResizeChannelByte, SimdResizeChannelShort, SimdResizeChannelFloat };
+        for (size_t t = 0; t < types.size(); ++t)
+        {
+            for (size_t m = 0; m < methods.size(); ++m)
+            {
+                for (size_t c = 1; c <= 4; ++c)
+                {
+                    result = result && ResizerCacheAutoTest(methods[m], types[t], c, 124, 93, 319, 239, f);
+                    result = result && ResizerCacheAutoTest(methods[m], types[t], c, 499, 374, 119, 89, f);
+                }
+            }
+        }
+
+        return result;
+    }
+
+    bool ResizerCacheAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && ResizerCacheAutoTest(FUNC_RS(Simd::Base::ResizerInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && ResizerCacheAutoTest(FUNC_RS(Simd::Sse41::ResizerInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && ResizerCacheAutoTest(FUNC_RS(Simd::Avx2::ResizerInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && ResizerCacheAutoTest(FUNC_RS(Simd::Avx512bw::ResizerInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon())
+            result = result && ResizerCacheAutoTest(FUNC_RS(Simd::Neon::ResizerInit));
+#endif
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
     bool ResizeYuv420pSpecialTest(SimdResizeMethodType method)
     {
         bool result = true;
@@ -24,6 +24,9 @@
 #include "Test/TestCompare.h"
 #include "Test/TestPerformance.h"
 #include "Test/TestRandom.h"
+#include "Test/TestString.h"
+
+#include "Simd/SimdConnectedComponents.h"
 
 namespace Test
 {
@@ -366,4 +369,127 @@ namespace Test
 
         return result;
     }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncCC
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, SimdConnectivityType connectivity, SimdBool moments);
+
+            FuncPtr func;
+            String description;
+
+            FuncCC(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(SimdConnectivityType connectivity)
+            {
+                description = description + "[" + ToString(int(connectivity)) + "]";
+            }
+
+            void Call(const View& mask, uint8_t index, SimdConnectivityType connectivity, View& labels, std::vector<SimdConnectedComponent>& components) const
+            {
+                void* context = func(mask.width, mask.height, connectivity, SimdTrue);
+                const SimdConnectedComponent* data = NULL;
+                size_t count = 0;
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    count = SimdConnectedComponentsRun(context, mask.data, mask.stride, index, (uint32_t*)labels.data, labels.stride, &data);
+                }
+                components.assign(data, data + count);
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_CC(function) \
+    FuncCC(function, std::string(#function))
+
+    bool ConnectedComponentsAutoTest(size_t width, size_t height, bool blobs, SimdConnectivityType connectivity, FuncCC f1, FuncCC f2)
+    {
+        bool result = true;
+
+        f1.Update(connectivity);
+        f2.Update(connectivity);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        const uint8_t index = 255;
+        View mask(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        if (blobs)
+        {
+            View noise(width / 8 + 2, height / 8 + 2, View::Gray8, NULL, TEST_ALIGN(width));
+            FillRandomMask(noise, index);
+            Simd::Resize(noise, mask, SimdResizeMethodBilinear);
+            SimdBinarization(mask.data, mask.stride, width, height, 128, index, 0, mask.data, mask.stride, SimdCompareGreater);
+        }
+        else
+            FillRandomMask(mask, index);
+
+        View labels1(width, height, View::Int32, NULL, TEST_ALIGN(width));
+        View labels2(width, height, View::Int32, NULL, TEST_ALIGN(width));
+        std::vector<SimdConnectedComponent> components1, components2;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(mask, index, connectivity, labels1, components1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(mask, index, connectivity, labels2, components2));
+
+        result = result && Compare(labels1, labels2, 0, true, 64);
+
+        if (components1.size() != components2.size())
+        {
+            TEST_LOG_SS(Error, "There is difference in component number: " << components1.size() << " != " << components2.size() << " !");
+            return false;
+        }
+        for (size_t i = 0; i < components1.size() && result; ++i)
+        {
+            const SimdConnectedComponent& c1 = components1[i], & c2 = components2[i];
+            if (c1.area != c2.area || c1.x != c2.x || c1.y != c2.y || c1.xx != c2.xx || c1.xy != c2.xy || c1.yy != c2.yy ||
+                c1.left != c2.left || c1.top != c2.top || c1.right != c2.right || c1.bottom != c2.bottom)
+            {
+                TEST_LOG_SS(Error, "There is difference in statistics of component " << i + 1 << " !");
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+    bool ConnectedComponentsAutoTest(const FuncCC& f1, const FuncCC& f2)
+    {
+        bool result = true;
+
+        result = result && ConnectedComponentsAutoTest(W, H, true, SimdConnectivity8, f1, f2);
+        result = result && ConnectedComponentsAutoTest(W + O, H - O, true, SimdConnectivity4, f1, f2);
+        result = result && ConnectedComponentsAutoTest(W - O, H + O, false, SimdConnectivity8, f1, f2);
+        result = result && ConnectedComponentsAutoTest(W, H, false, SimdConnectivity4, f1, f2);
+
+        return result;
+    }
+
+    bool ConnectedComponentsAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && ConnectedComponentsAutoTest(FUNC_CC(Simd::Base::ConnectedComponentsInit), FUNC_CC(SimdConnectedComponentsInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && ConnectedComponentsAutoTest(FUNC_CC(Simd::Sse41::ConnectedComponentsInit), FUNC_CC(SimdConnectedComponentsInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && ConnectedComponentsAutoTest(FUNC_CC(Simd::Avx2::ConnectedComponentsInit), FUNC_CC(SimdConnectedComponentsInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && ConnectedComponentsAutoTest(FUNC_CC(Simd::Avx512bw::ConnectedComponentsInit), FUNC_CC(SimdConnectedComponentsInit));
+#endif 
+
+        return result;
+    }
 }
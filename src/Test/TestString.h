@@ -103,6 +103,7 @@ namespace Test
         case SimdImageFilePpmBin:       return "PpmB";
         case SimdImageFilePng:          return "Png";
         case SimdImageFileJpeg:         return "Jpeg";
+        case SimdImageFileQoi:          return "Qoi";
         default: assert(0);  return "";
         }
     }
@@ -157,6 +158,7 @@ namespace Test
         case SimdImageFilePpmBin: return "ppm";
         case SimdImageFilePng:    return "png";
         case SimdImageFileJpeg:   return "jpg";
+        case SimdImageFileQoi:    return "qoi";
         default: assert(0);  return "";
         }
     }
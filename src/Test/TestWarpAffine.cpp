@@ -28,6 +28,8 @@
 #include "Test/TestFile.h"
 
 #include "Simd/SimdWarpAffine.h"
+#include "Simd/SimdWarpPerspective.h"
+#include "Simd/SimdRemap.h"
 
 #include "Simd/SimdDrawing.hpp"
 
@@ -49,8 +51,10 @@ namespace Test
             {
                 std::stringstream ss;
                 ss << description << "[" << channels;
-                ss << "-" << ((flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelByte ? "b" : "?");
-                ss << "-" << ((flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpNearest ? "nr" : "bl");
+                SimdWarpAffineFlags channel = (SimdWarpAffineFlags)(flags & SimdWarpAffineChannelMask);
+                SimdWarpAffineFlags interp = (SimdWarpAffineFlags)(flags & SimdWarpAffineInterpMask);
+                ss << "-" << (channel == SimdWarpAffineChannelByte ? "b" : (channel == SimdWarpAffineChannelShort ? "s" : "f"));
+                ss << "-" << (interp == SimdWarpAffineInterpNearest ? "nr" : (interp == SimdWarpAffineInterpBilinear ? "bl" : "bc"));
                 ss << "-" << ((flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderConstant ? "c" : "t") << "-{ ";
                 for(int i = 0; i < 6; ++i)
                     ss << std::setprecision(1) << std::fixed << mat[i] << " ";
@@ -58,13 +62,13 @@ namespace Test
                 description = ss.str();
             }
 
-            void Call(const View & src, View & dst, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border, const View & buf) const
+            void Call(const View & src, size_t srcW, View & dst, size_t dstW, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border, const View & buf) const
             {
                 void * context = NULL;
-                context = func(src.width, src.height, src.stride, dst.width, dst.height, dst.stride, channels, mat, flags, border);
+                context = func(srcW, src.height, src.stride, dstW, dst.height, dst.stride, channels, mat, flags, border);
                 if (context)
                 {
-                    if ((flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpBilinear && (flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderTransparent)
+                    if ((flags & SimdWarpAffineInterpMask) != SimdWarpAffineInterpNearest && (flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderTransparent)
                         Simd::Copy(buf, dst);
                     {
                         TEST_PERFORMANCE_TEST(description);
@@ -121,6 +125,7 @@ namespace Test
         TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " .");
 
         View::Format format;
+        size_t srcCols = srcW, dstCols = dstW;
         if ((SimdWarpAffineChannelMask & flags) == SimdWarpAffineChannelByte)
         {
             switch (channels)
@@ -133,12 +138,28 @@ namespace Test
                 assert(0);
             }
         }
+        else if ((SimdWarpAffineChannelMask & flags) == SimdWarpAffineChannelShort)
+        {
+            format = View::Int16;
+            srcCols *= channels;
+            dstCols *= channels;
+        }
+        else if ((SimdWarpAffineChannelMask & flags) == SimdWarpAffineChannelFloat)
+        {
+            format = View::Float;
+            srcCols *= channels;
+            dstCols *= channels;
+        }
         else
             assert(0);
 
-        View src(srcW, srcH, format, NULL, TEST_ALIGN(srcW));
+        View src(srcCols, srcH, format, NULL, TEST_ALIGN(srcCols));
         
-        if ((SimdWarpAffineChannelMask & flags) == SimdWarpAffineChannelByte)
+        if (format == View::Float)
+            FillRandom32f(src);
+        else if (format == View::Int16)
+            FillRandom16u(src);
+        else
         {
 #ifdef TEST_WARP_AFFINE_REAL_IMAGE
             ::srand(0);
@@ -148,29 +169,44 @@ namespace Test
 #endif
         }
 
-        View buf(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
-        View dst1(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
-        View dst2(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        View buf(dstCols, dstH, format, NULL, TEST_ALIGN(dstCols));
+        View dst1(dstCols, dstH, format, NULL, TEST_ALIGN(dstCols));
+        View dst2(dstCols, dstH, format, NULL, TEST_ALIGN(dstCols));
         Simd::Fill(dst1, 0x33);
         if((flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderConstant)
             Simd::Fill(dst2, 0x99);
         else
             Simd::Fill(dst2, 0x33);
         Simd::Copy(dst1, buf);
-        uint8_t border[4] = { 11, 33, 55, 77 };
+        uint8_t border[16] = { 11, 33, 55, 77 };
+        if (format == View::Int16)
+        {
+            const uint16_t value[4] = { 1111, 3333, 5555, 7777 };
+            memcpy(border, value, sizeof(value));
+        }
+        else if (format == View::Float)
+        {
+            const float value[4] = { 11.0f, 33.0f, 55.0f, 77.0f };
+            memcpy(border, value, sizeof(value));
+        }
 
         TEST_ALIGN(SIMD_ALIGN);
 
-        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1, channels, mat, flags, border, buf));
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, srcW, dst1, dstW, channels, mat, flags, border, buf));
 
-        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, channels, mat, flags, border, buf));
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, srcW, dst2, dstW, channels, mat, flags, border, buf));
 
 #if !((defined(_WIN32) && defined(SIMD_X86_ENABLE) && defined(_DEBUG)) || (defined(__clang__) && !defined(NDEBUG)))
-        result = result && Compare(dst1, dst2, 0, true, 64);
+        if (format == View::Float)
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+        else if (format == View::Int16)
+            result = result && Compare(dst1, dst2, 1, true, 64);
+        else
+            result = result && Compare(dst1, dst2, 0, true, 64);
 #endif
 
 #if defined(TEST_WARP_AFFINE_REAL_IMAGE)
-        if (!result)
+        if (!result && src.ChannelSize() == 1)
         {
             SaveImage(src, String("src"));
             SaveImage(dst1, String("dst1"));
@@ -204,8 +240,8 @@ namespace Test
     {
         bool result = true;
 
-        std::vector<SimdWarpAffineFlags> channel = { SimdWarpAffineChannelByte };
-        std::vector<SimdWarpAffineFlags> interp = { SimdWarpAffineInterpNearest, SimdWarpAffineInterpBilinear };
+        std::vector<SimdWarpAffineFlags> channel = { SimdWarpAffineChannelByte, SimdWarpAffineChannelShort, SimdWarpAffineChannelFloat };
+        std::vector<SimdWarpAffineFlags> interp = { SimdWarpAffineInterpNearest, SimdWarpAffineInterpBilinear, SimdWarpAffineInterpBicubic };
         std::vector<SimdWarpAffineFlags> border = { SimdWarpAffineBorderConstant, SimdWarpAffineBorderTransparent };
         for (size_t c = 0; c < channel.size(); ++c)
         {
@@ -258,6 +294,553 @@ namespace Test
 
 //-------------------------------------------------------------------------------------------------
 
+namespace Test
+{
+    namespace
+    {
+        struct FuncWP
+        {
+            typedef void*(*FuncPtr)(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS,
+                size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border);
+
+            FuncPtr func;
+            String description;
+
+            FuncWP(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float* mat, SimdWarpAffineFlags flags)
+            {
+                std::stringstream ss;
+                ss << description << "[" << channels;
+                ss << "-" << ((flags & SimdWarpAffineChannelMask) == SimdWarpAffineChannelByte ? "b" : "?");
+                ss << "-" << ((flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpNearest ? "nr" : "bl");
+                ss << "-" << ((flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderConstant ? "c" : "t") << "-{ ";
+                for (int i = 0; i < 9; ++i)
+                    ss << std::setprecision(4) << std::fixed << mat[i] << " ";
+                ss << "}:" << srcW << "x" << srcH << "->" << dstW << "x" << dstH << "]";
+                description = ss.str();
+            }
+
+            void Call(const View & src, View & dst, size_t channels, const float* mat, SimdWarpAffineFlags flags, const uint8_t* border, const View & buf) const
+            {
+                void * context = NULL;
+                context = func(src.width, src.height, src.stride, dst.width, dst.height, dst.stride, channels, mat, flags, border);
+                if (context)
+                {
+                    if ((flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderTransparent)
+                        Simd::Copy(buf, dst);
+                    {
+                        TEST_PERFORMANCE_TEST(description);
+                        SimdWarpPerspectiveRun(context, src.data, dst.data);
+                    }
+                    SimdRelease(context);
+                }
+            }
+        };
+    }
+
+#define FUNC_WP(function) \
+    FuncWP(function, std::string(#function))
+
+    bool WarpPerspectiveAutoTest(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpAffineFlags flags, FuncWP f1, FuncWP f2)
+    {
+        bool result = true;
+
+        f1.Update(srcW, srcH, dstW, dstH, channels, mat, flags);
+        f2.Update(srcW, srcH, dstW, dstH, channels, mat, flags);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " .");
+
+        View::Format format;
+        switch (channels)
+        {
+        case 1: format = View::Gray8; break;
+        case 2: format = View::Uv16; break;
+        case 3: format = View::Bgr24; break;
+        case 4: format = View::Bgra32; break;
+        default:
+            assert(0);
+        }
+
+        View src(srcW, srcH, format, NULL, TEST_ALIGN(srcW));
+#ifdef TEST_WARP_AFFINE_REAL_IMAGE
+        ::srand(0);
+        FillPicture(src);
+#else
+        FillRandom(src);
+#endif
+
+        View buf(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        View dst1(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        View dst2(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        Simd::Fill(dst1, 0x33);
+        if ((flags & SimdWarpAffineBorderMask) == SimdWarpAffineBorderConstant)
+            Simd::Fill(dst2, 0x99);
+        else
+            Simd::Fill(dst2, 0x33);
+        Simd::Copy(dst1, buf);
+        uint8_t border[4] = { 11, 33, 55, 77 };
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1, channels, mat, flags, border, buf));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, channels, mat, flags, border, buf));
+
+#if !((defined(_WIN32) && defined(SIMD_X86_ENABLE) && defined(_DEBUG)) || (defined(__clang__) && !defined(NDEBUG)))
+        result = result && Compare(dst1, dst2, 0, true, 64);
+#endif
+
+#if defined(TEST_WARP_AFFINE_REAL_IMAGE)
+        if (!result)
+        {
+            SaveImage(src, String("src"));
+            SaveImage(dst1, String("dst1"));
+            SaveImage(dst2, String("dst2"));
+        }
+#endif
+
+        return result;
+    }
+
+    bool WarpPerspectiveAutoTest(int channels, SimdWarpAffineFlags flags, const FuncWP & f1, const FuncWP & f2)
+    {
+        bool result = true;
+
+        Buffer32f mat;
+
+        mat = Buffer32f({ 0.9f, -0.2f, float(W / 8), 0.15f, 0.95f, float(-H / 10), 0.3f / W, 0.2f / H, 1.0f });
+        result = result && WarpPerspectiveAutoTest(W, H, W, H, channels, mat.data(), flags, f1, f2);
+
+        mat = Buffer32f({ 1.0f, 0.3f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, -1.6f / H, 1.0f });
+        result = result && WarpPerspectiveAutoTest(W, H, W + O, H - O, channels, mat.data(), flags, f1, f2);
+
+        return result;
+    }
+
+    bool WarpPerspectiveAutoTest(const FuncWP & f1, const FuncWP & f2)
+    {
+        bool result = true;
+
+        std::vector<SimdWarpAffineFlags> channel = { SimdWarpAffineChannelByte };
+        std::vector<SimdWarpAffineFlags> interp = { SimdWarpAffineInterpNearest, SimdWarpAffineInterpBilinear };
+        std::vector<SimdWarpAffineFlags> border = { SimdWarpAffineBorderConstant, SimdWarpAffineBorderTransparent };
+        for (size_t c = 0; c < channel.size(); ++c)
+        {
+            for (size_t i = 0; i < interp.size(); ++i)
+            {
+                for (size_t b = 0; b < border.size(); ++b)
+                {
+                    SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(channel[c] | interp[i] | border[b]);
+                    result = result && WarpPerspectiveAutoTest(1, flags, f1, f2);
+                    result = result && WarpPerspectiveAutoTest(2, flags, f1, f2);
+                    result = result && WarpPerspectiveAutoTest(3, flags, f1, f2);
+                    result = result && WarpPerspectiveAutoTest(4, flags, f1, f2);
+                }
+            }
+        }
+
+        return result;
+    }
+
+    bool WarpPerspectiveAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && WarpPerspectiveAutoTest(FUNC_WP(Simd::Base::WarpPerspectiveInit), FUNC_WP(SimdWarpPerspectiveInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && WarpPerspectiveAutoTest(FUNC_WP(Simd::Sse41::WarpPerspectiveInit), FUNC_WP(SimdWarpPerspectiveInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && WarpPerspectiveAutoTest(FUNC_WP(Simd::Avx2::WarpPerspectiveInit), FUNC_WP(SimdWarpPerspectiveInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && WarpPerspectiveAutoTest(FUNC_WP(Simd::Avx512bw::WarpPerspectiveInit), FUNC_WP(SimdWarpPerspectiveInit));
+#endif
+
+        return result;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncRM
+        {
+            typedef void*(*FuncPtr)(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+                const float* mapX, const float* mapY, size_t mapStride, SimdRemapFlags flags, const uint8_t* border);
+            typedef void*(*FuncUPtr)(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t dstS, size_t channels,
+                const float* camera, const float* distortion, SimdRemapFlags flags, const uint8_t* border);
+
+            FuncPtr func;
+            FuncUPtr funcU;
+            String description;
+
+            FuncRM(const FuncPtr & f, const FuncUPtr& fu, const String & d) : func(f), funcU(fu), description(d) {}
+
+            void Update(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdRemapFlags flags, const String & map)
+            {
+                std::stringstream ss;
+                ss << description << "[" << channels;
+                ss << "-" << ((flags & SimdRemapChannelMask) == SimdRemapChannelByte ? "b" : "?");
+                ss << "-" << ((flags & SimdRemapInterpMask) == SimdRemapInterpNearest ? "nr" : "bl");
+                ss << "-" << ((flags & SimdRemapBorderMask) == SimdRemapBorderConstant ? "c" : "t");
+                ss << "-" << map << ":" << srcW << "x" << srcH << "->" << dstW << "x" << dstH << "]";
+                description = ss.str();
+            }
+
+            void Call(const View & src, View & dst, size_t channels, const View & mapX, const View& mapY, const float* camera, const float* distortion, 
+                SimdRemapFlags flags, const uint8_t* border, const View & buf) const
+            {
+                void * context = NULL;
+                if (camera)
+                    context = funcU(src.width, src.height, src.stride, dst.width, dst.height, dst.stride, channels, camera, distortion, flags, border);
+                else
+                    context = func(src.width, src.height, src.stride, dst.width, dst.height, dst.stride, channels, 
+                        (float*)mapX.data, (float*)mapY.data, mapX.stride, flags, border);
+                if (context)
+                {
+                    if ((flags & SimdRemapBorderMask) == SimdRemapBorderTransparent)
+                        Simd::Copy(buf, dst);
+                    {
+                        TEST_PERFORMANCE_TEST(description);
+                        SimdRemapRun(context, src.data, dst.data);
+                    }
+                    SimdRelease(context);
+                }
+            }
+        };
+    }
+
+#define FUNC_RM(function) \
+    FuncRM(function##Init, function##InitUndistortion, std::string(#function))
+
+    bool RemapAutoTest(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, int map, SimdRemapFlags flags, FuncRM f1, FuncRM f2)
+    {
+        bool result = true;
+
+        const char* names[3] = { "warp", "pinhole", "fisheye" };
+        f1.Update(srcW, srcH, dstW, dstH, channels, flags, names[map]);
+        f2.Update(srcW, srcH, dstW, dstH, channels, flags, names[map]);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " .");
+
+        View::Format format;
+        switch (channels)
+        {
+        case 1: format = View::Gray8; break;
+        case 2: format = View::Uv16; break;
+        case 3: format = View::Bgr24; break;
+        case 4: format = View::Bgra32; break;
+        default:
+            assert(0);
+        }
+
+        View src(srcW, srcH, format, NULL, TEST_ALIGN(srcW));
+        FillRandom(src);
+
+        View mapX(dstW, dstH, View::Float, NULL, TEST_ALIGN(dstW));
+        View mapY(dstW, dstH, View::Float, NULL, TEST_ALIGN(dstW));
+        float cx = float(srcW) * 0.5f, cy = float(srcH) * 0.5f, sa = ::sin(0.3f), ca = ::cos(0.3f);
+        for (size_t y = 0; y < dstH; ++y)
+        {
+            for (size_t x = 0; x < dstW; ++x)
+            {
+                float dx = float(x) - cx, dy = float(y) - cy;
+                mapX.At<float>(x, y) = cx + dx * ca - dy * sa * 1.1f + 3.0f * ::sin(float(y) * 0.1f);
+                mapY.At<float>(x, y) = cy + dx * sa + dy * ca * 1.1f;
+            }
+        }
+        float camera[4] = { float(srcW) * 0.6f, float(srcW) * 0.6f, cx, cy };
+        float pinhole[5] = { -0.3f, 0.1f, 0.001f, -0.002f, 0.01f };
+        float fisheye[4] = { 0.1f, -0.05f, 0.01f, 0.0f };
+        const float* distortion = map == 1 ? pinhole : fisheye;
+        if (map == 2)
+            flags = (SimdRemapFlags)(flags | SimdRemapModelFisheye);
+
+        View buf(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        View dst1(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        View dst2(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        Simd::Fill(dst1, 0x33);
+        if ((flags & SimdRemapBorderMask) == SimdRemapBorderConstant)
+            Simd::Fill(dst2, 0x99);
+        else
+            Simd::Fill(dst2, 0x33);
+        Simd::Copy(dst1, buf);
+        uint8_t border[4] = { 11, 33, 55, 77 };
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1, channels, mapX, mapY, map ? camera : NULL, distortion, flags, border, buf));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, channels, mapX, mapY, map ? camera : NULL, distortion, flags, border, buf));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        if (map == 0 && dstW == srcW && dstH == srcH)
+        {
+            for (size_t y = 0; y < dstH; ++y)
+            {
+                for (size_t x = 0; x < dstW; ++x)
+                {
+                    mapX.At<float>(x, y) = float(x);
+                    mapY.At<float>(x, y) = float(y);
+                }
+            }
+            f2.Call(src, dst2, channels, mapX, mapY, NULL, NULL, flags, border, buf);
+            result = result && Compare(src, dst2, 0, true, 64, 0, "identity");
+        }
+
+        return result;
+    }
+
+    bool RemapAutoTest(int channels, SimdRemapFlags flags, const FuncRM & f1, const FuncRM & f2)
+    {
+        bool result = true;
+
+        result = result && RemapAutoTest(W, H, W, H, channels, 0, flags, f1, f2);
+        result = result && RemapAutoTest(W, H, W + O, H - O, channels, 1, flags, f1, f2);
+        result = result && RemapAutoTest(W, H, W - O, H + O, channels, 2, flags, f1, f2);
+
+        return result;
+    }
+
+    bool RemapAutoTest(const FuncRM & f1, const FuncRM & f2)
+    {
+        bool result = true;
+
+        std::vector<SimdRemapFlags> interp = { SimdRemapInterpNearest, SimdRemapInterpBilinear };
+        std::vector<SimdRemapFlags> border = { SimdRemapBorderConstant, SimdRemapBorderTransparent };
+        for (size_t i = 0; i < interp.size(); ++i)
+        {
+            for (size_t b = 0; b < border.size(); ++b)
+            {
+                SimdRemapFlags flags = (SimdRemapFlags)(SimdRemapChannelByte | interp[i] | border[b]);
+                result = result && RemapAutoTest(1, flags, f1, f2);
+                result = result && RemapAutoTest(2, flags, f1, f2);
+                result = result && RemapAutoTest(3, flags, f1, f2);
+                result = result && RemapAutoTest(4, flags, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool RemapAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && RemapAutoTest(FUNC_RM(Simd::Base::Remap), FUNC_RM(SimdRemap));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && RemapAutoTest(FUNC_RM(Simd::Sse41::Remap), FUNC_RM(SimdRemap));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && RemapAutoTest(FUNC_RM(Simd::Avx2::Remap), FUNC_RM(SimdRemap));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && RemapAutoTest(FUNC_RM(Simd::Avx512bw::Remap), FUNC_RM(SimdRemap));
+#endif
+
+        return result;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncWAB
+        {
+            typedef void*(*FuncPtr)(size_t srcW, size_t srcH, size_t srcS, size_t dstW, size_t dstH, size_t channels,
+                SimdWarpAffineFlags flags, const uint8_t* border, SimdTensorDataType type, const float* lower, const float* upper);
+
+            FuncPtr func;
+            String description;
+
+            FuncWAB(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(size_t dstW, size_t dstH, size_t channels, size_t count, SimdWarpAffineFlags flags, SimdTensorDataType type)
+            {
+                std::stringstream ss;
+                ss << description << "[" << channels;
+                ss << "-" << ((flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpNearest ? "nr" : 
+                    ((flags & SimdWarpAffineInterpMask) == SimdWarpAffineInterpBilinear ? "bl" : "bc"));
+                ss << "-" << (type == SimdTensorData32f ? "f" : "b");
+                ss << "-" << count << "x" << dstW << "x" << dstH << "]";
+                description = ss.str();
+            }
+
+            void Call(const View & src, size_t dstW, size_t dstH, size_t channels, const float* mats, size_t count, SimdWarpAffineFlags flags, 
+                const uint8_t* border, SimdTensorDataType type, const float* lower, const float* upper, uint8_t * dst) const
+            {
+                void * context = func(src.width, src.height, src.stride, dstW, dstH, channels, flags, border, type, lower, upper);
+                if (context)
+                {
+                    {
+                        TEST_PERFORMANCE_TEST(description);
+                        SimdWarpAffineBatchRun(context, src.data, mats, count, dst);
+                    }
+                    SimdRelease(context);
+                }
+            }
+        };
+    }
+
+#define FUNC_WAB(function) \
+    FuncWAB(function, std::string(#function))
+
+    bool WarpAffineBatchAutoTest(size_t channels, size_t count, SimdWarpAffineFlags flags, SimdTensorDataType type, FuncWAB f1, FuncWAB f2)
+    {
+        bool result = true;
+
+        const size_t dstW = 112, dstH = 112;
+
+        f1.Update(dstW, dstH, channels, count, flags, type);
+        f2.Update(dstW, dstH, channels, count, flags, type);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " .");
+
+        View::Format format = channels == 1 ? View::Gray8 : (channels == 2 ? View::Uv16 : (channels == 3 ? View::Bgr24 : View::Bgra32));
+        View src(W, H, format, NULL, TEST_ALIGN(W));
+        ::srand(0);
+        FillPicture(src);
+
+        Buffer32f mats(count * 6);
+        for (size_t i = 0; i < count; ++i)
+        {
+            float angle = float(Random()) * 0.6f - 0.3f, scale = 0.2f + float(Random()) * 0.5f;
+            float cx = float(Random()) * float(W), cy = float(Random()) * float(H);
+            float* m = mats.data() + i * 6;
+            m[0] = ::cos(angle) / scale, m[1] = -::sin(angle) / scale, m[3] = ::sin(angle) / scale, m[4] = ::cos(angle) / scale;
+            m[2] = dstW * 0.5f - (m[0] * cx + m[1] * cy);
+            m[5] = dstH * 0.5f - (m[3] * cx + m[4] * cy);
+        }
+        uint8_t border[4] = { 11, 33, 55, 77 };
+        float lower[3] = { -1.0f, -0.5f, 0.0f }, upper[3] = { 1.0f, 0.5f, 2.0f };
+
+        size_t tensorC = channels == 1 ? 1 : 3;
+        if (type == SimdTensorData32f)
+        {
+            size_t size = tensorC * dstH * dstW;
+            Buffer32f dst1(size * count, 1.0f), dst2(size * count, 2.0f), ref(size * count, 3.0f);
+
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dstW, dstH, channels, mats.data(), count, flags, border, type, lower, upper, (uint8_t*)dst1.data()));
+
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dstW, dstH, channels, mats.data(), count, flags, border, type, lower, upper, (uint8_t*)dst2.data()));
+
+            View image(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+            for (size_t i = 0; i < count; ++i)
+            {
+                void* context = SimdWarpAffineInit(src.width, src.height, src.stride, dstW, dstH, image.stride, channels, mats.data() + i * 6, flags, border);
+                SimdWarpAffineRun(context, src.data, image.data);
+                SimdRelease(context);
+                SimdSynetSetInput(image.data, dstW, dstH, image.stride, (SimdPixelFormatType)image.format, lower, upper, ref.data() + i * size, tensorC, SimdTensorFormatNchw);
+            }
+
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth, "dst1 & dst2");
+            result = result && Compare(dst2, ref, EPS, true, 64, DifferenceBoth, "dst2 & ref");
+        }
+        else
+        {
+            View dst1(dstW, dstH * count, format, NULL, 1), dst2(dstW, dstH * count, format, NULL, 1), ref(dstW, dstH * count, format, NULL, 1);
+            Simd::Fill(dst1, 0x11);
+            Simd::Fill(dst2, 0x22);
+
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dstW, dstH, channels, mats.data(), count, flags, border, type, lower, upper, dst1.data));
+
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dstW, dstH, channels, mats.data(), count, flags, border, type, lower, upper, dst2.data));
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                void* context = SimdWarpAffineInit(src.width, src.height, src.stride, dstW, dstH, ref.stride, channels, mats.data() + i * 6, flags, border);
+                SimdWarpAffineRun(context, src.data, ref.data + i * dstH * ref.stride);
+                SimdRelease(context);
+            }
+
+            result = result && Compare(dst1, dst2, 0, true, 64, 0, "dst1 & dst2");
+            result = result && Compare(dst2, ref, 0, true, 64, 0, "dst2 & ref");
+        }
+
+        return result;
+    }
+
+    bool WarpAffineBatchAutoTest(const FuncWAB & f1, const FuncWAB & f2)
+    {
+        bool result = true;
+
+        std::vector<SimdWarpAffineFlags> interp = { SimdWarpAffineInterpNearest, SimdWarpAffineInterpBilinear, SimdWarpAffineInterpBicubic };
+        for (size_t i = 0; i < interp.size(); ++i)
+        {
+            SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | interp[i] | SimdWarpAffineBorderConstant);
+            for (size_t c = 1; c <= 4; ++c)
+                result = result && WarpAffineBatchAutoTest(c, 17, flags, SimdTensorData8u, f1, f2);
+            result = result && WarpAffineBatchAutoTest(1, 17, flags, SimdTensorData32f, f1, f2);
+            result = result && WarpAffineBatchAutoTest(3, 17, flags, SimdTensorData32f, f1, f2);
+            result = result && WarpAffineBatchAutoTest(4, 1, flags, SimdTensorData32f, f1, f2);
+        }
+
+        if (result)
+        {
+            SimdWarpAffineFlags flags = (SimdWarpAffineFlags)(SimdWarpAffineChannelByte | SimdWarpAffineInterpBilinear | SimdWarpAffineBorderConstant);
+            View src(W, H, View::Gray8, NULL, TEST_ALIGN(W)), dst(16, 16 * 2, View::Gray8, NULL, 1);
+            const float mats[12] = { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 2.0f, 0.0f, 2.0f, 4.0f, 0.0f };
+            void* context = f2.func(src.width, src.height, src.stride, 16, 16, 1, flags, NULL, SimdTensorData8u, NULL, NULL);
+            if (context == NULL || SimdWarpAffineBatchRun(context, src.data, mats, 2, dst.data) != SimdFalse)
+            {
+                TEST_LOG_SS(Error, "WarpAffineBatch must reject singular matrix!");
+                result = false;
+            }
+            SimdRelease(context);
+        }
+
+        return result;
+    }
+
+    bool WarpAffineBatchAutoTest()
+    {
+        bool result = true;
+
+        if (TestBase())
+            result = result && WarpAffineBatchAutoTest(FUNC_WAB(Simd::Base::WarpAffineBatchInit), FUNC_WAB(SimdWarpAffineBatchInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41())
+            result = result && WarpAffineBatchAutoTest(FUNC_WAB(Simd::Sse41::WarpAffineBatchInit), FUNC_WAB(SimdWarpAffineBatchInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2())
+            result = result && WarpAffineBatchAutoTest(FUNC_WAB(Simd::Avx2::WarpAffineBatchInit), FUNC_WAB(SimdWarpAffineBatchInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw())
+            result = result && WarpAffineBatchAutoTest(FUNC_WAB(Simd::Avx512bw::WarpAffineBatchInit), FUNC_WAB(SimdWarpAffineBatchInit));
+#endif
+
+        return result;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+
 #ifdef SIMD_OPENCV_ENABLE
 #include <opencv2/core/core.hpp>
 #include <opencv2/core/utils/logger.hpp>